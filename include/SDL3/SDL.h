@@ -76,6 +76,7 @@
 #include <SDL3/SDL_time.h>
 #include <SDL3/SDL_timer.h>
 #include <SDL3/SDL_touch.h>
+#include <SDL3/SDL_trace.h>
 #include <SDL3/SDL_version.h>
 #include <SDL3/SDL_video.h>
 #include <SDL3/SDL_oldnames.h>
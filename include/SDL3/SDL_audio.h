@@ -521,6 +521,53 @@ extern SDL_DECLSPEC char *SDLCALL SDL_GetAudioDeviceName(SDL_AudioDeviceID devid
  */
 extern SDL_DECLSPEC int SDLCALL SDL_GetAudioDeviceFormat(SDL_AudioDeviceID devid, SDL_AudioSpec *spec, int *sample_frames);
 
+/**
+ * Performance counters for a physical audio device.
+ *
+ * These are collected by the device thread for every buffer it processes,
+ * and are reset when the physical device is opened. For output devices, "mix
+ * time" covers pulling data from all bound streams, mixing, and converting
+ * to the device format; for capture devices it covers feeding the captured
+ * data to the bound streams. Time spent waiting on the hardware is not
+ * included.
+ *
+ * \since This struct is available since SDL 3.0.0.
+ *
+ * \sa SDL_GetAudioDeviceStats
+ */
+typedef struct SDL_AudioDeviceStats
+{
+    Uint64 periods;             /**< Number of device buffers processed so far */
+    Uint64 period_ns;           /**< Duration of audio in one device buffer, in nanoseconds */
+    Uint64 min_mix_ns;          /**< Shortest time spent processing one buffer, in nanoseconds */
+    Uint64 avg_mix_ns;          /**< Average time spent processing one buffer, in nanoseconds */
+    Uint64 max_mix_ns;          /**< Longest time spent processing one buffer, in nanoseconds */
+    Uint64 deadline_misses;     /**< Number of buffers that took longer than `period_ns` to process */
+    Uint64 silence_frames;      /**< Output sample frames filled with silence because playing streams ran out of data */
+} SDL_AudioDeviceStats;
+
+/**
+ * Get performance counters for an audio device.
+ *
+ * This reports on the physical device, so logical devices opened on the same
+ * hardware share the same counters. This is meant to help diagnose crackles
+ * and dropouts: if `max_mix_ns` approaches `period_ns`, or `deadline_misses`
+ * or `silence_frames` keep growing, the device thread isn't keeping up or
+ * the app isn't supplying data fast enough.
+ *
+ * \param devid the instance ID of the device to query.
+ * \param stats On return, will be filled with the current counters.
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_GetAudioStreamStats
+ */
+extern SDL_DECLSPEC int SDLCALL SDL_GetAudioDeviceStats(SDL_AudioDeviceID devid, SDL_AudioDeviceStats *stats);
+
 
 /**
  * Open a specific audio device.
@@ -848,6 +895,41 @@ extern SDL_DECLSPEC SDL_AudioStream *SDLCALL SDL_CreateAudioStream(const SDL_Aud
  */
 extern SDL_DECLSPEC SDL_PropertiesID SDLCALL SDL_GetAudioStreamProperties(SDL_AudioStream *stream);
 
+/**
+ * Performance counters for an audio stream.
+ *
+ * All times are totals in nanoseconds, accumulated since the stream was
+ * created.
+ *
+ * \since This struct is available since SDL 3.0.0.
+ *
+ * \sa SDL_GetAudioStreamStats
+ */
+typedef struct SDL_AudioStreamStats
+{
+    Uint64 get_callback_ns;     /**< Time spent in the stream's get callback */
+    Uint64 put_callback_ns;     /**< Time spent in the stream's put callback */
+    Uint64 resample_ns;         /**< Time spent resampling */
+    Uint64 convert_ns;          /**< Time spent converting data format and channel layout */
+    Uint64 frames_out;          /**< Number of sample frames read from the stream */
+} SDL_AudioStreamStats;
+
+/**
+ * Get performance counters for an audio stream.
+ *
+ * \param stream the SDL_AudioStream to query.
+ * \param stats On return, will be filled with the current counters.
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_GetAudioDeviceStats
+ */
+extern SDL_DECLSPEC int SDLCALL SDL_GetAudioStreamStats(SDL_AudioStream *stream, SDL_AudioStreamStats *stats);
+
 /**
  * Query the current format of an audio stream.
  *
@@ -244,6 +244,51 @@ extern SDL_DECLSPEC void *SDLCALL SDL_GetClipboardData(const char *mime_type, si
  */
 extern SDL_DECLSPEC SDL_bool SDLCALL SDL_HasClipboardData(const char *mime_type);
 
+/**
+ * Callback function that receives clipboard data requested with
+ * SDL_RequestClipboardData().
+ *
+ * \param userdata a pointer provided by the app through
+ *                 SDL_RequestClipboardData
+ * \param mime_type the mime type that was requested
+ * \param data the clipboard data, or NULL if there is no data for this mime
+ *             type or it couldn't be retrieved. The data is owned by SDL and
+ *             is only valid until the callback returns. Text data is
+ *             guaranteed to be null terminated.
+ * \param size the length of the data, not including any terminator
+ *
+ * \since This datatype is available since SDL 3.0.0.
+ *
+ * \sa SDL_RequestClipboardData
+ */
+typedef void (SDLCALL *SDL_ClipboardRequestCallback)(void *userdata, const char *mime_type, const void *data, size_t size);
+
+/**
+ * Request the data from clipboard for a given mime type, without waiting for
+ * it.
+ *
+ * Unlike SDL_GetClipboardData(), this function doesn't block while another
+ * application sends the data, which can take a while for large data like
+ * images. The callback is called from the event loop once the data arrives,
+ * or before this function returns if the data is already available.
+ *
+ * On platforms that can't retrieve clipboard data asynchronously, the
+ * callback is always called before this function returns.
+ *
+ * \param mime_type The mime type to read from the clipboard
+ * \param callback A function pointer to the function that receives the data
+ * \param userdata An opaque pointer that will be forwarded to the callback
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety This function should only be called on the main thread.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_GetClipboardData
+ */
+extern SDL_DECLSPEC int SDLCALL SDL_RequestClipboardData(const char *mime_type, SDL_ClipboardRequestCallback callback, void *userdata);
+
 /* Ends C function definitions when using C++ */
 #ifdef __cplusplus
 }
@@ -525,6 +525,9 @@ extern "C" {
  *
  * The items can be prefixed by '+'/'-' to add/remove features.
  *
+ * This hint can be changed at any time, and applies to code paths that SDL
+ * chooses afterwards, such as the blitters for new surface blit mappings.
+ *
  * \since This hint is available since SDL 3.0.0.
  */
 #define SDL_HINT_CPU_FEATURE_MASK "SDL_CPU_FEATURE_MASK"
@@ -975,6 +978,32 @@ extern "C" {
  */
 #define SDL_HINT_IME_SHOW_UI "SDL_IME_SHOW_UI"
 
+/**
+ * A variable controlling whether SDL_InitSubSystem() initializes independent
+ * subsystems in parallel.
+ *
+ * When enabled, subsystems that don't need to be initialized on the calling
+ * thread (currently audio, and camera on platforms without udev) are
+ * initialized on a helper thread while the remaining subsystems are
+ * initialized on the calling thread. SDL_InitSubSystem() still waits for all
+ * of them to finish before returning, so this only helps when more than one
+ * subsystem is initialized in the same call, e.g. SDL_Init(SDL_INIT_VIDEO |
+ * SDL_INIT_AUDIO).
+ *
+ * The variable can be set to the following values:
+ *
+ * - "0": Subsystems are initialized one after another. (default)
+ * - "1": Independent subsystems are initialized in parallel.
+ *
+ * The time taken to initialize each subsystem is logged at
+ * SDL_LOG_PRIORITY_DEBUG in the SDL_LOG_CATEGORY_SYSTEM category.
+ *
+ * This hint should be set before calling SDL_Init().
+ *
+ * \since This hint is available since SDL 3.0.0.
+ */
+#define SDL_HINT_INIT_PARALLEL "SDL_INIT_PARALLEL"
+
 /**
  * A variable controlling whether the home indicator bar on iPhone X should be
  * hidden.
@@ -2130,6 +2159,12 @@ extern "C" {
  * Request SDL_AppIterate() be called at a specific rate.
  *
  * This number is in Hz, so "60" means try to iterate 60 times per second.
+ * Fractional rates like "59.94" are allowed.
+ *
+ * Iterations are scheduled to absolute deadlines, so lateness in one
+ * iteration doesn't delay the ones after it. If the app falls more than a
+ * whole iteration behind, the missed iterations are skipped rather than run
+ * back to back.
  *
  * On some platforms, or if you are using SDL_main instead of SDL_AppIterate,
  * this hint is ignored. When the hint can be used, it is allowed to be
@@ -2144,6 +2179,22 @@ extern "C" {
  */
 #define SDL_HINT_MAIN_CALLBACK_RATE "SDL_MAIN_CALLBACK_RATE"
 
+/**
+ * A variable controlling how long SDL busy-waits before each SDL_AppIterate()
+ * call paced by SDL_HINT_MAIN_CALLBACK_RATE.
+ *
+ * This number is in microseconds. SDL sleeps until this long before each
+ * deadline and then spins until the deadline arrives, trading some CPU time
+ * for more precise iteration timing.
+ *
+ * This defaults to 0, which never spins.
+ *
+ * This hint can be set anytime.
+ *
+ * \since This hint is available since SDL 3.0.0.
+ */
+#define SDL_HINT_MAIN_CALLBACK_SPIN "SDL_MAIN_CALLBACK_SPIN"
+
 /**
  * A variable controlling whether the mouse is captured while mouse buttons
  * are pressed.
@@ -2690,6 +2741,45 @@ extern "C" {
  */
 #define SDL_HINT_SCREENSAVER_INHIBIT_ACTIVITY_NAME "SDL_SCREENSAVER_INHIBIT_ACTIVITY_NAME"
 
+/**
+ * A variable setting the rate of a synthetic gyroscope provided by the dummy
+ * sensor driver.
+ *
+ * This is meant for testing code that reads high rate sensors on platforms
+ * without sensors. The sensor produces a slowly rotating set of values at
+ * the given rate in samples per second, and is only available when the dummy
+ * sensor driver is in use.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "0": The dummy sensor driver has no sensors. (default)
+ * - Any positive number: The number of samples per second.
+ *
+ * This hint should be set before the sensor subsystem is initialized.
+ *
+ * \since This hint is available since SDL 3.0.0.
+ */
+#define SDL_HINT_SENSOR_DUMMY_RATE "SDL_SENSOR_DUMMY_RATE"
+
+/**
+ * A variable controlling whether sensors post an SDL_EVENT_SENSOR_UPDATE
+ * event for every sample.
+ *
+ * High rate sensors can produce thousands of samples per second, which can
+ * be read in bulk with SDL_GetSensorSamples() instead of through the event
+ * queue. SDL_GetSensorData() and gamepad sensor fusion aren't affected.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "0": Sensor samples don't post events.
+ * - "1": Every sensor sample posts an event. (default)
+ *
+ * This hint can be set anytime.
+ *
+ * \since This hint is available since SDL 3.0.0.
+ */
+#define SDL_HINT_SENSOR_UPDATE_EVENTS "SDL_SENSOR_UPDATE_EVENTS"
+
 /**
  * A variable controlling whether SDL calls dbus_shutdown() on quit.
  *
@@ -2709,6 +2799,30 @@ extern "C" {
  */
 #define SDL_HINT_SHUTDOWN_DBUS_ON_QUIT "SDL_SHUTDOWN_DBUS_ON_QUIT"
 
+/**
+ * A variable that enables tracing where SDL spends its startup time.
+ *
+ * When enabled, SDL records how long each audio, video and camera driver
+ * took to initialize (including drivers that failed and were skipped), each
+ * library loaded with SDL_LoadObject(), and each device enumeration step.
+ * Only steps taken while SDL_InitSubSystem() is running are recorded, so
+ * libraries loaded and devices enumerated later on are not traced.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "0": Startup tracing is disabled. (default)
+ * - "1": Each step is written to the log as it finishes.
+ * - Any other value is treated as a file name, and the trace is written to
+ *   that file in the Chrome trace event format when SDL_InitSubSystem()
+ *   returns. The file can be loaded in chrome://tracing or
+ *   https://ui.perfetto.dev
+ *
+ * This hint should be set before calling SDL_Init().
+ *
+ * \since This hint is available since SDL 3.0.0.
+ */
+#define SDL_HINT_STARTUP_TRACE "SDL_STARTUP_TRACE"
+
 /**
  * A variable that specifies a backend to use for title storage.
  *
@@ -237,6 +237,13 @@ extern SDL_DECLSPEC SDL_IOStream *SDLCALL SDL_IOFromFile(const char *file, const
  * buffer, you should use SDL_IOFromConstMem() with a read-only buffer of
  * memory instead.
  *
+ * The following properties will be set at creation time by SDL:
+ *
+ * - `SDL_PROP_IOSTREAM_MEMORY_POINTER`: this will be the `mem` parameter that
+ *   was passed to this function.
+ * - `SDL_PROP_IOSTREAM_MEMORY_SIZE_NUMBER`: this will be the `size` parameter
+ *   that was passed to this function.
+ *
  * \param mem a pointer to a buffer to feed an SDL_IOStream stream
  * \param size the buffer size, in bytes
  * \returns a pointer to a new SDL_IOStream structure, or NULL if it fails;
@@ -270,6 +277,14 @@ extern SDL_DECLSPEC SDL_IOStream *SDLCALL SDL_IOFromMem(void *mem, size_t size);
  * If you need to write to a memory buffer, you should use SDL_IOFromMem()
  * with a writable buffer of memory instead.
  *
+ * The following properties will be set at creation time by SDL:
+ *
+ * - `SDL_PROP_IOSTREAM_MEMORY_POINTER`: this will be the `mem` parameter that
+ *   was passed to this function. The memory must not be written through this
+ *   pointer.
+ * - `SDL_PROP_IOSTREAM_MEMORY_SIZE_NUMBER`: this will be the `size` parameter
+ *   that was passed to this function.
+ *
  * \param mem a pointer to a read-only buffer to feed an SDL_IOStream stream
  * \param size the buffer size, in bytes
  * \returns a pointer to a new SDL_IOStream structure, or NULL if it fails;
@@ -285,6 +300,9 @@ extern SDL_DECLSPEC SDL_IOStream *SDLCALL SDL_IOFromMem(void *mem, size_t size);
  */
 extern SDL_DECLSPEC SDL_IOStream *SDLCALL SDL_IOFromConstMem(const void *mem, size_t size);
 
+#define SDL_PROP_IOSTREAM_MEMORY_POINTER            "SDL.iostream.memory.base"
+#define SDL_PROP_IOSTREAM_MEMORY_SIZE_NUMBER        "SDL.iostream.memory.size"
+
 /**
  * Use this function to create an SDL_IOStream that is backed by dynamically
  * allocated memory.
@@ -140,6 +140,29 @@ typedef enum SDL_SensorType
     SDL_SENSOR_GYRO_R           /**< Gyroscope for right Joy-Con controller */
 } SDL_SensorType;
 
+/**
+ * A single timestamped reading from a sensor.
+ *
+ * \since This struct is available since SDL 3.0.0.
+ *
+ * \sa SDL_GetSensorSamples
+ */
+typedef struct SDL_SensorSample
+{
+    Uint64 timestamp;        /**< When the sample was received, in nanoseconds, populated using SDL_GetTicksNS() */
+    Uint64 sensor_timestamp; /**< The timestamp of the sensor reading in nanoseconds, not necessarily synchronized with the system clock */
+    float data[6];           /**< Up to 6 values from the sensor */
+} SDL_SensorSample;
+
+/**
+ * The number of recent samples kept for each opened sensor.
+ *
+ * \since This macro is available since SDL 3.0.0.
+ *
+ * \sa SDL_GetSensorSamples
+ */
+#define SDL_SENSOR_SAMPLE_HISTORY   256
+
 
 /* Function prototypes */
 
@@ -277,6 +300,44 @@ extern SDL_DECLSPEC SDL_SensorID SDLCALL SDL_GetSensorInstanceID(SDL_Sensor *sen
  */
 extern SDL_DECLSPEC int SDLCALL SDL_GetSensorData(SDL_Sensor *sensor, float *data, int num_values);
 
+/**
+ * Get the samples a sensor has reported since a previous call.
+ *
+ * Every opened sensor keeps its most recent samples in a ring buffer, so
+ * high rate sensors can be read at their full rate without handling an
+ * SDL_EVENT_SENSOR_UPDATE for each sample. The ring holds just under
+ * SDL_SENSOR_SAMPLE_HISTORY samples, older samples are lost if they aren't
+ * read in time.
+ *
+ * `cursor` tracks the position of the caller in the ring. Set it to 0
+ * before the first call, and pass the same variable back on later calls to
+ * get only the samples that arrived in between. Samples are returned oldest
+ * first, and if there are more than `max_samples` available, the rest are
+ * returned by the next call.
+ *
+ * You can use SDL_HINT_SENSOR_UPDATE_EVENTS to stop sensors from posting an
+ * event for every sample when they're read this way.
+ *
+ * \param sensor The SDL_Sensor object to query
+ * \param cursor a pointer to the read position of the caller, updated to
+ *               follow the last sample returned
+ * \param samples an array filled with up to `max_samples` samples
+ * \param max_samples the number of elements in `samples`
+ * \returns the number of samples written to `samples` or a negative error
+ *          code on failure; call SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread, samples
+ *               are read without blocking the thread that reports them. A
+ *               copy that is in progress when another thread closes the
+ *               sensor finishes safely. A cursor should only be used by
+ *               one thread at a time.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_GetSensorData
+ */
+extern SDL_DECLSPEC int SDLCALL SDL_GetSensorSamples(SDL_Sensor *sensor, Uint32 *cursor, SDL_SensorSample *samples, int max_samples);
+
 /**
  * Close a sensor previously opened with SDL_OpenSensor().
  *
@@ -98,6 +98,24 @@ typedef enum SDL_FlipMode
     SDL_FLIP_VERTICAL       /**< flip vertically */
 } SDL_FlipMode;
 
+/**
+ * The dithering mode used when a blit reduces color precision.
+ *
+ * Dithering applies to blits and conversions from truecolor surfaces to
+ * 8-bit indexed surfaces and to formats with fewer bits per channel, like
+ * SDL_PIXELFORMAT_RGB565 and SDL_PIXELFORMAT_RGB332.
+ *
+ * \since This enum is available since SDL 3.0.0.
+ *
+ * \sa SDL_SetSurfaceDitherMode
+ */
+typedef enum SDL_DitherMode
+{
+    SDL_DITHER_NONE,      /**< truncate to the destination precision */
+    SDL_DITHER_ORDERED,   /**< 4x4 ordered (Bayer) dithering */
+    SDL_DITHER_DIFFUSION  /**< Floyd-Steinberg error diffusion */
+} SDL_DitherMode;
+
 /**
  * A collection of pixels used in software blitting.
  *
@@ -224,6 +242,10 @@ extern SDL_DECLSPEC void SDLCALL SDL_DestroySurface(SDL_Surface *surface);
  *   the same tone mapping that Chrome uses for HDR content, the form "*=N",
  *   where N is a floating point scale factor applied in linear space, and
  *   "none", which disables tone mapping. This defaults to "chrome".
+ * - `SDL_PROP_SURFACE_DITHER_MODE_NUMBER`: an SDL_DitherMode value used when
+ *   blitting from this surface to a surface with lower color precision,
+ *   defaults to SDL_DITHER_NONE. This is read when the blit mapping is
+ *   created, use SDL_SetSurfaceDitherMode() to change it between blits.
  *
  * \param surface the SDL_Surface structure to query
  * \returns a valid property ID on success or 0 on failure; call
@@ -240,6 +262,7 @@ extern SDL_DECLSPEC SDL_PropertiesID SDLCALL SDL_GetSurfaceProperties(SDL_Surfac
 #define SDL_PROP_SURFACE_SDR_WHITE_POINT_FLOAT              "SDL.surface.SDR_white_point"
 #define SDL_PROP_SURFACE_HDR_HEADROOM_FLOAT                 "SDL.surface.HDR_headroom"
 #define SDL_PROP_SURFACE_TONEMAP_OPERATOR_STRING            "SDL.surface.tonemap"
+#define SDL_PROP_SURFACE_DITHER_MODE_NUMBER                 "SDL.surface.dither_mode"
 
 /**
  * Set the colorspace used by a surface.
@@ -605,6 +628,42 @@ extern SDL_DECLSPEC int SDLCALL SDL_SetSurfaceBlendMode(SDL_Surface *surface, SD
  */
 extern SDL_DECLSPEC int SDLCALL SDL_GetSurfaceBlendMode(SDL_Surface *surface, SDL_BlendMode *blendMode);
 
+/**
+ * Set the dithering mode used for blit operations.
+ *
+ * The dithering mode of the SOURCE surface is used when it is blitted to a
+ * surface with lower color precision, including surface conversions with
+ * SDL_ConvertSurface(). Dithering is only applied to blits without blending,
+ * color or alpha modulation, colorkey or scaling.
+ *
+ * This sets the `SDL_PROP_SURFACE_DITHER_MODE_NUMBER` property of the
+ * surface.
+ *
+ * \param surface the SDL_Surface structure to update
+ * \param ditherMode the SDL_DitherMode to use for blits from this surface
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_GetSurfaceDitherMode
+ */
+extern SDL_DECLSPEC int SDLCALL SDL_SetSurfaceDitherMode(SDL_Surface *surface, SDL_DitherMode ditherMode);
+
+/**
+ * Get the dithering mode used for blit operations.
+ *
+ * \param surface the SDL_Surface structure to query
+ * \param ditherMode a pointer filled in with the current SDL_DitherMode
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_SetSurfaceDitherMode
+ */
+extern SDL_DECLSPEC int SDLCALL SDL_GetSurfaceDitherMode(SDL_Surface *surface, SDL_DitherMode *ditherMode);
+
 /**
  * Set the clipping rectangle for a surface.
  *
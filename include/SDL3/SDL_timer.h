@@ -124,6 +124,27 @@ extern SDL_DECLSPEC void SDLCALL SDL_Delay(Uint32 ms);
  */
 extern SDL_DECLSPEC void SDLCALL SDL_DelayNS(Uint64 ns);
 
+/**
+ * Wait a specified number of nanoseconds before returning, as precisely as
+ * possible.
+ *
+ * This function sleeps until shortly before the requested time and then
+ * busy-waits for the rest of it, so it returns within a few microseconds of
+ * the requested time at the cost of some CPU time. How long it spins is
+ * calibrated against how late the OS wakes up sleeping threads. On Linux,
+ * this also lowers the timer slack of the calling thread, so its other sleeps
+ * end closer to the requested time as well.
+ *
+ * \param ns the number of nanoseconds to delay
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_DelayNS
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_DelayPrecise(Uint64 ns);
+
 /**
  * Function prototype for the timer callback function.
  *
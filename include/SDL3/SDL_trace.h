@@ -0,0 +1,223 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+/**
+ * # CategoryTrace
+ *
+ * Lightweight tracing of where time goes, both inside SDL and in your app.
+ *
+ * Tracing is off by default. Once enabled with SDL_SetTraceEnabled(), SDL
+ * marks zones around its own hot paths (audio device iteration, audio stream
+ * conversion, render command queue flushes, event pumping, joystick updates,
+ * camera frame acquisition and surface blits), and your app can add its own
+ * zones and counters with SDL_BeginTraceZone(), SDL_EndTraceZone() and
+ * SDL_TraceCounter().
+ *
+ * Each thread records into its own fixed size ring buffer without taking any
+ * locks, so only the most recent events are kept. The buffers can be written
+ * out at any time with SDL_SaveTrace() in the Chrome trace event format, and
+ * an SDL_TraceCallback can be installed to forward every event to an
+ * external profiler such as Tracy or Perfetto as it happens.
+ *
+ * Tracing can be compiled out of SDL entirely, in which case these functions
+ * do nothing and SDL_SetTraceEnabled() returns an error.
+ */
+
+#ifndef SDL_trace_h_
+#define SDL_trace_h_
+
+#include <SDL3/SDL_stdinc.h>
+#include <SDL3/SDL_error.h>
+
+#include <SDL3/SDL_begin_code.h>
+/* Set up for C function definitions, even when using C++ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * The types of events that are recorded in a trace.
+ *
+ * \since This enum is available since SDL 3.0.0.
+ */
+typedef enum SDL_TraceEventType
+{
+    SDL_TRACE_EVENT_BEGIN,      /**< A thread entered a zone */
+    SDL_TRACE_EVENT_END,        /**< A thread left a zone */
+    SDL_TRACE_EVENT_COUNTER     /**< A counter changed value */
+} SDL_TraceEventType;
+
+/**
+ * The prototype for the trace callback function.
+ *
+ * This function is called on the thread that recorded the event, while
+ * tracing is enabled, so it should return quickly.
+ *
+ * \param userdata what was passed as `userdata` to SDL_SetTraceCallback()
+ * \param type the type of event
+ * \param name the name of the zone or counter, this pointer stays valid for
+ *             the lifetime of the program
+ * \param timestamp the time of the event, in nanoseconds since SDL library
+ *                  initialization, see SDL_GetTicksNS()
+ * \param value the new value of the counter for SDL_TRACE_EVENT_COUNTER,
+ *              otherwise 0
+ *
+ * \since This datatype is available since SDL 3.0.0.
+ */
+typedef void (SDLCALL *SDL_TraceCallback)(void *userdata, SDL_TraceEventType type, const char *name, Uint64 timestamp, Sint64 value);
+
+/**
+ * Turn tracing on or off.
+ *
+ * \param enabled SDL_TRUE to start recording trace events, SDL_FALSE to
+ *                stop
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_IsTraceEnabled
+ */
+extern SDL_DECLSPEC int SDLCALL SDL_SetTraceEnabled(SDL_bool enabled);
+
+/**
+ * Query whether tracing is enabled.
+ *
+ * \returns SDL_TRUE if trace events are being recorded, SDL_FALSE otherwise.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_SetTraceEnabled
+ */
+extern SDL_DECLSPEC SDL_bool SDLCALL SDL_IsTraceEnabled(void);
+
+/**
+ * Mark the start of a zone on the current thread.
+ *
+ * Zones nest, and every call to this function should be matched with a call
+ * to SDL_EndTraceZone() on the same thread.
+ *
+ * This function does nothing if tracing is not enabled.
+ *
+ * \param name the name of the zone, this string is not copied and must stay
+ *             valid until the trace has been saved, a string literal is
+ *             recommended
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_EndTraceZone
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_BeginTraceZone(const char *name);
+
+/**
+ * Mark the end of a zone on the current thread.
+ *
+ * This function does nothing if tracing is not enabled.
+ *
+ * \param name the name that was passed to SDL_BeginTraceZone()
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_BeginTraceZone
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_EndTraceZone(const char *name);
+
+/**
+ * Record a new value for a counter.
+ *
+ * This function does nothing if tracing is not enabled.
+ *
+ * \param name the name of the counter, this string is not copied and must
+ *             stay valid until the trace has been saved, a string literal is
+ *             recommended
+ * \param value the new value of the counter
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.0.0.
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_TraceCounter(const char *name, Sint64 value);
+
+/**
+ * Get the current trace callback.
+ *
+ * \param callback an SDL_TraceCallback filled in with the current trace
+ *                 callback, or NULL if there isn't one
+ * \param userdata a pointer filled in with the pointer that is passed to
+ *                 `callback`
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_SetTraceCallback
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_GetTraceCallback(SDL_TraceCallback *callback, void **userdata);
+
+/**
+ * Set a function to be called for every trace event.
+ *
+ * The callback is called in addition to recording the event in the trace
+ * buffers, and is intended for forwarding SDL's zones to an external
+ * profiler.
+ *
+ * \param callback an SDL_TraceCallback to call for each event, or NULL to
+ *                 remove the current callback
+ * \param userdata a pointer that is passed to `callback`
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_GetTraceCallback
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_SetTraceCallback(SDL_TraceCallback callback, void *userdata);
+
+/**
+ * Save the events currently in the trace buffers to a file.
+ *
+ * The file is written in the Chrome trace event format, which can be loaded
+ * in chrome://tracing or https://ui.perfetto.dev
+ *
+ * Saving doesn't clear the trace buffers, and other threads can keep
+ * recording while the trace is saved.
+ *
+ * \param file the file to write the trace to
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.0.0.
+ */
+extern SDL_DECLSPEC int SDLCALL SDL_SaveTrace(const char *file);
+
+/* Ends C function definitions when using C++ */
+#ifdef __cplusplus
+}
+#endif
+#include <SDL3/SDL_close_code.h>
+
+#endif /* SDL_trace_h_ */
@@ -184,6 +184,7 @@
 #cmakedefine HAVE_ST_MTIM 1
 #cmakedefine HAVE_SETJMP 1
 #cmakedefine HAVE_NANOSLEEP 1
+#cmakedefine HAVE_CLOCK_NANOSLEEP 1
 #cmakedefine HAVE_GMTIME_R 1
 #cmakedefine HAVE_LOCALTIME_R 1
 #cmakedefine HAVE_NL_LANGINFO 1
@@ -206,6 +207,8 @@
 #cmakedefine HAVE_STDDEF_H 1
 #cmakedefine HAVE_STDINT_H 1
 #cmakedefine HAVE_FLOAT_H 1
+/* Give each thread its own arena in the built-in allocator */
+#cmakedefine SDL_MALLOC_ARENAS 1
 #endif /* HAVE_LIBC */
 
 #cmakedefine HAVE_DBUS_DBUS_H 1
@@ -257,6 +260,7 @@
 #cmakedefine SDL_VIDEO_DISABLED @SDL_VIDEO_DISABLED@
 #cmakedefine SDL_POWER_DISABLED @SDL_POWER_DISABLED@
 #cmakedefine SDL_CAMERA_DISABLED @SDL_CAMERA_DISABLED@
+#cmakedefine SDL_TRACE_DISABLED @SDL_TRACE_DISABLED@
 
 /* Enable various audio drivers */
 #cmakedefine SDL_AUDIO_DRIVER_ALSA @SDL_AUDIO_DRIVER_ALSA@
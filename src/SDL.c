@@ -40,6 +40,7 @@
 #include "SDL_hints_c.h"
 #include "SDL_log_c.h"
 #include "SDL_properties_c.h"
+#include "SDL_trace_c.h"
 #include "audio/SDL_sysaudio.h"
 #include "cpuinfo/SDL_cpuinfo_c.h"
 #include "video/SDL_video_c.h"
@@ -174,6 +175,173 @@ static SDL_bool SDL_InitOrIncrementSubsystem(Uint32 subsystem)
     return SDL_InitSubSystem(subsystem) == 0;
 }
 
+/* Private helper to get a human readable name for a subsystem. */
+static const char *SDL_GetSubsystemName(Uint32 subsystem)
+{
+    switch (subsystem) {
+    case SDL_INIT_TIMER:
+        return "timer";
+    case SDL_INIT_AUDIO:
+        return "audio";
+    case SDL_INIT_VIDEO:
+        return "video";
+    case SDL_INIT_JOYSTICK:
+        return "joystick";
+    case SDL_INIT_HAPTIC:
+        return "haptic";
+    case SDL_INIT_GAMEPAD:
+        return "gamepad";
+    case SDL_INIT_EVENTS:
+        return "events";
+    case SDL_INIT_SENSOR:
+        return "sensor";
+    case SDL_INIT_CAMERA:
+        return "camera";
+    default:
+        return "unknown";
+    }
+}
+
+/* Private helper to report how long a subsystem took to initialize. */
+static void SDL_LogSubsystemInitTime(Uint32 subsystem, Uint64 start)
+{
+    const Uint64 elapsed = SDL_GetTicksNS() - start;
+    SDL_LogDebug(SDL_LOG_CATEGORY_SYSTEM, "Initialized %s subsystem in %" SDL_PRIu64 ".%03d ms",
+                 SDL_GetSubsystemName(subsystem), elapsed / SDL_NS_PER_MS, (int)((elapsed % SDL_NS_PER_MS) / 1000));
+}
+
+/* Subsystems that don't need the calling thread and don't share state with
+ * the other subsystems during startup, so they can be initialized on a
+ * helper thread when SDL_HINT_INIT_PARALLEL is set.
+ *
+ * The camera backends on Linux share the udev context with joysticks and
+ * haptics, which isn't safe to set up from two threads at once.
+ */
+#ifdef SDL_USE_LIBUDEV
+#define SDL_INIT_PARALLEL_SUBSYSTEMS SDL_INIT_AUDIO
+#else
+#define SDL_INIT_PARALLEL_SUBSYSTEMS (SDL_INIT_AUDIO | SDL_INIT_CAMERA)
+#endif
+
+typedef struct SDL_ParallelInit
+{
+    Uint32 flags;       /* Subsystems being initialized on the helper thread */
+    Uint32 initialized; /* Subsystems that initialized successfully */
+    char *error;        /* The error from the subsystem that failed, if any */
+    SDL_Thread *thread;
+} SDL_ParallelInit;
+
+static int SDLCALL SDL_ParallelInitThread(void *data)
+{
+    SDL_ParallelInit *init = (SDL_ParallelInit *)data;
+    Uint64 start;
+
+#ifndef SDL_AUDIO_DISABLED
+    if (init->flags & SDL_INIT_AUDIO) {
+        start = SDL_GetTicksNS();
+        if (SDL_InitAudio(NULL) < 0) {
+            goto done;
+        }
+        SDL_LogSubsystemInitTime(SDL_INIT_AUDIO, start);
+        init->initialized |= SDL_INIT_AUDIO;
+    }
+#endif
+
+#ifndef SDL_CAMERA_DISABLED
+    if (init->flags & SDL_INIT_CAMERA) {
+        start = SDL_GetTicksNS();
+        if (SDL_CameraInit(NULL) < 0) {
+            goto done;
+        }
+        SDL_LogSubsystemInitTime(SDL_INIT_CAMERA, start);
+        init->initialized |= SDL_INIT_CAMERA;
+    }
+#endif
+
+    (void)start;
+
+done:
+    if (init->initialized != init->flags) {
+        init->error = SDL_strdup(SDL_GetError());
+    }
+    return 0;
+}
+
+/* Private helper to start initializing the subsystems in flags that can be
+ * brought up on a helper thread. Returns the subsystems that were handed off.
+ */
+static Uint32 SDL_StartParallelInit(SDL_ParallelInit *init, Uint32 flags)
+{
+    Uint32 subsystem;
+
+    flags &= SDL_INIT_PARALLEL_SUBSYSTEMS;
+    if (!flags || !SDL_GetHintBoolean(SDL_HINT_INIT_PARALLEL, SDL_FALSE)) {
+        return 0;
+    }
+
+    /* Subsystems that are already initialized just get their refcount bumped on the calling thread */
+    for (subsystem = 1; subsystem && subsystem <= flags; subsystem <<= 1) {
+        if ((flags & subsystem) && SDL_ShouldInitSubsystem(subsystem)) {
+            init->flags |= subsystem;
+        }
+    }
+    if (!init->flags) {
+        return 0;
+    }
+
+    for (subsystem = 1; subsystem && subsystem <= init->flags; subsystem <<= 1) {
+        if (init->flags & subsystem) {
+            /* audio and camera imply events, which must be set up before they start.
+               Only the first of these can fail, in which case nothing has been
+               handed off yet and the calling thread will report the error. */
+            if (!SDL_InitOrIncrementSubsystem(SDL_INIT_EVENTS)) {
+                init->flags = 0;
+                return 0;
+            }
+            SDL_IncrementSubsystemRefCount(subsystem);
+        }
+    }
+
+    init->thread = SDL_CreateThread(SDL_ParallelInitThread, "SDLInit", init);
+    if (!init->thread) {
+        /* Fall back to initializing them on the calling thread */
+        for (subsystem = 1; subsystem && subsystem <= init->flags; subsystem <<= 1) {
+            if (init->flags & subsystem) {
+                SDL_DecrementSubsystemRefCount(subsystem);
+                SDL_QuitSubSystem(SDL_INIT_EVENTS);
+            }
+        }
+        init->flags = 0;
+        SDL_ClearError();
+        return 0;
+    }
+    return init->flags;
+}
+
+/* Private helper to wait for the helper thread and roll back anything that
+ * failed. Returns the subsystems that were successfully initialized, the
+ * error for any that failed is left in init->error.
+ */
+static Uint32 SDL_FinishParallelInit(SDL_ParallelInit *init)
+{
+    Uint32 subsystem;
+
+    if (!init->thread) {
+        return 0;
+    }
+
+    SDL_WaitThread(init->thread, NULL);
+    init->thread = NULL;
+
+    for (subsystem = 1; subsystem && subsystem <= init->flags; subsystem <<= 1) {
+        if ((init->flags & subsystem) && !(init->initialized & subsystem)) {
+            SDL_DecrementSubsystemRefCount(subsystem);
+            SDL_QuitSubSystem(SDL_INIT_EVENTS);
+        }
+    }
+    return init->initialized;
+}
+
 void SDL_SetMainReady(void)
 {
     SDL_MainIsReady = SDL_TRUE;
@@ -182,12 +350,17 @@ void SDL_SetMainReady(void)
 int SDL_InitSubSystem(Uint32 flags)
 {
     Uint32 flags_initialized = 0;
+    SDL_ParallelInit parallel_init;
+    Uint64 start;
+
+    SDL_zero(parallel_init);
 
     if (!SDL_MainIsReady) {
         return SDL_SetError("Application didn't initialize properly, did you include SDL_main.h in the file containing your main() function?");
     }
 
     SDL_InitLog();
+    SDL_InitStartupTrace();
     SDL_InitProperties();
     SDL_GetGlobalProperties();
 
@@ -195,7 +368,9 @@ int SDL_InitSubSystem(Uint32 flags)
     SDL_ClearError();
 
 #ifdef SDL_USE_LIBDBUS
+    start = SDL_BeginStartupTrace();
     SDL_DBus_Init();
+    SDL_EndStartupTrace(start, "dbus", "connect", SDL_TRUE);
 #endif
 
 #ifdef SDL_VIDEO_DRIVER_WINDOWS
@@ -212,10 +387,12 @@ int SDL_InitSubSystem(Uint32 flags)
     if (flags & SDL_INIT_EVENTS) {
         if (SDL_ShouldInitSubsystem(SDL_INIT_EVENTS)) {
             SDL_IncrementSubsystemRefCount(SDL_INIT_EVENTS);
+            start = SDL_GetTicksNS();
             if (SDL_InitEvents() < 0) {
                 SDL_DecrementSubsystemRefCount(SDL_INIT_EVENTS);
                 goto quit_and_error;
             }
+            SDL_LogSubsystemInitTime(SDL_INIT_EVENTS, start);
         } else {
             SDL_IncrementSubsystemRefCount(SDL_INIT_EVENTS);
         }
@@ -226,16 +403,22 @@ int SDL_InitSubSystem(Uint32 flags)
     if (flags & SDL_INIT_TIMER) {
         if (SDL_ShouldInitSubsystem(SDL_INIT_TIMER)) {
             SDL_IncrementSubsystemRefCount(SDL_INIT_TIMER);
+            start = SDL_GetTicksNS();
             if (SDL_InitTimers() < 0) {
                 SDL_DecrementSubsystemRefCount(SDL_INIT_TIMER);
                 goto quit_and_error;
             }
+            SDL_LogSubsystemInitTime(SDL_INIT_TIMER, start);
         } else {
             SDL_IncrementSubsystemRefCount(SDL_INIT_TIMER);
         }
         flags_initialized |= SDL_INIT_TIMER;
     }
 
+    /* Start the subsystems that can be initialized on a helper thread while
+       the rest are initialized here */
+    flags &= ~SDL_StartParallelInit(&parallel_init, flags);
+
     /* Initialize the video subsystem */
     if (flags & SDL_INIT_VIDEO) {
 #ifndef SDL_VIDEO_DISABLED
@@ -246,10 +429,12 @@ int SDL_InitSubSystem(Uint32 flags)
             }
 
             SDL_IncrementSubsystemRefCount(SDL_INIT_VIDEO);
+            start = SDL_GetTicksNS();
             if (SDL_VideoInit(NULL) < 0) {
                 SDL_DecrementSubsystemRefCount(SDL_INIT_VIDEO);
                 goto quit_and_error;
             }
+            SDL_LogSubsystemInitTime(SDL_INIT_VIDEO, start);
         } else {
             SDL_IncrementSubsystemRefCount(SDL_INIT_VIDEO);
         }
@@ -270,10 +455,12 @@ int SDL_InitSubSystem(Uint32 flags)
             }
 
             SDL_IncrementSubsystemRefCount(SDL_INIT_AUDIO);
+            start = SDL_GetTicksNS();
             if (SDL_InitAudio(NULL) < 0) {
                 SDL_DecrementSubsystemRefCount(SDL_INIT_AUDIO);
                 goto quit_and_error;
             }
+            SDL_LogSubsystemInitTime(SDL_INIT_AUDIO, start);
         } else {
             SDL_IncrementSubsystemRefCount(SDL_INIT_AUDIO);
         }
@@ -294,10 +481,12 @@ int SDL_InitSubSystem(Uint32 flags)
             }
 
             SDL_IncrementSubsystemRefCount(SDL_INIT_JOYSTICK);
+            start = SDL_GetTicksNS();
             if (SDL_InitJoysticks() < 0) {
                 SDL_DecrementSubsystemRefCount(SDL_INIT_JOYSTICK);
                 goto quit_and_error;
             }
+            SDL_LogSubsystemInitTime(SDL_INIT_JOYSTICK, start);
         } else {
             SDL_IncrementSubsystemRefCount(SDL_INIT_JOYSTICK);
         }
@@ -317,10 +506,12 @@ int SDL_InitSubSystem(Uint32 flags)
             }
 
             SDL_IncrementSubsystemRefCount(SDL_INIT_GAMEPAD);
+            start = SDL_GetTicksNS();
             if (SDL_InitGamepads() < 0) {
                 SDL_DecrementSubsystemRefCount(SDL_INIT_GAMEPAD);
                 goto quit_and_error;
             }
+            SDL_LogSubsystemInitTime(SDL_INIT_GAMEPAD, start);
         } else {
             SDL_IncrementSubsystemRefCount(SDL_INIT_GAMEPAD);
         }
@@ -336,10 +527,12 @@ int SDL_InitSubSystem(Uint32 flags)
 #ifndef SDL_HAPTIC_DISABLED
         if (SDL_ShouldInitSubsystem(SDL_INIT_HAPTIC)) {
             SDL_IncrementSubsystemRefCount(SDL_INIT_HAPTIC);
+            start = SDL_GetTicksNS();
             if (SDL_InitHaptics() < 0) {
                 SDL_DecrementSubsystemRefCount(SDL_INIT_HAPTIC);
                 goto quit_and_error;
             }
+            SDL_LogSubsystemInitTime(SDL_INIT_HAPTIC, start);
         } else {
             SDL_IncrementSubsystemRefCount(SDL_INIT_HAPTIC);
         }
@@ -355,10 +548,12 @@ int SDL_InitSubSystem(Uint32 flags)
 #ifndef SDL_SENSOR_DISABLED
         if (SDL_ShouldInitSubsystem(SDL_INIT_SENSOR)) {
             SDL_IncrementSubsystemRefCount(SDL_INIT_SENSOR);
+            start = SDL_GetTicksNS();
             if (SDL_InitSensors() < 0) {
                 SDL_DecrementSubsystemRefCount(SDL_INIT_SENSOR);
                 goto quit_and_error;
             }
+            SDL_LogSubsystemInitTime(SDL_INIT_SENSOR, start);
         } else {
             SDL_IncrementSubsystemRefCount(SDL_INIT_SENSOR);
         }
@@ -379,10 +574,12 @@ int SDL_InitSubSystem(Uint32 flags)
             }
 
             SDL_IncrementSubsystemRefCount(SDL_INIT_CAMERA);
+            start = SDL_GetTicksNS();
             if (SDL_CameraInit(NULL) < 0) {
                 SDL_DecrementSubsystemRefCount(SDL_INIT_CAMERA);
                 goto quit_and_error;
             }
+            SDL_LogSubsystemInitTime(SDL_INIT_CAMERA, start);
         } else {
             SDL_IncrementSubsystemRefCount(SDL_INIT_CAMERA);
         }
@@ -393,12 +590,25 @@ int SDL_InitSubSystem(Uint32 flags)
 #endif
     }
 
+    flags_initialized |= SDL_FinishParallelInit(&parallel_init);
+    if (parallel_init.initialized != parallel_init.flags) {
+        if (parallel_init.error) {
+            SDL_SetError("%s", parallel_init.error);
+        }
+        goto quit_and_error;
+    }
+
     (void)flags_initialized; /* make static analysis happy, since this only gets used in error cases. */
 
+    SDL_FinishStartupTrace();
+
     return SDL_ClearError();
 
 quit_and_error:
+    flags_initialized |= SDL_FinishParallelInit(&parallel_init);
+    SDL_free(parallel_init.error);
     SDL_QuitSubSystem(flags_initialized);
+    SDL_FinishStartupTrace();
     return -1;
 }
 
@@ -543,12 +753,14 @@ void SDL_Quit(void)
     SDL_DBus_Quit();
 #endif
 
+    SDL_QuitCPUInfo();
+
     SDL_ClearHints();
     SDL_AssertionsQuit();
 
-    SDL_QuitCPUInfo();
-
     SDL_QuitProperties();
+    SDL_QuitTrace();
+    SDL_QuitStartupTrace();
     SDL_QuitLog();
 
     /* Now that every subsystem has been quit, we reset the subsystem refcount
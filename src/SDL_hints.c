@@ -43,6 +43,36 @@ typedef struct SDL_Hint
 
 static SDL_Hint *SDL_hints;
 
+/* Subsystems can be initialized in parallel, so the list is protected by a
+   mutex. It's recursive, callbacks are called with it held and may query
+   hints or add and remove callbacks themselves. */
+static SDL_Mutex *SDL_hint_lock;
+
+static void SDL_LockHints(void)
+{
+#ifndef SDL_THREADS_DISABLED
+    if (!SDL_hint_lock) {
+        static SDL_SpinLock hint_lock_spinlock;
+        SDL_LockSpinlock(&hint_lock_spinlock);
+        if (!SDL_hint_lock) {
+            SDL_Mutex *mutex = SDL_CreateMutex();
+            SDL_MemoryBarrierRelease();
+            SDL_hint_lock = mutex;
+        }
+        SDL_UnlockSpinlock(&hint_lock_spinlock);
+    }
+    SDL_MemoryBarrierAcquire();
+    SDL_LockMutex(SDL_hint_lock);
+#endif
+}
+
+static void SDL_UnlockHints(void)
+{
+#ifndef SDL_THREADS_DISABLED
+    SDL_UnlockMutex(SDL_hint_lock);
+#endif
+}
+
 SDL_bool SDL_SetHintWithPriority(const char *name, const char *value, SDL_HintPriority priority)
 {
     const char *env;
@@ -58,9 +88,11 @@ SDL_bool SDL_SetHintWithPriority(const char *name, const char *value, SDL_HintPr
         return SDL_FALSE;
     }
 
+    SDL_LockHints();
     for (hint = SDL_hints; hint; hint = hint->next) {
         if (SDL_strcmp(name, hint->name) == 0) {
             if (priority < hint->priority) {
+                SDL_UnlockHints();
                 return SDL_FALSE;
             }
             if (hint->value != value &&
@@ -79,6 +111,7 @@ SDL_bool SDL_SetHintWithPriority(const char *name, const char *value, SDL_HintPr
                 }
             }
             hint->priority = priority;
+            SDL_UnlockHints();
             return SDL_TRUE;
         }
     }
@@ -86,6 +119,7 @@ SDL_bool SDL_SetHintWithPriority(const char *name, const char *value, SDL_HintPr
     /* Couldn't find the hint, add a new one */
     hint = (SDL_Hint *)SDL_malloc(sizeof(*hint));
     if (!hint) {
+        SDL_UnlockHints();
         return SDL_FALSE;
     }
     hint->name = SDL_strdup(name);
@@ -94,6 +128,7 @@ SDL_bool SDL_SetHintWithPriority(const char *name, const char *value, SDL_HintPr
     hint->callbacks = NULL;
     hint->next = SDL_hints;
     SDL_hints = hint;
+    SDL_UnlockHints();
     return SDL_TRUE;
 }
 
@@ -108,6 +143,7 @@ SDL_bool SDL_ResetHint(const char *name)
     }
 
     env = SDL_getenv(name);
+    SDL_LockHints();
     for (hint = SDL_hints; hint; hint = hint->next) {
         if (SDL_strcmp(name, hint->name) == 0) {
             if ((!env && hint->value) ||
@@ -123,9 +159,11 @@ SDL_bool SDL_ResetHint(const char *name)
             SDL_free(hint->value);
             hint->value = NULL;
             hint->priority = SDL_HINT_DEFAULT;
+            SDL_UnlockHints();
             return SDL_TRUE;
         }
     }
+    SDL_UnlockHints();
     return SDL_FALSE;
 }
 
@@ -135,6 +173,7 @@ void SDL_ResetHints(void)
     SDL_Hint *hint;
     SDL_HintWatch *entry;
 
+    SDL_LockHints();
     for (hint = SDL_hints; hint; hint = hint->next) {
         env = SDL_getenv(hint->name);
         if ((!env && hint->value) ||
@@ -151,6 +190,7 @@ void SDL_ResetHints(void)
         hint->value = NULL;
         hint->priority = SDL_HINT_DEFAULT;
     }
+    SDL_UnlockHints();
 }
 
 SDL_bool SDL_SetHint(const char *name, const char *value)
@@ -168,14 +208,16 @@ const char *SDL_GetHint(const char *name)
     }
 
     env = SDL_getenv(name);
+    SDL_LockHints();
     for (hint = SDL_hints; hint; hint = hint->next) {
         if (SDL_strcmp(name, hint->name) == 0) {
             if (!env || hint->priority == SDL_HINT_OVERRIDE) {
-                return hint->value;
+                env = hint->value;
             }
             break;
         }
     }
+    SDL_UnlockHints();
     return env;
 }
 
@@ -226,10 +268,12 @@ int SDL_AddHintCallback(const char *name, SDL_HintCallback callback, void *userd
         return SDL_InvalidParamError("callback");
     }
 
+    SDL_LockHints();
     SDL_DelHintCallback(name, callback, userdata);
 
     entry = (SDL_HintWatch *)SDL_malloc(sizeof(*entry));
     if (!entry) {
+        SDL_UnlockHints();
         return -1;
     }
     entry->callback = callback;
@@ -245,12 +289,14 @@ int SDL_AddHintCallback(const char *name, SDL_HintCallback callback, void *userd
         hint = (SDL_Hint *)SDL_malloc(sizeof(*hint));
         if (!hint) {
             SDL_free(entry);
+            SDL_UnlockHints();
             return -1;
         }
         hint->name = SDL_strdup(name);
         if (!hint->name) {
             SDL_free(entry);
             SDL_free(hint);
+            SDL_UnlockHints();
             return -1;
         }
         hint->value = NULL;
@@ -267,6 +313,7 @@ int SDL_AddHintCallback(const char *name, SDL_HintCallback callback, void *userd
     /* Now call it with the current value */
     value = SDL_GetHint(name);
     callback(userdata, name, value, value);
+    SDL_UnlockHints();
     return 0;
 }
 
@@ -275,6 +322,7 @@ void SDL_DelHintCallback(const char *name, SDL_HintCallback callback, void *user
     SDL_Hint *hint;
     SDL_HintWatch *entry, *prev;
 
+    SDL_LockHints();
     for (hint = SDL_hints; hint; hint = hint->next) {
         if (SDL_strcmp(name, hint->name) == 0) {
             prev = NULL;
@@ -290,9 +338,10 @@ void SDL_DelHintCallback(const char *name, SDL_HintCallback callback, void *user
                 }
                 prev = entry;
             }
-            return;
+            break;
         }
     }
+    SDL_UnlockHints();
 }
 
 void SDL_ClearHints(void)
@@ -300,6 +349,7 @@ void SDL_ClearHints(void)
     SDL_Hint *hint;
     SDL_HintWatch *entry;
 
+    SDL_LockHints();
     while (SDL_hints) {
         hint = SDL_hints;
         SDL_hints = hint->next;
@@ -313,4 +363,9 @@ void SDL_ClearHints(void)
         }
         SDL_free(hint);
     }
+    SDL_UnlockHints();
+
+    /* This is only called from SDL_Quit(), when nothing else is using hints */
+    SDL_DestroyMutex(SDL_hint_lock);
+    SDL_hint_lock = NULL;
 }
@@ -0,0 +1,683 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+/* Startup time tracing */
+
+#include "SDL_trace_c.h"
+
+/* Startup steps only happen a handful of times, but keep a bound on memory
+   in case something like hotplug enumeration keeps adding events */
+#define SDL_MAX_STARTUP_TRACE_EVENTS 4096
+
+typedef struct SDL_StartupTraceEvent
+{
+    const char *category;
+    char *name;
+    Uint64 start;
+    Uint64 duration;
+    SDL_ThreadID thread;
+    SDL_bool succeeded;
+} SDL_StartupTraceEvent;
+
+SDL_bool SDL_startup_trace_enabled = SDL_FALSE;
+
+static SDL_bool SDL_startup_trace_configured;
+static int SDL_startup_trace_init_depth;
+static SDL_Mutex *SDL_startup_trace_lock;
+static char *SDL_startup_trace_file;
+static SDL_StartupTraceEvent *SDL_startup_trace_events;
+static int SDL_num_startup_trace_events;
+static int SDL_max_startup_trace_events;
+static SDL_bool SDL_startup_trace_dirty;
+
+/* Called when SDL_InitSubSystem() starts, steps are only recorded until the
+   outermost call returns, so later library loads and hotplug enumeration stay quiet */
+void SDL_InitStartupTrace(void)
+{
+    const char *hint;
+
+    ++SDL_startup_trace_init_depth;
+    if (SDL_startup_trace_configured) {
+        SDL_startup_trace_enabled = SDL_TRUE;
+        return;
+    }
+
+    hint = SDL_GetHint(SDL_HINT_STARTUP_TRACE);
+    if (!hint || !*hint || SDL_strcmp(hint, "0") == 0 || SDL_strcasecmp(hint, "false") == 0) {
+        return;
+    }
+
+    /* Anything other than a boolean is the name of a file to write the trace to */
+    if (SDL_strcmp(hint, "1") != 0 && SDL_strcasecmp(hint, "true") != 0) {
+        SDL_startup_trace_lock = SDL_CreateMutex();
+        if (!SDL_startup_trace_lock) {
+            return;
+        }
+        SDL_startup_trace_file = SDL_strdup(hint);
+        if (!SDL_startup_trace_file) {
+            SDL_DestroyMutex(SDL_startup_trace_lock);
+            SDL_startup_trace_lock = NULL;
+            return;
+        }
+    }
+    SDL_startup_trace_configured = SDL_TRUE;
+    SDL_startup_trace_enabled = SDL_TRUE;
+}
+
+/* Called when SDL_InitSubSystem() returns */
+void SDL_FinishStartupTrace(void)
+{
+    SDL_FlushStartupTrace();
+
+    if (SDL_startup_trace_init_depth > 0 && --SDL_startup_trace_init_depth == 0) {
+        SDL_startup_trace_enabled = SDL_FALSE;
+    }
+}
+
+void SDL_AddStartupTraceEvent(const char *category, const char *name, Uint64 start, SDL_bool succeeded)
+{
+    const Uint64 duration = SDL_GetTicksNS() - start;
+    SDL_StartupTraceEvent *event;
+    char *name_copy;
+
+    if (!SDL_startup_trace_file) {
+        SDL_Log("Startup trace: %s %s%s took %" SDL_PRIu64 ".%03d ms",
+                category, name, succeeded ? "" : " (failed)",
+                duration / SDL_NS_PER_MS, (int)((duration % SDL_NS_PER_MS) / SDL_NS_PER_US));
+        return;
+    }
+
+    /* Threads initializing subsystems in parallel record events at the same
+       time, so do the allocations before taking the lock */
+    name_copy = SDL_strdup(name);
+    if (!name_copy) {
+        return;
+    }
+
+    SDL_LockMutex(SDL_startup_trace_lock);
+    if (SDL_num_startup_trace_events == SDL_MAX_STARTUP_TRACE_EVENTS) {
+        SDL_UnlockMutex(SDL_startup_trace_lock);
+        SDL_free(name_copy);
+        return;
+    }
+    if (SDL_num_startup_trace_events == SDL_max_startup_trace_events) {
+        int max_events = SDL_max_startup_trace_events ? SDL_max_startup_trace_events * 2 : 64;
+        SDL_StartupTraceEvent *events = (SDL_StartupTraceEvent *)SDL_realloc(SDL_startup_trace_events, max_events * sizeof(*events));
+        if (!events) {
+            SDL_UnlockMutex(SDL_startup_trace_lock);
+            SDL_free(name_copy);
+            return;
+        }
+        SDL_startup_trace_events = events;
+        SDL_max_startup_trace_events = max_events;
+    }
+    event = &SDL_startup_trace_events[SDL_num_startup_trace_events];
+    event->name = name_copy;
+    event->category = category;
+    event->start = start;
+    event->duration = duration;
+    event->thread = SDL_GetCurrentThreadID();
+    event->succeeded = succeeded;
+    ++SDL_num_startup_trace_events;
+    SDL_startup_trace_dirty = SDL_TRUE;
+    SDL_UnlockMutex(SDL_startup_trace_lock);
+}
+
+static void SDL_WriteJSONString(SDL_IOStream *io, const char *string)
+{
+    const char *ch;
+
+    SDL_WriteIO(io, "\"", 1);
+    for (ch = string; *ch; ++ch) {
+        if (*ch == '"' || *ch == '\\') {
+            SDL_IOprintf(io, "\\%c", *ch);
+        } else if ((unsigned char)*ch < 0x20) {
+            SDL_IOprintf(io, "\\u%.4x", (unsigned char)*ch);
+        } else {
+            SDL_WriteIO(io, ch, 1);
+        }
+    }
+    SDL_WriteIO(io, "\"", 1);
+}
+
+/* Writes everything recorded so far as a Chrome trace, which can be loaded
+   in chrome://tracing or https://ui.perfetto.dev */
+void SDL_FlushStartupTrace(void)
+{
+    SDL_StartupTraceEvent *events;
+    SDL_IOStream *io;
+    int i, num_events;
+
+    if (!SDL_startup_trace_file) {
+        return;
+    }
+
+    /* Copy the events out, so other threads can keep recording while we write.
+       The names are only freed in SDL_QuitStartupTrace(). */
+    SDL_LockMutex(SDL_startup_trace_lock);
+    if (!SDL_startup_trace_dirty) {
+        SDL_UnlockMutex(SDL_startup_trace_lock);
+        return;
+    }
+    num_events = SDL_num_startup_trace_events;
+    events = (SDL_StartupTraceEvent *)SDL_malloc(num_events * sizeof(*events));
+    if (!events) {
+        SDL_UnlockMutex(SDL_startup_trace_lock);
+        return;
+    }
+    SDL_memcpy(events, SDL_startup_trace_events, num_events * sizeof(*events));
+    SDL_startup_trace_dirty = SDL_FALSE;
+    SDL_UnlockMutex(SDL_startup_trace_lock);
+
+    io = SDL_IOFromFile(SDL_startup_trace_file, "wb");
+    if (!io) {
+        SDL_free(events);
+        return;
+    }
+
+    SDL_IOprintf(io, "{\"traceEvents\":[\n");
+    for (i = 0; i < num_events; ++i) {
+        const SDL_StartupTraceEvent *event = &events[i];
+
+        SDL_IOprintf(io, "{\"name\":");
+        SDL_WriteJSONString(io, event->name);
+        SDL_IOprintf(io, ",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%" SDL_PRIu64 ".%03d,\"dur\":%" SDL_PRIu64 ".%03d,\"pid\":1,\"tid\":%" SDL_PRIu64 ",\"args\":{\"succeeded\":%s}}%s\n",
+                     event->category,
+                     event->start / SDL_NS_PER_US, (int)(event->start % SDL_NS_PER_US),
+                     event->duration / SDL_NS_PER_US, (int)(event->duration % SDL_NS_PER_US),
+                     event->thread, event->succeeded ? "true" : "false",
+                     (i + 1) < num_events ? "," : "");
+    }
+    SDL_IOprintf(io, "],\"displayTimeUnit\":\"ms\"}\n");
+
+    SDL_CloseIO(io);
+    SDL_free(events);
+}
+
+void SDL_QuitStartupTrace(void)
+{
+    int i;
+
+    SDL_FlushStartupTrace();
+
+    SDL_startup_trace_enabled = SDL_FALSE;
+    SDL_startup_trace_configured = SDL_FALSE;
+    SDL_startup_trace_init_depth = 0;
+
+    for (i = 0; i < SDL_num_startup_trace_events; ++i) {
+        SDL_free(SDL_startup_trace_events[i].name);
+    }
+    SDL_free(SDL_startup_trace_events);
+    SDL_startup_trace_events = NULL;
+    SDL_num_startup_trace_events = 0;
+    SDL_max_startup_trace_events = 0;
+    SDL_startup_trace_dirty = SDL_FALSE;
+
+    SDL_free(SDL_startup_trace_file);
+    SDL_startup_trace_file = NULL;
+
+    SDL_DestroyMutex(SDL_startup_trace_lock);
+    SDL_startup_trace_lock = NULL;
+}
+
+/* Zones and counters */
+
+#ifndef SDL_TRACE_DISABLED
+
+/* The number of events kept for each thread, must be a power of two */
+#define SDL_TRACE_BUFFER_SIZE 8192
+
+typedef struct SDL_TraceEvent
+{
+    const char *name;
+    Uint64 timestamp;
+    Sint64 value;
+    SDL_TraceEventType type;
+} SDL_TraceEvent;
+
+/* Each buffer is only written by the thread that owns it. head is the total
+   number of events written, and is published after the event it covers, so
+   a reader can tell which events might have been overwritten while it was
+   copying them out. When its thread exits the buffer is handed on to the
+   next thread that needs one. The new owner keeps sequence odd while it sets
+   thread and moves first up past the events of the previous owner. */
+typedef struct SDL_TraceBuffer
+{
+    SDL_AtomicInt owned;
+    SDL_AtomicInt sequence;
+    SDL_ThreadID thread;
+    Uint32 first;
+    SDL_AtomicInt head;
+    struct SDL_TraceBuffer *next;
+    SDL_TraceEvent events[SDL_TRACE_BUFFER_SIZE];
+} SDL_TraceBuffer;
+
+/* The TLS slot of each thread outlives the buffers, which SDL_QuitTrace()
+   frees, so it remembers which generation of buffers its own belongs to. */
+typedef struct SDL_TraceThread
+{
+    int generation;
+    SDL_TraceBuffer *buffer;
+} SDL_TraceThread;
+
+/* Added to SDL_trace_users while SDL_QuitTrace() frees the buffers */
+#define SDL_TRACE_USERS_CLOSED (SDL_MIN_SINT32 / 2)
+
+SDL_bool SDL_trace_enabled = SDL_FALSE;
+
+static SDL_SpinLock SDL_trace_lock;
+static SDL_TLSID SDL_trace_tls;
+static void *SDL_trace_buffers;
+static SDL_AtomicInt SDL_trace_generation;
+static SDL_AtomicInt SDL_trace_users;
+
+/* The callback and its userdata are published together with a sequence
+   count, odd while SDL_SetTraceCallback() is changing them */
+static SDL_AtomicInt SDL_trace_callback_sequence;
+static SDL_TraceCallback SDL_trace_callback;
+static void *SDL_trace_userdata;
+
+/* Threads using the buffers are counted, so SDL_QuitTrace() can keep new
+   ones out and wait for the rest before it frees them */
+static SDL_bool SDL_LockTraceBuffers(void)
+{
+    if (SDL_AtomicAdd(&SDL_trace_users, 1) < 0) {
+        SDL_AtomicAdd(&SDL_trace_users, -1);
+        return SDL_FALSE;
+    }
+    return SDL_TRUE;
+}
+
+static void SDL_UnlockTraceBuffers(void)
+{
+    SDL_AtomicAdd(&SDL_trace_users, -1);
+}
+
+/* TLS destructor, gives the buffer of an exiting thread back for reuse */
+static void SDLCALL SDL_ReleaseTraceThread(void *data)
+{
+    SDL_TraceThread *thread = (SDL_TraceThread *)data;
+
+    if (thread->buffer && SDL_LockTraceBuffers()) {
+        if (thread->generation == SDL_AtomicGet(&SDL_trace_generation)) {
+            SDL_MemoryBarrierRelease();
+            SDL_AtomicSet(&thread->buffer->owned, 0);
+        }
+        SDL_UnlockTraceBuffers();
+    }
+    SDL_free(thread);
+}
+
+static SDL_TraceBuffer *SDL_ClaimTraceBuffer(void)
+{
+    SDL_TraceBuffer *buffer;
+
+    for (buffer = (SDL_TraceBuffer *)SDL_AtomicGetPtr(&SDL_trace_buffers); buffer; buffer = buffer->next) {
+        if (SDL_AtomicCompareAndSwap(&buffer->owned, 0, 1)) {
+            SDL_MemoryBarrierAcquire();
+            SDL_AtomicIncRef(&buffer->sequence);
+            SDL_MemoryBarrierRelease();
+            buffer->thread = SDL_GetCurrentThreadID();
+            buffer->first = (Uint32)SDL_AtomicGet(&buffer->head);
+            SDL_MemoryBarrierRelease();
+            SDL_AtomicIncRef(&buffer->sequence);
+            return buffer;
+        }
+    }
+    return NULL;
+}
+
+static SDL_TraceBuffer *SDL_GetTraceBuffer(void)
+{
+    SDL_TraceThread *thread;
+    SDL_TraceBuffer *buffer;
+    SDL_TLSID tls = SDL_trace_tls;
+    const int generation = SDL_AtomicGet(&SDL_trace_generation);
+
+    if (!tls) {
+        SDL_LockSpinlock(&SDL_trace_lock);
+        if (!SDL_trace_tls) {
+            SDL_trace_tls = SDL_CreateTLS();
+        }
+        tls = SDL_trace_tls;
+        SDL_UnlockSpinlock(&SDL_trace_lock);
+        if (!tls) {
+            return NULL;
+        }
+    }
+
+    thread = (SDL_TraceThread *)SDL_GetTLS(tls);
+    if (!thread) {
+        thread = (SDL_TraceThread *)SDL_calloc(1, sizeof(*thread));
+        if (!thread) {
+            return NULL;
+        }
+        if (SDL_SetTLS(tls, thread, SDL_ReleaseTraceThread) < 0) {
+            SDL_free(thread);
+            return NULL;
+        }
+    }
+    if (thread->buffer && thread->generation == generation) {
+        return thread->buffer;
+    }
+
+    buffer = SDL_ClaimTraceBuffer();
+    if (!buffer) {
+        buffer = (SDL_TraceBuffer *)SDL_calloc(1, sizeof(*buffer));
+        if (!buffer) {
+            return NULL;
+        }
+        buffer->thread = SDL_GetCurrentThreadID();
+        SDL_AtomicSet(&buffer->owned, 1);
+
+        /* Buffers are only removed in SDL_QuitTrace(), so a push is all we need here */
+        do {
+            buffer->next = (SDL_TraceBuffer *)SDL_AtomicGetPtr(&SDL_trace_buffers);
+        } while (!SDL_AtomicCompareAndSwapPointer(&SDL_trace_buffers, buffer->next, buffer));
+    }
+
+    thread->buffer = buffer;
+    thread->generation = generation;
+    return buffer;
+}
+
+static SDL_TraceCallback SDL_GetTraceCallbackInternal(void **userdata)
+{
+    SDL_TraceCallback callback;
+    int sequence;
+
+    for (;;) {
+        sequence = SDL_AtomicGet(&SDL_trace_callback_sequence);
+        if (sequence & 1) {
+            SDL_CPUPauseInstruction();
+            continue;
+        }
+        SDL_MemoryBarrierAcquire();
+        callback = SDL_trace_callback;
+        *userdata = SDL_trace_userdata;
+        SDL_MemoryBarrierAcquire();
+        if (SDL_AtomicGet(&SDL_trace_callback_sequence) == sequence) {
+            return callback;
+        }
+    }
+}
+
+static void SDL_AddTraceEvent(SDL_TraceEventType type, const char *name, Sint64 value)
+{
+    const Uint64 timestamp = SDL_GetTicksNS();
+    SDL_TraceCallback callback;
+    void *userdata;
+    SDL_TraceBuffer *buffer;
+    SDL_TraceEvent *event;
+    Uint32 head;
+
+    if (!SDL_LockTraceBuffers()) {
+        return;
+    }
+
+    callback = SDL_GetTraceCallbackInternal(&userdata);
+    if (callback) {
+        callback(userdata, type, name, timestamp, value);
+    }
+
+    buffer = SDL_GetTraceBuffer();
+    if (!buffer) {
+        SDL_UnlockTraceBuffers();
+        return;
+    }
+
+    head = (Uint32)SDL_AtomicGet(&buffer->head);
+    event = &buffer->events[head & (SDL_TRACE_BUFFER_SIZE - 1)];
+    event->name = name;
+    event->timestamp = timestamp;
+    event->value = value;
+    event->type = type;
+    SDL_AtomicSet(&buffer->head, (int)(head + 1));
+
+    SDL_UnlockTraceBuffers();
+}
+
+int SDL_SetTraceEnabled(SDL_bool enabled)
+{
+    SDL_trace_enabled = enabled;
+    SDL_MemoryBarrierRelease();
+    return 0;
+}
+
+SDL_bool SDL_IsTraceEnabled(void)
+{
+    return SDL_trace_enabled;
+}
+
+void SDL_BeginTraceZone(const char *name)
+{
+    if (SDL_trace_enabled && name) {
+        SDL_AddTraceEvent(SDL_TRACE_EVENT_BEGIN, name, 0);
+    }
+}
+
+void SDL_EndTraceZone(const char *name)
+{
+    if (SDL_trace_enabled && name) {
+        SDL_AddTraceEvent(SDL_TRACE_EVENT_END, name, 0);
+    }
+}
+
+void SDL_TraceCounter(const char *name, Sint64 value)
+{
+    if (SDL_trace_enabled && name) {
+        SDL_AddTraceEvent(SDL_TRACE_EVENT_COUNTER, name, value);
+    }
+}
+
+void SDL_GetTraceCallback(SDL_TraceCallback *callback, void **userdata)
+{
+    void *current_userdata;
+    SDL_TraceCallback current_callback = SDL_GetTraceCallbackInternal(&current_userdata);
+
+    if (callback) {
+        *callback = current_callback;
+    }
+    if (userdata) {
+        *userdata = current_userdata;
+    }
+}
+
+void SDL_SetTraceCallback(SDL_TraceCallback callback, void *userdata)
+{
+    SDL_LockSpinlock(&SDL_trace_lock);
+    SDL_AtomicIncRef(&SDL_trace_callback_sequence);
+    SDL_MemoryBarrierRelease();
+    SDL_trace_callback = callback;
+    SDL_trace_userdata = userdata;
+    SDL_MemoryBarrierRelease();
+    SDL_AtomicIncRef(&SDL_trace_callback_sequence);
+    SDL_UnlockSpinlock(&SDL_trace_lock);
+}
+
+static void SDL_WriteTraceBuffer(SDL_IOStream *io, SDL_TraceBuffer *buffer, SDL_TraceEvent *events, SDL_bool *first)
+{
+    Uint32 start, head, tail, count, i;
+    SDL_ThreadID thread;
+    int sequence;
+
+    /* A new owner is taking the buffer over, nothing in it is theirs yet */
+    sequence = SDL_AtomicGet(&buffer->sequence);
+    if (sequence & 1) {
+        return;
+    }
+    SDL_MemoryBarrierAcquire();
+    thread = buffer->thread;
+    start = buffer->first;
+    head = (Uint32)SDL_AtomicGet(&buffer->head);
+    SDL_MemoryBarrierAcquire();
+    count = SDL_min(head - start, SDL_TRACE_BUFFER_SIZE);
+    tail = head - count;
+    for (i = 0; i < count; ++i) {
+        events[i] = buffer->events[(tail + i) & (SDL_TRACE_BUFFER_SIZE - 1)];
+    }
+
+    /* Skip anything the owning thread wrapped around and overwrote while we
+       were copying. It may also be in the middle of writing event head, which
+       goes into the slot of event head - SDL_TRACE_BUFFER_SIZE. */
+    SDL_MemoryBarrierAcquire();
+    head = (Uint32)SDL_AtomicGet(&buffer->head);
+    i = 0;
+    if ((head - tail) >= SDL_TRACE_BUFFER_SIZE) {
+        i = SDL_min((head - tail) - SDL_TRACE_BUFFER_SIZE + 1, count);
+    }
+
+    /* Another thread took the buffer over while we were copying, so we
+       can't tell whose events these are */
+    if (SDL_AtomicGet(&buffer->sequence) != sequence) {
+        i = count;
+    }
+
+    for (; i < count; ++i) {
+        const SDL_TraceEvent *event = &events[i];
+        static const char phases[] = { 'B', 'E', 'C' };
+
+        SDL_IOprintf(io, "%s{\"name\":", *first ? "" : ",\n");
+        SDL_WriteJSONString(io, event->name);
+        SDL_IOprintf(io, ",\"ph\":\"%c\",\"ts\":%" SDL_PRIu64 ".%03d,\"pid\":1,\"tid\":%" SDL_PRIu64,
+                     phases[event->type], event->timestamp / SDL_NS_PER_US, (int)(event->timestamp % SDL_NS_PER_US), thread);
+        if (event->type == SDL_TRACE_EVENT_COUNTER) {
+            SDL_IOprintf(io, ",\"args\":{\"value\":%" SDL_PRIs64 "}", event->value);
+        }
+        SDL_IOprintf(io, "}");
+        *first = SDL_FALSE;
+    }
+}
+
+int SDL_SaveTrace(const char *file)
+{
+    SDL_TraceBuffer *buffer;
+    SDL_TraceEvent *events;
+    SDL_IOStream *io;
+    SDL_bool first = SDL_TRUE;
+
+    if (!file) {
+        return SDL_InvalidParamError("file");
+    }
+
+    events = (SDL_TraceEvent *)SDL_malloc(SDL_TRACE_BUFFER_SIZE * sizeof(*events));
+    if (!events) {
+        return -1;
+    }
+
+    io = SDL_IOFromFile(file, "wb");
+    if (!io) {
+        SDL_free(events);
+        return -1;
+    }
+
+    SDL_IOprintf(io, "{\"traceEvents\":[\n");
+    if (SDL_LockTraceBuffers()) {
+        for (buffer = (SDL_TraceBuffer *)SDL_AtomicGetPtr(&SDL_trace_buffers); buffer; buffer = buffer->next) {
+            SDL_WriteTraceBuffer(io, buffer, events, &first);
+        }
+        SDL_UnlockTraceBuffers();
+    }
+    SDL_IOprintf(io, "\n],\"displayTimeUnit\":\"ms\"}\n");
+
+    SDL_free(events);
+
+    return SDL_CloseIO(io);
+}
+
+void SDL_QuitTrace(void)
+{
+    SDL_TraceBuffer *buffer;
+
+    SDL_trace_enabled = SDL_FALSE;
+    SDL_SetTraceCallback(NULL, NULL);
+
+    /* Keep new events out, and wait for threads still recording one */
+    SDL_AtomicAdd(&SDL_trace_users, SDL_TRACE_USERS_CLOSED);
+    while (SDL_AtomicGet(&SDL_trace_users) != SDL_TRACE_USERS_CLOSED) {
+        SDL_Delay(1);
+    }
+
+    buffer = (SDL_TraceBuffer *)SDL_AtomicSetPtr(&SDL_trace_buffers, NULL);
+    while (buffer) {
+        SDL_TraceBuffer *next = buffer->next;
+        SDL_free(buffer);
+        buffer = next;
+    }
+
+    /* Threads that are still around get a new buffer the next time they
+       record an event, their TLS slots are freed as they exit */
+    SDL_AtomicIncRef(&SDL_trace_generation);
+    SDL_AtomicAdd(&SDL_trace_users, -SDL_TRACE_USERS_CLOSED);
+}
+
+#else
+
+int SDL_SetTraceEnabled(SDL_bool enabled)
+{
+    if (enabled) {
+        return SDL_SetError("SDL not built with tracing support");
+    }
+    return 0;
+}
+
+SDL_bool SDL_IsTraceEnabled(void)
+{
+    return SDL_FALSE;
+}
+
+void SDL_BeginTraceZone(const char *name)
+{
+}
+
+void SDL_EndTraceZone(const char *name)
+{
+}
+
+void SDL_TraceCounter(const char *name, Sint64 value)
+{
+}
+
+void SDL_GetTraceCallback(SDL_TraceCallback *callback, void **userdata)
+{
+    if (callback) {
+        *callback = NULL;
+    }
+    if (userdata) {
+        *userdata = NULL;
+    }
+}
+
+void SDL_SetTraceCallback(SDL_TraceCallback callback, void *userdata)
+{
+}
+
+int SDL_SaveTrace(const char *file)
+{
+    return SDL_SetError("SDL not built with tracing support");
+}
+
+void SDL_QuitTrace(void)
+{
+}
+
+#endif /* SDL_TRACE_DISABLED */
@@ -0,0 +1,91 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+/* This file defines the internal side of SDL_trace.h, and the startup
+   trace, which records where the time goes during SDL_Init(): driver
+   probing, library loading and device enumeration. The startup trace is
+   enabled with SDL_HINT_STARTUP_TRACE. */
+
+#ifndef SDL_trace_c_h_
+#define SDL_trace_c_h_
+
+/* Zones and counters around SDL's own hot paths, these cost a single branch
+   when tracing is disabled at runtime and nothing when it is compiled out. */
+#ifndef SDL_TRACE_DISABLED
+extern SDL_bool SDL_trace_enabled;
+
+#define SDL_TRACE_ZONE_BEGIN(name)          \
+    do {                                    \
+        if (SDL_trace_enabled) {            \
+            SDL_BeginTraceZone(name);       \
+        }                                   \
+    } while (0)
+#define SDL_TRACE_ZONE_END(name)            \
+    do {                                    \
+        if (SDL_trace_enabled) {            \
+            SDL_EndTraceZone(name);         \
+        }                                   \
+    } while (0)
+#define SDL_TRACE_COUNTER(name, value)      \
+    do {                                    \
+        if (SDL_trace_enabled) {            \
+            SDL_TraceCounter(name, value);  \
+        }                                   \
+    } while (0)
+#else
+#define SDL_TRACE_ZONE_BEGIN(name)
+#define SDL_TRACE_ZONE_END(name)
+#define SDL_TRACE_COUNTER(name, value)
+#endif
+
+extern void SDL_QuitTrace(void);
+
+extern SDL_bool SDL_startup_trace_enabled;
+
+extern void SDL_InitStartupTrace(void);
+extern void SDL_FinishStartupTrace(void);
+extern void SDL_FlushStartupTrace(void);
+extern void SDL_QuitStartupTrace(void);
+extern void SDL_AddStartupTraceEvent(const char *category, const char *name, Uint64 start, SDL_bool succeeded);
+
+/* Returns a start time to pass to SDL_EndStartupTrace(), or 0 if tracing is disabled */
+SDL_FORCE_INLINE Uint64 SDL_BeginStartupTrace(void)
+{
+    Uint64 start = 0;
+    if (SDL_startup_trace_enabled) {
+        start = SDL_GetTicksNS();
+        if (!start) {
+            start = 1;
+        }
+    }
+    return start;
+}
+
+/* Records a step that began at start, category should be a string literal */
+SDL_FORCE_INLINE void SDL_EndStartupTrace(Uint64 start, const char *category, const char *name, SDL_bool succeeded)
+{
+    if (start) {
+        SDL_AddStartupTraceEvent(category, name, start, succeeded);
+    }
+}
+
+#endif /* SDL_trace_c_h_ */
@@ -23,6 +23,7 @@
 #include "SDL_audio_c.h"
 #include "SDL_sysaudio.h"
 #include "../thread/SDL_systhread.h"
+#include "../SDL_trace_c.h"
 #include "../SDL_utils_c.h"
 
 // Available audio drivers
@@ -912,7 +913,10 @@ int SDL_InitAudio(const char *driver_name)
                     current_audio.pending_events_tail = &current_audio.pending_events;
                     current_audio.device_hash_lock = device_hash_lock;
                     current_audio.device_hash = device_hash;
-                    if (bootstrap[i]->init(&current_audio.impl)) {
+                    const Uint64 start = SDL_BeginStartupTrace();
+                    const SDL_bool driver_initialized = bootstrap[i]->init(&current_audio.impl);
+                    SDL_EndStartupTrace(start, "audio", bootstrap[i]->name, driver_initialized);
+                    if (driver_initialized) {
                         current_audio.name = bootstrap[i]->name;
                         current_audio.desc = bootstrap[i]->desc;
                         initialized = SDL_TRUE;
@@ -936,7 +940,10 @@ int SDL_InitAudio(const char *driver_name)
             current_audio.pending_events_tail = &current_audio.pending_events;
             current_audio.device_hash_lock = device_hash_lock;
             current_audio.device_hash = device_hash;
-            if (bootstrap[i]->init(&current_audio.impl)) {
+            const Uint64 start = SDL_BeginStartupTrace();
+            const SDL_bool driver_initialized = bootstrap[i]->init(&current_audio.impl);
+            SDL_EndStartupTrace(start, "audio", bootstrap[i]->name, driver_initialized);
+            if (driver_initialized) {
                 current_audio.name = bootstrap[i]->name;
                 current_audio.desc = bootstrap[i]->desc;
                 initialized = SDL_TRUE;
@@ -965,7 +972,9 @@ int SDL_InitAudio(const char *driver_name)
     // Make sure we have a list of devices available at startup...
     SDL_AudioDevice *default_output = NULL;
     SDL_AudioDevice *default_capture = NULL;
+    const Uint64 start = SDL_BeginStartupTrace();
     current_audio.impl.DetectDevices(&default_output, &default_capture);
+    SDL_EndStartupTrace(start, "audio", "DetectDevices", SDL_TRUE);
 
     // If no default was _ever_ specified, just take the first device we see, if any.
     if (!default_output) {
@@ -1060,14 +1069,39 @@ void SDL_OutputAudioThreadSetup(SDL_AudioDevice *device)
     current_audio.impl.ThreadInit(device);
 }
 
+// Record how long the device thread spent on one buffer. This expects the device lock to be held.
+static void UpdateAudioDeviceStats(SDL_AudioDevice *device, int buffer_size, Uint64 start_ns, int silence_frames)
+{
+    SDL_AudioDeviceStats *stats = &device->stats;
+    const Uint64 elapsed = SDL_GetTicksNS() - start_ns;
+    const int frames = buffer_size / SDL_AUDIO_FRAMESIZE(device->spec);
+
+    stats->period_ns = (((Uint64) frames) * SDL_NS_PER_SECOND) / device->spec.freq;
+    if ((stats->periods == 0) || (elapsed < stats->min_mix_ns)) {
+        stats->min_mix_ns = elapsed;
+    }
+    if (elapsed > stats->max_mix_ns) {
+        stats->max_mix_ns = elapsed;
+    }
+    if (elapsed > stats->period_ns) {
+        stats->deadline_misses++;
+    }
+    stats->silence_frames += silence_frames;
+    stats->periods++;
+    device->total_mix_ns += elapsed;
+}
+
 SDL_bool SDL_OutputAudioThreadIterate(SDL_AudioDevice *device)
 {
     SDL_assert(!device->iscapture);
 
+    SDL_TRACE_ZONE_BEGIN("SDL_OutputAudioThreadIterate");
+
     SDL_LockMutex(device->lock);
 
     if (SDL_AtomicGet(&device->shutdown)) {
         SDL_UnlockMutex(device->lock);
+        SDL_TRACE_ZONE_END("SDL_OutputAudioThreadIterate");
         return SDL_FALSE;  // we're done, shut it down.
     }
 
@@ -1082,6 +1116,9 @@ SDL_bool SDL_OutputAudioThreadIterate(SDL_AudioDevice *device)
         SDL_assert(buffer_size <= device->buffer_size);  // you can ask for less, but not more.
         SDL_assert(AudioDeviceCanUseSimpleCopy(device) == device->simple_copy);  // make sure this hasn't gotten out of sync.
 
+        const Uint64 start_ns = SDL_GetTicksNS();
+        int silence_frames = 0;  // sample frames that playing streams couldn't supply.
+
         // can we do a basic copy without silencing/mixing the buffer? This is an extremely likely scenario, so we special-case it.
         if (device->simple_copy) {
             SDL_LogicalAudioDevice *logdev = device->logical_devices;
@@ -1096,6 +1133,9 @@ SDL_bool SDL_OutputAudioThreadIterate(SDL_AudioDevice *device)
                 SDL_memset(device_buffer, device->silence_value, buffer_size);  // just supply silence to the device before we die.
             } else if (br < buffer_size) {
                 SDL_memset(device_buffer + br, device->silence_value, buffer_size - br);  // silence whatever we didn't write to.
+                if (!SDL_AtomicGet(&logdev->paused)) {
+                    silence_frames = (buffer_size - br) / SDL_AUDIO_FRAMESIZE(device->spec);
+                }
             }
         } else {  // need to actually mix (or silence the buffer)
             float *final_mix_buffer = (float *) ((device->spec.format == SDL_AUDIO_F32) ? device_buffer : device->mix_buffer);
@@ -1111,6 +1151,8 @@ SDL_bool SDL_OutputAudioThreadIterate(SDL_AudioDevice *device)
 
             SDL_memset(final_mix_buffer, '\0', work_buffer_size);  // start with silence.
 
+            int most_mixed = -1;  // the most any playing stream supplied, -1 if nothing is playing.
+
             for (SDL_LogicalAudioDevice *logdev = device->logical_devices; logdev; logdev = logdev->next) {
                 if (SDL_AtomicGet(&logdev->paused)) {
                     continue;  // paused? Skip this logical device.
@@ -1138,6 +1180,7 @@ SDL_bool SDL_OutputAudioThreadIterate(SDL_AudioDevice *device)
                     } else if (br > 0) {  // it's okay if we get less than requested, we mix what we have.
                         MixFloat32Audio(mix_buffer, (float *) device->work_buffer, br);
                     }
+                    most_mixed = SDL_max(most_mixed, br);
                 }
 
                 if (postmix) {
@@ -1153,8 +1196,14 @@ SDL_bool SDL_OutputAudioThreadIterate(SDL_AudioDevice *device)
                 ConvertAudio(needed_samples / device->spec.channels, final_mix_buffer, SDL_AUDIO_F32, device->spec.channels, device->work_buffer, device->spec.format, device->spec.channels, NULL);
                 SDL_memcpy(device_buffer, device->work_buffer, buffer_size);
             }
+
+            if (most_mixed >= 0) {
+                silence_frames = (work_buffer_size - most_mixed) / (int) (sizeof (float) * device->spec.channels);
+            }
         }
 
+        UpdateAudioDeviceStats(device, buffer_size, start_ns, silence_frames);
+
         // PlayDevice SHOULD NOT BLOCK, as we are holding a lock right now. Block in WaitDevice instead!
         if (device->PlayDevice(device, device_buffer, buffer_size) < 0) {
             failed = SDL_TRUE;
@@ -1167,6 +1216,8 @@ SDL_bool SDL_OutputAudioThreadIterate(SDL_AudioDevice *device)
         SDL_AudioDeviceDisconnected(device);  // doh.
     }
 
+    SDL_TRACE_ZONE_END("SDL_OutputAudioThreadIterate");
+
     return SDL_TRUE;  // always go on if not shutting down, even if device failed.
 }
 
@@ -1209,14 +1260,45 @@ void SDL_CaptureAudioThreadSetup(SDL_AudioDevice *device)
     current_audio.impl.ThreadInit(device);
 }
 
+// A block of captured audio that is referenced by several bound streams at once, freed when the last one is done with it.
+typedef struct SharedCaptureBuffer
+{
+    SDL_AtomicInt refcount;
+    Uint8 *data;  // points past the header, SIMD-aligned.
+} SharedCaptureBuffer;
+
+static SharedCaptureBuffer *CreateSharedCaptureBuffer(const void *buf, int buflen, int refcount)
+{
+    const size_t alignment = SDL_GetSIMDAlignment();
+    const size_t header_size = SDL_max(alignment, 16);  // big enough for the header, and keeps `data` aligned.
+    SharedCaptureBuffer *shared = (SharedCaptureBuffer *) SDL_aligned_alloc(alignment, header_size + buflen);
+    if (shared) {
+        SDL_AtomicSet(&shared->refcount, refcount);
+        shared->data = ((Uint8 *) shared) + header_size;
+        SDL_memcpy(shared->data, buf, buflen);
+    }
+    return shared;
+}
+
+static void SDLCALL ReleaseSharedCaptureBuffer(void *userdata, const void *buf, int buflen)
+{
+    SharedCaptureBuffer *shared = (SharedCaptureBuffer *) userdata;
+    if (SDL_AtomicDecRef(&shared->refcount)) {
+        SDL_aligned_free(shared);
+    }
+}
+
 SDL_bool SDL_CaptureAudioThreadIterate(SDL_AudioDevice *device)
 {
     SDL_assert(device->iscapture);
 
+    SDL_TRACE_ZONE_BEGIN("SDL_CaptureAudioThreadIterate");
+
     SDL_LockMutex(device->lock);
 
     if (SDL_AtomicGet(&device->shutdown)) {
         SDL_UnlockMutex(device->lock);
+        SDL_TRACE_ZONE_END("SDL_CaptureAudioThreadIterate");
         return SDL_FALSE;  // we're done, shut it down.
     }
 
@@ -1227,6 +1309,8 @@ SDL_bool SDL_CaptureAudioThreadIterate(SDL_AudioDevice *device)
     } else {
         // this SHOULD NOT BLOCK, as we are holding a lock right now. Block in WaitCaptureDevice!
         int br = device->CaptureFromDevice(device, device->work_buffer, device->buffer_size);
+        const Uint64 start_ns = SDL_GetTicksNS();
+        const int captured = br;
         if (br < 0) {  // uhoh, device failed for some reason!
             failed = SDL_TRUE;
         } else if (br > 0) {  // queue the new data to each bound stream.
@@ -1251,6 +1335,18 @@ SDL_bool SDL_CaptureAudioThreadIterate(SDL_AudioDevice *device)
                     logdev->postmix(logdev->postmix_userdata, &outspec, device->postmix_buffer, br);
                 }
 
+                // If more than one stream is bound, publish the buffer once and let every stream reference it,
+                // instead of copying it into each stream's queue. Streams only convert/resample it when read,
+                // and only if their output spec differs from the device's.
+                SharedCaptureBuffer *shared = NULL;
+                if (logdev->bound_streams && logdev->bound_streams->next_binding) {
+                    int num_streams = 0;
+                    for (SDL_AudioStream *stream = logdev->bound_streams; stream; stream = stream->next_binding) {
+                        num_streams++;
+                    }
+                    shared = CreateSharedCaptureBuffer(output_buffer, br, num_streams);  // if this fails, we'll just copy into each stream below.
+                }
+
                 for (SDL_AudioStream *stream = logdev->bound_streams; stream; stream = stream->next_binding) {
                     // We should have updated this elsewhere if the format changed!
                     SDL_assert(stream->src_spec.format == (logdev->postmix ? SDL_AUDIO_F32 : device->spec.format));
@@ -1261,13 +1357,30 @@ SDL_bool SDL_CaptureAudioThreadIterate(SDL_AudioDevice *device)
                        for iterating here because the binding linked list can only change while the device lock is held.
                        (we _do_ lock the stream during binding/unbinding to make sure that two threads can't try to bind
                        the same stream to different devices at the same time, though.) */
-                    if (SDL_PutAudioStreamData(stream, output_buffer, br) < 0) {
+                    int rc;
+                    if (shared) {
+                        rc = PutAudioStreamBuffer(stream, shared->data, br, ReleaseSharedCaptureBuffer, shared);
+                        if (rc < 0) {
+                            ReleaseSharedCaptureBuffer(shared, shared->data, br);  // the stream didn't take its reference.
+                        }
+                    } else {
+                        rc = SDL_PutAudioStreamData(stream, output_buffer, br);
+                    }
+
+                    if (rc < 0) {
                         // oh crud, we probably ran out of memory. This is possibly an overreaction to kill the audio device, but it's likely the whole thing is going down in a moment anyhow.
                         failed = SDL_TRUE;
+                        if (shared) {  // drop the references that the remaining streams won't take.
+                            for (stream = stream->next_binding; stream; stream = stream->next_binding) {
+                                ReleaseSharedCaptureBuffer(shared, shared->data, br);
+                            }
+                        }
                         break;
                     }
                 }
             }
+
+            UpdateAudioDeviceStats(device, captured, start_ns, 0);
         }
     }
 
@@ -1277,6 +1390,8 @@ SDL_bool SDL_CaptureAudioThreadIterate(SDL_AudioDevice *device)
         SDL_AudioDeviceDisconnected(device);  // doh.
     }
 
+    SDL_TRACE_ZONE_END("SDL_CaptureAudioThreadIterate");
+
     return SDL_TRUE;  // always go on if not shutting down, even if device failed.
 }
 
@@ -1435,6 +1550,24 @@ int SDL_GetAudioDeviceFormat(SDL_AudioDeviceID devid, SDL_AudioSpec *spec, int *
     return retval;
 }
 
+int SDL_GetAudioDeviceStats(SDL_AudioDeviceID devid, SDL_AudioDeviceStats *stats)
+{
+    if (!stats) {
+        return SDL_InvalidParamError("stats");
+    }
+
+    int retval = -1;
+    SDL_AudioDevice *device = ObtainPhysicalAudioDevice(devid);
+    if (device) {
+        SDL_copyp(stats, &device->stats);
+        stats->avg_mix_ns = stats->periods ? (device->total_mix_ns / stats->periods) : 0;
+        retval = 0;
+    }
+    ReleaseAudioDevice(device);
+
+    return retval;
+}
+
 // this is awkward, but this makes sure we can release the device lock
 //  so the device thread can terminate but also not have two things
 //  race to close or open the device while the lock is unprotected.
@@ -1608,6 +1741,9 @@ static int OpenPhysicalAudioDevice(SDL_AudioDevice *device, const SDL_AudioSpec
     device->sample_frames = GetDefaultSampleFramesFromFreq(device->spec.freq);
     SDL_UpdatedAudioDeviceFormat(device);  // start this off sane.
 
+    SDL_zero(device->stats);
+    device->total_mix_ns = 0;
+
     device->currently_opened = SDL_TRUE;  // mark this true even if impl.OpenDevice fails, so we know to clean up.
     if (current_audio.impl.OpenDevice(device) < 0) {
         ClosePhysicalAudioDevice(device);  // clean up anything the backend left half-initialized.
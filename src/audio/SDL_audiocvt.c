@@ -24,6 +24,7 @@
 
 #include "SDL_audioqueue.h"
 #include "SDL_audioresample.h"
+#include "../SDL_trace_c.h"
 
 #ifndef SDL_INT_MAX
 #define SDL_INT_MAX ((int)(~0u>>1))
@@ -364,6 +365,21 @@ SDL_PropertiesID SDL_GetAudioStreamProperties(SDL_AudioStream *stream)
     return stream->props;
 }
 
+int SDL_GetAudioStreamStats(SDL_AudioStream *stream, SDL_AudioStreamStats *stats)
+{
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    } else if (!stats) {
+        return SDL_InvalidParamError("stats");
+    }
+
+    SDL_LockMutex(stream->lock);
+    SDL_copyp(stats, &stream->stats);
+    SDL_UnlockMutex(stream->lock);
+
+    return 0;
+}
+
 int SDL_SetAudioStreamGetCallback(SDL_AudioStream *stream, SDL_AudioStreamCallback callback, void *userdata)
 {
     if (!stream) {
@@ -540,7 +556,7 @@ static int CheckAudioStreamIsFullySetup(SDL_AudioStream *stream)
     return 0;
 }
 
-static int PutAudioStreamBuffer(SDL_AudioStream *stream, const void *buf, int len, SDL_ReleaseAudioBufferCallback callback, void* userdata)
+int PutAudioStreamBuffer(SDL_AudioStream *stream, const void *buf, int len, SDL_ReleaseAudioBufferCallback callback, void* userdata)
 {
 #if DEBUG_AUDIOSTREAM
     SDL_Log("AUDIOSTREAM: wants to put %d bytes", len);
@@ -582,7 +598,9 @@ static int PutAudioStreamBuffer(SDL_AudioStream *stream, const void *buf, int le
     if (retval == 0) {
         if (stream->put_callback) {
             const int newavail = SDL_GetAudioStreamAvailable(stream) - prev_available;
+            const Uint64 start_ns = SDL_GetTicksNS();
             stream->put_callback(stream->put_callback_userdata, stream, newavail, newavail);
+            stream->stats.put_callback_ns += SDL_GetTicksNS() - start_ns;
         }
     }
 
@@ -789,9 +807,11 @@ static int GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int ou
             }
         }
 
+        const Uint64 start_ns = SDL_GetTicksNS();
         if (SDL_ReadFromAudioQueue(stream->queue, buf, dst_format, dst_channels, 0, output_frames, 0, work_buffer) != buf) {
             return SDL_SetError("Not enough data in queue");
         }
+        stream->stats.convert_ns += SDL_GetTicksNS() - start_ns;
 
         return 0;
     }
@@ -854,6 +874,7 @@ static int GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int ou
         return -1;
     }
 
+    Uint64 start_ns = SDL_GetTicksNS();
     const Uint8* input_buffer = SDL_ReadFromAudioQueue(stream->queue,
         NULL, resample_format, resample_channels,
         padding_frames, input_frames, padding_frames, work_buffer);
@@ -864,17 +885,34 @@ static int GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int ou
 
     input_buffer += padding_frames * resample_frame_size;
 
+    Uint64 now_ns = SDL_GetTicksNS();
+    stream->stats.convert_ns += now_ns - start_ns;
+    start_ns = now_ns;
+
     // Decide where the resampled output goes
     void* resample_buffer = (resample_buffer_offset != -1) ? (work_buffer + resample_buffer_offset) : buf;
 
+    // Rebuild the phase table if the ratio changed. It stays NULL if the ratio isn't a simple fraction.
+    if (resample_rate != stream->resample_phases_rate) {
+        SDL_DestroyResamplePhases(stream->resample_phases);
+        stream->resample_phases = SDL_CreateResamplePhases(resample_rate);
+        stream->resample_phases_rate = resample_rate;
+    }
+
     SDL_ResampleAudio(resample_channels,
                   (const float *) input_buffer, input_frames,
                   (float*) resample_buffer, output_frames,
-                  resample_rate, &stream->resample_offset);
+                  resample_rate, &stream->resample_offset, stream->resample_phases);
+
+    now_ns = SDL_GetTicksNS();
+    stream->stats.resample_ns += now_ns - start_ns;
+    start_ns = now_ns;
 
     // Convert to the final format, if necessary
     ConvertAudio(output_frames, resample_buffer, resample_format, resample_channels, buf, dst_format, dst_channels, work_buffer);
 
+    stream->stats.convert_ns += SDL_GetTicksNS() - start_ns;
+
     return 0;
 }
 
@@ -897,10 +935,13 @@ int SDL_GetAudioStreamData(SDL_AudioStream *stream, void *voidbuf, int len)
         return 0; // nothing to do.
     }
 
+    SDL_TRACE_ZONE_BEGIN("SDL_GetAudioStreamData");
+
     SDL_LockMutex(stream->lock);
 
     if (CheckAudioStreamIsFullySetup(stream) != 0) {
         SDL_UnlockMutex(stream->lock);
+        SDL_TRACE_ZONE_END("SDL_GetAudioStreamData");
         return -1;
     }
 
@@ -927,7 +968,9 @@ int SDL_GetAudioStreamData(SDL_AudioStream *stream, void *voidbuf, int len)
 
         total_request *= SDL_AUDIO_FRAMESIZE(stream->src_spec);  // convert sample frames to bytes.
         additional_request *= SDL_AUDIO_FRAMESIZE(stream->src_spec);  // convert sample frames to bytes.
+        const Uint64 start_ns = SDL_GetTicksNS();
         stream->get_callback(stream->get_callback_userdata, stream, (int) SDL_min(additional_request, SDL_INT_MAX), (int) SDL_min(total_request, SDL_INT_MAX));
+        stream->stats.get_callback_ns += SDL_GetTicksNS() - start_ns;
     }
 
     // Process the data in chunks to avoid allocating too much memory (and potential integer overflows)
@@ -969,10 +1012,13 @@ int SDL_GetAudioStreamData(SDL_AudioStream *stream, void *voidbuf, int len)
         }
 
         total += output_frames * dst_frame_size;
+        stream->stats.frames_out += output_frames;
     }
 
     SDL_UnlockMutex(stream->lock);
 
+    SDL_TRACE_ZONE_END("SDL_GetAudioStreamData");
+
 #if DEBUG_AUDIOSTREAM
     SDL_Log("AUDIOSTREAM: Final result was %d", total);
 #endif
@@ -1058,6 +1104,7 @@ void SDL_DestroyAudioStream(SDL_AudioStream *stream)
         SDL_UnbindAudioStream(stream);
     }
 
+    SDL_DestroyResamplePhases(stream->resample_phases);
     SDL_aligned_free(stream->work_buffer);
     SDL_DestroyAudioQueue(stream->queue);
     SDL_DestroyMutex(stream->lock);
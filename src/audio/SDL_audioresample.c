@@ -68,17 +68,11 @@ typedef union Cubic
 
 } Cubic;
 
-static void ResampleFrame_Generic(const float *src, float *dst, const Cubic *filter, float frac, int chans)
+// The ResampleFrameTaps functions skip the interpolation, and take the final filter taps directly.
+// They are used as-is for fixed rational rates, where the taps for each phase are precomputed.
+static void ResampleFrameTaps_Generic(const float *src, float *dst, const float *scales, int chans)
 {
-    const float frac2 = frac * frac;
-    const float frac3 = frac * frac2;
-
     int i, chan;
-    float scales[RESAMPLER_SAMPLES_PER_FRAME];
-
-    for (i = 0; i < RESAMPLER_SAMPLES_PER_FRAME; ++i, ++filter) {
-        scales[i] = filter->v[0] + (filter->v[1] * frac) + (filter->v[2] * frac2) + (filter->v[3] * frac3);
-    }
 
     for (chan = 0; chan < chans; ++chan) {
         float out = 0.0f;
@@ -91,6 +85,48 @@ static void ResampleFrame_Generic(const float *src, float *dst, const Cubic *fil
     }
 }
 
+static void ResampleFrameTaps_Mono(const float *src, float *dst, const float *scales, int chans)
+{
+    int i;
+    float out = 0.0f;
+
+    for (i = 0; i < RESAMPLER_SAMPLES_PER_FRAME; ++i) {
+        out += src[i] * scales[i];
+    }
+
+    dst[0] = out;
+}
+
+static void ResampleFrameTaps_Stereo(const float *src, float *dst, const float *scales, int chans)
+{
+    int i;
+    float out0 = 0.0f;
+    float out1 = 0.0f;
+
+    for (i = 0; i < RESAMPLER_SAMPLES_PER_FRAME; ++i) {
+        out0 += src[i * 2 + 0] * scales[i];
+        out1 += src[i * 2 + 1] * scales[i];
+    }
+
+    dst[0] = out0;
+    dst[1] = out1;
+}
+
+static void ResampleFrame_Generic(const float *src, float *dst, const Cubic *filter, float frac, int chans)
+{
+    const float frac2 = frac * frac;
+    const float frac3 = frac * frac2;
+
+    int i;
+    float scales[RESAMPLER_SAMPLES_PER_FRAME];
+
+    for (i = 0; i < RESAMPLER_SAMPLES_PER_FRAME; ++i, ++filter) {
+        scales[i] = filter->v[0] + (filter->v[1] * frac) + (filter->v[2] * frac2) + (filter->v[3] * frac3);
+    }
+
+    ResampleFrameTaps_Generic(src, dst, scales, chans);
+}
+
 static void ResampleFrame_Mono(const float *src, float *dst, const Cubic *filter, float frac, int chans)
 {
     const float frac2 = frac * frac;
@@ -133,34 +169,16 @@ static void ResampleFrame_Stereo(const float *src, float *dst, const Cubic *filt
 #ifdef SDL_SSE_INTRINSICS
 #define sdl_madd_ps(a, b, c) _mm_add_ps(a, _mm_mul_ps(b, c)) // Not-so-fused multiply-add
 
-static void SDL_TARGETING("sse") ResampleFrame_Generic_SSE(const float *src, float *dst, const Cubic *filter, float frac, int chans)
+SDL_FORCE_INLINE void SDL_TARGETING("sse") ResampleFrameTaps_SSE_Inline(const float *src, float *dst, const float *scales, int chans)
 {
 #if RESAMPLER_SAMPLES_PER_FRAME != 12
 #error Invalid samples per frame
 #endif
 
-    __m128 f0, f1, f2;
-
-    {
-        const __m128 frac1 = _mm_set1_ps(frac);
-        const __m128 frac2 = _mm_mul_ps(frac1, frac1);
-        const __m128 frac3 = _mm_mul_ps(frac1, frac2);
-
-// Transposed in SetupAudioResampler
-// Explicitly use _mm_load_ps to workaround ICE in GCC 4.9.4 accessing Cubic.v128
-#define X(out)                                               \
-    out = _mm_load_ps(filter[0].v);                          \
-    out = sdl_madd_ps(out, frac1, _mm_load_ps(filter[1].v)); \
-    out = sdl_madd_ps(out, frac2, _mm_load_ps(filter[2].v)); \
-    out = sdl_madd_ps(out, frac3, _mm_load_ps(filter[3].v)); \
-    filter += 4
-
-        X(f0);
-        X(f1);
-        X(f2);
-
-#undef X
-    }
+    // `scales` must be 16-byte aligned
+    const __m128 f0 = _mm_load_ps(scales + 0);
+    const __m128 f1 = _mm_load_ps(scales + 4);
+    const __m128 f2 = _mm_load_ps(scales + 8);
 
     if (chans == 2) {
         // Duplicate each of the filter elements and multiply by the input
@@ -261,35 +279,55 @@ static void SDL_TARGETING("sse") ResampleFrame_Generic_SSE(const float *src, flo
     }
 }
 
-#undef sdl_madd_ps
-#endif
-
-#ifdef SDL_NEON_INTRINSICS
-static void ResampleFrame_Generic_NEON(const float *src, float *dst, const Cubic *filter, float frac, int chans)
+static void SDL_TARGETING("sse") ResampleFrameTaps_SSE(const float *src, float *dst, const float *scales, int chans)
 {
-#if RESAMPLER_SAMPLES_PER_FRAME != 12
-#error Invalid samples per frame
-#endif
+    ResampleFrameTaps_SSE_Inline(src, dst, scales, chans);
+}
 
-    float32x4_t f0, f1, f2;
+static void SDL_TARGETING("sse") ResampleFrame_Generic_SSE(const float *src, float *dst, const Cubic *filter, float frac, int chans)
+{
+    Cubic scales[RESAMPLER_SAMPLES_PER_FRAME / 4];
 
     {
-        const float32x4_t frac1 = vdupq_n_f32(frac);
-        const float32x4_t frac2 = vmulq_f32(frac1, frac1);
-        const float32x4_t frac3 = vmulq_f32(frac1, frac2);
+        const __m128 frac1 = _mm_set1_ps(frac);
+        const __m128 frac2 = _mm_mul_ps(frac1, frac1);
+        const __m128 frac3 = _mm_mul_ps(frac1, frac2);
+        __m128 out;
 
 // Transposed in SetupAudioResampler
-#define X(out)                                                                                                                  \
-    out = vmlaq_f32(vmlaq_f32(vmlaq_f32(filter[0].v128, filter[1].v128, frac1), filter[2].v128, frac2), filter[3].v128, frac3); \
+// Explicitly use _mm_load_ps to workaround ICE in GCC 4.9.4 accessing Cubic.v128
+#define X(i)                                                 \
+    out = _mm_load_ps(filter[0].v);                          \
+    out = sdl_madd_ps(out, frac1, _mm_load_ps(filter[1].v)); \
+    out = sdl_madd_ps(out, frac2, _mm_load_ps(filter[2].v)); \
+    out = sdl_madd_ps(out, frac3, _mm_load_ps(filter[3].v)); \
+    _mm_store_ps(scales[i].v, out);                          \
     filter += 4
 
-        X(f0);
-        X(f1);
-        X(f2);
+        X(0);
+        X(1);
+        X(2);
 
 #undef X
     }
 
+    ResampleFrameTaps_SSE_Inline(src, dst, scales[0].v, chans);
+}
+
+#undef sdl_madd_ps
+#endif
+
+#ifdef SDL_NEON_INTRINSICS
+SDL_FORCE_INLINE void ResampleFrameTaps_NEON_Inline(const float *src, float *dst, const float *scales, int chans)
+{
+#if RESAMPLER_SAMPLES_PER_FRAME != 12
+#error Invalid samples per frame
+#endif
+
+    const float32x4_t f0 = vld1q_f32(scales + 0);
+    const float32x4_t f1 = vld1q_f32(scales + 4);
+    const float32x4_t f2 = vld1q_f32(scales + 8);
+
     if (chans == 2) {
         float32x4x2_t g0 = vzipq_f32(f0, f0);
         float32x4x2_t g1 = vzipq_f32(f1, f1);
@@ -393,6 +431,34 @@ static void ResampleFrame_Generic_NEON(const float *src, float *dst, const Cubic
         vst1_lane_f32(&dst[chan], sum, 0);
     }
 }
+static void ResampleFrameTaps_NEON(const float *src, float *dst, const float *scales, int chans)
+{
+    ResampleFrameTaps_NEON_Inline(src, dst, scales, chans);
+}
+
+static void ResampleFrame_Generic_NEON(const float *src, float *dst, const Cubic *filter, float frac, int chans)
+{
+    Cubic scales[RESAMPLER_SAMPLES_PER_FRAME / 4];
+
+    {
+        const float32x4_t frac1 = vdupq_n_f32(frac);
+        const float32x4_t frac2 = vmulq_f32(frac1, frac1);
+        const float32x4_t frac3 = vmulq_f32(frac1, frac2);
+
+// Transposed in SetupAudioResampler
+#define X(i)                                                                                                                               \
+    scales[i].v128 = vmlaq_f32(vmlaq_f32(vmlaq_f32(filter[0].v128, filter[1].v128, frac1), filter[2].v128, frac2), filter[3].v128, frac3); \
+    filter += 4
+
+        X(0);
+        X(1);
+        X(2);
+
+#undef X
+    }
+
+    ResampleFrameTaps_NEON_Inline(src, dst, scales[0].v, chans);
+}
 #endif
 
 // Calculate the cubic equation which passes through all four points.
@@ -516,6 +582,12 @@ static void GenerateResamplerFilter()
 typedef void (*ResampleFrameFunc)(const float *src, float *dst, const Cubic *filter, float frac, int chans);
 static ResampleFrameFunc ResampleFrame[8];
 
+typedef void (*ResampleFrameTapsFunc)(const float *src, float *dst, const float *scales, int chans);
+static ResampleFrameTapsFunc ResampleFrameTaps[8];
+
+// SDL_TRUE if each group of 4 Cubics in ResamplerFilter has been transposed for SIMD.
+static SDL_bool ResamplerFilterTransposed = SDL_FALSE;
+
 // Transpose 4x4 floats
 static void Transpose4x4(Cubic *data)
 {
@@ -541,6 +613,7 @@ static void SetupAudioResampler(void)
     if (SDL_HasSSE()) {
         for (i = 0; i < 8; ++i) {
             ResampleFrame[i] = ResampleFrame_Generic_SSE;
+            ResampleFrameTaps[i] = ResampleFrameTaps_SSE;
         }
         transpose = SDL_TRUE;
     } else
@@ -549,6 +622,7 @@ static void SetupAudioResampler(void)
     if (SDL_HasNEON()) {
         for (i = 0; i < 8; ++i) {
             ResampleFrame[i] = ResampleFrame_Generic_NEON;
+            ResampleFrameTaps[i] = ResampleFrameTaps_NEON;
         }
         transpose = SDL_TRUE;
     } else
@@ -556,10 +630,13 @@ static void SetupAudioResampler(void)
     {
         for (i = 0; i < 8; ++i) {
             ResampleFrame[i] = ResampleFrame_Generic;
+            ResampleFrameTaps[i] = ResampleFrameTaps_Generic;
         }
 
         ResampleFrame[0] = ResampleFrame_Mono;
         ResampleFrame[1] = ResampleFrame_Stereo;
+        ResampleFrameTaps[0] = ResampleFrameTaps_Mono;
+        ResampleFrameTaps[1] = ResampleFrameTaps_Stereo;
     }
 
     if (transpose) {
@@ -570,6 +647,8 @@ static void SetupAudioResampler(void)
             }
         }
     }
+
+    ResamplerFilterTransposed = transpose;
 }
 
 void SDL_SetupAudioResampler(void)
@@ -669,8 +748,154 @@ Sint64 SDL_GetResamplerOutputFrames(Sint64 input_frames, Sint64 resample_rate, S
     return output_frames;
 }
 
+// Largest denominator worth precomputing. This covers every pair of the common rates
+// (8000, 11025, 16000, 22050, 32000, 44100, 48000, 88200, 96000...), e.g. 11025->48000 is 147:640.
+#define RESAMPLER_MAX_PHASES 640
+
+struct SDL_ResamplePhases
+{
+    int num_phases; // q: the number of distinct output phases
+    int step;       // p: input frames advanced per output frame, in units of 1/q
+    float *taps;    // RESAMPLER_SAMPLES_PER_FRAME taps for each phase
+};
+
+// Evaluate the interpolated filter at `srcfraction`, the same way the ResampleFrame functions do.
+static void CalculateResamplerTaps(Uint32 srcfraction, float *taps)
+{
+    const Cubic *filter = ResamplerFilter[srcfraction >> RESAMPLER_FILTER_INTERP_BITS];
+    const float frac = (float)(srcfraction & (RESAMPLER_FILTER_INTERP_RANGE - 1)) * (1.0f / RESAMPLER_FILTER_INTERP_RANGE);
+    const float frac2 = frac * frac;
+    const float frac3 = frac * frac2;
+    int i;
+
+    for (i = 0; i < RESAMPLER_SAMPLES_PER_FRAME; ++i) {
+        const float *v;
+
+        if (ResamplerFilterTransposed) {
+            // Each group of 4 Cubics holds coefficient j for all 4 taps
+            const Cubic *group = &filter[i & ~3];
+            float c[4];
+            int j;
+            for (j = 0; j < 4; ++j) {
+                c[j] = group[j].v[i & 3];
+            }
+            taps[i] = c[0] + (c[1] * frac) + (c[2] * frac2) + (c[3] * frac3);
+            continue;
+        }
+
+        v = filter[i].v;
+        taps[i] = v[0] + (v[1] * frac) + (v[2] * frac2) + (v[3] * frac3);
+    }
+}
+
+SDL_ResamplePhases *SDL_CreateResamplePhases(Sint64 resample_rate)
+{
+    SDL_ResamplePhases *phases;
+    Sint64 step = 0;
+    int num_phases;
+    int i;
+
+    SDL_assert(resample_rate > 0);
+
+    // SDL_GetResampleRate truncates (src << 32) / dst, so look for the smallest q where that is reproduced exactly.
+    for (num_phases = 1; num_phases <= RESAMPLER_MAX_PHASES; ++num_phases) {
+        step = (Sint64)(((Uint64)resample_rate * num_phases + 0x80000000) >> 32);
+
+        if ((step > 0) && (step < 0x40000000) && (((step << 32) / num_phases) == resample_rate)) {
+            break;
+        }
+    }
+
+    if (num_phases > RESAMPLER_MAX_PHASES) {
+        return NULL;
+    }
+
+    SDL_SetupAudioResampler();
+
+    phases = (SDL_ResamplePhases *)SDL_malloc(sizeof(*phases));
+    if (!phases) {
+        return NULL;
+    }
+
+    // Each row is 48 bytes, so every row stays aligned for the SIMD paths.
+    phases->taps = (float *)SDL_aligned_alloc(SDL_GetSIMDAlignment(), (size_t)num_phases * RESAMPLER_SAMPLES_PER_FRAME * sizeof(float));
+    if (!phases->taps) {
+        SDL_free(phases);
+        return NULL;
+    }
+
+    phases->num_phases = num_phases;
+    phases->step = (int)step;
+
+    for (i = 0; i < num_phases; ++i) {
+        const Uint32 srcfraction = (Uint32)(((Uint64)i << 32) / (Uint64)num_phases);
+        CalculateResamplerTaps(srcfraction, &phases->taps[i * RESAMPLER_SAMPLES_PER_FRAME]);
+    }
+
+    return phases;
+}
+
+void SDL_DestroyResamplePhases(SDL_ResamplePhases *phases)
+{
+    if (phases) {
+        SDL_aligned_free(phases->taps);
+        SDL_free(phases);
+    }
+}
+
+static void ResampleAudioPhases(int chans, const float *src, int inframes, float *dst, int outframes,
+                                const SDL_ResamplePhases *phases, Sint64 *inout_resample_offset)
+{
+    const Sint64 num_phases = phases->num_phases;
+    const int step_frames = (int)(phases->step / num_phases);
+    const int step_phase = (int)(phases->step % num_phases);
+    const Sint64 resample_offset = *inout_resample_offset;
+    ResampleFrameTapsFunc resample_frame = ResampleFrameTaps[chans - 1];
+    int srcindex = (int)(Sint32)(resample_offset >> 32);
+    int phase;
+    int i;
+
+    // Find the phase the offset was left at. It is normally exact (see below), but if the rate
+    // was changed mid-stream it might not be, in which case just snap down to the previous phase.
+    {
+        const Sint64 scaled = (Sint64)(resample_offset & 0xFFFFFFFF) * num_phases;
+        const Sint64 error = scaled - (((scaled + 0x80000000) >> 32) << 32);
+        phase = (int)((scaled + 0x80000000) >> 32);
+
+        if ((error > num_phases) || (error < -num_phases)) {
+            phase = (int)(scaled >> 32);
+        }
+
+        if (phase == num_phases) {
+            phase = 0;
+            ++srcindex;
+        }
+    }
+
+    src -= (RESAMPLER_ZERO_CROSSINGS - 1) * chans;
+
+    for (i = 0; i < outframes; ++i) {
+        // The precise position can land one frame later than the truncated 32:32 one
+        SDL_assert(srcindex >= -2 && srcindex <= inframes);
+
+        resample_frame(&src[srcindex * chans], dst, &phases->taps[phase * RESAMPLER_SAMPLES_PER_FRAME], chans);
+        dst += chans;
+
+        srcindex += step_frames;
+        phase += step_phase;
+
+        if (phase >= num_phases) {
+            phase -= (int)num_phases;
+            ++srcindex;
+        }
+    }
+
+    // Round to the nearest 32:32 position, so the phase can be recovered exactly next time.
+    *inout_resample_offset = ((Sint64)(srcindex - inframes) << 32) + (Sint64)((((Uint64)phase << 32) + (num_phases / 2)) / num_phases);
+}
+
 void SDL_ResampleAudio(int chans, const float *src, int inframes, float *dst, int outframes,
-                       Sint64 resample_rate, Sint64 *inout_resample_offset)
+                       Sint64 resample_rate, Sint64 *inout_resample_offset, const SDL_ResamplePhases *phases)
 {
     int i;
     Sint64 srcpos = *inout_resample_offset;
@@ -678,6 +903,11 @@ void SDL_ResampleAudio(int chans, const float *src, int inframes, float *dst, in
 
     SDL_assert(resample_rate > 0);
 
+    if (phases) {
+        ResampleAudioPhases(chans, src, inframes, dst, outframes, phases, inout_resample_offset);
+        return;
+    }
+
     src -= (RESAMPLER_ZERO_CROSSINGS - 1) * chans;
 
     for (i = 0; i < outframes; ++i) {
@@ -34,10 +34,18 @@ int SDL_GetResamplerPaddingFrames(Sint64 resample_rate);
 Sint64 SDL_GetResamplerInputFrames(Sint64 output_frames, Sint64 resample_rate, Sint64 resample_offset);
 Sint64 SDL_GetResamplerOutputFrames(Sint64 input_frames, Sint64 resample_rate, Sint64 *inout_resample_offset);
 
+// Precomputed filter taps for each output phase of a fixed rational resample rate (such as 44100->48000, 147:160).
+typedef struct SDL_ResamplePhases SDL_ResamplePhases;
+
+// Returns NULL if `resample_rate` isn't a ratio with a small enough denominator to be worth it (or on failure).
+SDL_ResamplePhases *SDL_CreateResamplePhases(Sint64 resample_rate);
+void SDL_DestroyResamplePhases(SDL_ResamplePhases *phases);
+
 // Resample some audio.
+// If `phases` is non-NULL, it must have been created for `resample_rate`.
 // REQUIRES: `inframes >= SDL_GetResamplerInputFrames(outframes)`
 // REQUIRES: At least `SDL_GetResamplerPaddingFrames(...)` extra frames to the left of src, and right of src+inframes
 void SDL_ResampleAudio(int chans, const float *src, int inframes, float *dst, int outframes,
-                       Sint64 resample_rate, Sint64 *inout_resample_offset);
+                       Sint64 resample_rate, Sint64 *inout_resample_offset, const SDL_ResamplePhases *phases);
 
 #endif // SDL_audioresample_h_
@@ -526,6 +526,526 @@ static void SDL_TARGETING("ssse3") SDL_Convert_Swap32_SSSE3(Uint32* dst, const U
 }
 #endif
 
+// Convert forwards, when sizeof(*src) >= sizeof(*dst), 32 samples at a time
+#define CONVERT_32_FWD(CVT1, CVT32)                          \
+    int i = 0;                                               \
+    if (num_samples >= 32) {                                 \
+        while ((uintptr_t)(&dst[i]) & 31) { CVT1  ++i;     } \
+        while ((i + 32) <= num_samples)   { CVT32 i += 32; } \
+    }                                                        \
+    while (i < num_samples)               { CVT1  ++i;     }
+
+// Convert backwards, when sizeof(*src) <= sizeof(*dst), 32 samples at a time
+#define CONVERT_32_REV(CVT1, CVT32)                          \
+    int i = num_samples;                                     \
+    if (i >= 32) {                                           \
+        while ((uintptr_t)(&dst[i]) & 31) { --i;     CVT1  } \
+        while (i >= 32)                   { i -= 32; CVT32 } \
+    }                                                        \
+    while (i > 0)                         { --i;     CVT1  }
+
+#ifdef SDL_AVX2_INTRINSICS
+/* These produce exactly the same results as the scalar converters: the F32 to integer
+   conversions clamp in the float domain and then round (or truncate, for S32) the same
+   way the scalar bit tricks do, so there's no dithering and no wraparound on overflow. */
+
+static void SDL_TARGETING("avx2") SDL_Convert_S8_to_F32_AVX2(float *dst, const Sint8 *src, int num_samples)
+{
+    // dst[i] = i2f((src[i] ^ 0x80) | 0x47800000) - 65537.0
+    const __m256i caster = _mm256_set1_epi32(0x47800080);
+    const __m256 offset = _mm256_set1_ps(-65537.0f);
+
+    LOG_DEBUG_AUDIO_CONVERT("S8", "F32 (using AVX2)");
+
+    CONVERT_32_REV({
+        SDL_Convert_S8_to_F32_Scalar(&dst[i], &src[i], 1);
+    }, {
+        const __m128i bytes0 = _mm_loadl_epi64((const __m128i *)&src[i]);
+        const __m128i bytes1 = _mm_loadl_epi64((const __m128i *)&src[i + 8]);
+        const __m128i bytes2 = _mm_loadl_epi64((const __m128i *)&src[i + 16]);
+        const __m128i bytes3 = _mm_loadl_epi64((const __m128i *)&src[i + 24]);
+
+        const __m256 floats0 = _mm256_add_ps(_mm256_castsi256_ps(_mm256_xor_si256(_mm256_cvtepu8_epi32(bytes0), caster)), offset);
+        const __m256 floats1 = _mm256_add_ps(_mm256_castsi256_ps(_mm256_xor_si256(_mm256_cvtepu8_epi32(bytes1), caster)), offset);
+        const __m256 floats2 = _mm256_add_ps(_mm256_castsi256_ps(_mm256_xor_si256(_mm256_cvtepu8_epi32(bytes2), caster)), offset);
+        const __m256 floats3 = _mm256_add_ps(_mm256_castsi256_ps(_mm256_xor_si256(_mm256_cvtepu8_epi32(bytes3), caster)), offset);
+
+        _mm256_store_ps(&dst[i], floats0);
+        _mm256_store_ps(&dst[i + 8], floats1);
+        _mm256_store_ps(&dst[i + 16], floats2);
+        _mm256_store_ps(&dst[i + 24], floats3);
+    })
+}
+
+static void SDL_TARGETING("avx2") SDL_Convert_U8_to_F32_AVX2(float *dst, const Uint8 *src, int num_samples)
+{
+    // dst[i] = i2f(src[i] | 0x47800000) - 65537.0
+    const __m256i caster = _mm256_set1_epi32(0x47800000);
+    const __m256 offset = _mm256_set1_ps(-65537.0f);
+
+    LOG_DEBUG_AUDIO_CONVERT("U8", "F32 (using AVX2)");
+
+    CONVERT_32_REV({
+        SDL_Convert_U8_to_F32_Scalar(&dst[i], &src[i], 1);
+    }, {
+        const __m128i bytes0 = _mm_loadl_epi64((const __m128i *)&src[i]);
+        const __m128i bytes1 = _mm_loadl_epi64((const __m128i *)&src[i + 8]);
+        const __m128i bytes2 = _mm_loadl_epi64((const __m128i *)&src[i + 16]);
+        const __m128i bytes3 = _mm_loadl_epi64((const __m128i *)&src[i + 24]);
+
+        const __m256 floats0 = _mm256_add_ps(_mm256_castsi256_ps(_mm256_or_si256(_mm256_cvtepu8_epi32(bytes0), caster)), offset);
+        const __m256 floats1 = _mm256_add_ps(_mm256_castsi256_ps(_mm256_or_si256(_mm256_cvtepu8_epi32(bytes1), caster)), offset);
+        const __m256 floats2 = _mm256_add_ps(_mm256_castsi256_ps(_mm256_or_si256(_mm256_cvtepu8_epi32(bytes2), caster)), offset);
+        const __m256 floats3 = _mm256_add_ps(_mm256_castsi256_ps(_mm256_or_si256(_mm256_cvtepu8_epi32(bytes3), caster)), offset);
+
+        _mm256_store_ps(&dst[i], floats0);
+        _mm256_store_ps(&dst[i + 8], floats1);
+        _mm256_store_ps(&dst[i + 16], floats2);
+        _mm256_store_ps(&dst[i + 24], floats3);
+    })
+}
+
+// S16 (optionally byteswapped first) to F32: dst[i] = i2f((src[i] ^ 0x8000) | 0x43800000) - 257.0
+#define S16_TO_F32_AVX2(SWAP)                                                                                          \
+    const __m128i shuffle = _mm_set_epi8(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1);                      \
+    const __m256i caster = _mm256_set1_epi32(0x43808000);                                                              \
+    const __m256 offset = _mm256_set1_ps(-257.0f);                                                                     \
+    CONVERT_32_REV({                                                                                                   \
+        Sint16 sample = src[i];                                                                                        \
+        if (SWAP) {                                                                                                    \
+            sample = (Sint16)SDL_Swap16((Uint16)sample);                                                               \
+        }                                                                                                              \
+        SDL_Convert_S16_to_F32_Scalar(&dst[i], &sample, 1);                                                            \
+    }, {                                                                                                               \
+        __m128i shorts0 = _mm_loadu_si128((const __m128i *)&src[i]);                                                   \
+        __m128i shorts1 = _mm_loadu_si128((const __m128i *)&src[i + 8]);                                               \
+        __m128i shorts2 = _mm_loadu_si128((const __m128i *)&src[i + 16]);                                              \
+        __m128i shorts3 = _mm_loadu_si128((const __m128i *)&src[i + 24]);                                              \
+        if (SWAP) {                                                                                                    \
+            shorts0 = _mm_shuffle_epi8(shorts0, shuffle);                                                              \
+            shorts1 = _mm_shuffle_epi8(shorts1, shuffle);                                                              \
+            shorts2 = _mm_shuffle_epi8(shorts2, shuffle);                                                              \
+            shorts3 = _mm_shuffle_epi8(shorts3, shuffle);                                                              \
+        }                                                                                                              \
+        const __m256 floats0 = _mm256_add_ps(_mm256_castsi256_ps(_mm256_xor_si256(_mm256_cvtepu16_epi32(shorts0), caster)), offset); \
+        const __m256 floats1 = _mm256_add_ps(_mm256_castsi256_ps(_mm256_xor_si256(_mm256_cvtepu16_epi32(shorts1), caster)), offset); \
+        const __m256 floats2 = _mm256_add_ps(_mm256_castsi256_ps(_mm256_xor_si256(_mm256_cvtepu16_epi32(shorts2), caster)), offset); \
+        const __m256 floats3 = _mm256_add_ps(_mm256_castsi256_ps(_mm256_xor_si256(_mm256_cvtepu16_epi32(shorts3), caster)), offset); \
+        _mm256_store_ps(&dst[i], floats0);                                                                             \
+        _mm256_store_ps(&dst[i + 8], floats1);                                                                         \
+        _mm256_store_ps(&dst[i + 16], floats2);                                                                        \
+        _mm256_store_ps(&dst[i + 24], floats3);                                                                        \
+    })
+
+static void SDL_TARGETING("avx2") SDL_Convert_S16_to_F32_AVX2(float *dst, const Sint16 *src, int num_samples)
+{
+    LOG_DEBUG_AUDIO_CONVERT("S16", "F32 (using AVX2)");
+    S16_TO_F32_AVX2(0)
+}
+
+static void SDL_TARGETING("avx2") SDL_Convert_S16_Swapped_to_F32_AVX2(float *dst, const Sint16 *src, int num_samples)
+{
+    LOG_DEBUG_AUDIO_CONVERT("S16 (swapped)", "F32 (using AVX2)");
+    S16_TO_F32_AVX2(1)
+}
+
+#undef S16_TO_F32_AVX2
+
+// S32 (optionally byteswapped first) to F32: dst[i] = f32(src[i]) / f32(0x80000000)
+#define S32_TO_F32_AVX2(SWAP)                                                                                          \
+    const __m256i shuffle = _mm256_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3,                      \
+                                            12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);                     \
+    const __m256 scaler = _mm256_set1_ps(DIVBY2147483648);                                                             \
+    CONVERT_32_FWD({                                                                                                   \
+        Sint32 sample = src[i];                                                                                        \
+        if (SWAP) {                                                                                                    \
+            sample = (Sint32)SDL_Swap32((Uint32)sample);                                                               \
+        }                                                                                                              \
+        SDL_Convert_S32_to_F32_Scalar(&dst[i], &sample, 1);                                                            \
+    }, {                                                                                                               \
+        __m256i ints0 = _mm256_loadu_si256((const __m256i *)&src[i]);                                                  \
+        __m256i ints1 = _mm256_loadu_si256((const __m256i *)&src[i + 8]);                                              \
+        __m256i ints2 = _mm256_loadu_si256((const __m256i *)&src[i + 16]);                                             \
+        __m256i ints3 = _mm256_loadu_si256((const __m256i *)&src[i + 24]);                                             \
+        if (SWAP) {                                                                                                    \
+            ints0 = _mm256_shuffle_epi8(ints0, shuffle);                                                               \
+            ints1 = _mm256_shuffle_epi8(ints1, shuffle);                                                               \
+            ints2 = _mm256_shuffle_epi8(ints2, shuffle);                                                               \
+            ints3 = _mm256_shuffle_epi8(ints3, shuffle);                                                               \
+        }                                                                                                              \
+        _mm256_store_ps(&dst[i], _mm256_mul_ps(_mm256_cvtepi32_ps(ints0), scaler));                                    \
+        _mm256_store_ps(&dst[i + 8], _mm256_mul_ps(_mm256_cvtepi32_ps(ints1), scaler));                                \
+        _mm256_store_ps(&dst[i + 16], _mm256_mul_ps(_mm256_cvtepi32_ps(ints2), scaler));                               \
+        _mm256_store_ps(&dst[i + 24], _mm256_mul_ps(_mm256_cvtepi32_ps(ints3), scaler));                               \
+    })
+
+static void SDL_TARGETING("avx2") SDL_Convert_S32_to_F32_AVX2(float *dst, const Sint32 *src, int num_samples)
+{
+    LOG_DEBUG_AUDIO_CONVERT("S32", "F32 (using AVX2)");
+    S32_TO_F32_AVX2(0)
+}
+
+static void SDL_TARGETING("avx2") SDL_Convert_S32_Swapped_to_F32_AVX2(float *dst, const Sint32 *src, int num_samples)
+{
+    LOG_DEBUG_AUDIO_CONVERT("S32 (swapped)", "F32 (using AVX2)");
+    S32_TO_F32_AVX2(1)
+}
+
+#undef S32_TO_F32_AVX2
+
+static void SDL_TARGETING("avx2") SDL_Convert_F32_to_S8_AVX2(Sint8 *dst, const float *src, int num_samples)
+{
+    // dst[i] = round(clamp(src[i] * 128.0, -128.0, 127.0))
+    const __m256 scaler = _mm256_set1_ps(128.0f);
+    const __m256 minval = _mm256_set1_ps(-128.0f);
+    const __m256 maxval = _mm256_set1_ps(127.0f);
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+    LOG_DEBUG_AUDIO_CONVERT("F32", "S8 (using AVX2)");
+
+    CONVERT_32_FWD({
+        SDL_Convert_F32_to_S8_Scalar(&dst[i], &src[i], 1);
+    }, {
+        const __m256i ints0 = _mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_loadu_ps(&src[i]), scaler), minval), maxval));
+        const __m256i ints1 = _mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_loadu_ps(&src[i + 8]), scaler), minval), maxval));
+        const __m256i ints2 = _mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_loadu_ps(&src[i + 16]), scaler), minval), maxval));
+        const __m256i ints3 = _mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_loadu_ps(&src[i + 24]), scaler), minval), maxval));
+
+        // packing works within 128-bit lanes, so put the 32-bit groups back in order afterwards.
+        const __m256i shorts0 = _mm256_packs_epi32(ints0, ints1);
+        const __m256i shorts1 = _mm256_packs_epi32(ints2, ints3);
+        const __m256i bytes = _mm256_permutevar8x32_epi32(_mm256_packs_epi16(shorts0, shorts1), order);
+
+        _mm256_store_si256((__m256i *)&dst[i], bytes);
+    })
+}
+
+static void SDL_TARGETING("avx2") SDL_Convert_F32_to_U8_AVX2(Uint8 *dst, const float *src, int num_samples)
+{
+    // dst[i] = round(clamp(src[i] * 128.0, -128.0, 127.0)) + 128
+    const __m256 scaler = _mm256_set1_ps(128.0f);
+    const __m256 minval = _mm256_set1_ps(-128.0f);
+    const __m256 maxval = _mm256_set1_ps(127.0f);
+    const __m256i bias = _mm256_set1_epi32(128);
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+    LOG_DEBUG_AUDIO_CONVERT("F32", "U8 (using AVX2)");
+
+    CONVERT_32_FWD({
+        SDL_Convert_F32_to_U8_Scalar(&dst[i], &src[i], 1);
+    }, {
+        const __m256i ints0 = _mm256_add_epi32(_mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_loadu_ps(&src[i]), scaler), minval), maxval)), bias);
+        const __m256i ints1 = _mm256_add_epi32(_mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_loadu_ps(&src[i + 8]), scaler), minval), maxval)), bias);
+        const __m256i ints2 = _mm256_add_epi32(_mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_loadu_ps(&src[i + 16]), scaler), minval), maxval)), bias);
+        const __m256i ints3 = _mm256_add_epi32(_mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_loadu_ps(&src[i + 24]), scaler), minval), maxval)), bias);
+
+        const __m256i shorts0 = _mm256_packs_epi32(ints0, ints1);
+        const __m256i shorts1 = _mm256_packs_epi32(ints2, ints3);
+        const __m256i bytes = _mm256_permutevar8x32_epi32(_mm256_packus_epi16(shorts0, shorts1), order);
+
+        _mm256_store_si256((__m256i *)&dst[i], bytes);
+    })
+}
+
+// F32 to S16 (optionally byteswapped afterwards): dst[i] = round(clamp(src[i] * 32768.0, -32768.0, 32767.0))
+#define F32_TO_S16_AVX2(SWAP)                                                                                          \
+    const __m256i shuffle = _mm256_set_epi8(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1,                      \
+                                            14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1);                     \
+    const __m256 scaler = _mm256_set1_ps(32768.0f);                                                                    \
+    const __m256 minval = _mm256_set1_ps(-32768.0f);                                                                   \
+    const __m256 maxval = _mm256_set1_ps(32767.0f);                                                                    \
+    CONVERT_32_FWD({                                                                                                   \
+        SDL_Convert_F32_to_S16_Scalar(&dst[i], &src[i], 1);                                                            \
+        if (SWAP) {                                                                                                    \
+            dst[i] = (Sint16)SDL_Swap16((Uint16)dst[i]);                                                               \
+        }                                                                                                              \
+    }, {                                                                                                               \
+        const __m256i ints0 = _mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_loadu_ps(&src[i]), scaler), minval), maxval));      \
+        const __m256i ints1 = _mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_loadu_ps(&src[i + 8]), scaler), minval), maxval));  \
+        const __m256i ints2 = _mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_loadu_ps(&src[i + 16]), scaler), minval), maxval)); \
+        const __m256i ints3 = _mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_loadu_ps(&src[i + 24]), scaler), minval), maxval)); \
+        __m256i shorts0 = _mm256_permute4x64_epi64(_mm256_packs_epi32(ints0, ints1), _MM_SHUFFLE(3, 1, 2, 0));        \
+        __m256i shorts1 = _mm256_permute4x64_epi64(_mm256_packs_epi32(ints2, ints3), _MM_SHUFFLE(3, 1, 2, 0));        \
+        if (SWAP) {                                                                                                    \
+            shorts0 = _mm256_shuffle_epi8(shorts0, shuffle);                                                           \
+            shorts1 = _mm256_shuffle_epi8(shorts1, shuffle);                                                           \
+        }                                                                                                              \
+        _mm256_store_si256((__m256i *)&dst[i], shorts0);                                                               \
+        _mm256_store_si256((__m256i *)&dst[i + 16], shorts1);                                                          \
+    })
+
+static void SDL_TARGETING("avx2") SDL_Convert_F32_to_S16_AVX2(Sint16 *dst, const float *src, int num_samples)
+{
+    LOG_DEBUG_AUDIO_CONVERT("F32", "S16 (using AVX2)");
+    F32_TO_S16_AVX2(0)
+}
+
+static void SDL_TARGETING("avx2") SDL_Convert_F32_to_S16_Swapped_AVX2(Sint16 *dst, const float *src, int num_samples)
+{
+    LOG_DEBUG_AUDIO_CONVERT("F32", "S16 (swapped, using AVX2)");
+    F32_TO_S16_AVX2(1)
+}
+
+#undef F32_TO_S16_AVX2
+
+/* F32 to S32 (optionally byteswapped afterwards):
+   dst[i] = i32(src[i] * 2147483648.0) ^ ((src[i] >= 2147483648.0) ? 0xFFFFFFFF : 0x00000000) */
+#define F32_TO_S32_AVX2(SWAP)                                                                                          \
+    const __m256i shuffle = _mm256_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3,                      \
+                                            12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);                     \
+    const __m256 limit = _mm256_set1_ps(2147483648.0f);                                                                \
+    CONVERT_32_FWD({                                                                                                   \
+        SDL_Convert_F32_to_S32_Scalar(&dst[i], &src[i], 1);                                                            \
+        if (SWAP) {                                                                                                    \
+            dst[i] = (Sint32)SDL_Swap32((Uint32)dst[i]);                                                               \
+        }                                                                                                              \
+    }, {                                                                                                               \
+        const __m256 values0 = _mm256_mul_ps(_mm256_loadu_ps(&src[i]), limit);                                         \
+        const __m256 values1 = _mm256_mul_ps(_mm256_loadu_ps(&src[i + 8]), limit);                                     \
+        const __m256 values2 = _mm256_mul_ps(_mm256_loadu_ps(&src[i + 16]), limit);                                    \
+        const __m256 values3 = _mm256_mul_ps(_mm256_loadu_ps(&src[i + 24]), limit);                                    \
+        __m256i ints0 = _mm256_xor_si256(_mm256_cvttps_epi32(values0), _mm256_castps_si256(_mm256_cmp_ps(values0, limit, _CMP_GE_OQ))); \
+        __m256i ints1 = _mm256_xor_si256(_mm256_cvttps_epi32(values1), _mm256_castps_si256(_mm256_cmp_ps(values1, limit, _CMP_GE_OQ))); \
+        __m256i ints2 = _mm256_xor_si256(_mm256_cvttps_epi32(values2), _mm256_castps_si256(_mm256_cmp_ps(values2, limit, _CMP_GE_OQ))); \
+        __m256i ints3 = _mm256_xor_si256(_mm256_cvttps_epi32(values3), _mm256_castps_si256(_mm256_cmp_ps(values3, limit, _CMP_GE_OQ))); \
+        if (SWAP) {                                                                                                    \
+            ints0 = _mm256_shuffle_epi8(ints0, shuffle);                                                               \
+            ints1 = _mm256_shuffle_epi8(ints1, shuffle);                                                               \
+            ints2 = _mm256_shuffle_epi8(ints2, shuffle);                                                               \
+            ints3 = _mm256_shuffle_epi8(ints3, shuffle);                                                               \
+        }                                                                                                              \
+        _mm256_store_si256((__m256i *)&dst[i], ints0);                                                                 \
+        _mm256_store_si256((__m256i *)&dst[i + 8], ints1);                                                             \
+        _mm256_store_si256((__m256i *)&dst[i + 16], ints2);                                                            \
+        _mm256_store_si256((__m256i *)&dst[i + 24], ints3);                                                            \
+    })
+
+static void SDL_TARGETING("avx2") SDL_Convert_F32_to_S32_AVX2(Sint32 *dst, const float *src, int num_samples)
+{
+    LOG_DEBUG_AUDIO_CONVERT("F32", "S32 (using AVX2)");
+    F32_TO_S32_AVX2(0)
+}
+
+static void SDL_TARGETING("avx2") SDL_Convert_F32_to_S32_Swapped_AVX2(Sint32 *dst, const float *src, int num_samples)
+{
+    LOG_DEBUG_AUDIO_CONVERT("F32", "S32 (swapped, using AVX2)");
+    F32_TO_S32_AVX2(1)
+}
+
+#undef F32_TO_S32_AVX2
+
+static void SDL_TARGETING("avx2") SDL_Convert_Swap16_AVX2(Uint16* dst, const Uint16* src, int num_samples)
+{
+    const __m256i shuffle = _mm256_set_epi8(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1,
+                                            14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1);
+
+    CONVERT_32_FWD({
+        dst[i] = SDL_Swap16(src[i]);
+    }, {
+        __m256i ints0 = _mm256_loadu_si256((const __m256i*)&src[i]);
+        __m256i ints1 = _mm256_loadu_si256((const __m256i*)&src[i + 16]);
+
+        ints0 = _mm256_shuffle_epi8(ints0, shuffle);
+        ints1 = _mm256_shuffle_epi8(ints1, shuffle);
+
+        _mm256_store_si256((__m256i*)&dst[i], ints0);
+        _mm256_store_si256((__m256i*)&dst[i + 16], ints1);
+    })
+}
+
+static void SDL_TARGETING("avx2") SDL_Convert_Swap32_AVX2(Uint32* dst, const Uint32* src, int num_samples)
+{
+    const __m256i shuffle = _mm256_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3,
+                                            12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+
+    CONVERT_32_FWD({
+        dst[i] = SDL_Swap32(src[i]);
+    }, {
+        __m256i ints0 = _mm256_loadu_si256((const __m256i*)&src[i]);
+        __m256i ints1 = _mm256_loadu_si256((const __m256i*)&src[i + 8]);
+        __m256i ints2 = _mm256_loadu_si256((const __m256i*)&src[i + 16]);
+        __m256i ints3 = _mm256_loadu_si256((const __m256i*)&src[i + 24]);
+
+        ints0 = _mm256_shuffle_epi8(ints0, shuffle);
+        ints1 = _mm256_shuffle_epi8(ints1, shuffle);
+        ints2 = _mm256_shuffle_epi8(ints2, shuffle);
+        ints3 = _mm256_shuffle_epi8(ints3, shuffle);
+
+        _mm256_store_si256((__m256i*)&dst[i], ints0);
+        _mm256_store_si256((__m256i*)&dst[i + 8], ints1);
+        _mm256_store_si256((__m256i*)&dst[i + 16], ints2);
+        _mm256_store_si256((__m256i*)&dst[i + 24], ints3);
+    })
+}
+#endif
+
+#ifdef SDL_AVX512F_INTRINSICS
+/* AVX-512F has no byte/word shuffles (that's AVX-512BW), but it can widen and narrow
+   with saturation directly, which covers all of the sample format conversions.
+   Byteswapping is left to the AVX2 converters. */
+
+static void SDL_TARGETING("avx512f") SDL_Convert_S8_to_F32_AVX512F(float *dst, const Sint8 *src, int num_samples)
+{
+    // dst[i] = i2f((src[i] ^ 0x80) | 0x47800000) - 65537.0
+    const __m512i caster = _mm512_set1_epi32(0x47800080);
+    const __m512 offset = _mm512_set1_ps(-65537.0f);
+
+    LOG_DEBUG_AUDIO_CONVERT("S8", "F32 (using AVX-512F)");
+
+    CONVERT_32_REV({
+        SDL_Convert_S8_to_F32_Scalar(&dst[i], &src[i], 1);
+    }, {
+        const __m128i bytes0 = _mm_loadu_si128((const __m128i *)&src[i]);
+        const __m128i bytes1 = _mm_loadu_si128((const __m128i *)&src[i + 16]);
+
+        _mm512_storeu_ps(&dst[i], _mm512_add_ps(_mm512_castsi512_ps(_mm512_xor_si512(_mm512_cvtepu8_epi32(bytes0), caster)), offset));
+        _mm512_storeu_ps(&dst[i + 16], _mm512_add_ps(_mm512_castsi512_ps(_mm512_xor_si512(_mm512_cvtepu8_epi32(bytes1), caster)), offset));
+    })
+}
+
+static void SDL_TARGETING("avx512f") SDL_Convert_U8_to_F32_AVX512F(float *dst, const Uint8 *src, int num_samples)
+{
+    // dst[i] = i2f(src[i] | 0x47800000) - 65537.0
+    const __m512i caster = _mm512_set1_epi32(0x47800000);
+    const __m512 offset = _mm512_set1_ps(-65537.0f);
+
+    LOG_DEBUG_AUDIO_CONVERT("U8", "F32 (using AVX-512F)");
+
+    CONVERT_32_REV({
+        SDL_Convert_U8_to_F32_Scalar(&dst[i], &src[i], 1);
+    }, {
+        const __m128i bytes0 = _mm_loadu_si128((const __m128i *)&src[i]);
+        const __m128i bytes1 = _mm_loadu_si128((const __m128i *)&src[i + 16]);
+
+        _mm512_storeu_ps(&dst[i], _mm512_add_ps(_mm512_castsi512_ps(_mm512_or_si512(_mm512_cvtepu8_epi32(bytes0), caster)), offset));
+        _mm512_storeu_ps(&dst[i + 16], _mm512_add_ps(_mm512_castsi512_ps(_mm512_or_si512(_mm512_cvtepu8_epi32(bytes1), caster)), offset));
+    })
+}
+
+static void SDL_TARGETING("avx512f") SDL_Convert_S16_to_F32_AVX512F(float *dst, const Sint16 *src, int num_samples)
+{
+    // dst[i] = i2f((src[i] ^ 0x8000) | 0x43800000) - 257.0
+    const __m512i caster = _mm512_set1_epi32(0x43808000);
+    const __m512 offset = _mm512_set1_ps(-257.0f);
+
+    LOG_DEBUG_AUDIO_CONVERT("S16", "F32 (using AVX-512F)");
+
+    CONVERT_32_REV({
+        SDL_Convert_S16_to_F32_Scalar(&dst[i], &src[i], 1);
+    }, {
+        const __m256i shorts0 = _mm256_loadu_si256((const __m256i *)&src[i]);
+        const __m256i shorts1 = _mm256_loadu_si256((const __m256i *)&src[i + 16]);
+
+        _mm512_storeu_ps(&dst[i], _mm512_add_ps(_mm512_castsi512_ps(_mm512_xor_si512(_mm512_cvtepu16_epi32(shorts0), caster)), offset));
+        _mm512_storeu_ps(&dst[i + 16], _mm512_add_ps(_mm512_castsi512_ps(_mm512_xor_si512(_mm512_cvtepu16_epi32(shorts1), caster)), offset));
+    })
+}
+
+static void SDL_TARGETING("avx512f") SDL_Convert_S32_to_F32_AVX512F(float *dst, const Sint32 *src, int num_samples)
+{
+    // dst[i] = f32(src[i]) / f32(0x80000000)
+    const __m512 scaler = _mm512_set1_ps(DIVBY2147483648);
+
+    LOG_DEBUG_AUDIO_CONVERT("S32", "F32 (using AVX-512F)");
+
+    CONVERT_32_FWD({
+        SDL_Convert_S32_to_F32_Scalar(&dst[i], &src[i], 1);
+    }, {
+        const __m512i ints0 = _mm512_loadu_si512((const void *)&src[i]);
+        const __m512i ints1 = _mm512_loadu_si512((const void *)&src[i + 16]);
+
+        _mm512_storeu_ps(&dst[i], _mm512_mul_ps(_mm512_cvtepi32_ps(ints0), scaler));
+        _mm512_storeu_ps(&dst[i + 16], _mm512_mul_ps(_mm512_cvtepi32_ps(ints1), scaler));
+    })
+}
+
+static void SDL_TARGETING("avx512f") SDL_Convert_F32_to_S8_AVX512F(Sint8 *dst, const float *src, int num_samples)
+{
+    // dst[i] = round(clamp(src[i] * 128.0, -128.0, 127.0))
+    const __m512 scaler = _mm512_set1_ps(128.0f);
+    const __m512 minval = _mm512_set1_ps(-128.0f);
+    const __m512 maxval = _mm512_set1_ps(127.0f);
+
+    LOG_DEBUG_AUDIO_CONVERT("F32", "S8 (using AVX-512F)");
+
+    CONVERT_32_FWD({
+        SDL_Convert_F32_to_S8_Scalar(&dst[i], &src[i], 1);
+    }, {
+        const __m512i ints0 = _mm512_cvtps_epi32(_mm512_min_ps(_mm512_max_ps(_mm512_mul_ps(_mm512_loadu_ps(&src[i]), scaler), minval), maxval));
+        const __m512i ints1 = _mm512_cvtps_epi32(_mm512_min_ps(_mm512_max_ps(_mm512_mul_ps(_mm512_loadu_ps(&src[i + 16]), scaler), minval), maxval));
+
+        _mm_storeu_si128((__m128i *)&dst[i], _mm512_cvtsepi32_epi8(ints0));
+        _mm_storeu_si128((__m128i *)&dst[i + 16], _mm512_cvtsepi32_epi8(ints1));
+    })
+}
+
+static void SDL_TARGETING("avx512f") SDL_Convert_F32_to_U8_AVX512F(Uint8 *dst, const float *src, int num_samples)
+{
+    // dst[i] = round(clamp(src[i] * 128.0, -128.0, 127.0)) + 128
+    const __m512 scaler = _mm512_set1_ps(128.0f);
+    const __m512 minval = _mm512_set1_ps(-128.0f);
+    const __m512 maxval = _mm512_set1_ps(127.0f);
+    const __m512i bias = _mm512_set1_epi32(128);
+
+    LOG_DEBUG_AUDIO_CONVERT("F32", "U8 (using AVX-512F)");
+
+    CONVERT_32_FWD({
+        SDL_Convert_F32_to_U8_Scalar(&dst[i], &src[i], 1);
+    }, {
+        const __m512i ints0 = _mm512_add_epi32(_mm512_cvtps_epi32(_mm512_min_ps(_mm512_max_ps(_mm512_mul_ps(_mm512_loadu_ps(&src[i]), scaler), minval), maxval)), bias);
+        const __m512i ints1 = _mm512_add_epi32(_mm512_cvtps_epi32(_mm512_min_ps(_mm512_max_ps(_mm512_mul_ps(_mm512_loadu_ps(&src[i + 16]), scaler), minval), maxval)), bias);
+
+        _mm_storeu_si128((__m128i *)&dst[i], _mm512_cvtusepi32_epi8(ints0));
+        _mm_storeu_si128((__m128i *)&dst[i + 16], _mm512_cvtusepi32_epi8(ints1));
+    })
+}
+
+static void SDL_TARGETING("avx512f") SDL_Convert_F32_to_S16_AVX512F(Sint16 *dst, const float *src, int num_samples)
+{
+    // dst[i] = round(clamp(src[i] * 32768.0, -32768.0, 32767.0))
+    const __m512 scaler = _mm512_set1_ps(32768.0f);
+    const __m512 minval = _mm512_set1_ps(-32768.0f);
+    const __m512 maxval = _mm512_set1_ps(32767.0f);
+
+    LOG_DEBUG_AUDIO_CONVERT("F32", "S16 (using AVX-512F)");
+
+    CONVERT_32_FWD({
+        SDL_Convert_F32_to_S16_Scalar(&dst[i], &src[i], 1);
+    }, {
+        const __m512i ints0 = _mm512_cvtps_epi32(_mm512_min_ps(_mm512_max_ps(_mm512_mul_ps(_mm512_loadu_ps(&src[i]), scaler), minval), maxval));
+        const __m512i ints1 = _mm512_cvtps_epi32(_mm512_min_ps(_mm512_max_ps(_mm512_mul_ps(_mm512_loadu_ps(&src[i + 16]), scaler), minval), maxval));
+
+        _mm256_store_si256((__m256i *)&dst[i], _mm512_cvtsepi32_epi16(ints0));
+        _mm256_store_si256((__m256i *)&dst[i + 16], _mm512_cvtsepi32_epi16(ints1));
+    })
+}
+
+static void SDL_TARGETING("avx512f") SDL_Convert_F32_to_S32_AVX512F(Sint32 *dst, const float *src, int num_samples)
+{
+    // dst[i] = (src[i] * 2147483648.0 >= 2147483648.0) ? 0x7FFFFFFF : i32(src[i] * 2147483648.0)
+    const __m512 limit = _mm512_set1_ps(2147483648.0f);
+    const __m512i maxint = _mm512_set1_epi32(0x7FFFFFFF);
+
+    LOG_DEBUG_AUDIO_CONVERT("F32", "S32 (using AVX-512F)");
+
+    CONVERT_32_FWD({
+        SDL_Convert_F32_to_S32_Scalar(&dst[i], &src[i], 1);
+    }, {
+        const __m512 values0 = _mm512_mul_ps(_mm512_loadu_ps(&src[i]), limit);
+        const __m512 values1 = _mm512_mul_ps(_mm512_loadu_ps(&src[i + 16]), limit);
+
+        const __m512i ints0 = _mm512_mask_mov_epi32(_mm512_cvttps_epi32(values0), _mm512_cmp_ps_mask(values0, limit, _CMP_GE_OQ), maxint);
+        const __m512i ints1 = _mm512_mask_mov_epi32(_mm512_cvttps_epi32(values1), _mm512_cmp_ps_mask(values1, limit, _CMP_GE_OQ), maxint);
+
+        _mm512_storeu_si512((void *)&dst[i], ints0);
+        _mm512_storeu_si512((void *)&dst[i + 16], ints1);
+    })
+}
+#endif
+
+#undef CONVERT_32_FWD
+#undef CONVERT_32_REV
+
 #ifdef SDL_NEON_INTRINSICS
 static void SDL_Convert_S8_to_F32_NEON(float *dst, const Sint8 *src, int num_samples)
 {
@@ -785,6 +1305,37 @@ static void (*SDL_Convert_F32_to_S32)(Sint32 *dst, const float *src, int num_sam
 static void (*SDL_Convert_Swap16)(Uint16* dst, const Uint16* src, int num_samples) = NULL;
 static void (*SDL_Convert_Swap32)(Uint32* dst, const Uint32* src, int num_samples) = NULL;
 
+// Non-native byte order conversions, which byteswap and convert in one pass when possible.
+static void (*SDL_Convert_S16_Swapped_to_F32)(float *dst, const Sint16 *src, int num_samples) = NULL;
+static void (*SDL_Convert_S32_Swapped_to_F32)(float *dst, const Sint32 *src, int num_samples) = NULL;
+static void (*SDL_Convert_F32_to_S16_Swapped)(Sint16 *dst, const float *src, int num_samples) = NULL;
+static void (*SDL_Convert_F32_to_S32_Swapped)(Sint32 *dst, const float *src, int num_samples) = NULL;
+
+// Fallbacks for the above, which just run the byteswap and the conversion separately.
+static void SDL_Convert_S16_Swapped_to_F32_Generic(float *dst, const Sint16 *src, int num_samples)
+{
+    SDL_Convert_Swap16((Uint16*) dst, (const Uint16*) src, num_samples);
+    SDL_Convert_S16_to_F32(dst, (const Sint16 *) dst, num_samples);
+}
+
+static void SDL_Convert_S32_Swapped_to_F32_Generic(float *dst, const Sint32 *src, int num_samples)
+{
+    SDL_Convert_Swap32((Uint32*) dst, (const Uint32*) src, num_samples);
+    SDL_Convert_S32_to_F32(dst, (const Sint32 *) dst, num_samples);
+}
+
+static void SDL_Convert_F32_to_S16_Swapped_Generic(Sint16 *dst, const float *src, int num_samples)
+{
+    SDL_Convert_F32_to_S16(dst, src, num_samples);
+    SDL_Convert_Swap16((Uint16*) dst, (const Uint16*) dst, num_samples);
+}
+
+static void SDL_Convert_F32_to_S32_Swapped_Generic(Sint32 *dst, const float *src, int num_samples)
+{
+    SDL_Convert_F32_to_S32(dst, src, num_samples);
+    SDL_Convert_Swap32((Uint32*) dst, (const Uint32*) dst, num_samples);
+}
+
 void ConvertAudioToFloat(float *dst, const void *src, int num_samples, SDL_AudioFormat src_fmt)
 {
     switch (src_fmt) {
@@ -801,8 +1352,7 @@ void ConvertAudioToFloat(float *dst, const void *src, int num_samples, SDL_Audio
             break;
 
         case SDL_AUDIO_S16 ^ SDL_AUDIO_MASK_BIG_ENDIAN:
-            SDL_Convert_Swap16((Uint16*) dst, (const Uint16*) src, num_samples);
-            SDL_Convert_S16_to_F32(dst, (const Sint16 *) dst, num_samples);
+            SDL_Convert_S16_Swapped_to_F32(dst, (const Sint16 *) src, num_samples);
             break;
 
         case SDL_AUDIO_S32:
@@ -810,8 +1360,7 @@ void ConvertAudioToFloat(float *dst, const void *src, int num_samples, SDL_Audio
             break;
 
         case SDL_AUDIO_S32 ^ SDL_AUDIO_MASK_BIG_ENDIAN:
-            SDL_Convert_Swap32((Uint32*) dst, (const Uint32*) src, num_samples);
-            SDL_Convert_S32_to_F32(dst, (const Sint32 *) dst, num_samples);
+            SDL_Convert_S32_Swapped_to_F32(dst, (const Sint32 *) src, num_samples);
             break;
 
         case SDL_AUDIO_F32 ^ SDL_AUDIO_MASK_BIG_ENDIAN:
@@ -838,8 +1387,7 @@ void ConvertAudioFromFloat(void *dst, const float *src, int num_samples, SDL_Aud
             break;
 
         case SDL_AUDIO_S16 ^ SDL_AUDIO_MASK_BIG_ENDIAN:
-            SDL_Convert_F32_to_S16((Sint16 *) dst, src, num_samples);
-            SDL_Convert_Swap16((Uint16*) dst, (const Uint16*) dst, num_samples);
+            SDL_Convert_F32_to_S16_Swapped((Sint16 *) dst, src, num_samples);
             break;
 
         case SDL_AUDIO_S32:
@@ -847,8 +1395,7 @@ void ConvertAudioFromFloat(void *dst, const float *src, int num_samples, SDL_Aud
             break;
 
         case SDL_AUDIO_S32 ^ SDL_AUDIO_MASK_BIG_ENDIAN:
-            SDL_Convert_F32_to_S32((Sint32 *) dst, src, num_samples);
-            SDL_Convert_Swap32((Uint32*) dst, (const Uint32*) dst, num_samples);
+            SDL_Convert_F32_to_S32_Swapped((Sint32 *) dst, src, num_samples);
             break;
 
         case SDL_AUDIO_F32 ^ SDL_AUDIO_MASK_BIG_ENDIAN:
@@ -879,6 +1426,11 @@ void SDL_ChooseAudioConverters(void)
     SDL_Convert_Swap16 = SDL_Convert_Swap16_##fntype; \
     SDL_Convert_Swap32 = SDL_Convert_Swap32_##fntype;
 
+#ifdef SDL_AVX2_INTRINSICS
+    if (SDL_HasAVX2()) {
+        SET_CONVERTER_FUNCS(AVX2);
+    } else
+#endif
 #ifdef SDL_SSE4_1_INTRINSICS
     if (SDL_HasSSE41()) {
         SET_CONVERTER_FUNCS(SSSE3);
@@ -905,6 +1457,16 @@ void SDL_ChooseAudioConverters(void)
     SDL_Convert_F32_to_S16 = SDL_Convert_F32_to_S16_##fntype; \
     SDL_Convert_F32_to_S32 = SDL_Convert_F32_to_S32_##fntype; \
 
+#ifdef SDL_AVX512F_INTRINSICS
+    if (SDL_HasAVX512F()) {
+        SET_CONVERTER_FUNCS(AVX512F);
+    } else
+#endif
+#ifdef SDL_AVX2_INTRINSICS
+    if (SDL_HasAVX2()) {
+        SET_CONVERTER_FUNCS(AVX2);
+    } else
+#endif
 #ifdef SDL_SSE2_INTRINSICS
     if (SDL_HasSSE2()) {
         SET_CONVERTER_FUNCS(SSE2);
@@ -919,6 +1481,23 @@ void SDL_ChooseAudioConverters(void)
         SET_CONVERTER_FUNCS(Scalar);
     }
 
+#undef SET_CONVERTER_FUNCS
+
+#define SET_CONVERTER_FUNCS(fntype) \
+    SDL_Convert_S16_Swapped_to_F32 = SDL_Convert_S16_Swapped_to_F32_##fntype; \
+    SDL_Convert_S32_Swapped_to_F32 = SDL_Convert_S32_Swapped_to_F32_##fntype; \
+    SDL_Convert_F32_to_S16_Swapped = SDL_Convert_F32_to_S16_Swapped_##fntype; \
+    SDL_Convert_F32_to_S32_Swapped = SDL_Convert_F32_to_S32_Swapped_##fntype;
+
+#ifdef SDL_AVX2_INTRINSICS
+    if (SDL_HasAVX2()) {
+        SET_CONVERTER_FUNCS(AVX2);
+    } else
+#endif
+    {
+        SET_CONVERTER_FUNCS(Generic);
+    }
+
 #undef SET_CONVERTER_FUNCS
 
     converters_chosen = SDL_TRUE;
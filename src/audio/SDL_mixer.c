@@ -82,25 +82,390 @@ static const Uint8 mix8[] = {
 #define ADJUST_VOLUME(type, s, v) ((s) = (type)(((s) * (v)) / MIX_MAXVOLUME))
 #define ADJUST_VOLUME_U8(s, v)    ((s) = (Uint8)(((((s) - 128) * (v)) / MIX_MAXVOLUME) + 128))
 
-// !!! FIXME: This needs some SIMD magic.
 // !!! FIXME: Add fast-path for volume = 1
 // !!! FIXME: Use larger scales for 16-bit/32-bit integers
 
+/* The SIMD paths below produce exactly the same results as the scalar code, including
+ * rounding the volume adjustment towards zero. They only handle 0 < volume <= MIX_MAXVOLUME,
+ * where the adjusted sample is guaranteed to fit the original type. Each returns the number
+ * of samples it processed; the scalar loops take care of whatever is left over.
+ */
+#define MIX_MAXVOLUME_BITS 7
+
+#ifdef SDL_SSE2_INTRINSICS
+#define SWAP16_SSE2(x) _mm_or_si128(_mm_slli_epi16(x, 8), _mm_srli_epi16(x, 8))
+
+// (x * volume) / MIX_MAXVOLUME for 8 Sint16s
+SDL_FORCE_INLINE __m128i SDL_TARGETING("sse2") AdjustVolume_S16_SSE2(__m128i x, __m128i vol)
+{
+    const __m128i round = _mm_set1_epi32(MIX_MAXVOLUME - 1);
+    const __m128i lo = _mm_mullo_epi16(x, vol);
+    const __m128i hi = _mm_mulhi_epi16(x, vol);
+    __m128i p0 = _mm_unpacklo_epi16(lo, hi);
+    __m128i p1 = _mm_unpackhi_epi16(lo, hi);
+
+    p0 = _mm_srai_epi32(_mm_add_epi32(p0, _mm_and_si128(_mm_srai_epi32(p0, 31), round)), MIX_MAXVOLUME_BITS);
+    p1 = _mm_srai_epi32(_mm_add_epi32(p1, _mm_and_si128(_mm_srai_epi32(p1, 31), round)), MIX_MAXVOLUME_BITS);
+    return _mm_packs_epi32(p0, p1);
+}
+
+static Uint32 SDL_TARGETING("sse2") MixAudio_S8_SSE2(Uint8 *dst, const Uint8 *src, Uint32 num_samples, int volume, Uint8 flip)
+{
+    const __m128i vol = _mm_set1_epi16((Sint16)volume);
+    const __m128i round = _mm_set1_epi16(MIX_MAXVOLUME - 1);
+    const __m128i bias = _mm_set1_epi8((char)flip);
+    const __m128i zero = _mm_setzero_si128();
+    Uint32 i;
+
+    for (i = 0; i + 16 <= num_samples; i += 16) {
+        __m128i x = _mm_xor_si128(_mm_loadu_si128((const __m128i *)&src[i]), bias);
+        const __m128i d = _mm_xor_si128(_mm_loadu_si128((const __m128i *)&dst[i]), bias);
+
+        if (volume != MIX_MAXVOLUME) {
+            __m128i x0 = _mm_mullo_epi16(_mm_srai_epi16(_mm_unpacklo_epi8(zero, x), 8), vol);
+            __m128i x1 = _mm_mullo_epi16(_mm_srai_epi16(_mm_unpackhi_epi8(zero, x), 8), vol);
+            x0 = _mm_srai_epi16(_mm_add_epi16(x0, _mm_and_si128(_mm_srai_epi16(x0, 15), round)), MIX_MAXVOLUME_BITS);
+            x1 = _mm_srai_epi16(_mm_add_epi16(x1, _mm_and_si128(_mm_srai_epi16(x1, 15), round)), MIX_MAXVOLUME_BITS);
+            x = _mm_packs_epi16(x0, x1);
+        }
+
+        _mm_storeu_si128((__m128i *)&dst[i], _mm_xor_si128(_mm_adds_epi8(d, x), bias));
+    }
+
+    return i;
+}
+
+static Uint32 SDL_TARGETING("sse2") MixAudio_S16_SSE2(Sint16 *dst, const Sint16 *src, Uint32 num_samples, int volume, SDL_bool swap)
+{
+    const __m128i vol = _mm_set1_epi16((Sint16)volume);
+    Uint32 i;
+
+    for (i = 0; i + 8 <= num_samples; i += 8) {
+        __m128i x = _mm_loadu_si128((const __m128i *)&src[i]);
+        __m128i d = _mm_loadu_si128((const __m128i *)&dst[i]);
+
+        if (swap) {
+            x = SWAP16_SSE2(x);
+            d = SWAP16_SSE2(d);
+        }
+        if (volume != MIX_MAXVOLUME) {
+            x = AdjustVolume_S16_SSE2(x, vol);
+        }
+
+        d = _mm_adds_epi16(d, x);
+        if (swap) {
+            d = SWAP16_SSE2(d);
+        }
+        _mm_storeu_si128((__m128i *)&dst[i], d);
+    }
+
+    return i;
+}
+
+static Uint32 SDL_TARGETING("sse2") MixAudio_S32_SSE2(Sint32 *dst, const Sint32 *src, Uint32 num_samples, int volume)
+{
+    const __m128i vol = _mm_set1_epi32(volume);
+    const __m128i mask = _mm_set1_epi32(MIX_MAXVOLUME - 1);
+    const __m128i max = _mm_set1_epi32(SDL_MAX_SINT32);
+    Uint32 i;
+
+    for (i = 0; i + 4 <= num_samples; i += 4) {
+        __m128i x = _mm_loadu_si128((const __m128i *)&src[i]);
+        const __m128i d = _mm_loadu_si128((const __m128i *)&dst[i]);
+
+        if (volume != MIX_MAXVOLUME) {
+            /* There's no 32x32 multiply in SSE2, so split x into (hi * MIX_MAXVOLUME) + lo:
+               (x * volume) / MIX_MAXVOLUME == (hi * volume) + ((lo * volume) / MIX_MAXVOLUME), with the
+               last term rounded down, then add 1 if x is negative and the division wasn't exact. */
+            const __m128i hi = _mm_srai_epi32(x, MIX_MAXVOLUME_BITS);
+            const __m128i lo = _mm_mullo_epi16(_mm_and_si128(x, mask), vol);  // < 2^14, so a 16-bit multiply is enough
+            const __m128i even = _mm_mul_epu32(hi, vol);
+            const __m128i odd = _mm_mul_epu32(_mm_srli_epi64(hi, 32), vol);
+            const __m128i hiv = _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+            const __m128i inexact = _mm_andnot_si128(_mm_cmpeq_epi32(_mm_and_si128(lo, mask), _mm_setzero_si128()), _mm_srai_epi32(x, 31));
+            x = _mm_sub_epi32(_mm_add_epi32(hiv, _mm_srai_epi32(lo, MIX_MAXVOLUME_BITS)), inexact);
+        }
+
+        // Saturating add: if both inputs have the same sign, and the result doesn't, clamp.
+        {
+            const __m128i sum = _mm_add_epi32(d, x);
+            const __m128i overflow = _mm_srai_epi32(_mm_and_si128(_mm_xor_si128(d, sum), _mm_xor_si128(x, sum)), 31);
+            const __m128i clamped = _mm_xor_si128(_mm_srai_epi32(d, 31), max);
+            _mm_storeu_si128((__m128i *)&dst[i], _mm_or_si128(_mm_and_si128(overflow, clamped), _mm_andnot_si128(overflow, sum)));
+        }
+    }
+
+    return i;
+}
+#endif
+
+#ifdef SDL_AVX2_INTRINSICS
+#define SWAP16_AVX2(x) _mm256_or_si256(_mm256_slli_epi16(x, 8), _mm256_srli_epi16(x, 8))
+
+static Uint32 SDL_TARGETING("avx2") MixAudio_S8_AVX2(Uint8 *dst, const Uint8 *src, Uint32 num_samples, int volume, Uint8 flip)
+{
+    const __m256i vol = _mm256_set1_epi16((Sint16)volume);
+    const __m256i round = _mm256_set1_epi16(MIX_MAXVOLUME - 1);
+    const __m256i bias = _mm256_set1_epi8((char)flip);
+    const __m256i zero = _mm256_setzero_si256();
+    Uint32 i;
+
+    for (i = 0; i + 32 <= num_samples; i += 32) {
+        __m256i x = _mm256_xor_si256(_mm256_loadu_si256((const __m256i *)&src[i]), bias);
+        const __m256i d = _mm256_xor_si256(_mm256_loadu_si256((const __m256i *)&dst[i]), bias);
+
+        if (volume != MIX_MAXVOLUME) {
+            // unpack and pack both work within 128-bit lanes, so the order comes back out the same.
+            __m256i x0 = _mm256_mullo_epi16(_mm256_srai_epi16(_mm256_unpacklo_epi8(zero, x), 8), vol);
+            __m256i x1 = _mm256_mullo_epi16(_mm256_srai_epi16(_mm256_unpackhi_epi8(zero, x), 8), vol);
+            x0 = _mm256_srai_epi16(_mm256_add_epi16(x0, _mm256_and_si256(_mm256_srai_epi16(x0, 15), round)), MIX_MAXVOLUME_BITS);
+            x1 = _mm256_srai_epi16(_mm256_add_epi16(x1, _mm256_and_si256(_mm256_srai_epi16(x1, 15), round)), MIX_MAXVOLUME_BITS);
+            x = _mm256_packs_epi16(x0, x1);
+        }
+
+        _mm256_storeu_si256((__m256i *)&dst[i], _mm256_xor_si256(_mm256_adds_epi8(d, x), bias));
+    }
+
+    return i;
+}
+
+static Uint32 SDL_TARGETING("avx2") MixAudio_S16_AVX2(Sint16 *dst, const Sint16 *src, Uint32 num_samples, int volume, SDL_bool swap)
+{
+    const __m256i vol = _mm256_set1_epi16((Sint16)volume);
+    const __m256i round = _mm256_set1_epi32(MIX_MAXVOLUME - 1);
+    Uint32 i;
+
+    for (i = 0; i + 16 <= num_samples; i += 16) {
+        __m256i x = _mm256_loadu_si256((const __m256i *)&src[i]);
+        __m256i d = _mm256_loadu_si256((const __m256i *)&dst[i]);
+
+        if (swap) {
+            x = SWAP16_AVX2(x);
+            d = SWAP16_AVX2(d);
+        }
+        if (volume != MIX_MAXVOLUME) {
+            const __m256i lo = _mm256_mullo_epi16(x, vol);
+            const __m256i hi = _mm256_mulhi_epi16(x, vol);
+            __m256i p0 = _mm256_unpacklo_epi16(lo, hi);
+            __m256i p1 = _mm256_unpackhi_epi16(lo, hi);
+            p0 = _mm256_srai_epi32(_mm256_add_epi32(p0, _mm256_and_si256(_mm256_srai_epi32(p0, 31), round)), MIX_MAXVOLUME_BITS);
+            p1 = _mm256_srai_epi32(_mm256_add_epi32(p1, _mm256_and_si256(_mm256_srai_epi32(p1, 31), round)), MIX_MAXVOLUME_BITS);
+            x = _mm256_packs_epi32(p0, p1);
+        }
+
+        d = _mm256_adds_epi16(d, x);
+        if (swap) {
+            d = SWAP16_AVX2(d);
+        }
+        _mm256_storeu_si256((__m256i *)&dst[i], d);
+    }
+
+    return i;
+}
+
+static Uint32 SDL_TARGETING("avx2") MixAudio_S32_AVX2(Sint32 *dst, const Sint32 *src, Uint32 num_samples, int volume)
+{
+    const __m256i vol = _mm256_set1_epi32(volume);
+    const __m256i mask = _mm256_set1_epi32(MIX_MAXVOLUME - 1);
+    const __m256i max = _mm256_set1_epi32(SDL_MAX_SINT32);
+    Uint32 i;
+
+    for (i = 0; i + 8 <= num_samples; i += 8) {
+        __m256i x = _mm256_loadu_si256((const __m256i *)&src[i]);
+        const __m256i d = _mm256_loadu_si256((const __m256i *)&dst[i]);
+
+        if (volume != MIX_MAXVOLUME) {
+            // Same split as the SSE2 version, so nothing overflows 32 bits.
+            const __m256i hi = _mm256_mullo_epi32(_mm256_srai_epi32(x, MIX_MAXVOLUME_BITS), vol);
+            const __m256i lo = _mm256_mullo_epi32(_mm256_and_si256(x, mask), vol);
+            const __m256i inexact = _mm256_andnot_si256(_mm256_cmpeq_epi32(_mm256_and_si256(lo, mask), _mm256_setzero_si256()), _mm256_srai_epi32(x, 31));
+            x = _mm256_sub_epi32(_mm256_add_epi32(hi, _mm256_srai_epi32(lo, MIX_MAXVOLUME_BITS)), inexact);
+        }
+
+        {
+            const __m256i sum = _mm256_add_epi32(d, x);
+            const __m256i overflow = _mm256_srai_epi32(_mm256_and_si256(_mm256_xor_si256(d, sum), _mm256_xor_si256(x, sum)), 31);
+            const __m256i clamped = _mm256_xor_si256(_mm256_srai_epi32(d, 31), max);
+            _mm256_storeu_si256((__m256i *)&dst[i], _mm256_blendv_epi8(sum, clamped, overflow));
+        }
+    }
+
+    return i;
+}
+#endif
+
+#ifdef SDL_NEON_INTRINSICS
+// (x * volume) / MIX_MAXVOLUME, for 4 widened samples
+SDL_FORCE_INLINE int32x4_t AdjustVolume_S32x4_NEON(int32x4_t p)
+{
+    const int32x4_t round = vdupq_n_s32(MIX_MAXVOLUME - 1);
+    return vshrq_n_s32(vaddq_s32(p, vandq_s32(vshrq_n_s32(p, 31), round)), MIX_MAXVOLUME_BITS);
+}
+
+static Uint32 MixAudio_S8_NEON(Uint8 *dst, const Uint8 *src, Uint32 num_samples, int volume, Uint8 flip)
+{
+    const uint8x16_t bias = vdupq_n_u8(flip);
+    const int16x8_t round = vdupq_n_s16(MIX_MAXVOLUME - 1);
+    Uint32 i;
+
+    for (i = 0; i + 16 <= num_samples; i += 16) {
+        int8x16_t x = vreinterpretq_s8_u8(veorq_u8(vld1q_u8(&src[i]), bias));
+        const int8x16_t d = vreinterpretq_s8_u8(veorq_u8(vld1q_u8(&dst[i]), bias));
+
+        if (volume != MIX_MAXVOLUME) {
+            int16x8_t x0 = vmulq_n_s16(vmovl_s8(vget_low_s8(x)), (int16_t)volume);
+            int16x8_t x1 = vmulq_n_s16(vmovl_s8(vget_high_s8(x)), (int16_t)volume);
+            x0 = vshrq_n_s16(vaddq_s16(x0, vandq_s16(vshrq_n_s16(x0, 15), round)), MIX_MAXVOLUME_BITS);
+            x1 = vshrq_n_s16(vaddq_s16(x1, vandq_s16(vshrq_n_s16(x1, 15), round)), MIX_MAXVOLUME_BITS);
+            x = vcombine_s8(vmovn_s16(x0), vmovn_s16(x1));
+        }
+
+        vst1q_u8(&dst[i], veorq_u8(vreinterpretq_u8_s8(vqaddq_s8(d, x)), bias));
+    }
+
+    return i;
+}
+
+static Uint32 MixAudio_S16_NEON(Sint16 *dst, const Sint16 *src, Uint32 num_samples, int volume, SDL_bool swap)
+{
+    Uint32 i;
+
+    for (i = 0; i + 8 <= num_samples; i += 8) {
+        int16x8_t x = vld1q_s16(&src[i]);
+        int16x8_t d = vld1q_s16(&dst[i]);
+
+        if (swap) {
+            x = vreinterpretq_s16_u8(vrev16q_u8(vreinterpretq_u8_s16(x)));
+            d = vreinterpretq_s16_u8(vrev16q_u8(vreinterpretq_u8_s16(d)));
+        }
+        if (volume != MIX_MAXVOLUME) {
+            const int32x4_t p0 = AdjustVolume_S32x4_NEON(vmull_n_s16(vget_low_s16(x), (int16_t)volume));
+            const int32x4_t p1 = AdjustVolume_S32x4_NEON(vmull_n_s16(vget_high_s16(x), (int16_t)volume));
+            x = vcombine_s16(vmovn_s32(p0), vmovn_s32(p1));
+        }
+
+        d = vqaddq_s16(d, x);
+        if (swap) {
+            d = vreinterpretq_s16_u8(vrev16q_u8(vreinterpretq_u8_s16(d)));
+        }
+        vst1q_s16(&dst[i], d);
+    }
+
+    return i;
+}
+
+static Uint32 MixAudio_S32_NEON(Sint32 *dst, const Sint32 *src, Uint32 num_samples, int volume)
+{
+    const int64x2_t round = vdupq_n_s64(MIX_MAXVOLUME - 1);
+    Uint32 i;
+
+    for (i = 0; i + 4 <= num_samples; i += 4) {
+        int32x4_t x = vld1q_s32(&src[i]);
+        const int32x4_t d = vld1q_s32(&dst[i]);
+
+        if (volume != MIX_MAXVOLUME) {
+            int64x2_t p0 = vmull_n_s32(vget_low_s32(x), volume);
+            int64x2_t p1 = vmull_n_s32(vget_high_s32(x), volume);
+            p0 = vshrq_n_s64(vaddq_s64(p0, vandq_s64(vshrq_n_s64(p0, 63), round)), MIX_MAXVOLUME_BITS);
+            p1 = vshrq_n_s64(vaddq_s64(p1, vandq_s64(vshrq_n_s64(p1, 63), round)), MIX_MAXVOLUME_BITS);
+            x = vcombine_s32(vmovn_s64(p0), vmovn_s64(p1));
+        }
+
+        vst1q_s32(&dst[i], vqaddq_s32(d, x));
+    }
+
+    return i;
+}
+#endif
+
+// `flip` is 0x80 for U8 data, to move it into signed range, or 0 for S8.
+static Uint32 MixAudioSIMD_S8(Uint8 *dst, const Uint8 *src, Uint32 num_samples, int volume, Uint8 flip)
+{
+#ifdef SDL_AVX2_INTRINSICS
+    if (SDL_HasAVX2()) {
+        return MixAudio_S8_AVX2(dst, src, num_samples, volume, flip);
+    }
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    if (SDL_HasSSE2()) {
+        return MixAudio_S8_SSE2(dst, src, num_samples, volume, flip);
+    }
+#endif
+#ifdef SDL_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+        return MixAudio_S8_NEON(dst, src, num_samples, volume, flip);
+    }
+#endif
+    return 0;
+}
+
+static Uint32 MixAudioSIMD_S16(Uint8 *dst, const Uint8 *src, Uint32 num_samples, int volume, SDL_bool swap)
+{
+#ifdef SDL_AVX2_INTRINSICS
+    if (SDL_HasAVX2()) {
+        return MixAudio_S16_AVX2((Sint16 *)dst, (const Sint16 *)src, num_samples, volume, swap);
+    }
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    if (SDL_HasSSE2()) {
+        return MixAudio_S16_SSE2((Sint16 *)dst, (const Sint16 *)src, num_samples, volume, swap);
+    }
+#endif
+#ifdef SDL_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+        return MixAudio_S16_NEON((Sint16 *)dst, (const Sint16 *)src, num_samples, volume, swap);
+    }
+#endif
+    return 0;
+}
+
+// Native byte order only.
+static Uint32 MixAudioSIMD_S32(Uint8 *dst, const Uint8 *src, Uint32 num_samples, int volume)
+{
+#ifdef SDL_AVX2_INTRINSICS
+    if (SDL_HasAVX2()) {
+        return MixAudio_S32_AVX2((Sint32 *)dst, (const Sint32 *)src, num_samples, volume);
+    }
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    if (SDL_HasSSE2()) {
+        return MixAudio_S32_SSE2((Sint32 *)dst, (const Sint32 *)src, num_samples, volume);
+    }
+#endif
+#ifdef SDL_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+        return MixAudio_S32_NEON((Sint32 *)dst, (const Sint32 *)src, num_samples, volume);
+    }
+#endif
+    return 0;
+}
+
 int SDL_MixAudio(Uint8 *dst, const Uint8 *src, SDL_AudioFormat format,
                  Uint32 len, float fvolume)
 {
     int volume = (int)SDL_roundf(fvolume * MIX_MAXVOLUME);
+    SDL_bool simd;
+    Uint32 done = 0;
 
     if (volume == 0) {
         return 0;
     }
 
+    simd = (volume > 0) && (volume <= MIX_MAXVOLUME);
+
     switch (format) {
 
     case SDL_AUDIO_U8:
     {
         Uint8 src_sample;
 
+        if (simd) {
+            done = MixAudioSIMD_S8(dst, src, len, volume, 0x80);
+            dst += done;
+            src += done;
+            len -= done;
+        }
+
         while (len--) {
             src_sample = *src;
             ADJUST_VOLUME_U8(src_sample, volume);
@@ -118,8 +483,13 @@ int SDL_MixAudio(Uint8 *dst, const Uint8 *src, SDL_AudioFormat format,
         const int max_audioval = SDL_MAX_SINT8;
         const int min_audioval = SDL_MIN_SINT8;
 
-        src8 = (Sint8 *)src;
-        dst8 = (Sint8 *)dst;
+        if (simd) {
+            done = MixAudioSIMD_S8(dst, src, len, volume, 0);
+        }
+
+        src8 = (Sint8 *)src + done;
+        dst8 = (Sint8 *)dst + done;
+        len -= done;
         while (len--) {
             src_sample = *src8;
             ADJUST_VOLUME(Sint8, src_sample, volume);
@@ -143,6 +513,13 @@ int SDL_MixAudio(Uint8 *dst, const Uint8 *src, SDL_AudioFormat format,
         const int min_audioval = SDL_MIN_SINT16;
 
         len /= 2;
+        if (simd) {
+            done = MixAudioSIMD_S16(dst, src, len, volume, (SDL_BYTEORDER == SDL_BIG_ENDIAN));
+            dst += done * 2;
+            src += done * 2;
+            len -= done;
+        }
+
         while (len--) {
             src1 = SDL_SwapLE16(*(Sint16 *)src);
             ADJUST_VOLUME(Sint16, src1, volume);
@@ -167,6 +544,13 @@ int SDL_MixAudio(Uint8 *dst, const Uint8 *src, SDL_AudioFormat format,
         const int min_audioval = SDL_MIN_SINT16;
 
         len /= 2;
+        if (simd) {
+            done = MixAudioSIMD_S16(dst, src, len, volume, (SDL_BYTEORDER == SDL_LIL_ENDIAN));
+            dst += done * 2;
+            src += done * 2;
+            len -= done;
+        }
+
         while (len--) {
             src1 = SDL_SwapBE16(*(Sint16 *)src);
             ADJUST_VOLUME(Sint16, src1, volume);
@@ -193,6 +577,13 @@ int SDL_MixAudio(Uint8 *dst, const Uint8 *src, SDL_AudioFormat format,
         const Sint64 min_audioval = SDL_MIN_SINT32;
 
         len /= 4;
+        if (simd && (format == SDL_AUDIO_S32)) {
+            done = MixAudioSIMD_S32(dst, src, len, volume);
+            src32 += done;
+            dst32 += done;
+            len -= done;
+        }
+
         while (len--) {
             src1 = (Sint64)((Sint32)SDL_SwapLE32(*src32));
             src32++;
@@ -218,6 +609,13 @@ int SDL_MixAudio(Uint8 *dst, const Uint8 *src, SDL_AudioFormat format,
         const Sint64 min_audioval = SDL_MIN_SINT32;
 
         len /= 4;
+        if (simd && (format == SDL_AUDIO_S32)) {
+            done = MixAudioSIMD_S32(dst, src, len, volume);
+            src32 += done;
+            dst32 += done;
+            len -= done;
+        }
+
         while (len--) {
             src1 = (Sint64)((Sint32)SDL_SwapBE32(*src32));
             src32++;
@@ -121,6 +121,9 @@ extern void ConvertAudio(int num_frames, const void *src, SDL_AudioFormat src_fo
 extern void OnAudioStreamCreated(SDL_AudioStream *stream);
 extern void OnAudioStreamDestroy(SDL_AudioStream *stream);
 
+// Special case to let SDL_audio.c queue a buffer it owns into a stream without copying it; `callback` is called when the stream is done with it (but not on failure!). Don't use this.
+extern int PutAudioStreamBuffer(SDL_AudioStream *stream, const void *buf, int len, void (SDLCALL *callback)(void *userdata, const void *buf, int buflen), void *userdata);
+
 typedef struct SDL_AudioDriverImpl
 {
     void (*DetectDevices)(SDL_AudioDevice **default_output, SDL_AudioDevice **default_capture);
@@ -194,6 +197,11 @@ struct SDL_AudioStream
     SDL_AudioSpec input_spec; // The spec of input data currently being processed
     Sint64 resample_offset;
 
+    SDL_AudioStreamStats stats;  // Performance counters, protected by `lock`.
+
+    Sint64 resample_phases_rate;  // the resample rate `resample_phases` was built for, 0 if none.
+    struct SDL_ResamplePhases *resample_phases;  // precomputed filter taps for rational rates, can be NULL.
+
     Uint8 *work_buffer;    // used for scratch space during data conversion/resampling.
     size_t work_buffer_allocation;
 
@@ -309,6 +317,10 @@ struct SDL_AudioDevice
     // SDL_TRUE if this physical device is currently opened by the backend.
     SDL_bool currently_opened;
 
+    // Performance counters, updated by the device thread while holding `lock`. avg_mix_ns is calculated from total_mix_ns on request.
+    SDL_AudioDeviceStats stats;
+    Uint64 total_mix_ns;
+
     // Data private to this driver
     struct SDL_PrivateAudioData *hidden;
 
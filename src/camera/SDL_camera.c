@@ -24,6 +24,7 @@
 #include "SDL_camera_c.h"
 #include "../video/SDL_pixels_c.h"
 #include "../thread/SDL_systhread.h"
+#include "../SDL_trace_c.h"
 
 
 // A lot of this is a simplified version of SDL_audio.c; if fixing stuff here,
@@ -779,6 +780,8 @@ SDL_bool SDL_CameraThreadIterate(SDL_CameraDevice *device)
         return (permission < 0) ? SDL_FALSE : SDL_TRUE;  // if permission was denied, shut it down. if undecided, we're done for now.
     }
 
+    SDL_TRACE_ZONE_BEGIN("SDL_CameraThreadIterate");
+
     SDL_bool failed = SDL_FALSE;  // set to true if disaster worthy of treating the device as lost has happened.
     SDL_Surface *acquired = NULL;
     SDL_Surface *output_surface = NULL;
@@ -886,6 +889,8 @@ SDL_bool SDL_CameraThreadIterate(SDL_CameraDevice *device)
         SDL_UnlockMutex(device->lock);
     }
 
+    SDL_TRACE_ZONE_END("SDL_CameraThreadIterate");
+
     return SDL_TRUE;  // always go on if not shutting down, even if device failed.
 }
 
@@ -1422,7 +1427,10 @@ int SDL_CameraInit(const char *driver_name)
                     camera_driver.pending_events_tail = &camera_driver.pending_events;
                     camera_driver.device_hash_lock = device_hash_lock;
                     camera_driver.device_hash = device_hash;
-                    if (bootstrap[i]->init(&camera_driver.impl)) {
+                    const Uint64 start = SDL_BeginStartupTrace();
+                    const SDL_bool driver_initialized = bootstrap[i]->init(&camera_driver.impl);
+                    SDL_EndStartupTrace(start, "camera", bootstrap[i]->name, driver_initialized);
+                    if (driver_initialized) {
                         camera_driver.name = bootstrap[i]->name;
                         camera_driver.desc = bootstrap[i]->desc;
                         initialized = SDL_TRUE;
@@ -1446,7 +1454,10 @@ int SDL_CameraInit(const char *driver_name)
             camera_driver.pending_events_tail = &camera_driver.pending_events;
             camera_driver.device_hash_lock = device_hash_lock;
             camera_driver.device_hash = device_hash;
-            if (bootstrap[i]->init(&camera_driver.impl)) {
+            const Uint64 start = SDL_BeginStartupTrace();
+            const SDL_bool driver_initialized = bootstrap[i]->init(&camera_driver.impl);
+            SDL_EndStartupTrace(start, "camera", bootstrap[i]->name, driver_initialized);
+            if (driver_initialized) {
                 camera_driver.name = bootstrap[i]->name;
                 camera_driver.desc = bootstrap[i]->desc;
                 initialized = SDL_TRUE;
@@ -1473,7 +1484,9 @@ int SDL_CameraInit(const char *driver_name)
     CompleteCameraEntryPoints();
 
     // Make sure we have a list of devices available at startup...
+    const Uint64 start = SDL_BeginStartupTrace();
     camera_driver.impl.DetectDevices();
+    SDL_EndStartupTrace(start, "camera", "DetectDevices", SDL_TRUE);
 
     return 0;
 }
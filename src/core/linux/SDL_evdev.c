@@ -105,6 +105,9 @@ typedef struct SDL_evdevlist_item
             int x, y, pressure;
         } *slots;
 
+        /* The slots that moved since the last SYN_REPORT, sent as one batch */
+        SDL_Finger *motion;
+
     } *touchscreen_data;
 
     /* Mouse state */
@@ -312,7 +315,8 @@ int SDL_EVDEV_GetDeviceCount(int device_class)
 void SDL_EVDEV_Poll(void)
 {
     struct input_event events[32];
-    int i, j, len;
+    int i, j, len, num_motion;
+    SDL_Finger *motion;
     SDL_evdevlist_item *item;
     SDL_Scancode scan_code;
     int mouse_button;
@@ -527,6 +531,7 @@ void SDL_EVDEV_Poll(void)
                             break;
                         }
 
+                        num_motion = 0;
                         for (j = 0; j < item->touchscreen_data->max_slots; j++) {
                             norm_x = (float)(item->touchscreen_data->slots[j].x - item->touchscreen_data->min_x) /
                                      (float)item->touchscreen_data->range_x;
@@ -555,13 +560,20 @@ void SDL_EVDEV_Poll(void)
                                 item->touchscreen_data->slots[j].delta = EVDEV_TOUCH_SLOTDELTA_NONE;
                                 break;
                             case EVDEV_TOUCH_SLOTDELTA_MOVE:
-                                SDL_SendTouchMotion(SDL_EVDEV_GetEventTimestamp(event), item->fd, item->touchscreen_data->slots[j].tracking_id, NULL, norm_x, norm_y, norm_pressure);
+                                motion = &item->touchscreen_data->motion[num_motion++];
+                                motion->id = item->touchscreen_data->slots[j].tracking_id;
+                                motion->x = norm_x;
+                                motion->y = norm_y;
+                                motion->pressure = norm_pressure;
                                 item->touchscreen_data->slots[j].delta = EVDEV_TOUCH_SLOTDELTA_NONE;
                                 break;
                             default:
                                 break;
                             }
                         }
+                        if (num_motion > 0) {
+                            SDL_SendTouchMotions(SDL_EVDEV_GetEventTimestamp(event), item->fd, NULL, item->touchscreen_data->motion, num_motion);
+                        }
 
                         if (item->out_of_sync) {
                             item->out_of_sync = SDL_FALSE;
@@ -743,10 +755,21 @@ static int SDL_EVDEV_init_touchscreen(SDL_evdevlist_item *item, int udev_class)
         return -1;
     }
 
+    item->touchscreen_data->motion = SDL_calloc(
+        item->touchscreen_data->max_slots,
+        sizeof(*item->touchscreen_data->motion));
+    if (!item->touchscreen_data->motion) {
+        SDL_free(item->touchscreen_data->slots);
+        SDL_free(item->touchscreen_data->name);
+        SDL_free(item->touchscreen_data);
+        return -1;
+    }
+
     ret = SDL_AddTouch(item->fd, /* I guess our fd is unique enough */
                        (udev_class & SDL_UDEV_DEVICE_TOUCHPAD) ? SDL_TOUCH_DEVICE_INDIRECT_ABSOLUTE : SDL_TOUCH_DEVICE_DIRECT,
                        item->touchscreen_data->name);
     if (ret < 0) {
+        SDL_free(item->touchscreen_data->motion);
         SDL_free(item->touchscreen_data->slots);
         SDL_free(item->touchscreen_data->name);
         SDL_free(item->touchscreen_data);
@@ -763,6 +786,7 @@ static void SDL_EVDEV_destroy_touchscreen(SDL_evdevlist_item *item)
     }
 
     SDL_DelTouch(item->fd);
+    SDL_free(item->touchscreen_data->motion);
     SDL_free(item->touchscreen_data->slots);
     SDL_free(item->touchscreen_data->name);
     SDL_free(item->touchscreen_data);
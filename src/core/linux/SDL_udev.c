@@ -35,6 +35,7 @@
 
 #include "SDL_evdev_capabilities.h"
 #include "../unix/SDL_poll.h"
+#include "../../SDL_trace_c.h"
 
 static const char *SDL_UDEV_LIBS[] = { "libudev.so.1", "libudev.so.0" };
 
@@ -147,7 +148,9 @@ int SDL_UDEV_Init(void)
         _this->syms.udev_monitor_enable_receiving(_this->udev_mon);
 
         /* Do an initial scan of existing devices */
+        const Uint64 start = SDL_BeginStartupTrace();
         SDL_UDEV_Scan();
+        SDL_EndStartupTrace(start, "udev", "scan", SDL_TRUE);
     }
 
     _this->ref_count += 1;
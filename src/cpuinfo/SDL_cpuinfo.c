@@ -862,6 +862,7 @@ int SDL_GetCPUCacheLineSize(void)
 
 static Uint32 SDL_CPUFeatures = SDL_CPUFEATURES_RESET_VALUE;
 static Uint32 SDL_SIMDAlignment = 0xFFFFFFFF;
+static SDL_AtomicInt SDL_CPUFeatureMaskWatched;
 
 static SDL_bool ref_string_equals(const char *ref, const char *test, const char *end_test) {
     size_t len_test = end_test - test;
@@ -937,9 +938,19 @@ static Uint32 SDLCALL SDL_CPUFeatureMaskFromHint(void)
     return result_mask;
 }
 
+static void SDLCALL SDL_CPUFeatureMaskChanged(void *userdata, const char *name, const char *oldValue, const char *newValue)
+{
+    /* Apply the new mask the next time the features are queried */
+    SDL_CPUFeatures = SDL_CPUFEATURES_RESET_VALUE;
+}
+
 static Uint32 SDL_GetCPUFeatures(void)
 {
     if (SDL_CPUFeatures == SDL_CPUFEATURES_RESET_VALUE) {
+        /* Any thread can be the first to query the features, only one of them adds the callback */
+        if (SDL_AtomicCompareAndSwap(&SDL_CPUFeatureMaskWatched, 0, 1)) {
+            SDL_AddHintCallback(SDL_HINT_CPU_FEATURE_MASK, SDL_CPUFeatureMaskChanged, NULL);
+        }
         CPU_calcCPUIDFeatures();
         SDL_CPUFeatures = 0;
         SDL_SIMDAlignment = sizeof(void *); /* a good safe base value */
@@ -1005,6 +1016,9 @@ static Uint32 SDL_GetCPUFeatures(void)
 }
 
 void SDL_QuitCPUInfo(void) {
+    if (SDL_AtomicCompareAndSwap(&SDL_CPUFeatureMaskWatched, 1, 0)) {
+        SDL_DelHintCallback(SDL_HINT_CPU_FEATURE_MASK, SDL_CPUFeatureMaskChanged, NULL);
+    }
     SDL_CPUFeatures = SDL_CPUFEATURES_RESET_VALUE;
 }
 
@@ -1037,3 +1037,18 @@
 #define SDL_wcsnstr SDL_wcsnstr_REAL
 #define SDL_wcsstr SDL_wcsstr_REAL
 #define SDL_wcstol SDL_wcstol_REAL
+#define SDL_GetAudioDeviceStats SDL_GetAudioDeviceStats_REAL
+#define SDL_GetAudioStreamStats SDL_GetAudioStreamStats_REAL
+#define SDL_SetTraceEnabled SDL_SetTraceEnabled_REAL
+#define SDL_IsTraceEnabled SDL_IsTraceEnabled_REAL
+#define SDL_BeginTraceZone SDL_BeginTraceZone_REAL
+#define SDL_EndTraceZone SDL_EndTraceZone_REAL
+#define SDL_TraceCounter SDL_TraceCounter_REAL
+#define SDL_GetTraceCallback SDL_GetTraceCallback_REAL
+#define SDL_SetTraceCallback SDL_SetTraceCallback_REAL
+#define SDL_SaveTrace SDL_SaveTrace_REAL
+#define SDL_DelayPrecise SDL_DelayPrecise_REAL
+#define SDL_RequestClipboardData SDL_RequestClipboardData_REAL
+#define SDL_GetSensorSamples SDL_GetSensorSamples_REAL
+#define SDL_SetSurfaceDitherMode SDL_SetSurfaceDitherMode_REAL
+#define SDL_GetSurfaceDitherMode SDL_GetSurfaceDitherMode_REAL
@@ -1043,3 +1043,18 @@ SDL_DYNAPI_PROC(size_t,SDL_wcsnlen,(const wchar_t *a, size_t b),(a,b),return)
 SDL_DYNAPI_PROC(wchar_t*,SDL_wcsnstr,(const wchar_t *a, const wchar_t *b, size_t c),(a,b,c),return)
 SDL_DYNAPI_PROC(wchar_t*,SDL_wcsstr,(const wchar_t *a, const wchar_t *b),(a,b),return)
 SDL_DYNAPI_PROC(long,SDL_wcstol,(const wchar_t *a, wchar_t **b, int c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_GetAudioDeviceStats,(SDL_AudioDeviceID a, SDL_AudioDeviceStats *b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_GetAudioStreamStats,(SDL_AudioStream *a, SDL_AudioStreamStats *b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_SetTraceEnabled,(SDL_bool a),(a),return)
+SDL_DYNAPI_PROC(SDL_bool,SDL_IsTraceEnabled,(void),(),return)
+SDL_DYNAPI_PROC(void,SDL_BeginTraceZone,(const char *a),(a),)
+SDL_DYNAPI_PROC(void,SDL_EndTraceZone,(const char *a),(a),)
+SDL_DYNAPI_PROC(void,SDL_TraceCounter,(const char *a, Sint64 b),(a,b),)
+SDL_DYNAPI_PROC(void,SDL_GetTraceCallback,(SDL_TraceCallback *a, void **b),(a,b),)
+SDL_DYNAPI_PROC(void,SDL_SetTraceCallback,(SDL_TraceCallback a, void *b),(a,b),)
+SDL_DYNAPI_PROC(int,SDL_SaveTrace,(const char *a),(a),return)
+SDL_DYNAPI_PROC(void,SDL_DelayPrecise,(Uint64 a),(a),)
+SDL_DYNAPI_PROC(int,SDL_RequestClipboardData,(const char *a, SDL_ClipboardRequestCallback b, void *c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_GetSensorSamples,(SDL_Sensor *a, Uint32 *b, SDL_SensorSample *c, int d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(int,SDL_SetSurfaceDitherMode,(SDL_Surface *a, SDL_DitherMode b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_GetSurfaceDitherMode,(SDL_Surface *a, SDL_DitherMode *b),(a,b),return)
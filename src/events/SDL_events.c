@@ -24,6 +24,7 @@
 
 #include "SDL_events_c.h"
 #include "../SDL_hints_c.h"
+#include "../SDL_trace_c.h"
 #include "../audio/SDL_audio_c.h"
 #include "../camera/SDL_camera_c.h"
 #include "../timer/SDL_timer_c.h"
@@ -978,6 +979,8 @@ static void SDL_PumpEventsInternal(SDL_bool push_sentinel)
 {
     SDL_VideoDevice *_this = SDL_GetVideoDevice();
 
+    SDL_TRACE_ZONE_BEGIN("SDL_PumpEvents");
+
     /* Free old event memory */
     /*SDL_FlushEventMemory(SDL_last_event_id - SDL_MAX_QUEUED_EVENTS);*/
     if (SDL_AtomicGet(&SDL_EventQ.count) == 0) {
@@ -1028,6 +1031,9 @@ static void SDL_PumpEventsInternal(SDL_bool push_sentinel)
         sentinel.common.timestamp = 0;
         SDL_PushEvent(&sentinel);
     }
+
+    SDL_TRACE_COUNTER("SDL event queue", SDL_AtomicGet(&SDL_EventQ.count));
+    SDL_TRACE_ZONE_END("SDL_PumpEvents");
 }
 
 void SDL_PumpEvents(void)
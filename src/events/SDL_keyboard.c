@@ -46,6 +46,10 @@ typedef struct SDL_KeyboardInstance
     char *name;
 } SDL_KeyboardInstance;
 
+/* Open addressed hash tables of scancode + 1, 0 is an empty slot */
+#define SDL_KEYBOARD_INDEX_SIZE (SDL_NUM_SCANCODES * 2)
+#define SDL_KEYBOARD_INDEX_MASK (SDL_KEYBOARD_INDEX_SIZE - 1)
+
 typedef struct SDL_Keyboard
 {
     /* Data common to all keyboards */
@@ -54,6 +58,7 @@ typedef struct SDL_Keyboard
     Uint8 keysource[SDL_NUM_SCANCODES];
     Uint8 keystate[SDL_NUM_SCANCODES];
     SDL_Keycode keymap[SDL_NUM_SCANCODES];
+    Uint16 keymap_index[SDL_KEYBOARD_INDEX_SIZE];
     SDL_bool autorelease_pending;
     Uint64 hardware_timestamp;
 } SDL_Keyboard;
@@ -650,6 +655,99 @@ static const char *SDL_scancode_names[SDL_NUM_SCANCODES] = {
     /* 290 */ "EndCall",
 };
 
+/* Case-insensitive index of SDL_scancode_names, built on first lookup */
+static Uint16 SDL_scancode_name_index[SDL_KEYBOARD_INDEX_SIZE];
+static SDL_AtomicInt SDL_scancode_name_index_built;
+static SDL_bool SDL_scancode_name_index_complete;
+static SDL_SpinLock SDL_scancode_name_index_lock;
+
+/* Returns SDL_FALSE if the name has characters that SDL_strcasecmp() might fold to ASCII */
+static SDL_bool SDL_HashScancodeName(const char *name, Uint32 *hash)
+{
+    Uint32 h = 2166136261u;
+
+    for (; *name; ++name) {
+        unsigned char ch = (unsigned char)*name;
+        if (ch >= 0x80) {
+            return SDL_FALSE;
+        }
+        if (ch >= 'A' && ch <= 'Z') {
+            ch += 'a' - 'A';
+        }
+        h = (h ^ ch) * 16777619u;
+    }
+    *hash = h;
+    return SDL_TRUE;
+}
+
+static void SDL_BuildScancodeNameIndex(void)
+{
+    int i;
+
+    SDL_zeroa(SDL_scancode_name_index);
+    SDL_scancode_name_index_complete = SDL_TRUE;
+
+    for (i = 0; i < SDL_arraysize(SDL_scancode_names); ++i) {
+        const char *name = SDL_scancode_names[i];
+        Uint32 hash;
+        Uint32 slot;
+
+        if (!name) {
+            continue;
+        }
+        if (!SDL_HashScancodeName(name, &hash)) {
+            SDL_scancode_name_index_complete = SDL_FALSE;
+            continue;
+        }
+
+        /* Keep the first scancode with this name, to match a linear search */
+        for (slot = hash & SDL_KEYBOARD_INDEX_MASK; SDL_scancode_name_index[slot]; slot = (slot + 1) & SDL_KEYBOARD_INDEX_MASK) {
+            if (SDL_strcasecmp(name, SDL_scancode_names[SDL_scancode_name_index[slot] - 1]) == 0) {
+                break;
+            }
+        }
+        if (!SDL_scancode_name_index[slot]) {
+            SDL_scancode_name_index[slot] = (Uint16)(i + 1);
+        }
+    }
+}
+
+static SDL_Scancode SDL_FindScancodeName(const char *name)
+{
+    Uint32 hash;
+    Uint32 slot;
+    int i;
+
+    if (!SDL_AtomicGet(&SDL_scancode_name_index_built)) {
+        SDL_LockSpinlock(&SDL_scancode_name_index_lock);
+        if (!SDL_AtomicGet(&SDL_scancode_name_index_built)) {
+            SDL_BuildScancodeNameIndex();
+            SDL_AtomicSet(&SDL_scancode_name_index_built, 1);
+        }
+        SDL_UnlockSpinlock(&SDL_scancode_name_index_lock);
+    }
+
+    if (SDL_scancode_name_index_complete && SDL_HashScancodeName(name, &hash)) {
+        for (slot = hash & SDL_KEYBOARD_INDEX_MASK; SDL_scancode_name_index[slot]; slot = (slot + 1) & SDL_KEYBOARD_INDEX_MASK) {
+            SDL_Scancode scancode = (SDL_Scancode)(SDL_scancode_name_index[slot] - 1);
+            if (SDL_strcasecmp(name, SDL_scancode_names[scancode]) == 0) {
+                return scancode;
+            }
+        }
+        return SDL_SCANCODE_UNKNOWN;
+    }
+
+    for (i = 0; i < SDL_arraysize(SDL_scancode_names); ++i) {
+        if (!SDL_scancode_names[i]) {
+            continue;
+        }
+        if (SDL_strcasecmp(name, SDL_scancode_names[i]) == 0) {
+            return (SDL_Scancode)i;
+        }
+    }
+    return SDL_SCANCODE_UNKNOWN;
+}
+
 /* Taken from SDL_iconv() */
 char *SDL_UCS4ToUTF8(Uint32 ch, char *dst)
 {
@@ -816,6 +914,34 @@ void SDL_GetDefaultKeymap(SDL_Keycode *keymap)
     SDL_memcpy(keymap, SDL_default_keymap, sizeof(SDL_default_keymap));
 }
 
+static Uint32 SDL_HashKeycode(SDL_Keycode key)
+{
+    return ((Uint32)key * 0x9E3779B1u) >> 16;
+}
+
+/* Rebuild the reverse lookup for SDL_GetScancodeFromKey(), once per keymap change */
+static void SDL_BuildKeymapIndex(SDL_Keyboard *keyboard)
+{
+    SDL_Scancode scancode;
+
+    SDL_zeroa(keyboard->keymap_index);
+
+    for (scancode = SDL_SCANCODE_UNKNOWN; scancode < SDL_NUM_SCANCODES; ++scancode) {
+        const SDL_Keycode key = keyboard->keymap[scancode];
+        Uint32 slot;
+
+        /* Keep the first scancode with this keycode, to match a linear search */
+        for (slot = SDL_HashKeycode(key) & SDL_KEYBOARD_INDEX_MASK; keyboard->keymap_index[slot]; slot = (slot + 1) & SDL_KEYBOARD_INDEX_MASK) {
+            if (keyboard->keymap[keyboard->keymap_index[slot] - 1] == key) {
+                break;
+            }
+        }
+        if (!keyboard->keymap_index[slot]) {
+            keyboard->keymap_index[slot] = (Uint16)(scancode + 1);
+        }
+    }
+}
+
 void SDL_SetKeymap(int start, const SDL_Keycode *keys, int length, SDL_bool send_event)
 {
     SDL_Keyboard *keyboard = &SDL_keyboard;
@@ -865,6 +991,8 @@ void SDL_SetKeymap(int start, const SDL_Keycode *keys, int length, SDL_bool send
 
     SDL_memcpy(&keyboard->keymap[start], &normalized_keymap[start], sizeof(*keys) * length);
 
+    SDL_BuildKeymapIndex(keyboard);
+
     if (send_event) {
         SDL_SendKeymapChangedEvent();
     }
@@ -876,6 +1004,7 @@ void SDL_SetScancodeName(SDL_Scancode scancode, const char *name)
         return;
     }
     SDL_scancode_names[scancode] = name;
+    SDL_AtomicSet(&SDL_scancode_name_index_built, 0);
 }
 
 SDL_Window *SDL_GetKeyboardFocus(void)
@@ -1323,10 +1452,10 @@ SDL_Keycode SDL_GetDefaultKeyFromScancode(SDL_Scancode scancode)
 SDL_Scancode SDL_GetScancodeFromKey(SDL_Keycode key)
 {
     SDL_Keyboard *keyboard = &SDL_keyboard;
-    SDL_Scancode scancode;
+    Uint32 slot;
 
-    for (scancode = SDL_SCANCODE_UNKNOWN; scancode < SDL_NUM_SCANCODES;
-         ++scancode) {
+    for (slot = SDL_HashKeycode(key) & SDL_KEYBOARD_INDEX_MASK; keyboard->keymap_index[slot]; slot = (slot + 1) & SDL_KEYBOARD_INDEX_MASK) {
+        SDL_Scancode scancode = (SDL_Scancode)(keyboard->keymap_index[slot] - 1);
         if (keyboard->keymap[scancode] == key) {
             return scancode;
         }
@@ -1352,24 +1481,18 @@ const char *SDL_GetScancodeName(SDL_Scancode scancode)
 
 SDL_Scancode SDL_GetScancodeFromName(const char *name)
 {
-    int i;
+    SDL_Scancode scancode;
 
     if (!name || !*name) {
         SDL_InvalidParamError("name");
         return SDL_SCANCODE_UNKNOWN;
     }
 
-    for (i = 0; i < SDL_arraysize(SDL_scancode_names); ++i) {
-        if (!SDL_scancode_names[i]) {
-            continue;
-        }
-        if (SDL_strcasecmp(name, SDL_scancode_names[i]) == 0) {
-            return (SDL_Scancode)i;
-        }
+    scancode = SDL_FindScancodeName(name);
+    if (scancode == SDL_SCANCODE_UNKNOWN) {
+        SDL_InvalidParamError("name");
     }
-
-    SDL_InvalidParamError("name");
-    return SDL_SCANCODE_UNKNOWN;
+    return scancode;
 }
 
 const char *SDL_GetKeyName(SDL_Keycode key)
@@ -48,16 +48,16 @@ static SDL_Mutex *SDL_pen_access_lock;
 #  define SDL_UNLOCK_PENS()
 #endif
 
+#define PEN_INDEX_MIN_SIZE 16
+
 static struct
 {
-    SDL_Pen *pens;         /* if "sorted" is SDL_TRUE:
-                              sorted by: (is-attached, id):
-                              - first all attached pens, in ascending ID order
-                              - then all detached pens, in ascending ID order */
+    SDL_Pen **pens;        /* in registration order, each pen stays at the same address until SDL_PenQuit() */
     size_t pens_allocated; /* # entries allocated to "pens" */
     size_t pens_known;     /* <= pens_allocated; this includes detached pens */
-    size_t pens_attached;  /* <= pens_known; all attached pens are at the beginning of "pens" */
-    SDL_bool sorted;       /* This is SDL_FALSE in the period between SDL_PenGCMark() and SDL_PenGCSWeep() */
+    size_t pens_attached;  /* <= pens_known */
+    Uint32 *index;         /* open addressed table of (position in "pens" + 1) by pen ID, 0 is an empty slot */
+    Uint32 index_mask;
 } pen_handler;
 
 static SDL_PenID pen_invalid = { SDL_PEN_INVALID };
@@ -83,79 +83,130 @@ static int SDL_GUIDCompare(SDL_GUID lhs, SDL_GUID rhs)
     return SDL_memcmp(lhs.data, rhs.data, sizeof(lhs.data));
 }
 
-static int SDLCALL pen_compare(const void *lhs, const void *rhs)
+static int SDLCALL pen_id_compare(const void *lhs, const void *rhs)
 {
-    int left_inactive = (((const SDL_Pen *)lhs)->header.flags & SDL_PEN_FLAG_DETACHED);
-    int right_inactive = (((const SDL_Pen *)rhs)->header.flags & SDL_PEN_FLAG_DETACHED);
-    if (left_inactive && !right_inactive) {
-        return 1;
-    }
-    if (!left_inactive && right_inactive) {
+    const SDL_PenID l = *(const SDL_PenID *)lhs;
+    const SDL_PenID r = *(const SDL_PenID *)rhs;
+
+    if (l < r) {
         return -1;
     }
-    return ((const SDL_Pen *)lhs)->header.id - ((const SDL_Pen *)rhs)->header.id;
+    return (l > r) ? 1 : 0;
+}
+
+static Uint32 pen_hash(Uint32 instance_id)
+{
+    /* Pen IDs are often small and consecutive, spread them over the table */
+    return instance_id * 0x9E3779B1u;
 }
 
-static int SDLCALL pen_header_compare(const void *lhs, const void *rhs)
+/* Index the pen at "pos" in pen_handler.pens.  Only safe during SDL_LOCK_PENS. */
+static int pen_index_insert(size_t pos)
 {
-    const SDL_PenHeader *l = (const SDL_PenHeader *)lhs;
-    const SDL_PenHeader *r = (const SDL_PenHeader *)rhs;
-    int l_detached = l->flags & SDL_PEN_FLAG_DETACHED;
-    int r_detached = r->flags & SDL_PEN_FLAG_DETACHED;
+    const Uint32 size = pen_handler.index ? pen_handler.index_mask + 1 : 0;
+    Uint32 slot;
 
-    if (l_detached != r_detached) {
-        if (l_detached) {
+    /* Keep the table at most half full */
+    if ((pen_handler.pens_known + 1) * 2 > size) {
+        const Uint32 new_size = size ? size * 2 : PEN_INDEX_MIN_SIZE;
+        Uint32 *index = (Uint32 *)SDL_calloc(new_size, sizeof(*index));
+        Uint32 i;
+
+        if (!index) {
             return -1;
         }
-        return 1;
+        SDL_free(pen_handler.index);
+        pen_handler.index = index;
+        pen_handler.index_mask = new_size - 1;
+        for (i = 0; i < pen_handler.pens_known; ++i) {
+            if (i != pos) {
+                for (slot = pen_hash(pen_handler.pens[i]->header.id) & pen_handler.index_mask; index[slot]; slot = (slot + 1) & pen_handler.index_mask) {
+                }
+                index[slot] = i + 1;
+            }
+        }
     }
 
-    return l->id - r->id;
+    for (slot = pen_hash(pen_handler.pens[pos]->header.id) & pen_handler.index_mask; pen_handler.index[slot]; slot = (slot + 1) & pen_handler.index_mask) {
+    }
+    pen_handler.index[slot] = (Uint32)pos + 1;
+    return 0;
 }
 
-SDL_Pen *SDL_GetPenPtr(Uint32 instance_id)
+/* Remove the pen at "pos" from the index.  Only safe during SDL_LOCK_PENS. */
+static void pen_index_remove(size_t pos)
 {
-    unsigned int i;
+    const Uint32 mask = pen_handler.index_mask;
+    Uint32 slot, next, home;
 
-    if (!pen_handler.pens) {
-        return NULL;
+    for (slot = pen_hash(pen_handler.pens[pos]->header.id) & mask; pen_handler.index[slot] != pos + 1; slot = (slot + 1) & mask) {
+        if (!pen_handler.index[slot]) {
+            return;
+        }
     }
 
-    if (pen_handler.sorted) {
-        SDL_PenHeader key;
-        SDL_Pen *pen;
+    /* Shift back entries that probed past this slot, so lookups never need tombstones */
+    for (next = (slot + 1) & mask; pen_handler.index[next]; next = (next + 1) & mask) {
+        home = pen_hash(pen_handler.pens[pen_handler.index[next] - 1]->header.id) & mask;
+        if (((next - home) & mask) >= ((next - slot) & mask)) {
+            pen_handler.index[slot] = pen_handler.index[next];
+            slot = next;
+        }
+    }
+    pen_handler.index[slot] = 0;
+}
 
-        SDL_zero(key);
-        key.id = instance_id;
+SDL_Pen *SDL_GetPenPtr(Uint32 instance_id)
+{
+    Uint32 slot;
 
-        pen = (SDL_Pen *)SDL_bsearch(&key, pen_handler.pens, pen_handler.pens_known, sizeof(SDL_Pen), pen_header_compare);
-        if (pen) {
-            return pen;
-        }
-        /* If the pen is not active, fall through */
+    if (!pen_handler.index) {
+        return NULL;
     }
 
-    /* fall back to linear search */
-    for (i = 0; i < pen_handler.pens_known; ++i) {
-        if (pen_handler.pens[i].header.id == instance_id) {
-            return &pen_handler.pens[i];
+    for (slot = pen_hash(instance_id) & pen_handler.index_mask; pen_handler.index[slot]; slot = (slot + 1) & pen_handler.index_mask) {
+        SDL_Pen *pen = pen_handler.pens[pen_handler.index[slot] - 1];
+        if (pen->header.id == instance_id) {
+            return pen;
         }
     }
     return NULL;
 }
 
+/* Publish the status of a pen for SDL_GetPenStatus(), called from the thread sending pen events */
+static void pen_publish_status(SDL_Pen *pen)
+{
+    SDL_AtomicIncRef(&pen->status_sequence);
+    SDL_MemoryBarrierRelease();
+    pen->status_snapshot = pen->last;
+    pen->status_flags_snapshot = pen->header.flags;
+    SDL_MemoryBarrierRelease();
+    SDL_AtomicIncRef(&pen->status_sequence);
+}
+
 SDL_PenID *SDL_GetPens(int *count)
 {
-    int i;
-    int pens_nr = (int)pen_handler.pens_attached;
-    SDL_PenID *pens = (SDL_PenID *)SDL_calloc(pens_nr + 1, sizeof(SDL_PenID));
+    size_t i;
+    int pens_nr = 0;
+    SDL_PenID *pens;
+
+    SDL_LOCK_PENS();
+    pens = (SDL_PenID *)SDL_calloc(pen_handler.pens_attached + 1, sizeof(SDL_PenID));
     if (!pens) { /* OOM */
+        SDL_UNLOCK_PENS();
         return pens;
     }
 
-    for (i = 0; i < pens_nr; ++i) {
-        pens[i] = pen_handler.pens[i].header.id;
+    for (i = 0; i < pen_handler.pens_known && pens_nr < (int)pen_handler.pens_attached; ++i) {
+        const SDL_Pen *pen = pen_handler.pens[i];
+        if (!(pen->header.flags & (SDL_PEN_FLAG_DETACHED | SDL_PEN_FLAG_NEW))) {
+            pens[pens_nr++] = pen->header.id;
+        }
     }
+    SDL_UNLOCK_PENS();
+
+    /* Report pens in ascending ID order */
+    SDL_qsort(pens, pens_nr, sizeof(SDL_PenID), pen_id_compare);
 
     if (count) {
         *count = pens_nr;
@@ -169,7 +220,7 @@ SDL_PenID SDL_GetPenFromGUID(SDL_GUID guid)
     /* Must do linear search */
     SDL_LOCK_PENS();
     for (i = 0; i < pen_handler.pens_known; ++i) {
-        SDL_Pen *pen = &pen_handler.pens[i];
+        SDL_Pen *pen = pen_handler.pens[i];
 
         if (0 == SDL_GUIDCompare(guid, pen->guid)) {
             SDL_UNLOCK_PENS();
@@ -241,40 +292,47 @@ SDL_PenCapabilityFlags SDL_GetPenCapabilities(SDL_PenID instance_id, SDL_PenCapa
 
 Uint32 SDL_GetPenStatus(SDL_PenID instance_id, float *x, float *y, float *axes, size_t num_axes)
 {
-    Uint32 result;
+    SDL_PenStatusInfo status;
+    Uint32 flags;
+    int sequence;
     SDL_LOAD_LOCK_PEN(pen, instance_id, 0u);
+    /* The pen stays at this address, so the status can be read after unlocking */
+    SDL_UNLOCK_PENS();
+
+    /* Read a consistent snapshot, retrying if the event thread published a new one meanwhile */
+    for (;;) {
+        sequence = SDL_AtomicGet(&pen->status_sequence);
+        if (sequence & 1) {
+            SDL_CPUPauseInstruction();
+            continue;
+        }
+        SDL_MemoryBarrierAcquire();
+        status = pen->status_snapshot;
+        flags = pen->status_flags_snapshot;
+        SDL_MemoryBarrierAcquire();
+        if (SDL_AtomicGet(&pen->status_sequence) == sequence) {
+            break;
+        }
+    }
 
     if (x) {
-        *x = pen->last.x;
+        *x = status.x;
     }
     if (y) {
-        *y = pen->last.y;
+        *y = status.y;
     }
     if (axes && num_axes) {
         size_t axes_to_copy = SDL_min(num_axes, SDL_PEN_NUM_AXES);
-        SDL_memcpy(axes, pen->last.axes, sizeof(float) * axes_to_copy);
+        SDL_memcpy(axes, status.axes, sizeof(float) * axes_to_copy);
     }
-    result = pen->last.buttons | (pen->header.flags & (SDL_PEN_INK_MASK | SDL_PEN_ERASER_MASK | SDL_PEN_DOWN_MASK));
-    SDL_UNLOCK_PENS();
-    return result;
+    return status.buttons | (flags & (SDL_PEN_INK_MASK | SDL_PEN_ERASER_MASK | SDL_PEN_DOWN_MASK));
 }
 
 /* Backend functionality */
 
-/* Sort all pens.  Only safe during SDL_LOCK_PENS. */
-static void pen_sort(void)
-{
-    SDL_qsort(pen_handler.pens,
-              pen_handler.pens_known,
-              sizeof(SDL_Pen),
-              pen_compare);
-    pen_handler.sorted = SDL_TRUE;
-}
-
 SDL_Pen *SDL_PenModifyBegin(Uint32 instance_id)
 {
     SDL_PenID id = { 0 };
-    const size_t alloc_growth_constant = 1; /* Expect few pens */
     SDL_Pen *pen;
 
     id = instance_id;
@@ -288,20 +346,28 @@ SDL_Pen *SDL_PenModifyBegin(Uint32 instance_id)
     pen = SDL_GetPenPtr(id);
 
     if (!pen) {
-        if (!pen_handler.pens || pen_handler.pens_known == pen_handler.pens_allocated) {
-            size_t pens_to_allocate = pen_handler.pens_allocated + alloc_growth_constant;
-            SDL_Pen *pens;
-            if (pen_handler.pens) {
-                pens = (SDL_Pen *)SDL_realloc(pen_handler.pens, sizeof(SDL_Pen) * pens_to_allocate);
-                SDL_memset(pens + pen_handler.pens_known, 0,
-                           sizeof(SDL_Pen) * (pens_to_allocate - pen_handler.pens_allocated));
-            } else {
-                pens = (SDL_Pen *)SDL_calloc(sizeof(SDL_Pen), pens_to_allocate);
+        if (pen_handler.pens_known == pen_handler.pens_allocated) {
+            size_t pens_to_allocate = pen_handler.pens_allocated ? pen_handler.pens_allocated * 2 : 4;
+            SDL_Pen **pens = (SDL_Pen **)SDL_realloc(pen_handler.pens, sizeof(SDL_Pen *) * pens_to_allocate);
+            if (!pens) {
+                SDL_UNLOCK_PENS();
+                return NULL;
             }
             pen_handler.pens = pens;
             pen_handler.pens_allocated = pens_to_allocate;
         }
-        pen = &pen_handler.pens[pen_handler.pens_known];
+        pen = (SDL_Pen *)SDL_calloc(1, sizeof(SDL_Pen));
+        if (!pen) {
+            SDL_UNLOCK_PENS();
+            return NULL;
+        }
+        pen_handler.pens[pen_handler.pens_known] = pen;
+        pen->header.id = id;
+        if (pen_index_insert(pen_handler.pens_known) < 0) {
+            SDL_free(pen);
+            SDL_UNLOCK_PENS();
+            return NULL;
+        }
         pen_handler.pens_known += 1;
 
         /* Default pen initialization */
@@ -311,6 +377,13 @@ SDL_Pen *SDL_PenModifyBegin(Uint32 instance_id)
         pen->info.max_tilt = SDL_PEN_INFO_UNKNOWN;
         pen->type = SDL_PEN_TYPE_PEN;
         pen->name = (char *)SDL_calloc(1, SDL_PEN_MAX_NAME); /* Never deallocated */
+        if (!pen->name) {
+            pen_handler.pens_known -= 1;
+            pen_index_remove(pen_handler.pens_known);
+            SDL_free(pen);
+            SDL_UNLOCK_PENS();
+            return NULL;
+        }
     }
     return pen;
 }
@@ -343,7 +416,6 @@ void SDL_PenModifyEnd(SDL_Pen *pen, SDL_bool attach)
 {
     SDL_bool is_new = pen->header.flags & SDL_PEN_FLAG_NEW;
     SDL_bool was_attached = !(pen->header.flags & (SDL_PEN_FLAG_DETACHED | SDL_PEN_FLAG_NEW));
-    SDL_bool broke_sort_order = SDL_FALSE;
 
     if (pen->type == SDL_PEN_TYPE_NONE) {
         /* remove pen */
@@ -357,9 +429,12 @@ void SDL_PenModifyEnd(SDL_Pen *pen, SDL_bool attach)
             pen->type = SDL_PEN_TYPE_PEN;
             attach = SDL_FALSE;
         } else {
+            /* New pens are always the most recently registered one */
+            SDL_assert(pen_handler.pens[pen_handler.pens_known - 1] == pen);
+            pen_index_remove(pen_handler.pens_known - 1);
             pen_handler.pens_known -= 1;
             SDL_free(pen->name);
-            SDL_memset(pen, 0, sizeof(SDL_Pen));
+            SDL_free(pen);
             SDL_UNLOCK_PENS();
             return;
         }
@@ -369,14 +444,12 @@ void SDL_PenModifyEnd(SDL_Pen *pen, SDL_bool attach)
     if (attach == SDL_FALSE) {
         pen->header.flags |= SDL_PEN_FLAG_DETACHED;
         if (was_attached) {
-            broke_sort_order = SDL_TRUE;
             if (!is_new) {
                 pen_handler.pens_attached -= 1;
             }
             pen_hotplug_detach(pen);
         }
     } else if (!was_attached || is_new) {
-        broke_sort_order = SDL_TRUE;
         pen_handler.pens_attached += 1;
         pen_hotplug_attach(pen);
     }
@@ -407,13 +480,8 @@ void SDL_PenModifyEnd(SDL_Pen *pen, SDL_bool attach)
         } else {
             pen->header.flags = (pen->header.flags & ~SDL_PEN_ERASER_MASK) | SDL_PEN_INK_MASK;
         }
-
-        broke_sort_order = SDL_TRUE;
-    }
-    if (broke_sort_order && pen_handler.sorted) {
-        /* Maintain sortedness invariant */
-        pen_sort();
     }
+    pen_publish_status(pen);
     SDL_UNLOCK_PENS();
 }
 
@@ -422,23 +490,22 @@ void SDL_PenGCMark(void)
     unsigned int i;
     SDL_LOCK_PENS();
     for (i = 0; i < pen_handler.pens_known; ++i) {
-        SDL_Pen *pen = &pen_handler.pens[i];
+        SDL_Pen *pen = pen_handler.pens[i];
         pen->header.flags |= SDL_PEN_FLAG_STALE;
     }
-    pen_handler.sorted = SDL_FALSE;
     SDL_UNLOCK_PENS();
 }
 
 void SDL_PenGCSweep(void *context, void (*free_deviceinfo)(Uint32, void *, void *))
 {
     unsigned int i;
-    pen_handler.pens_attached = 0;
 
     SDL_LOCK_PENS();
+    pen_handler.pens_attached = 0;
     /* We don't actually free the SDL_Pen entries, so that we can still answer queries about
        formerly active SDL_PenIDs later.  */
     for (i = 0; i < pen_handler.pens_known; ++i) {
-        SDL_Pen *pen = &pen_handler.pens[i];
+        SDL_Pen *pen = pen_handler.pens[i];
 
         if (pen->header.flags & SDL_PEN_FLAG_STALE) {
             pen->header.flags |= SDL_PEN_FLAG_DETACHED;
@@ -453,7 +520,6 @@ void SDL_PenGCSweep(void *context, void (*free_deviceinfo)(Uint32, void *, void
 
         pen->header.flags &= ~SDL_PEN_FLAG_STALE;
     }
-    pen_sort();
     /* We could test for changes in the above and send a hotplugging event here */
     SDL_UNLOCK_PENS();
 }
@@ -504,8 +570,8 @@ int SDL_SendPenMotion(Uint64 timestamp,
     SDL_bool posted = SDL_FALSE;
     float x = status->x;
     float y = status->y;
-    float last_x = pen->last.x;
-    float last_y = pen->last.y;
+    float last_x;
+    float last_y;
     /* Suppress mouse updates for axis changes or sub-pixel movement: */
     SDL_bool send_mouse_update;
     SDL_bool axes_changed = SDL_FALSE;
@@ -514,6 +580,8 @@ int SDL_SendPenMotion(Uint64 timestamp,
     if (!pen) {
         return SDL_FALSE;
     }
+    last_x = pen->last.x;
+    last_y = pen->last.y;
     window = pen->header.window;
     if (!window) {
         return SDL_FALSE;
@@ -537,6 +605,7 @@ int SDL_SendPenMotion(Uint64 timestamp,
         /* No-op event */
         return SDL_FALSE;
     }
+    pen_publish_status(pen);
 
     send_mouse_update = (x != last_x) || (y != last_y);
 
@@ -608,6 +677,7 @@ int SDL_SendPenTipEvent(Uint64 timestamp, SDL_PenID instance_id, Uint8 state)
         event.pbutton.type = SDL_EVENT_PEN_UP;
         pen->header.flags &= ~SDL_PEN_DOWN_MASK;
     }
+    pen_publish_status(pen);
 
     if (SDL_EventEnabled(event.ptip.type)) {
         event_setup(pen, window, timestamp, &pen->last, &event);
@@ -686,6 +756,7 @@ int SDL_SendPenButton(Uint64 timestamp,
         event.pbutton.type = SDL_EVENT_PEN_BUTTON_UP;
         pen->last.buttons &= ~(1 << (button - 1));
     }
+    pen_publish_status(pen);
 
     if (SDL_EventEnabled(event.pbutton.type)) {
         event_setup(pen, window, timestamp, &pen->last, &event);
@@ -844,9 +915,11 @@ void SDL_PenQuit(void)
 
     if (pen_handler.pens) {
         for (i = 0; i < pen_handler.pens_known; ++i) {
-            SDL_free(pen_handler.pens[i].name);
+            SDL_free(pen_handler.pens[i]->name);
+            SDL_free(pen_handler.pens[i]);
         }
         SDL_free(pen_handler.pens);
+        SDL_free(pen_handler.index);
         /* Reset static pen information */
         SDL_memset(&pen_handler, 0, sizeof(pen_handler));
     }
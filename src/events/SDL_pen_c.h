@@ -92,6 +92,12 @@ typedef struct SDL_Pen
                                    creation. */
 
     void *deviceinfo; /* implementation-specific information */
+
+    /* Copy of "last" and the public status flags for SDL_GetPenStatus(), published
+       by the event thread without taking the pen lock. Backend MUST NOT write to these. */
+    SDL_AtomicInt status_sequence; /* odd while a new snapshot is being written */
+    SDL_PenStatusInfo status_snapshot;
+    Uint32 status_flags_snapshot;
 } SDL_Pen;
 
 /* ---- API for backend driver only ---- */
@@ -102,7 +108,8 @@ typedef struct SDL_Pen
  * \param instance_id A Uint32 pen identifier (driver-dependent meaning).  Must not be 0 = SDL_PEN_INVALID.
  * The same ID is exposed to clients as SDL_PenID.
  *
- * The pen pointer is only valid until the next call to SDL_PenModifyEnd() or SDL_PenGCSweep()
+ * Pens are never moved or freed before SDL_PenQuit(), so the pointer stays valid while the
+ * pen subsystem is initialised, including for detached pens.
  *
  * \return pen, if it exists, or NULL
  */
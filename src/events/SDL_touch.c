@@ -27,6 +27,7 @@
 
 static int SDL_num_touch = 0;
 static SDL_Touch **SDL_touchDevices = NULL;
+static SDL_TouchIDMap SDL_touch_map;
 
 /* for mapping touch events to mice */
 
@@ -38,6 +39,120 @@ static SDL_FingerID track_fingerid;
 static SDL_TouchID track_touchid;
 #endif
 
+/* Touch devices and fingers are looked up by ID on every event, so both are
+   indexed by open addressed tables that map the ID to an array index */
+#define SDL_TOUCH_MAP_MIN_SIZE 16
+
+static Uint32 SDL_HashTouchID(Uint64 id)
+{
+    id ^= id >> 33;
+    id *= SDL_UINT64_C(0xFF51AFD7ED558CCD);
+    id ^= id >> 33;
+    return (Uint32)id;
+}
+
+static int SDL_FindTouchIDIndex(const SDL_TouchIDMap *map, Uint64 id)
+{
+    Uint32 slot;
+
+    if (!map->slots) {
+        return -1;
+    }
+    for (slot = SDL_HashTouchID(id) & map->mask; map->slots[slot].index; slot = (slot + 1) & map->mask) {
+        if (map->slots[slot].id == id) {
+            return map->slots[slot].index - 1;
+        }
+    }
+    return -1;
+}
+
+static int SDL_GrowTouchIDMap(SDL_TouchIDMap *map)
+{
+    const Uint32 size = map->slots ? (map->mask + 1) * 2 : SDL_TOUCH_MAP_MIN_SIZE;
+    SDL_TouchIDSlot *slots;
+    Uint32 i, slot;
+
+    slots = (SDL_TouchIDSlot *)SDL_calloc(size, sizeof(*slots));
+    if (!slots) {
+        return -1;
+    }
+    if (map->slots) {
+        for (i = 0; i <= map->mask; ++i) {
+            if (map->slots[i].index) {
+                for (slot = SDL_HashTouchID(map->slots[i].id) & (size - 1); slots[slot].index; slot = (slot + 1) & (size - 1)) {
+                }
+                slots[slot] = map->slots[i];
+            }
+        }
+        SDL_free(map->slots);
+    }
+    map->slots = slots;
+    map->mask = size - 1;
+    return 0;
+}
+
+/* Adds the ID or updates its index if it's already in the map */
+static int SDL_SetTouchIDIndex(SDL_TouchIDMap *map, Uint64 id, int index)
+{
+    Uint32 slot;
+
+    if (map->slots) {
+        for (slot = SDL_HashTouchID(id) & map->mask; map->slots[slot].index; slot = (slot + 1) & map->mask) {
+            if (map->slots[slot].id == id) {
+                map->slots[slot].index = index + 1;
+                return 0;
+            }
+        }
+    }
+
+    /* Keep the map at most half full */
+    if (!map->slots || (Uint32)(map->count + 1) * 2 > map->mask + 1) {
+        if (SDL_GrowTouchIDMap(map) < 0) {
+            return -1;
+        }
+    }
+    for (slot = SDL_HashTouchID(id) & map->mask; map->slots[slot].index; slot = (slot + 1) & map->mask) {
+    }
+    map->slots[slot].id = id;
+    map->slots[slot].index = index + 1;
+    ++map->count;
+    return 0;
+}
+
+static void SDL_RemoveTouchID(SDL_TouchIDMap *map, Uint64 id)
+{
+    Uint32 slot, next, home;
+
+    if (!map->slots) {
+        return;
+    }
+    for (slot = SDL_HashTouchID(id) & map->mask; map->slots[slot].id != id; slot = (slot + 1) & map->mask) {
+        if (!map->slots[slot].index) {
+            return;
+        }
+    }
+    if (!map->slots[slot].index) {
+        return;
+    }
+
+    /* Shift back any entries that probed past this slot, so lookups don't need tombstones */
+    for (next = (slot + 1) & map->mask; map->slots[next].index; next = (next + 1) & map->mask) {
+        home = SDL_HashTouchID(map->slots[next].id) & map->mask;
+        if (((next - home) & map->mask) >= ((next - slot) & map->mask)) {
+            map->slots[slot] = map->slots[next];
+            slot = next;
+        }
+    }
+    map->slots[slot].index = 0;
+    --map->count;
+}
+
+static void SDL_FreeTouchIDMap(SDL_TouchIDMap *map)
+{
+    SDL_free(map->slots);
+    SDL_zerop(map);
+}
+
 /* Public functions */
 int SDL_InitTouch(void)
 {
@@ -72,16 +187,7 @@ SDL_TouchID *SDL_GetTouchDevices(int *count)
 
 static int SDL_GetTouchIndex(SDL_TouchID id)
 {
-    int index;
-    SDL_Touch *touch;
-
-    for (index = 0; index < SDL_num_touch; ++index) {
-        touch = SDL_touchDevices[index];
-        if (touch->id == id) {
-            return index;
-        }
-    }
-    return -1;
+    return SDL_FindTouchIDIndex(&SDL_touch_map, id);
 }
 
 SDL_Touch *SDL_GetTouch(SDL_TouchID id)
@@ -113,13 +219,7 @@ SDL_TouchDeviceType SDL_GetTouchDeviceType(SDL_TouchID id)
 
 static int SDL_GetFingerIndex(const SDL_Touch *touch, SDL_FingerID fingerid)
 {
-    int index;
-    for (index = 0; index < touch->num_fingers; ++index) {
-        if (touch->fingers[index]->id == fingerid) {
-            return index;
-        }
-    }
-    return -1;
+    return SDL_FindTouchIDIndex(&touch->finger_map, fingerid);
 }
 
 static SDL_Finger *SDL_GetFinger(const SDL_Touch *touch, SDL_FingerID id)
@@ -128,7 +228,7 @@ static SDL_Finger *SDL_GetFinger(const SDL_Touch *touch, SDL_FingerID id)
     if (index < 0 || index >= touch->num_fingers) {
         return NULL;
     }
-    return touch->fingers[index];
+    return &touch->fingers[index];
 }
 
 SDL_Finger **SDL_GetTouchFingers(SDL_TouchID touchID, int *count)
@@ -154,7 +254,7 @@ SDL_Finger **SDL_GetTouchFingers(SDL_TouchID touchID, int *count)
 
     for (int i = 0; i < touch->num_fingers; ++i) {
         fingers[i] = &finger_data[i];
-        SDL_copyp(fingers[i], touch->fingers[i]);
+        SDL_copyp(fingers[i], &touch->fingers[i]);
     }
     fingers[touch->num_fingers] = NULL;
 
@@ -186,10 +286,14 @@ int SDL_AddTouch(SDL_TouchID touchID, SDL_TouchDeviceType type, const char *name
     SDL_touchDevices = touchDevices;
     index = SDL_num_touch;
 
-    SDL_touchDevices[index] = (SDL_Touch *)SDL_malloc(sizeof(*SDL_touchDevices[index]));
+    SDL_touchDevices[index] = (SDL_Touch *)SDL_calloc(1, sizeof(*SDL_touchDevices[index]));
     if (!SDL_touchDevices[index]) {
         return -1;
     }
+    if (SDL_SetTouchIDIndex(&SDL_touch_map, touchID, index) < 0) {
+        SDL_free(SDL_touchDevices[index]);
+        return -1;
+    }
 
     /* Added touch to list */
     ++SDL_num_touch;
@@ -197,9 +301,6 @@ int SDL_AddTouch(SDL_TouchID touchID, SDL_TouchDeviceType type, const char *name
     /* we're setting the touch properties */
     SDL_touchDevices[index]->id = touchID;
     SDL_touchDevices[index]->type = type;
-    SDL_touchDevices[index]->num_fingers = 0;
-    SDL_touchDevices[index]->max_fingers = 0;
-    SDL_touchDevices[index]->fingers = NULL;
     SDL_touchDevices[index]->name = SDL_strdup(name ? name : "");
 
     return index;
@@ -212,20 +313,21 @@ static int SDL_AddFinger(SDL_Touch *touch, SDL_FingerID fingerid, float x, float
     SDL_assert(fingerid != 0);
 
     if (touch->num_fingers == touch->max_fingers) {
-        SDL_Finger **new_fingers;
-        new_fingers = (SDL_Finger **)SDL_realloc(touch->fingers, (touch->max_fingers + 1) * sizeof(*touch->fingers));
+        /* Grow the pool geometrically, finger slots are reused as fingers come and go */
+        const int max_fingers = touch->max_fingers ? touch->max_fingers * 2 : 8;
+        SDL_Finger *new_fingers = (SDL_Finger *)SDL_realloc(touch->fingers, max_fingers * sizeof(*touch->fingers));
         if (!new_fingers) {
             return -1;
         }
         touch->fingers = new_fingers;
-        touch->fingers[touch->max_fingers] = (SDL_Finger *)SDL_malloc(sizeof(*finger));
-        if (!touch->fingers[touch->max_fingers]) {
-            return -1;
-        }
-        touch->max_fingers++;
+        touch->max_fingers = max_fingers;
     }
 
-    finger = touch->fingers[touch->num_fingers++];
+    if (SDL_SetTouchIDIndex(&touch->finger_map, fingerid, touch->num_fingers) < 0) {
+        return -1;
+    }
+
+    finger = &touch->fingers[touch->num_fingers++];
     finger->id = fingerid;
     finger->x = x;
     finger->y = y;
@@ -240,14 +342,12 @@ static int SDL_DelFinger(SDL_Touch *touch, SDL_FingerID fingerid)
         return -1;
     }
 
+    SDL_RemoveTouchID(&touch->finger_map, fingerid);
     --touch->num_fingers;
-    if (index < (touch->num_fingers)) {
-        // Move the deleted finger to just past the end of the active fingers array and shift the active fingers by one.
-        // This ensures that the descriptor for the now-deleted finger is located at `touch->fingers[touch->num_fingers]`
-        // and is ready for use in SDL_AddFinger.
-        SDL_Finger *deleted_finger = touch->fingers[index]; 
-        SDL_memmove(&touch->fingers[index], &touch->fingers[index + 1], (touch->num_fingers - index) * sizeof(touch->fingers[index]));
-        touch->fingers[touch->num_fingers] = deleted_finger;
+    if (index < touch->num_fingers) {
+        // Move the last active finger into the hole, so removal doesn't depend on the number of fingers
+        touch->fingers[index] = touch->fingers[touch->num_fingers];
+        SDL_SetTouchIDIndex(&touch->finger_map, touch->fingers[index].id, index);
     }
     return 0;
 }
@@ -380,22 +480,14 @@ int SDL_SendTouch(Uint64 timestamp, SDL_TouchID id, SDL_FingerID fingerid, SDL_W
     return posted;
 }
 
-int SDL_SendTouchMotion(Uint64 timestamp, SDL_TouchID id, SDL_FingerID fingerid, SDL_Window *window,
-                        float x, float y, float pressure)
+static int SDL_SendTouchMotionInternal(Uint64 timestamp, SDL_Touch *touch, SDL_Mouse *mouse, SDL_FingerID fingerid, SDL_Window *window,
+                                       float x, float y, float pressure)
 {
-    SDL_Touch *touch;
+    const SDL_TouchID id = touch->id;
     SDL_Finger *finger;
-    SDL_Mouse *mouse;
     int posted;
     float xrel, yrel, prel;
 
-    touch = SDL_GetTouch(id);
-    if (!touch) {
-        return -1;
-    }
-
-    mouse = SDL_GetMouse();
-
 #if SYNTHESIZE_TOUCH_TO_MOUSE
     /* SDL_HINT_TOUCH_MOUSE_EVENTS: controlling whether touch events should generate synthetic mouse events */
     {
@@ -473,9 +565,39 @@ int SDL_SendTouchMotion(Uint64 timestamp, SDL_TouchID id, SDL_FingerID fingerid,
     return posted;
 }
 
+int SDL_SendTouchMotion(Uint64 timestamp, SDL_TouchID id, SDL_FingerID fingerid, SDL_Window *window,
+                        float x, float y, float pressure)
+{
+    SDL_Touch *touch = SDL_GetTouch(id);
+    if (!touch) {
+        return -1;
+    }
+    return SDL_SendTouchMotionInternal(timestamp, touch, SDL_GetMouse(), fingerid, window, x, y, pressure);
+}
+
+int SDL_SendTouchMotions(Uint64 timestamp, SDL_TouchID id, SDL_Window *window, const SDL_Finger *fingers, int num_fingers)
+{
+    SDL_Touch *touch;
+    SDL_Mouse *mouse;
+    int i, posted = 0;
+
+    touch = SDL_GetTouch(id);
+    if (!touch) {
+        return -1;
+    }
+
+    mouse = SDL_GetMouse();
+    for (i = 0; i < num_fingers; ++i) {
+        if (SDL_SendTouchMotionInternal(timestamp, touch, mouse, fingers[i].id, window, fingers[i].x, fingers[i].y, fingers[i].pressure) > 0) {
+            ++posted;
+        }
+    }
+    return posted;
+}
+
 void SDL_DelTouch(SDL_TouchID id)
 {
-    int i, index;
+    int index;
     SDL_Touch *touch;
 
     if (SDL_num_touch == 0) {
@@ -489,15 +611,17 @@ void SDL_DelTouch(SDL_TouchID id)
         return;
     }
 
-    for (i = 0; i < touch->max_fingers; ++i) {
-        SDL_free(touch->fingers[i]);
-    }
     SDL_free(touch->fingers);
+    SDL_FreeTouchIDMap(&touch->finger_map);
     SDL_free(touch->name);
     SDL_free(touch);
 
+    SDL_RemoveTouchID(&SDL_touch_map, id);
     SDL_num_touch--;
-    SDL_touchDevices[index] = SDL_touchDevices[SDL_num_touch];
+    if (index < SDL_num_touch) {
+        SDL_touchDevices[index] = SDL_touchDevices[SDL_num_touch];
+        SDL_SetTouchIDIndex(&SDL_touch_map, SDL_touchDevices[index]->id, index);
+    }
 }
 
 void SDL_QuitTouch(void)
@@ -511,4 +635,5 @@ void SDL_QuitTouch(void)
 
     SDL_free(SDL_touchDevices);
     SDL_touchDevices = NULL;
+    SDL_FreeTouchIDMap(&SDL_touch_map);
 }
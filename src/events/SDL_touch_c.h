@@ -23,13 +23,28 @@
 #ifndef SDL_touch_c_h_
 #define SDL_touch_c_h_
 
+/* An open addressed table from touch or finger ID to an array index */
+typedef struct SDL_TouchIDSlot
+{
+    Uint64 id;
+    int index; /* array index + 1, 0 is an empty slot */
+} SDL_TouchIDSlot;
+
+typedef struct SDL_TouchIDMap
+{
+    SDL_TouchIDSlot *slots;
+    Uint32 mask;
+    int count;
+} SDL_TouchIDMap;
+
 typedef struct SDL_Touch
 {
     SDL_TouchID id;
     SDL_TouchDeviceType type;
     int num_fingers;
     int max_fingers;
-    SDL_Finger **fingers;
+    SDL_Finger *fingers; /* the active fingers, in a pool that only grows */
+    SDL_TouchIDMap finger_map;
     char *name;
 } SDL_Touch;
 
@@ -51,6 +66,9 @@ extern int SDL_SendTouch(Uint64 timestamp, SDL_TouchID id, SDL_FingerID fingerid
 /* Send a touch motion event for a touch */
 extern int SDL_SendTouchMotion(Uint64 timestamp, SDL_TouchID id, SDL_FingerID fingerid, SDL_Window *window, float x, float y, float pressure);
 
+/* Send touch motion events for several fingers of a touch at once, returns the number of events posted */
+extern int SDL_SendTouchMotions(Uint64 timestamp, SDL_TouchID id, SDL_Window *window, const SDL_Finger *fingers, int num_fingers);
+
 /* Remove a touch */
 extern void SDL_DelTouch(SDL_TouchID id);
 
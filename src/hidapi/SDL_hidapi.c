@@ -33,6 +33,7 @@
 #include "SDL_hidapi_c.h"
 #include "../joystick/usb_ids.h"
 #include "../SDL_hints_c.h"
+#include "../SDL_trace_c.h"
 
 /* Initial type declarations */
 #define HID_API_NO_EXPORT_DEFINE /* do not export hidapi procedures */
@@ -1415,11 +1416,14 @@ struct SDL_hid_device_info *SDL_hid_enumerate(unsigned short vendor_id, unsigned
     struct hid_device_info *raw_devs = NULL;
     struct hid_device_info *dev;
     struct SDL_hid_device_info *devs = NULL, *last = NULL;
+    Uint64 start;
 
     if (SDL_hidapi_refcount == 0 && SDL_hid_init() != 0) {
         return NULL;
     }
 
+    start = SDL_BeginStartupTrace();
+
     /* Collect the available devices */
 #ifdef HAVE_DRIVER_BACKEND
     driver_devs = DRIVER_hid_enumerate(vendor_id, product_id);
@@ -1485,6 +1489,8 @@ struct SDL_hid_device_info *SDL_hid_enumerate(unsigned short vendor_id, unsigned
     PLATFORM_hid_free_enumeration(raw_devs);
 #endif
 
+    SDL_EndStartupTrace(start, "hidapi", "enumerate", SDL_TRUE);
+
     return devs;
 }
 
@@ -24,6 +24,7 @@
 
 #include "SDL_sysjoystick.h"
 #include "../SDL_hints_c.h"
+#include "../SDL_trace_c.h"
 #include "SDL_gamepad_c.h"
 #include "SDL_joystick_c.h"
 #include "SDL_steam_virtual_gamepad.h"
@@ -609,6 +610,7 @@ static void SDLCALL SDL_JoystickAllowBackgroundEventsChanged(void *userdata, con
 int SDL_InitJoysticks(void)
 {
     int i, status;
+    Uint64 start;
 
     /* Create the joystick list lock */
     if (SDL_joystick_lock == NULL) {
@@ -641,11 +643,13 @@ int SDL_InitJoysticks(void)
     SDL_InitSteamVirtualGamepadInfo();
 
     status = -1;
+    start = SDL_BeginStartupTrace();
     for (i = 0; i < SDL_arraysize(SDL_joystick_drivers); ++i) {
         if (SDL_joystick_drivers[i]->Init() >= 0) {
             status = 0;
         }
     }
+    SDL_EndStartupTrace(start, "joystick", "DetectDevices", status == 0);
     SDL_UnlockJoysticks();
 
     if (status < 0) {
@@ -2391,6 +2395,8 @@ void SDL_UpdateJoysticks(void)
         return;
     }
 
+    SDL_TRACE_ZONE_BEGIN("SDL_UpdateJoysticks");
+
     SDL_LockJoysticks();
 
     if (SDL_UpdateSteamVirtualGamepadInfo()) {
@@ -2453,6 +2459,8 @@ void SDL_UpdateJoysticks(void)
     }
 
     SDL_UnlockJoysticks();
+
+    SDL_TRACE_ZONE_END("SDL_UpdateJoysticks");
 }
 
 static const Uint32 SDL_joystick_event_list[] = {
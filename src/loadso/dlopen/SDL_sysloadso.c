@@ -28,6 +28,8 @@
 #include <stdio.h>
 #include <dlfcn.h>
 
+#include "../../SDL_trace_c.h"
+
 #ifdef SDL_VIDEO_DRIVER_UIKIT
 #include "../../video/uikit/SDL_uikitvideo.h"
 #endif
@@ -36,6 +38,7 @@ void *SDL_LoadObject(const char *sofile)
 {
     void *handle;
     const char *loaderror;
+    Uint64 start;
 
 #ifdef SDL_VIDEO_DRIVER_UIKIT
     if (!UIKit_IsSystemVersionAtLeast(8.0)) {
@@ -44,8 +47,10 @@ void *SDL_LoadObject(const char *sofile)
     }
 #endif
 
+    start = SDL_BeginStartupTrace();
     handle = dlopen(sofile, RTLD_NOW | RTLD_LOCAL);
     loaderror = dlerror();
+    SDL_EndStartupTrace(start, "loadso", sofile ? sofile : "(main program)", handle != NULL);
     if (!handle) {
         SDL_SetError("Failed loading %s: %s", sofile, loaderror);
     }
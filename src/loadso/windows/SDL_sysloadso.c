@@ -26,17 +26,20 @@
 /* System dependent library loading routines                           */
 
 #include "../../core/windows/SDL_windows.h"
+#include "../../SDL_trace_c.h"
 
 void *SDL_LoadObject(const char *sofile)
 {
     void *handle;
     LPTSTR tstr;
+    Uint64 start;
 
     if (!sofile) {
         SDL_InvalidParamError("sofile");
         return NULL;
     }
     tstr = WIN_UTF8ToString(sofile);
+    start = SDL_BeginStartupTrace();
 #ifdef SDL_PLATFORM_WINRT
     /* WinRT only publicly supports LoadPackagedLibrary() for loading .dll
        files.  LoadLibrary() is a private API, and not available for apps
@@ -46,6 +49,7 @@ void *SDL_LoadObject(const char *sofile)
 #else
     handle = (void *)LoadLibrary(tstr);
 #endif
+    SDL_EndStartupTrace(start, "loadso", sofile, handle != NULL);
     SDL_free(tstr);
 
     /* Generate an error message if all loads failed */
@@ -22,18 +22,94 @@
 #include "SDL_internal.h"
 #include "../SDL_main_callbacks.h"
 #include "../../video/SDL_sysvideo.h"
+#include "../../timer/SDL_timer_c.h"
+#include "../../SDL_trace_c.h"
 
 #ifndef SDL_PLATFORM_IOS
 
-static int callback_rate_increment = 0;
+// Paces SDL_AppIterate() to absolute deadlines, so the oversleep of one
+//  iteration is taken out of the next one instead of adding up.
+typedef struct SDL_MainCallbackPacing
+{
+    Uint64 interval;        // nanoseconds between iterations, 0 to run unpaced
+    Uint64 spin;            // nanoseconds to busy-wait before each deadline
+    Uint64 next_deadline;   // 0 if the schedule needs to be restarted
+    Uint64 iterations;      // paced iterations
+    Uint64 missed;          // deadlines skipped because we fell too far behind
+    Uint64 total_lateness;  // sum of how late each wakeup was
+    Uint64 max_lateness;    // latest wakeup
+} SDL_MainCallbackPacing;
+
+static SDL_MainCallbackPacing pacing;
+
+// The slowest we'll pace iterations, one per hour.
+#define MAX_CALLBACK_INTERVAL_NS (SDL_NS_PER_SECOND * 60 * 60)
 
 static void SDLCALL MainCallbackRateHintChanged(void *userdata, const char *name, const char *oldValue, const char *newValue)
 {
-    const int callback_rate = newValue ? SDL_atoi(newValue) : 60;
-    if (callback_rate > 0) {
-        callback_rate_increment = ((Uint64) 1000000000) / ((Uint64) callback_rate);
+    const double callback_rate = newValue ? SDL_atof(newValue) : 60.0;
+    if (callback_rate > 0.0) {
+        // Clamp before converting, a tiny rate would overflow the interval.
+        const double interval = SDL_NS_PER_SECOND / callback_rate;
+        pacing.interval = (interval < (double)MAX_CALLBACK_INTERVAL_NS) ? (Uint64)interval : MAX_CALLBACK_INTERVAL_NS;
     } else {
-        callback_rate_increment = 0;
+        pacing.interval = 0;
+    }
+    pacing.next_deadline = 0;
+}
+
+static void SDLCALL MainCallbackSpinHintChanged(void *userdata, const char *name, const char *oldValue, const char *newValue)
+{
+    const int spin = newValue ? SDL_atoi(newValue) : 0;
+    pacing.spin = (spin > 0) ? SDL_US_TO_NS((Uint64)spin) : 0;
+}
+
+static void WaitForNextIteration(void)
+{
+    Uint64 now = SDL_GetTicksNS();
+    Uint64 deadline = pacing.next_deadline;
+
+    if (!deadline) {
+        // First iteration, or the rate changed: start a new schedule from here.
+        deadline = now + pacing.interval;
+    }
+
+    if (now < deadline) {
+        if (deadline - now > pacing.spin) {
+            SDL_DelayUntilNS(deadline - pacing.spin);
+        }
+        if (pacing.spin) {
+            now = SDL_SpinUntilNS(deadline);
+        } else {
+            now = SDL_GetTicksNS();
+        }
+    }
+
+    const Uint64 lateness = (now > deadline) ? (now - deadline) : 0;
+    pacing.total_lateness += lateness;
+    if (lateness > pacing.max_lateness) {
+        pacing.max_lateness = lateness;
+    }
+    ++pacing.iterations;
+
+    if (lateness >= pacing.interval) {
+        // We fell a whole iteration or more behind, skip the deadlines we
+        //  missed rather than running a burst of iterations to catch up.
+        const Uint64 missed = lateness / pacing.interval;
+        pacing.missed += missed;
+        deadline += missed * pacing.interval;
+        SDL_TRACE_COUNTER("SDL main callback missed deadlines", (Sint64)pacing.missed);
+    }
+    pacing.next_deadline = deadline + pacing.interval;
+}
+
+static void LogPacingStatistics(void)
+{
+    if (pacing.iterations > 0) {
+        SDL_LogDebug(SDL_LOG_CATEGORY_SYSTEM, "Main callback pacing: %" SDL_PRIu64 " iterations, %" SDL_PRIu64 " missed deadlines, average lateness %" SDL_PRIu64 " us, max lateness %" SDL_PRIu64 " us",
+                     pacing.iterations, pacing.missed,
+                     SDL_NS_TO_US(pacing.total_lateness / pacing.iterations),
+                     SDL_NS_TO_US(pacing.max_lateness));
     }
 }
 
@@ -41,9 +117,9 @@ int SDL_EnterAppMainCallbacks(int argc, char* argv[], SDL_AppInit_func appinit,
 {
     int rc = SDL_InitMainCallbacks(argc, argv, appinit, appiter, appevent, appquit);
     if (rc == 0) {
+        SDL_zero(pacing);
         SDL_AddHintCallback(SDL_HINT_MAIN_CALLBACK_RATE, MainCallbackRateHintChanged, NULL);
-
-        Uint64 next_iteration = callback_rate_increment ? (SDL_GetTicksNS() + callback_rate_increment) : 0;
+        SDL_AddHintCallback(SDL_HINT_MAIN_CALLBACK_SPIN, MainCallbackSpinHintChanged, NULL);
 
         while ((rc = SDL_IterateMainCallbacks(SDL_TRUE)) == 0) {
             // !!! FIXME: this can be made more complicated if we decide to
@@ -60,19 +136,16 @@ int SDL_EnterAppMainCallbacks(int argc, char* argv[], SDL_AppInit_func appinit,
             //  as possible, which means we'll clamp to vsync in common cases,
             //  and won't be restrained to vsync if the app is doing a benchmark
             //  or doesn't want to be, based on how they've set up that window.
-            if ((callback_rate_increment == 0) || SDL_HasWindows()) {
-                next_iteration = 0; // just clear the timer and run at the pace the video subsystem allows.
+            if ((pacing.interval == 0) || SDL_HasWindows()) {
+                pacing.next_deadline = 0; // just clear the timer and run at the pace the video subsystem allows.
             } else {
-                const Uint64 now = SDL_GetTicksNS();
-                if (next_iteration > now) { // Running faster than the limit, sleep a little.
-                    SDL_DelayNS(next_iteration - now);
-                } else {
-                    next_iteration = now; // running behind (or just lost the window)...reset the timer.
-                }
-                next_iteration += callback_rate_increment;
+                WaitForNextIteration();
             }
         }
 
+        LogPacingStatistics();
+
+        SDL_DelHintCallback(SDL_HINT_MAIN_CALLBACK_SPIN, MainCallbackSpinHintChanged, NULL);
         SDL_DelHintCallback(SDL_HINT_MAIN_CALLBACK_RATE, MainCallbackRateHintChanged, NULL);
     }
     SDL_QuitMainCallbacks();
@@ -25,7 +25,9 @@
 #include "SDL_sysrender.h"
 #include "software/SDL_render_sw_c.h"
 #include "../video/SDL_pixels_c.h"
+#include "../video/SDL_rect_c.h"
 #include "../video/SDL_video_c.h"
+#include "../SDL_trace_c.h"
 
 #ifdef SDL_PLATFORM_ANDROID
 #include "../core/android/SDL_android.h"
@@ -43,8 +45,6 @@ this should probably be removed at some point in the future.  --ryan. */
 #define DONT_DRAW_WHILE_HIDDEN 0
 #endif
 
-#define SDL_PROP_WINDOW_RENDERER_POINTER "SDL.internal.window.renderer"
-#define SDL_PROP_TEXTURE_PARENT_POINTER "SDL.internal.texture.parent"
 
 #define CHECK_RENDERER_MAGIC_BUT_NOT_DESTROYED_FLAG(renderer, retval)                  \
     if (!(renderer) || (renderer)->magic != &SDL_renderer_magic) { \
@@ -305,7 +305,10 @@ static int FlushRenderCommands(SDL_Renderer *renderer)
 
     DebugLogRenderCommands(renderer->render_commands);
 
+    SDL_TRACE_COUNTER("SDL render vertex bytes", (Sint64)renderer->vertex_data_used);
+    SDL_TRACE_ZONE_BEGIN("RunCommandQueue");
     retval = renderer->RunCommandQueue(renderer, renderer->render_commands, renderer->vertex_data, renderer->vertex_data_used);
+    SDL_TRACE_ZONE_END("RunCommandQueue");
 
     /* Move the whole render command queue to the unused pool so we can reuse them next time. */
     if (renderer->render_commands_tail) {
@@ -587,12 +590,26 @@ static int QueueCmdDrawLines(SDL_Renderer *renderer, const SDL_FPoint *points, c
     return retval;
 }
 
-static int QueueCmdFillRects(SDL_Renderer *renderer, const SDL_FRect *rects, const int count)
+/* The rects are in pixels relative to the viewport, and rects that can't touch it are dropped */
+static int QueueCmdFillRects(SDL_Renderer *renderer, SDL_FRect *rects, int count)
 {
     SDL_RenderCommand *cmd;
+    SDL_Rect viewport;
+    SDL_FRect bounds;
     int retval = -1;
     const int use_rendergeometry = (!renderer->QueueFillRects);
 
+    /* Leave a pixel of slack for backends that round rects outwards */
+    GetRenderViewportInPixels(renderer, &viewport);
+    bounds.x = -1.0f;
+    bounds.y = -1.0f;
+    bounds.w = (float)viewport.w + 2.0f;
+    bounds.h = (float)viewport.h + 2.0f;
+    count = SDL_CullFRects(rects, count, &bounds);
+    if (count == 0) {
+        return 0;
+    }
+
     cmd = PrepQueueCmdDraw(renderer, (use_rendergeometry ? SDL_RENDERCMD_GEOMETRY : SDL_RENDERCMD_FILL_RECTS), NULL);
 
     if (cmd) {
@@ -604,7 +621,6 @@ static int QueueCmdFillRects(SDL_Renderer *renderer, const SDL_FRect *rects, con
 
             if (xy && indices) {
                 int i;
-                float *ptr_xy = xy;
                 int *ptr_indices = indices;
                 const int xy_stride = 2 * sizeof(float);
                 const int num_vertices = 4 * count;
@@ -613,23 +629,9 @@ static int QueueCmdFillRects(SDL_Renderer *renderer, const SDL_FRect *rects, con
                 int cur_index = 0;
                 const int *rect_index_order = renderer->rect_index_order;
 
-                for (i = 0; i < count; ++i) {
-                    float minx, miny, maxx, maxy;
-
-                    minx = rects[i].x;
-                    miny = rects[i].y;
-                    maxx = rects[i].x + rects[i].w;
-                    maxy = rects[i].y + rects[i].h;
-
-                    *ptr_xy++ = minx;
-                    *ptr_xy++ = miny;
-                    *ptr_xy++ = maxx;
-                    *ptr_xy++ = miny;
-                    *ptr_xy++ = maxx;
-                    *ptr_xy++ = maxy;
-                    *ptr_xy++ = minx;
-                    *ptr_xy++ = maxy;
+                SDL_GetFRectQuads(rects, count, xy);
 
+                for (i = 0; i < count; ++i) {
                     *ptr_indices++ = cur_index + rect_index_order[0];
                     *ptr_indices++ = cur_index + rect_index_order[1];
                     *ptr_indices++ = cur_index + rect_index_order[2];
@@ -1083,7 +1085,7 @@ SDL_Renderer *SDL_CreateRendererWithProperties(SDL_PropertiesID props)
     UpdateHDRProperties(renderer);
 
     if (window) {
-        SDL_SetProperty(SDL_GetWindowProperties(window), SDL_PROP_WINDOW_RENDERER_POINTER, renderer);
+        SDL_SetWindowRenderer(window, renderer);
     }
 
     SDL_SetRenderViewport(renderer, NULL);
@@ -1155,7 +1157,7 @@ SDL_Renderer *SDL_CreateSoftwareRenderer(SDL_Surface *surface)
 
 SDL_Renderer *SDL_GetRenderer(SDL_Window *window)
 {
-    return (SDL_Renderer *)SDL_GetProperty(SDL_GetWindowProperties(window), SDL_PROP_WINDOW_RENDERER_POINTER, NULL);
+    return SDL_GetWindowRenderer(window);
 }
 
 SDL_Window *SDL_GetRenderWindow(SDL_Renderer *renderer)
@@ -1374,7 +1376,7 @@ SDL_Texture *SDL_CreateTextureWithProperties(SDL_Renderer *renderer, SDL_Propert
             return NULL;
         }
 
-        SDL_SetProperty(SDL_GetTextureProperties(texture->native), SDL_PROP_TEXTURE_PARENT_POINTER, texture);
+        texture->native->parent = texture;
 
         /* Swap textures to have texture before texture->native in the list */
         texture->native->next = texture->next;
@@ -2400,7 +2402,7 @@ SDL_Texture *SDL_GetRenderTarget(SDL_Renderer *renderer)
     if (renderer->target == renderer->logical_target) {
         return NULL;
     } else {
-        return (SDL_Texture *)SDL_GetProperty(SDL_GetTextureProperties(renderer->target), SDL_PROP_TEXTURE_PARENT_POINTER, renderer->target);
+        return renderer->target->parent ? renderer->target->parent : renderer->target;
     }
 }
 
@@ -3051,7 +3053,6 @@ static int RenderPointsWithRects(SDL_Renderer *renderer, const SDL_FPoint *fpoin
     int retval;
     SDL_bool isstack;
     SDL_FRect *frects;
-    int i;
 
     if (count < 1) {
         return 0;
@@ -3062,12 +3063,7 @@ static int RenderPointsWithRects(SDL_Renderer *renderer, const SDL_FPoint *fpoin
         return -1;
     }
 
-    for (i = 0; i < count; ++i) {
-        frects[i].x = fpoints[i].x * renderer->view->scale.x;
-        frects[i].y = fpoints[i].y * renderer->view->scale.y;
-        frects[i].w = renderer->view->scale.x;
-        frects[i].h = renderer->view->scale.y;
-    }
+    SDL_ScaleFPointsToFRects(fpoints, count, renderer->view->scale.x, renderer->view->scale.y, frects);
 
     retval = QueueCmdFillRects(renderer, frects, count);
 
@@ -3505,7 +3501,6 @@ int SDL_RenderFillRect(SDL_Renderer *renderer, const SDL_FRect *rect)
 int SDL_RenderFillRects(SDL_Renderer *renderer, const SDL_FRect *rects, int count)
 {
     SDL_FRect *frects;
-    int i;
     int retval;
     SDL_bool isstack;
 
@@ -3529,12 +3524,7 @@ int SDL_RenderFillRects(SDL_Renderer *renderer, const SDL_FRect *rects, int coun
     if (!frects) {
         return -1;
     }
-    for (i = 0; i < count; ++i) {
-        frects[i].x = rects[i].x * renderer->view->scale.x;
-        frects[i].y = rects[i].y * renderer->view->scale.y;
-        frects[i].w = rects[i].w * renderer->view->scale.x;
-        frects[i].h = rects[i].h * renderer->view->scale.y;
-    }
+    SDL_ScaleFRects(rects, count, renderer->view->scale.x, renderer->view->scale.y, frects);
 
     retval = QueueCmdFillRects(renderer, frects, count);
 
@@ -4378,7 +4368,7 @@ SDL_Surface *SDL_RenderReadPixels(SDL_Renderer *renderer, const SDL_Rect *rect)
 
 static void SDL_RenderApplyWindowShape(SDL_Renderer *renderer)
 {
-    SDL_Surface *shape = (SDL_Surface *)SDL_GetProperty(SDL_GetWindowProperties(renderer->window), SDL_PROP_WINDOW_SHAPE_POINTER, NULL);
+    SDL_Surface *shape = SDL_GetWindowShape(renderer->window);
     if (shape != renderer->shape_surface) {
         if (renderer->shape_texture) {
             SDL_DestroyTexture(renderer->shape_texture);
@@ -4575,8 +4565,8 @@ void SDL_DestroyRendererWithoutFreeing(SDL_Renderer *renderer)
 
     SDL_free(renderer->vertex_data);
 
-    if (renderer->window) {
-        SDL_ClearProperty(SDL_GetWindowProperties(renderer->window), SDL_PROP_WINDOW_RENDERER_POINTER);
+    if (renderer->window && SDL_GetWindowRenderer(renderer->window) == renderer) {
+        SDL_SetWindowRenderer(renderer->window, NULL);
     }
 
     /* Free the target mutex */
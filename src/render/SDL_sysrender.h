@@ -79,6 +79,7 @@ struct SDL_Texture
 
     /* Support for formats not supported directly by the renderer */
     SDL_Texture *native;
+    SDL_Texture *parent;        /**< The texture this is the native texture of, if any */
     SDL_SW_YUVTexture *yuv;
     void *pixels;
     int pitch;
@@ -24,6 +24,7 @@
 
 #include "SDL_syssensor.h"
 
+#include "../SDL_hints_c.h"
 #include "../events/SDL_events_c.h"
 #include "../joystick/SDL_gamepad_c.h"
 
@@ -57,6 +58,7 @@ static int SDL_sensors_locked;
 static SDL_bool SDL_sensors_initialized;
 static SDL_Sensor *SDL_sensors SDL_GUARDED_BY(SDL_sensor_lock) = NULL;
 static char SDL_sensor_magic;
+static SDL_bool SDL_sensor_update_events = SDL_TRUE;
 
 #define CHECK_SENSOR_MAGIC(sensor, retval)              \
     if (!sensor || sensor->magic != &SDL_sensor_magic) { \
@@ -121,6 +123,11 @@ void SDL_AssertSensorsLocked(void)
     SDL_assert(SDL_SensorsLocked());
 }
 
+static void SDLCALL SDL_SensorUpdateEventsChanged(void *userdata, const char *name, const char *oldValue, const char *hint)
+{
+    SDL_sensor_update_events = SDL_GetStringBoolean(hint, SDL_TRUE);
+}
+
 int SDL_InitSensors(void)
 {
     int i, status;
@@ -134,6 +141,8 @@ int SDL_InitSensors(void)
         return -1;
     }
 
+    SDL_AddHintCallback(SDL_HINT_SENSOR_UPDATE_EVENTS, SDL_SensorUpdateEventsChanged, NULL);
+
     SDL_LockSensors();
 
     SDL_sensors_initialized = SDL_TRUE;
@@ -333,7 +342,16 @@ SDL_Sensor *SDL_OpenSensor(SDL_SensorID instance_id)
     sensor->type = driver->GetDeviceType(device_index);
     sensor->non_portable_type = driver->GetDeviceNonPortableType(device_index);
 
+    sensor->samples = (SDL_SensorSampleRing *)SDL_calloc(1, sizeof(*sensor->samples));
+    if (!sensor->samples) {
+        SDL_free(sensor);
+        SDL_UnlockSensors();
+        return NULL;
+    }
+    SDL_AtomicSet(&sensor->samples->refcount, 1);
+
     if (driver->Open(sensor, device_index) < 0) {
+        SDL_free(sensor->samples);
         SDL_free(sensor);
         SDL_UnlockSensors();
         return NULL;
@@ -486,6 +504,79 @@ int SDL_GetSensorData(SDL_Sensor *sensor, float *data, int num_values)
     return 0;
 }
 
+static void SDL_ReleaseSensorSamples(SDL_SensorSampleRing *ring)
+{
+    if (SDL_AtomicDecRef(&ring->refcount)) {
+        SDL_free(ring);
+    }
+}
+
+/*
+ * Get the samples that arrived since the cursor
+ */
+int SDL_GetSensorSamples(SDL_Sensor *sensor, Uint32 *cursor, SDL_SensorSample *samples, int max_samples)
+{
+    SDL_SensorSampleRing *ring;
+    Uint32 start, head, available, count, lost, i;
+
+    SDL_LockSensors();
+    {
+        CHECK_SENSOR_MAGIC(sensor, -1);
+
+        ring = sensor->samples;
+        SDL_AtomicIncRef(&ring->refcount);
+    }
+    SDL_UnlockSensors();
+
+    if (!cursor) {
+        SDL_ReleaseSensorSamples(ring);
+        return SDL_InvalidParamError("cursor");
+    }
+    if (!samples || max_samples < 0) {
+        SDL_ReleaseSensorSamples(ring);
+        return SDL_InvalidParamError("samples");
+    }
+
+    /* The sensor keeps writing while we copy, the samples are only kept
+       if they can't have been overwritten by the time we're done */
+    start = *cursor;
+    for (;;) {
+        head = (Uint32)SDL_AtomicGet(&ring->head);
+        SDL_MemoryBarrierAcquire();
+
+        /* The slot after the newest sample may be in the middle of being written */
+        available = head - start;
+        if (available > SDL_SENSOR_SAMPLE_HISTORY - 1) {
+            start = head - (SDL_SENSOR_SAMPLE_HISTORY - 1);
+            available = SDL_SENSOR_SAMPLE_HISTORY - 1;
+        }
+        count = SDL_min(available, (Uint32)max_samples);
+        for (i = 0; i < count; ++i) {
+            samples[i] = ring->samples[(start + i) % SDL_SENSOR_SAMPLE_HISTORY];
+        }
+
+        SDL_MemoryBarrierAcquire();
+        lost = (Uint32)SDL_AtomicGet(&ring->head) - start;
+        if (lost < SDL_SENSOR_SAMPLE_HISTORY) {
+            break;
+        }
+        lost -= (SDL_SENSOR_SAMPLE_HISTORY - 1);
+        if (lost < count) {
+            count -= lost;
+            SDL_memmove(samples, samples + lost, count * sizeof(*samples));
+            start += lost;
+            break;
+        }
+        /* We fell a whole ring behind while copying, try again */
+        start += lost;
+    }
+
+    SDL_ReleaseSensorSamples(ring);
+
+    *cursor = start + count;
+    return (int)count;
+}
+
 /*
  * Close a sensor previously opened with SDL_OpenSensor()
  */
@@ -526,6 +617,7 @@ void SDL_CloseSensor(SDL_Sensor *sensor)
         }
 
         /* Free the data associated with this sensor */
+        SDL_ReleaseSensorSamples(sensor->samples);
         SDL_free(sensor->name);
         SDL_free(sensor);
     }
@@ -549,6 +641,8 @@ void SDL_QuitSensors(void)
         SDL_sensor_drivers[i]->Quit();
     }
 
+    SDL_DelHintCallback(SDL_HINT_SENSOR_UPDATE_EVENTS, SDL_SensorUpdateEventsChanged, NULL);
+
     SDL_QuitSubSystem(SDL_INIT_EVENTS);
 
     SDL_sensors_initialized = SDL_FALSE;
@@ -570,9 +664,24 @@ int SDL_SendSensorUpdate(Uint64 timestamp, SDL_Sensor *sensor, Uint64 sensor_tim
     num_values = SDL_min(num_values, SDL_arraysize(sensor->data));
     SDL_memcpy(sensor->data, data, num_values * sizeof(*data));
 
+    /* Keep the sample for SDL_GetSensorSamples(), we're the only writer */
+    {
+        SDL_SensorSampleRing *ring = sensor->samples;
+        const Uint32 head = (Uint32)SDL_AtomicGet(&ring->head);
+        SDL_SensorSample *sample = &ring->samples[head % SDL_SENSOR_SAMPLE_HISTORY];
+        const int num_sample_values = SDL_min(num_values, SDL_arraysize(sample->data));
+
+        sample->timestamp = timestamp;
+        sample->sensor_timestamp = sensor_timestamp;
+        SDL_memcpy(sample->data, data, num_sample_values * sizeof(*data));
+        SDL_memset(sample->data + num_sample_values, 0, (SDL_arraysize(sample->data) - num_sample_values) * sizeof(*data));
+        SDL_MemoryBarrierRelease();
+        SDL_AtomicSet(&ring->head, (int)(head + 1));
+    }
+
     /* Post the event, if desired */
     posted = 0;
-    if (SDL_EventEnabled(SDL_EVENT_SENSOR_UPDATE)) {
+    if (SDL_sensor_update_events && SDL_EventEnabled(SDL_EVENT_SENSOR_UPDATE)) {
         SDL_Event event;
         event.type = SDL_EVENT_SENSOR_UPDATE;
         event.common.timestamp = timestamp;
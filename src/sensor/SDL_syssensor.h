@@ -29,6 +29,17 @@
 
 #define _guarded SDL_GUARDED_BY(SDL_sensor_lock)
 
+/* Recent samples of a sensor, these are written with the sensors locked
+   and read by SDL_GetSensorSamples() without taking the lock. Readers hold
+   a reference while copying, so closing the sensor doesn't free the ring
+   out from under them. */
+typedef struct SDL_SensorSampleRing
+{
+    SDL_AtomicInt refcount; /* The sensor and each reader in SDL_GetSensorSamples() */
+    SDL_AtomicInt head; /* The number of samples written, wrapping */
+    SDL_SensorSample samples[SDL_SENSOR_SAMPLE_HISTORY];
+} SDL_SensorSampleRing;
+
 /* The SDL sensor structure */
 struct SDL_Sensor
 {
@@ -41,6 +52,8 @@ struct SDL_Sensor
 
     float data[16] _guarded;             /* The current state of the sensor */
 
+    SDL_SensorSampleRing *samples;       /* Recent samples, allocated when the sensor is opened */
+
     struct SDL_SensorDriver *driver _guarded;
 
     struct sensor_hwdata *hwdata _guarded; /* Driver dependent information */
@@ -25,14 +25,35 @@
 #include "SDL_dummysensor.h"
 #include "../SDL_syssensor.h"
 
+/* The dummy driver can provide a synthetic gyroscope for testing,
+   see SDL_HINT_SENSOR_DUMMY_RATE */
+static SDL_SensorID SDL_DUMMY_sensor_id;
+static Uint64 SDL_DUMMY_sensor_period;
+
+struct sensor_hwdata
+{
+    Uint64 next_sample;  /* When the next sample is due, in SDL_GetTicksNS() time */
+    Uint64 sample_count;
+};
+
 static int SDL_DUMMY_SensorInit(void)
 {
+    const char *hint = SDL_GetHint(SDL_HINT_SENSOR_DUMMY_RATE);
+    const int rate = hint ? SDL_atoi(hint) : 0;
+
+    if (rate > 0) {
+        SDL_DUMMY_sensor_id = SDL_GetNextObjectID();
+        SDL_DUMMY_sensor_period = SDL_max(SDL_NS_PER_SECOND / rate, 1);
+    } else {
+        SDL_DUMMY_sensor_id = 0;
+        SDL_DUMMY_sensor_period = 0;
+    }
     return 0;
 }
 
 static int SDL_DUMMY_SensorGetCount(void)
 {
-    return 0;
+    return SDL_DUMMY_sensor_id ? 1 : 0;
 }
 
 static void SDL_DUMMY_SensorDetect(void)
@@ -41,39 +62,75 @@ static void SDL_DUMMY_SensorDetect(void)
 
 static const char *SDL_DUMMY_SensorGetDeviceName(int device_index)
 {
-    return NULL;
+    return "Dummy Gyroscope";
 }
 
 static SDL_SensorType SDL_DUMMY_SensorGetDeviceType(int device_index)
 {
-    return SDL_SENSOR_INVALID;
+    return SDL_SENSOR_GYRO;
 }
 
 static int SDL_DUMMY_SensorGetDeviceNonPortableType(int device_index)
 {
-    return -1;
+    return SDL_SENSOR_GYRO;
 }
 
 static SDL_SensorID SDL_DUMMY_SensorGetDeviceInstanceID(int device_index)
 {
-    return -1;
+    return SDL_DUMMY_sensor_id;
 }
 
 static int SDL_DUMMY_SensorOpen(SDL_Sensor *sensor, int device_index)
 {
-    return SDL_Unsupported();
+    struct sensor_hwdata *hwdata;
+
+    if (!SDL_DUMMY_sensor_id) {
+        return SDL_Unsupported();
+    }
+
+    hwdata = (struct sensor_hwdata *)SDL_calloc(1, sizeof(*hwdata));
+    if (!hwdata) {
+        return -1;
+    }
+    hwdata->next_sample = SDL_GetTicksNS();
+    sensor->hwdata = hwdata;
+    return 0;
 }
 
 static void SDL_DUMMY_SensorUpdate(SDL_Sensor *sensor)
 {
+    struct sensor_hwdata *hwdata = sensor->hwdata;
+    const Uint64 now = SDL_GetTicksNS();
+
+    /* Don't try to catch up on more than a ring's worth of samples after a stall */
+    if (now > hwdata->next_sample + SDL_DUMMY_sensor_period * SDL_SENSOR_SAMPLE_HISTORY) {
+        hwdata->next_sample = now - SDL_DUMMY_sensor_period * SDL_SENSOR_SAMPLE_HISTORY;
+    }
+
+    while (hwdata->next_sample <= now) {
+        /* A slow rotation around all three axes, in radians per second */
+        const float t = (float)hwdata->sample_count * 0.001f;
+        float data[3];
+
+        data[0] = SDL_sinf(t);
+        data[1] = SDL_cosf(t);
+        data[2] = 0.5f * SDL_sinf(2.0f * t);
+        SDL_SendSensorUpdate(hwdata->next_sample, sensor, hwdata->sample_count * SDL_DUMMY_sensor_period, data, SDL_arraysize(data));
+
+        hwdata->next_sample += SDL_DUMMY_sensor_period;
+        ++hwdata->sample_count;
+    }
 }
 
 static void SDL_DUMMY_SensorClose(SDL_Sensor *sensor)
 {
+    SDL_free(sensor->hwdata);
 }
 
 static void SDL_DUMMY_SensorQuit(void)
 {
+    SDL_DUMMY_sensor_id = 0;
+    SDL_DUMMY_sensor_period = 0;
 }
 
 SDL_SensorDriver SDL_DUMMY_SensorDriver = {
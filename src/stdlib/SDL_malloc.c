@@ -31,6 +31,11 @@
 #define ABORT
 #define USE_LOCKS 1
 #define USE_DL_PREFIX
+#ifdef SDL_MALLOC_ARENAS
+/* Each arena is an mspace; footers let dlfree/dlrealloc find the arena that owns a chunk. */
+#define MSPACES 1
+#define FOOTERS 1
+#endif
 
 /*
   This is a version (aka dlmalloc) of malloc/free/realloc written by
@@ -2541,7 +2546,7 @@ static int init_mparams(void) {
         s = *((size_t *)buf);
       else
 #endif /* USE_DEV_RANDOM */
-        s = (size_t)(time(0) ^ (size_t)0x55555555U);
+        s = (size_t)(SDL_GetPerformanceCounter() ^ (size_t)0x55555555U);
 
       s |= (size_t)8U;    /* ensure nonzero */
       s &= ~(size_t)7U;   /* improve chances of fault for bad values */
@@ -3208,7 +3213,7 @@ static void internal_malloc_stats(mstate m) {
 #else /* ONLY_MSPACES */
 #if MSPACES
 #define internal_malloc(m, b)\
-   (m == gm)? dlmalloc(b) : mspace_malloc(m, b)
+   ((m == gm)? dlmalloc(b) : mspace_malloc(m, b))
 #define internal_free(m, mem)\
    if (m == gm) dlfree(mem); else mspace_free(m,mem);
 #else /* MSPACES */
@@ -5189,6 +5194,56 @@ static void* SDLCALL real_malloc(size_t s) { return malloc(s); }
 static void* SDLCALL real_calloc(size_t n, size_t s) { return calloc(n, s); }
 static void* SDLCALL real_realloc(void *p, size_t s) { return realloc(p,s); }
 static void  SDLCALL real_free(void *p) { free(p); }
+#elif defined(SDL_MALLOC_ARENAS)
+/* A single dlmalloc heap has one lock, which every thread allocating at the same time fights over.
+ * Instead, spread threads across several independently locked mspaces (arenas), picked by thread.
+ * Memory can be freed or reallocated from any thread, as the chunk footer points back to its arena.
+ */
+#define SDL_NUM_MALLOC_ARENAS 8
+
+static mspace s_arenas[SDL_NUM_MALLOC_ARENAS];
+static SDL_SpinLock s_arenas_lock;
+
+static Uint32 GetThreadHash(void);
+
+static mspace GetArena(void)
+{
+    const Uint32 index = GetThreadHash() % SDL_NUM_MALLOC_ARENAS;
+    mspace arena = SDL_AtomicGetPtr(&s_arenas[index]);
+
+    if (!arena) {
+        SDL_LockSpinlock(&s_arenas_lock);
+        arena = s_arenas[index];
+        if (!arena) {
+            arena = create_mspace(0, 1);
+            SDL_AtomicSetPtr(&s_arenas[index], arena);
+        }
+        SDL_UnlockSpinlock(&s_arenas_lock);
+    }
+    return arena;
+}
+
+static void * SDLCALL real_malloc(size_t s)
+{
+    mspace arena = GetArena();
+    return arena ? mspace_malloc(arena, s) : dlmalloc(s);
+}
+
+static void * SDLCALL real_calloc(size_t n, size_t s)
+{
+    mspace arena = GetArena();
+    return arena ? mspace_calloc(arena, n, s) : dlcalloc(n, s);
+}
+
+static void * SDLCALL real_realloc(void *p, size_t s)
+{
+    return p ? dlrealloc(p, s) : real_malloc(s);
+}
+
+static void SDLCALL real_free(void *p)
+{
+    dlfree(p);
+}
 #else
 #define real_malloc dlmalloc
 #define real_calloc dlcalloc
@@ -5203,11 +5258,38 @@ static struct
     SDL_calloc_func calloc_func;
     SDL_realloc_func realloc_func;
     SDL_free_func free_func;
-    SDL_AtomicInt num_allocations;
 } s_mem = {
-    real_malloc, real_calloc, real_realloc, real_free, { 0 }
+    real_malloc, real_calloc, real_realloc, real_free
 };
 
+/* The number of outstanding allocations is updated on every allocation, from any thread, but
+ * only read by SDL_GetNumAllocations(). A single counter would bounce its cache line between
+ * every core that allocates, so it's split into shards, picked by thread, and summed on request.
+ * A shard can go negative if memory is freed on a different thread than it was allocated on.
+ */
+#define SDL_NUM_ALLOCATION_SHARDS 32
+
+typedef union
+{
+    SDL_AtomicInt count;
+    char padding[64]; /* keep each shard on its own cache line */
+} SDL_AllocationCounter;
+
+static SDL_AllocationCounter s_num_allocations[SDL_NUM_ALLOCATION_SHARDS];
+
+/* Spread threads evenly over the allocation shards (and arenas) */
+static Uint32 GetThreadHash(void)
+{
+    /* Thread IDs are often pointers, so hash away the low zero bits */
+    const Uint64 hash = ((Uint64)SDL_GetCurrentThreadID()) * SDL_UINT64_C(0x9E3779B97F4A7C15);
+    return (Uint32)(hash >> 32);
+}
+
+static SDL_AtomicInt *GetAllocationCounter(void)
+{
+    return &s_num_allocations[GetThreadHash() % SDL_NUM_ALLOCATION_SHARDS].count;
+}
+
 void SDL_GetOriginalMemoryFunctions(SDL_malloc_func *malloc_func,
                                     SDL_calloc_func *calloc_func,
                                     SDL_realloc_func *realloc_func,
@@ -5273,7 +5355,12 @@ int SDL_SetMemoryFunctions(SDL_malloc_func malloc_func,
 
 int SDL_GetNumAllocations(void)
 {
-    return SDL_AtomicGet(&s_mem.num_allocations);
+    int i, num_allocations = 0;
+
+    for (i = 0; i < SDL_NUM_ALLOCATION_SHARDS; ++i) {
+        num_allocations += SDL_AtomicGet(&s_num_allocations[i].count);
+    }
+    return num_allocations;
 }
 
 void *SDL_malloc(size_t size)
@@ -5286,7 +5373,7 @@ void *SDL_malloc(size_t size)
 
     mem = s_mem.malloc_func(size);
     if (mem) {
-        SDL_AtomicIncRef(&s_mem.num_allocations);
+        SDL_AtomicIncRef(GetAllocationCounter());
     } else {
         SDL_OutOfMemory();
     }
@@ -5305,7 +5392,7 @@ void *SDL_calloc(size_t nmemb, size_t size)
 
     mem = s_mem.calloc_func(nmemb, size);
     if (mem) {
-        SDL_AtomicIncRef(&s_mem.num_allocations);
+        SDL_AtomicIncRef(GetAllocationCounter());
     } else {
         SDL_OutOfMemory();
     }
@@ -5323,7 +5410,7 @@ void *SDL_realloc(void *ptr, size_t size)
 
     mem = s_mem.realloc_func(ptr, size);
     if (mem && !ptr) {
-        SDL_AtomicIncRef(&s_mem.num_allocations);
+        SDL_AtomicIncRef(GetAllocationCounter());
     } else if (!mem) {
         SDL_OutOfMemory();
     }
@@ -5338,5 +5425,5 @@ void SDL_free(void *ptr)
     }
 
     s_mem.free_func(ptr);
-    (void)SDL_AtomicDecRef(&s_mem.num_allocations);
+    (void)SDL_AtomicDecRef(GetAllocationCounter());
 }
@@ -25,6 +25,25 @@
 
 /* #define DEBUG_TIMERS */
 
+#ifdef SDL_PLATFORM_LINUX
+#include <sys/prctl.h>
+#endif
+
+/* How long before the deadline SDL_DelayPrecise() wakes up to spin, this is
+   calibrated against how late the OS actually wakes us up */
+#define PRECISE_DELAY_MIN_MARGIN_NS SDL_US_TO_NS(20)
+#define PRECISE_DELAY_MAX_MARGIN_NS SDL_MS_TO_NS(2)
+static SDL_AtomicInt precise_delay_margin = { (int)SDL_US_TO_NS(200) };
+
+/* The timer thread only spins for the last little bit before a timer is due,
+   it can't see new timers or shutdown requests while it's spinning */
+#define TIMER_PRECISE_SPIN_NS SDL_US_TO_NS(50)
+
+static Uint64 SDL_GetPreciseDelayMarginNS(void)
+{
+    return (Uint64)SDL_AtomicGet(&precise_delay_margin);
+}
+
 #if !defined(SDL_PLATFORM_EMSCRIPTEN) || !defined(SDL_THREADS_DISABLED)
 
 typedef struct SDL_Timer
@@ -104,6 +123,8 @@ static int SDLCALL SDL_TimerThread(void *_data)
     SDL_Timer *freelist_tail = NULL;
     Uint64 tick, now, interval, delay;
 
+    SDL_SetPreciseTimerSlack();
+
     /* Threaded timer loop:
      *  1. Queue timers added by other threads
      *  2. Handle any timers that should dispatch this cycle
@@ -195,8 +216,19 @@ static int SDLCALL SDL_TimerThread(void *_data)
            immediately, but we process the timers added all at once.
            That's okay, it just means we run through the loop a few
            extra times.
+
+           The last few microseconds before a timer is due are waited out
+           precisely, so the callback doesn't pay for the OS waking us up
+           late. Anything longer waits on the semaphore, so new timers and
+           SDL_QuitTimers() still wake us up.
          */
-        SDL_WaitSemaphoreTimeoutNS(data->sem, delay);
+        if (delay == 0 || delay == (Uint64)-1) {
+            SDL_WaitSemaphoreTimeoutNS(data->sem, delay);
+        } else if (delay <= TIMER_PRECISE_SPIN_NS) {
+            SDL_DelayPrecise(delay);
+        } else {
+            SDL_WaitSemaphoreTimeoutNS(data->sem, delay - TIMER_PRECISE_SPIN_NS);
+        }
     }
     return 0;
 }
@@ -592,3 +624,71 @@ void SDL_Delay(Uint32 ms)
 {
     SDL_DelayNS(SDL_MS_TO_NS(ms));
 }
+
+void SDL_SetPreciseTimerSlack(void)
+{
+#if defined(SDL_PLATFORM_LINUX) && defined(PR_SET_TIMERSLACK)
+    /* The default slack of 50 microseconds is added to every sleep */
+    prctl(PR_SET_TIMERSLACK, 1UL, 0UL, 0UL, 0UL);
+#endif
+}
+
+static void SDL_UpdatePreciseDelayMargin(Uint64 oversleep)
+{
+    Uint64 margin = SDL_GetPreciseDelayMarginNS();
+
+    /* Grow right away when the OS wakes us up later than expected, and shrink
+       slowly while it keeps waking us up early enough */
+    if (oversleep > margin) {
+        margin = oversleep + oversleep / 4;
+    } else {
+        margin -= (margin - oversleep) / 16;
+    }
+    margin = SDL_clamp(margin, PRECISE_DELAY_MIN_MARGIN_NS, PRECISE_DELAY_MAX_MARGIN_NS);
+    SDL_AtomicSet(&precise_delay_margin, (int)margin);
+}
+
+void SDL_DelayPrecise(Uint64 ns)
+{
+    Uint64 now = SDL_GetTicksNS();
+    const Uint64 deadline = now + ns;
+    const Uint64 margin = SDL_GetPreciseDelayMarginNS();
+
+    if (ns > margin) {
+        const Uint64 wakeup = deadline - margin;
+
+        SDL_SetPreciseTimerSlack();
+        SDL_DelayUntilNS(wakeup);
+        now = SDL_GetTicksNS();
+        SDL_UpdatePreciseDelayMargin((now > wakeup) ? (now - wakeup) : 0);
+    }
+
+    if (now < deadline) {
+        SDL_SpinUntilNS(deadline);
+    }
+}
+
+Uint64 SDL_SpinUntilNS(Uint64 deadline)
+{
+    Uint64 now = SDL_GetTicksNS();
+
+    while (now < deadline) {
+        SDL_CPUPauseInstruction();
+        now = SDL_GetTicksNS();
+    }
+    return now;
+}
+
+void SDL_DelayUntilNS(Uint64 deadline)
+{
+    const Uint64 now = SDL_GetTicksNS();
+
+    if (deadline <= now) {
+        return;
+    }
+#ifdef SDL_HAVE_SYS_DELAY_UNTIL
+    SDL_SYS_DelayUntilNS(deadline - now);
+#else
+    SDL_DelayNS(deadline - now);
+#endif
+}
@@ -34,4 +34,19 @@ extern void SDL_QuitTicks(void);
 extern int SDL_InitTimers(void);
 extern void SDL_QuitTimers(void);
 
+/* Sleeps until SDL_GetTicksNS() reaches deadline, without adding up the
+   oversleep of repeated relative delays */
+extern void SDL_DelayUntilNS(Uint64 deadline);
+
+/* Busy-waits until the deadline and returns the current time, only use this for the last few microseconds of a wait */
+extern Uint64 SDL_SpinUntilNS(Uint64 deadline);
+
+/* Asks the OS to wake the calling thread up as close to its deadlines as it can */
+extern void SDL_SetPreciseTimerSlack(void);
+
+#if defined(SDL_TIMER_UNIX) && defined(HAVE_CLOCK_NANOSLEEP) && defined(HAVE_CLOCK_GETTIME) && !defined(SDL_PLATFORM_EMSCRIPTEN)
+#define SDL_HAVE_SYS_DELAY_UNTIL
+extern void SDL_SYS_DelayUntilNS(Uint64 ns);
+#endif
+
 #endif /* SDL_timer_c_h_ */
@@ -185,4 +185,23 @@ void SDL_DelayNS(Uint64 ns)
     } while (was_error && (errno == EINTR));
 }
 
+#ifdef SDL_HAVE_SYS_DELAY_UNTIL
+void SDL_SYS_DelayUntilNS(Uint64 ns)
+{
+    struct timespec deadline;
+    int rc;
+
+    /* CLOCK_MONOTONIC_RAW can't be slept on, but the two clocks don't drift
+       apart noticeably over a single delay. The deadline is absolute, so
+       being interrupted doesn't add to the delay. */
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+    ns += deadline.tv_nsec;
+    deadline.tv_sec += (time_t)(ns / SDL_NS_PER_SECOND);
+    deadline.tv_nsec = (long)(ns % SDL_NS_PER_SECOND);
+    do {
+        rc = clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL);
+    } while (rc == EINTR);
+}
+#endif /* SDL_HAVE_SYS_DELAY_UNTIL */
+
 #endif /* SDL_TIMER_UNIX */
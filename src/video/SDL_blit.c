@@ -126,26 +126,34 @@ static SDL_BlitFunc SDL_ChooseBlitFunc(Uint32 src_format, Uint32 dst_format, int
                                        SDL_BlitFuncEntry *entries)
 {
     int i, flagcheck = (flags & (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_COLORKEY | SDL_COPY_NEAREST));
-    static unsigned int features = 0x7fffffff;
+    unsigned int features;
 
-    /* Get the available CPU features */
-    if (features == 0x7fffffff) {
-        features = SDL_CPU_ANY;
-        if (SDL_HasMMX()) {
-            features |= SDL_CPU_MMX;
-        }
-        if (SDL_HasSSE()) {
-            features |= SDL_CPU_SSE;
-        }
-        if (SDL_HasSSE2()) {
-            features |= SDL_CPU_SSE2;
-        }
-        if (SDL_HasAltiVec()) {
-            if (SDL_UseAltivecPrefetch()) {
-                features |= SDL_CPU_ALTIVEC_PREFETCH;
-            } else {
-                features |= SDL_CPU_ALTIVEC_NOPREFETCH;
-            }
+    /* Get the available CPU features, these are checked every time so that
+       changes to SDL_HINT_CPU_FEATURE_MASK apply to new blit mappings */
+    features = SDL_CPU_ANY;
+    if (SDL_HasMMX()) {
+        features |= SDL_CPU_MMX;
+    }
+    if (SDL_HasSSE()) {
+        features |= SDL_CPU_SSE;
+    }
+    if (SDL_HasSSE2()) {
+        features |= SDL_CPU_SSE2;
+    }
+    if (SDL_HasSSE41()) {
+        features |= SDL_CPU_SSE4_1;
+    }
+    if (SDL_HasAVX2()) {
+        features |= SDL_CPU_AVX2;
+    }
+    if (SDL_HasNEON()) {
+        features |= SDL_CPU_NEON;
+    }
+    if (SDL_HasAltiVec()) {
+        if (SDL_UseAltivecPrefetch()) {
+            features |= SDL_CPU_ALTIVEC_PREFETCH;
+        } else {
+            features |= SDL_CPU_ALTIVEC_NOPREFETCH;
         }
     }
 
@@ -54,6 +54,9 @@ extern Uint16 SDL_expand_byte10[];
 #define SDL_CPU_SSE2               0x00000004
 #define SDL_CPU_ALTIVEC_PREFETCH   0x00000008
 #define SDL_CPU_ALTIVEC_NOPREFETCH 0x00000010
+#define SDL_CPU_SSE4_1             0x00000020
+#define SDL_CPU_AVX2               0x00000040
+#define SDL_CPU_NEON               0x00000080
 
 typedef struct
 {
@@ -977,11 +977,13 @@ static void Blit_XRGB8888_index8(SDL_BlitInfo *info)
             /* *INDENT-OFF* */ /* clang-format off */
             DUFFS_LOOP(
                 RGB888_RGB332(*dst++, *src);
+                ++src;
             , width);
             /* *INDENT-ON* */ /* clang-format on */
 #else
             for (c = width / 4; c; --c) {
                 /* Pack RGB into 8bit pixel */
+                RGB888_RGB332(*dst++, *src);
                 ++src;
                 RGB888_RGB332(*dst++, *src);
                 ++src;
@@ -1091,11 +1093,13 @@ static void Blit_RGB101010_index8(SDL_BlitInfo *info)
             /* *INDENT-OFF* */ /* clang-format off */
             DUFFS_LOOP(
                 RGB101010_RGB332(*dst++, *src);
+                ++src;
             , width);
             /* *INDENT-ON* */ /* clang-format on */
 #else
             for (c = width / 4; c; --c) {
                 /* Pack RGB into 8bit pixel */
+                RGB101010_RGB332(*dst++, *src);
                 ++src;
                 RGB101010_RGB332(*dst++, *src);
                 ++src;
@@ -3194,6 +3198,410 @@ static void Blit_3or4_to_3or4__inversed_rgb(SDL_BlitInfo *info)
     }
 }
 
+/* Dithered blits to lower precision destinations, used when the source
+ * surface has a dither mode set. Each channel is quantized to the number of
+ * bits the destination keeps. 8-bit indexed destinations are quantized to
+ * RGB332 and go through the same table as BlitNto1.
+ */
+typedef struct
+{
+    int srcbpp;
+    int dstbpp;
+    SDL_PixelFormat *srcfmt;
+    SDL_PixelFormat *dstfmt;
+    SDL_bool indexed;
+    const Uint8 *table;
+    const SDL_Color *colors;
+    int Rloss, Gloss, Bloss;
+    int Rshift, Gshift, Bshift;
+} DitherTarget;
+
+static void GetDitherTarget(SDL_BlitInfo *info, DitherTarget *target)
+{
+    SDL_PixelFormat *dstfmt = info->dst_fmt;
+
+    target->srcbpp = info->src_fmt->bytes_per_pixel;
+    target->dstbpp = dstfmt->bytes_per_pixel;
+    target->srcfmt = info->src_fmt;
+    target->dstfmt = dstfmt;
+    target->indexed = SDL_ISPIXELFORMAT_INDEXED(dstfmt->format);
+    if (target->indexed) {
+        /* The table is NULL if the palette is the RGB332 dither palette */
+        target->table = info->table;
+        target->colors = info->table ? dstfmt->palette->colors : NULL;
+        target->Rloss = 5;
+        target->Gloss = 5;
+        target->Bloss = 6;
+        target->Rshift = 5;
+        target->Gshift = 2;
+        target->Bshift = 0;
+    } else {
+        target->table = NULL;
+        target->colors = NULL;
+        target->Rloss = dstfmt->Rloss;
+        target->Gloss = dstfmt->Gloss;
+        target->Bloss = dstfmt->Bloss;
+        target->Rshift = dstfmt->Rshift;
+        target->Gshift = dstfmt->Gshift;
+        target->Bshift = dstfmt->Bshift;
+    }
+}
+
+/* Writes a pixel quantized to the destination precision and returns the
+   color that was actually written, so the error can be diffused */
+static SDL_INLINE void DitherStore(const DitherTarget *target, Uint8 *dst, unsigned r, unsigned g, unsigned b, unsigned a, int *qR, int *qG, int *qB)
+{
+    if (target->indexed) {
+        const Uint8 code = (Uint8)(((r >> 5) << 5) | ((g >> 5) << 2) | (b >> 6));
+        if (target->table) {
+            const SDL_Color *color = &target->colors[target->table[code]];
+            *dst = target->table[code];
+            *qR = color->r;
+            *qG = color->g;
+            *qB = color->b;
+            return;
+        }
+        *dst = code;
+    } else {
+        ASSEMBLE_RGBA(dst, target->dstbpp, target->dstfmt, r, g, b, a);
+    }
+    *qR = SDL_expand_byte[target->Rloss][r >> target->Rloss];
+    *qG = SDL_expand_byte[target->Gloss][g >> target->Gloss];
+    *qB = SDL_expand_byte[target->Bloss][b >> target->Bloss];
+}
+
+/* Dithering is anchored to the destination surface, so separate blits to
+   neighboring areas line up */
+static void GetDitherOrigin(SDL_BlitInfo *info, int *x, int *y)
+{
+    SDL_Surface *dst = info->dst_surface;
+    const size_t offset = (size_t)(info->dst - (Uint8 *)dst->pixels);
+
+    *y = (int)(offset / dst->pitch);
+    *x = (int)((offset % dst->pitch) / dst->format->bytes_per_pixel);
+}
+
+static const Uint8 dither_bayer4[4][4] = {
+    { 0, 8, 2, 10 },
+    { 12, 4, 14, 6 },
+    { 3, 11, 1, 9 },
+    { 15, 7, 13, 5 }
+};
+
+/* Ordered dithering scales each channel to the destination levels before
+ * adding the threshold, c - (c >> bits) stays below 256 with the threshold
+ * added, so no clamping is needed. The thresholds repeat every four pixels,
+ * so the SIMD kernels add the same ones to every group of four pixels in a
+ * row. They handle 32-bit sources with 8-bit channels and return the number
+ * of pixels they handled, the scalar loop takes care of whatever is left.
+ */
+#define DITHER_LEVEL(c, loss, bias) ((((c) - ((c) >> (8 - (loss)))) + (bias)) >> (loss))
+
+#ifdef SDL_SSE2_INTRINSICS
+static SDL_INLINE __m128i SDL_TARGETING("sse2") DitherChannel_SSE2(__m128i px, __m128i shift, __m128i bits, __m128i bias, __m128i loss, __m128i dstshift)
+{
+    const __m128i c = _mm_and_si128(_mm_srl_epi32(px, shift), _mm_set1_epi32(0xFF));
+
+    return _mm_sll_epi32(_mm_srl_epi32(_mm_add_epi32(_mm_sub_epi32(c, _mm_srl_epi32(c, bits)), bias), loss), dstshift);
+}
+
+static int SDL_TARGETING("sse2") DitherOrderedRow_SSE2(const DitherTarget *target, const Uint32 bias_row[3][4], const Uint32 *src, Uint8 *dst, int width)
+{
+    const __m128i rbias = _mm_loadu_si128((const __m128i *)bias_row[0]);
+    const __m128i gbias = _mm_loadu_si128((const __m128i *)bias_row[1]);
+    const __m128i bbias = _mm_loadu_si128((const __m128i *)bias_row[2]);
+    const __m128i rsrc = _mm_cvtsi32_si128(target->srcfmt->Rshift);
+    const __m128i gsrc = _mm_cvtsi32_si128(target->srcfmt->Gshift);
+    const __m128i bsrc = _mm_cvtsi32_si128(target->srcfmt->Bshift);
+    const __m128i rbits = _mm_cvtsi32_si128(8 - target->Rloss);
+    const __m128i gbits = _mm_cvtsi32_si128(8 - target->Gloss);
+    const __m128i bbits = _mm_cvtsi32_si128(8 - target->Bloss);
+    const __m128i rloss = _mm_cvtsi32_si128(target->Rloss);
+    const __m128i gloss = _mm_cvtsi32_si128(target->Gloss);
+    const __m128i bloss = _mm_cvtsi32_si128(target->Bloss);
+    const __m128i rdst = _mm_cvtsi32_si128(target->Rshift);
+    const __m128i gdst = _mm_cvtsi32_si128(target->Gshift);
+    const __m128i bdst = _mm_cvtsi32_si128(target->Bshift);
+    int i = 0;
+
+#define DITHER_QUANTIZE_SSE2(result, offset)                                                            \
+    {                                                                                                   \
+        const __m128i px = _mm_loadu_si128((const __m128i *)(src + i + offset));                       \
+        result = _mm_or_si128(_mm_or_si128(DitherChannel_SSE2(px, rsrc, rbits, rbias, rloss, rdst),     \
+                                           DitherChannel_SSE2(px, gsrc, gbits, gbias, gloss, gdst)),    \
+                              DitherChannel_SSE2(px, bsrc, bbits, bbias, bloss, bdst));                 \
+    }
+
+    if (target->dstbpp == 2) {
+        for (; i + 8 <= width; i += 8) {
+            __m128i lo, hi;
+
+            DITHER_QUANTIZE_SSE2(lo, 0);
+            DITHER_QUANTIZE_SSE2(hi, 4);
+            /* Sign extend the low words so the signed pack keeps them intact */
+            lo = _mm_srai_epi32(_mm_slli_epi32(lo, 16), 16);
+            hi = _mm_srai_epi32(_mm_slli_epi32(hi, 16), 16);
+            _mm_storeu_si128((__m128i *)(dst + i * 2), _mm_packs_epi32(lo, hi));
+        }
+    } else {
+        Uint8 codes[16];
+        int j;
+
+        for (; i + 16 <= width; i += 16) {
+            __m128i p0, p1, p2, p3, packed;
+
+            DITHER_QUANTIZE_SSE2(p0, 0);
+            DITHER_QUANTIZE_SSE2(p1, 4);
+            DITHER_QUANTIZE_SSE2(p2, 8);
+            DITHER_QUANTIZE_SSE2(p3, 12);
+            packed = _mm_packus_epi16(_mm_packs_epi32(p0, p1), _mm_packs_epi32(p2, p3));
+            if (target->table) {
+                _mm_storeu_si128((__m128i *)codes, packed);
+                for (j = 0; j < 16; ++j) {
+                    dst[i + j] = target->table[codes[j]];
+                }
+            } else {
+                _mm_storeu_si128((__m128i *)(dst + i), packed);
+            }
+        }
+    }
+#undef DITHER_QUANTIZE_SSE2
+    return i;
+}
+#endif /* SDL_SSE2_INTRINSICS */
+
+#ifdef SDL_NEON_INTRINSICS
+/* NEON shifts right with negative counts */
+static SDL_INLINE uint32x4_t DitherChannel_NEON(uint32x4_t px, int32x4_t shift, int32x4_t bits, uint32x4_t bias, int32x4_t loss, int32x4_t dstshift)
+{
+    const uint32x4_t c = vandq_u32(vshlq_u32(px, shift), vdupq_n_u32(0xFF));
+
+    return vshlq_u32(vshlq_u32(vaddq_u32(vsubq_u32(c, vshlq_u32(c, bits)), bias), loss), dstshift);
+}
+
+static int DitherOrderedRow_NEON(const DitherTarget *target, const Uint32 bias_row[3][4], const Uint32 *src, Uint8 *dst, int width)
+{
+    const uint32x4_t rbias = vld1q_u32(bias_row[0]);
+    const uint32x4_t gbias = vld1q_u32(bias_row[1]);
+    const uint32x4_t bbias = vld1q_u32(bias_row[2]);
+    const int32x4_t rsrc = vdupq_n_s32(-target->srcfmt->Rshift);
+    const int32x4_t gsrc = vdupq_n_s32(-target->srcfmt->Gshift);
+    const int32x4_t bsrc = vdupq_n_s32(-target->srcfmt->Bshift);
+    const int32x4_t rbits = vdupq_n_s32(target->Rloss - 8);
+    const int32x4_t gbits = vdupq_n_s32(target->Gloss - 8);
+    const int32x4_t bbits = vdupq_n_s32(target->Bloss - 8);
+    const int32x4_t rloss = vdupq_n_s32(-target->Rloss);
+    const int32x4_t gloss = vdupq_n_s32(-target->Gloss);
+    const int32x4_t bloss = vdupq_n_s32(-target->Bloss);
+    const int32x4_t rdst = vdupq_n_s32(target->Rshift);
+    const int32x4_t gdst = vdupq_n_s32(target->Gshift);
+    const int32x4_t bdst = vdupq_n_s32(target->Bshift);
+    int i = 0;
+
+#define DITHER_QUANTIZE_NEON(result, offset)                                                    \
+    {                                                                                           \
+        const uint32x4_t px = vld1q_u32(src + i + offset);                                      \
+        result = vorrq_u32(vorrq_u32(DitherChannel_NEON(px, rsrc, rbits, rbias, rloss, rdst),   \
+                                     DitherChannel_NEON(px, gsrc, gbits, gbias, gloss, gdst)),  \
+                           DitherChannel_NEON(px, bsrc, bbits, bbias, bloss, bdst));            \
+    }
+
+    if (target->dstbpp == 2) {
+        for (; i + 8 <= width; i += 8) {
+            uint32x4_t lo, hi;
+
+            DITHER_QUANTIZE_NEON(lo, 0);
+            DITHER_QUANTIZE_NEON(hi, 4);
+            vst1q_u16((Uint16 *)(dst + i * 2), vcombine_u16(vmovn_u32(lo), vmovn_u32(hi)));
+        }
+    } else {
+        Uint8 codes[16];
+        int j;
+
+        for (; i + 16 <= width; i += 16) {
+            uint32x4_t p0, p1, p2, p3;
+            uint8x16_t packed;
+
+            DITHER_QUANTIZE_NEON(p0, 0);
+            DITHER_QUANTIZE_NEON(p1, 4);
+            DITHER_QUANTIZE_NEON(p2, 8);
+            DITHER_QUANTIZE_NEON(p3, 12);
+            packed = vcombine_u8(vmovn_u16(vcombine_u16(vmovn_u32(p0), vmovn_u32(p1))),
+                                 vmovn_u16(vcombine_u16(vmovn_u32(p2), vmovn_u32(p3))));
+            if (target->table) {
+                vst1q_u8(codes, packed);
+                for (j = 0; j < 16; ++j) {
+                    dst[i + j] = target->table[codes[j]];
+                }
+            } else {
+                vst1q_u8(dst + i, packed);
+            }
+        }
+    }
+#undef DITHER_QUANTIZE_NEON
+    return i;
+}
+#endif /* SDL_NEON_INTRINSICS */
+
+static void BlitNtoN_DitherOrdered(SDL_BlitInfo *info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint8 *src = info->src;
+    Uint8 *dst = info->dst;
+    DitherTarget target;
+    unsigned Rbias[16], Gbias[16], Bbias[16];
+    Uint32 bias_rows[4][3][4];
+    SDL_bool simd;
+    int x0, y0, x, y, i;
+
+    GetDitherTarget(info, &target);
+    GetDitherOrigin(info, &x0, &y0);
+
+    /* Thresholds centered in each step, so the average comes out right */
+    for (i = 0; i < 16; ++i) {
+        Rbias[i] = ((2 * i + 1) << target.Rloss) >> 5;
+        Gbias[i] = ((2 * i + 1) << target.Gloss) >> 5;
+        Bbias[i] = ((2 * i + 1) << target.Bloss) >> 5;
+    }
+
+    simd = (target.srcbpp == 4 &&
+            !target.srcfmt->Rloss && !target.srcfmt->Gloss && !target.srcfmt->Bloss &&
+            (target.indexed || !target.dstfmt->Amask));
+    if (simd) {
+        for (y = 0; y < 4; ++y) {
+            for (x = 0; x < 4; ++x) {
+                const int cell = dither_bayer4[y][(x0 + x) & 3];
+                bias_rows[y][0][x] = Rbias[cell];
+                bias_rows[y][1][x] = Gbias[cell];
+                bias_rows[y][2][x] = Bbias[cell];
+            }
+        }
+    }
+
+    for (y = 0; y < height; ++y) {
+        const int row = (y0 + y) & 3;
+
+        x = 0;
+#ifdef SDL_SSE2_INTRINSICS
+        if (simd && SDL_HasSSE2()) {
+            x = DitherOrderedRow_SSE2(&target, bias_rows[row], (const Uint32 *)src, dst, width);
+        }
+#endif
+#ifdef SDL_NEON_INTRINSICS
+        if (x == 0 && simd && SDL_HasNEON()) {
+            x = DitherOrderedRow_NEON(&target, bias_rows[row], (const Uint32 *)src, dst, width);
+        }
+#endif
+        for (; x < width; ++x) {
+            const int cell = dither_bayer4[row][(x0 + x) & 3];
+            Uint32 Pixel;
+            unsigned r, g, b, a;
+            int qR, qG, qB;
+
+            DISEMBLE_RGBA(src + x * target.srcbpp, target.srcbpp, target.srcfmt, Pixel, r, g, b, a);
+            r = DITHER_LEVEL(r, target.Rloss, Rbias[cell]) << target.Rloss;
+            g = DITHER_LEVEL(g, target.Gloss, Gbias[cell]) << target.Gloss;
+            b = DITHER_LEVEL(b, target.Bloss, Bbias[cell]) << target.Bloss;
+            DitherStore(&target, dst + x * target.dstbpp, r, g, b, a, &qR, &qG, &qB);
+        }
+        src += info->src_pitch;
+        dst += info->dst_pitch;
+    }
+}
+
+/* Floyd-Steinberg error diffusion. The error for a row only depends on the
+ * row above it, so two lines of error terms are enough, and the three color
+ * channels are carried through each pixel together.
+ */
+static void BlitNtoN_DitherDiffusion(SDL_BlitInfo *info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint8 *src = info->src;
+    Uint8 *dst = info->dst;
+    const int stride = (width + 2) * 3;
+    DitherTarget target;
+    int *errors, *cur, *next, *tmp;
+    int x, y;
+
+    errors = (int *)SDL_calloc(2 * stride, sizeof(*errors));
+    if (!errors) {
+        BlitNtoN_DitherOrdered(info);
+        return;
+    }
+    /* Leave room for the pixel on either side of the row */
+    cur = errors + 3;
+    next = cur + stride;
+
+    GetDitherTarget(info, &target);
+
+    for (y = 0; y < height; ++y) {
+        for (x = 0; x < width; ++x) {
+            int *e = &cur[x * 3];
+            int *n = &next[x * 3];
+            Uint32 Pixel;
+            unsigned r, g, b, a;
+            int vR, vG, vB, qR, qG, qB, eR, eG, eB;
+
+            DISEMBLE_RGBA(src + x * target.srcbpp, target.srcbpp, target.srcfmt, Pixel, r, g, b, a);
+            vR = (int)r + e[0] / 16;
+            vG = (int)g + e[1] / 16;
+            vB = (int)b + e[2] / 16;
+            vR = SDL_clamp(vR, 0, 255);
+            vG = SDL_clamp(vG, 0, 255);
+            vB = SDL_clamp(vB, 0, 255);
+            DitherStore(&target, dst + x * target.dstbpp, (unsigned)vR, (unsigned)vG, (unsigned)vB, a, &qR, &qG, &qB);
+
+            eR = vR - qR;
+            eG = vG - qG;
+            eB = vB - qB;
+            e[3] += eR * 7;
+            e[4] += eG * 7;
+            e[5] += eB * 7;
+            n[-3] += eR * 3;
+            n[-2] += eG * 3;
+            n[-1] += eB * 3;
+            n[0] += eR * 5;
+            n[1] += eG * 5;
+            n[2] += eB * 5;
+            n[3] += eR;
+            n[4] += eG;
+            n[5] += eB;
+        }
+        tmp = cur;
+        cur = next;
+        next = tmp;
+        SDL_memset(next - 3, 0, stride * sizeof(*next));
+
+        src += info->src_pitch;
+        dst += info->dst_pitch;
+    }
+    SDL_free(errors);
+}
+
+/* Returns the dithering blitter if the source asks for one and the
+   destination has less color precision than the source */
+static SDL_BlitFunc ChooseDitherBlit(SDL_Surface *surface)
+{
+    SDL_PixelFormat *srcfmt = surface->format;
+    SDL_PixelFormat *dstfmt = surface->map->dst->format;
+    SDL_DitherMode mode = SDL_DITHER_NONE;
+
+    if (SDL_GetSurfaceDitherMode(surface, &mode) < 0 || mode == SDL_DITHER_NONE) {
+        return NULL;
+    }
+    if (SDL_ISPIXELFORMAT_10BIT(srcfmt->format) ||
+        dstfmt->bytes_per_pixel > 2 ||
+        dstfmt->bits_per_pixel >= srcfmt->bits_per_pixel) {
+        return NULL;
+    }
+    if (mode == SDL_DITHER_DIFFUSION) {
+        return BlitNtoN_DitherDiffusion;
+    }
+    return BlitNtoN_DitherOrdered;
+}
+
 /* Normal N to N optimized blitters */
 #define NO_ALPHA   1
 #define SET_ALPHA  2
@@ -3353,7 +3761,10 @@ SDL_BlitFunc SDL_CalculateBlitN(SDL_Surface *surface)
 
     switch (surface->map->info.flags & ~SDL_COPY_RLE_MASK) {
     case 0:
-        blitfun = NULL;
+        blitfun = ChooseDitherBlit(surface);
+        if (blitfun) {
+            return blitfun;
+        }
         if (dstfmt->bits_per_pixel == 8) {
             if ((srcfmt->bytes_per_pixel == 4) &&
                 (srcfmt->Rmask == 0x00FF0000) &&
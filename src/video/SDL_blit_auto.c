@@ -28,33 +28,60 @@
 #include "SDL_blit.h"
 #include "SDL_blit_auto.h"
 
+/* Fills in the source column of each destination pixel in a scaled blit, so
+   the rows only have to look them up instead of stepping through the source */
+static void SDL_GetBlitAutoColumns(const SDL_BlitInfo *info, Uint32 *columns)
+{
+    const Uint64 incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    Uint64 posx = incx / 2;
+    int x;
+
+    for (x = 0; x < info->dst_w; ++x) {
+        columns[x] = (Uint32)(posx >> 16);
+        posx += incx;
+    }
+}
+
 static void SDL_Blit_XRGB8888_XRGB8888_Scale(SDL_BlitInfo *info)
 {
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+    Uint64 lasty = ~(Uint64)0;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        if (srcy == lasty) {
+            SDL_memcpy(dst, info->dst - info->dst_pitch, info->dst_w * 4);
+            posy += incy;
+            info->dst += info->dst_pitch;
+            continue;
+        }
+        lasty = srcy;
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             *dst = *src;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_XRGB8888_XRGB8888_Blend(SDL_BlitInfo *info)
@@ -113,24 +140,29 @@ static void SDL_Blit_XRGB8888_XRGB8888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             srcpixel = *src;
             srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel;
             dstpixel = *dst;
@@ -159,12 +191,12 @@ static void SDL_Blit_XRGB8888_XRGB8888_Blend_Scale(SDL_BlitInfo *info)
             }
             dstpixel = (dstR << 16) | (dstG << 8) | dstB;
             *dst = dstpixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_XRGB8888_XRGB8888_Modulate(SDL_BlitInfo *info)
@@ -206,24 +238,37 @@ static void SDL_Blit_XRGB8888_XRGB8888_Modulate_Scale(SDL_BlitInfo *info)
     const Uint32 modulateB = info->b;
     Uint32 pixel;
     Uint32 R, G, B;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+    Uint64 lasty = ~(Uint64)0;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        if (srcy == lasty) {
+            SDL_memcpy(dst, info->dst - info->dst_pitch, info->dst_w * 4);
+            posy += incy;
+            info->dst += info->dst_pitch;
+            continue;
+        }
+        lasty = srcy;
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             pixel = *src;
             R = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); B = (Uint8)pixel;
             if (flags & SDL_COPY_MODULATE_COLOR) {
@@ -233,12 +278,12 @@ static void SDL_Blit_XRGB8888_XRGB8888_Modulate_Scale(SDL_BlitInfo *info)
             }
             pixel = (R << 16) | (G << 8) | B;
             *dst = pixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_XRGB8888_XRGB8888_Modulate_Blend(SDL_BlitInfo *info)
@@ -320,24 +365,29 @@ static void SDL_Blit_XRGB8888_XRGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             srcpixel = *src;
             srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel;
             dstpixel = *dst;
@@ -379,46 +429,59 @@ static void SDL_Blit_XRGB8888_XRGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
             }
             dstpixel = (dstR << 16) | (dstG << 8) | dstB;
             *dst = dstpixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_XRGB8888_XBGR8888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
     Uint32 R, G, B;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+    Uint64 lasty = ~(Uint64)0;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        if (srcy == lasty) {
+            SDL_memcpy(dst, info->dst - info->dst_pitch, info->dst_w * 4);
+            posy += incy;
+            info->dst += info->dst_pitch;
+            continue;
+        }
+        lasty = srcy;
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             pixel = *src;
             R = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); B = (Uint8)pixel;
             pixel = (B << 16) | (G << 8) | R;
             *dst = pixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_XRGB8888_XBGR8888_Blend(SDL_BlitInfo *info)
@@ -477,24 +540,29 @@ static void SDL_Blit_XRGB8888_XBGR8888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             srcpixel = *src;
             srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel;
             dstpixel = *dst;
@@ -523,12 +591,12 @@ static void SDL_Blit_XRGB8888_XBGR8888_Blend_Scale(SDL_BlitInfo *info)
             }
             dstpixel = (dstB << 16) | (dstG << 8) | dstR;
             *dst = dstpixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_XRGB8888_XBGR8888_Modulate(SDL_BlitInfo *info)
@@ -570,24 +638,37 @@ static void SDL_Blit_XRGB8888_XBGR8888_Modulate_Scale(SDL_BlitInfo *info)
     const Uint32 modulateB = info->b;
     Uint32 pixel;
     Uint32 R, G, B;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+    Uint64 lasty = ~(Uint64)0;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        if (srcy == lasty) {
+            SDL_memcpy(dst, info->dst - info->dst_pitch, info->dst_w * 4);
+            posy += incy;
+            info->dst += info->dst_pitch;
+            continue;
+        }
+        lasty = srcy;
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             pixel = *src;
             R = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); B = (Uint8)pixel;
             if (flags & SDL_COPY_MODULATE_COLOR) {
@@ -597,12 +678,12 @@ static void SDL_Blit_XRGB8888_XBGR8888_Modulate_Scale(SDL_BlitInfo *info)
             }
             pixel = (B << 16) | (G << 8) | R;
             *dst = pixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_XRGB8888_XBGR8888_Modulate_Blend(SDL_BlitInfo *info)
@@ -684,24 +765,29 @@ static void SDL_Blit_XRGB8888_XBGR8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             srcpixel = *src;
             srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel;
             dstpixel = *dst;
@@ -743,45 +829,58 @@ static void SDL_Blit_XRGB8888_XBGR8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
             }
             dstpixel = (dstB << 16) | (dstG << 8) | dstR;
             *dst = dstpixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_XRGB8888_ARGB8888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
     const Uint32 A = 0xFF;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+    Uint64 lasty = ~(Uint64)0;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        if (srcy == lasty) {
+            SDL_memcpy(dst, info->dst - info->dst_pitch, info->dst_w * 4);
+            posy += incy;
+            info->dst += info->dst_pitch;
+            continue;
+        }
+        lasty = srcy;
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             pixel = *src;
             pixel |= (A << 24);
             *dst = pixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_XRGB8888_ARGB8888_Blend(SDL_BlitInfo *info)
@@ -841,24 +940,29 @@ static void SDL_Blit_XRGB8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB, dstA;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             srcpixel = *src;
             srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel;
             dstpixel = *dst;
@@ -888,12 +992,12 @@ static void SDL_Blit_XRGB8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
             }
             dstpixel = (dstA << 24) | (dstR << 16) | (dstG << 8) | dstB;
             *dst = dstpixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_XRGB8888_ARGB8888_Modulate(SDL_BlitInfo *info)
@@ -939,24 +1043,37 @@ static void SDL_Blit_XRGB8888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
     Uint32 pixel;
     const Uint32 A = (flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 0xFF;
     Uint32 R, G, B;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+    Uint64 lasty = ~(Uint64)0;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        if (srcy == lasty) {
+            SDL_memcpy(dst, info->dst - info->dst_pitch, info->dst_w * 4);
+            posy += incy;
+            info->dst += info->dst_pitch;
+            continue;
+        }
+        lasty = srcy;
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             pixel = *src;
             R = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); B = (Uint8)pixel;
             if (flags & SDL_COPY_MODULATE_COLOR) {
@@ -966,12 +1083,12 @@ static void SDL_Blit_XRGB8888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
             }
             pixel = (A << 24) | (R << 16) | (G << 8) | B;
             *dst = pixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_XRGB8888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
@@ -1054,24 +1171,29 @@ static void SDL_Blit_XRGB8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB, dstA;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             srcpixel = *src;
             srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel;
             dstpixel = *dst;
@@ -1114,46 +1236,59 @@ static void SDL_Blit_XRGB8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
             }
             dstpixel = (dstA << 24) | (dstR << 16) | (dstG << 8) | dstB;
             *dst = dstpixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_XBGR8888_XRGB8888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
     Uint32 R, G, B;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+    Uint64 lasty = ~(Uint64)0;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        if (srcy == lasty) {
+            SDL_memcpy(dst, info->dst - info->dst_pitch, info->dst_w * 4);
+            posy += incy;
+            info->dst += info->dst_pitch;
+            continue;
+        }
+        lasty = srcy;
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             pixel = *src;
             B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel;
             pixel = (R << 16) | (G << 8) | B;
             *dst = pixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_XBGR8888_XRGB8888_Blend(SDL_BlitInfo *info)
@@ -1212,24 +1347,29 @@ static void SDL_Blit_XBGR8888_XRGB8888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             srcpixel = *src;
             srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel;
             dstpixel = *dst;
@@ -1258,12 +1398,12 @@ static void SDL_Blit_XBGR8888_XRGB8888_Blend_Scale(SDL_BlitInfo *info)
             }
             dstpixel = (dstR << 16) | (dstG << 8) | dstB;
             *dst = dstpixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_XBGR8888_XRGB8888_Modulate(SDL_BlitInfo *info)
@@ -1305,24 +1445,37 @@ static void SDL_Blit_XBGR8888_XRGB8888_Modulate_Scale(SDL_BlitInfo *info)
     const Uint32 modulateB = info->b;
     Uint32 pixel;
     Uint32 R, G, B;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+    Uint64 lasty = ~(Uint64)0;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        if (srcy == lasty) {
+            SDL_memcpy(dst, info->dst - info->dst_pitch, info->dst_w * 4);
+            posy += incy;
+            info->dst += info->dst_pitch;
+            continue;
+        }
+        lasty = srcy;
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             pixel = *src;
             B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel;
             if (flags & SDL_COPY_MODULATE_COLOR) {
@@ -1332,12 +1485,12 @@ static void SDL_Blit_XBGR8888_XRGB8888_Modulate_Scale(SDL_BlitInfo *info)
             }
             pixel = (R << 16) | (G << 8) | B;
             *dst = pixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_XBGR8888_XRGB8888_Modulate_Blend(SDL_BlitInfo *info)
@@ -1419,24 +1572,29 @@ static void SDL_Blit_XBGR8888_XRGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             srcpixel = *src;
             srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel;
             dstpixel = *dst;
@@ -1478,41 +1636,54 @@ static void SDL_Blit_XBGR8888_XRGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
             }
             dstpixel = (dstR << 16) | (dstG << 8) | dstB;
             *dst = dstpixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_XBGR8888_XBGR8888_Scale(SDL_BlitInfo *info)
 {
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+    Uint64 lasty = ~(Uint64)0;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        if (srcy == lasty) {
+            SDL_memcpy(dst, info->dst - info->dst_pitch, info->dst_w * 4);
+            posy += incy;
+            info->dst += info->dst_pitch;
+            continue;
+        }
+        lasty = srcy;
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             *dst = *src;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_XBGR8888_XBGR8888_Blend(SDL_BlitInfo *info)
@@ -1571,24 +1742,29 @@ static void SDL_Blit_XBGR8888_XBGR8888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             srcpixel = *src;
             srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel;
             dstpixel = *dst;
@@ -1617,12 +1793,12 @@ static void SDL_Blit_XBGR8888_XBGR8888_Blend_Scale(SDL_BlitInfo *info)
             }
             dstpixel = (dstB << 16) | (dstG << 8) | dstR;
             *dst = dstpixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_XBGR8888_XBGR8888_Modulate(SDL_BlitInfo *info)
@@ -1664,24 +1840,37 @@ static void SDL_Blit_XBGR8888_XBGR8888_Modulate_Scale(SDL_BlitInfo *info)
     const Uint32 modulateB = info->b;
     Uint32 pixel;
     Uint32 R, G, B;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+    Uint64 lasty = ~(Uint64)0;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        if (srcy == lasty) {
+            SDL_memcpy(dst, info->dst - info->dst_pitch, info->dst_w * 4);
+            posy += incy;
+            info->dst += info->dst_pitch;
+            continue;
+        }
+        lasty = srcy;
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             pixel = *src;
             B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel;
             if (flags & SDL_COPY_MODULATE_COLOR) {
@@ -1691,12 +1880,12 @@ static void SDL_Blit_XBGR8888_XBGR8888_Modulate_Scale(SDL_BlitInfo *info)
             }
             pixel = (B << 16) | (G << 8) | R;
             *dst = pixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_XBGR8888_XBGR8888_Modulate_Blend(SDL_BlitInfo *info)
@@ -1778,24 +1967,29 @@ static void SDL_Blit_XBGR8888_XBGR8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             srcpixel = *src;
             srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel;
             dstpixel = *dst;
@@ -1837,12 +2031,12 @@ static void SDL_Blit_XBGR8888_XBGR8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
             }
             dstpixel = (dstB << 16) | (dstG << 8) | dstR;
             *dst = dstpixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_XBGR8888_ARGB8888_Scale(SDL_BlitInfo *info)
@@ -1850,34 +2044,47 @@ static void SDL_Blit_XBGR8888_ARGB8888_Scale(SDL_BlitInfo *info)
     Uint32 pixel;
     const Uint32 A = 0xFF;
     Uint32 R, G, B;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+    Uint64 lasty = ~(Uint64)0;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        if (srcy == lasty) {
+            SDL_memcpy(dst, info->dst - info->dst_pitch, info->dst_w * 4);
+            posy += incy;
+            info->dst += info->dst_pitch;
+            continue;
+        }
+        lasty = srcy;
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             pixel = *src;
             B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel;
             pixel = (A << 24) | (R << 16) | (G << 8) | B;
             *dst = pixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_XBGR8888_ARGB8888_Blend(SDL_BlitInfo *info)
@@ -1937,24 +2144,29 @@ static void SDL_Blit_XBGR8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB, dstA;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             srcpixel = *src;
             srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel;
             dstpixel = *dst;
@@ -1984,12 +2196,12 @@ static void SDL_Blit_XBGR8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
             }
             dstpixel = (dstA << 24) | (dstR << 16) | (dstG << 8) | dstB;
             *dst = dstpixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_XBGR8888_ARGB8888_Modulate(SDL_BlitInfo *info)
@@ -2035,24 +2247,37 @@ static void SDL_Blit_XBGR8888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
     Uint32 pixel;
     const Uint32 A = (flags & SDL_COPY_MODULATE_ALPHA) ? modulateA : 0xFF;
     Uint32 R, G, B;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+    Uint64 lasty = ~(Uint64)0;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        if (srcy == lasty) {
+            SDL_memcpy(dst, info->dst - info->dst_pitch, info->dst_w * 4);
+            posy += incy;
+            info->dst += info->dst_pitch;
+            continue;
+        }
+        lasty = srcy;
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             pixel = *src;
             B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel;
             if (flags & SDL_COPY_MODULATE_COLOR) {
@@ -2062,12 +2287,12 @@ static void SDL_Blit_XBGR8888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
             }
             pixel = (A << 24) | (R << 16) | (G << 8) | B;
             *dst = pixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_XBGR8888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
@@ -2150,24 +2375,29 @@ static void SDL_Blit_XBGR8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB, dstA;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             srcpixel = *src;
             srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel;
             dstpixel = *dst;
@@ -2210,44 +2440,57 @@ static void SDL_Blit_XBGR8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
             }
             dstpixel = (dstA << 24) | (dstR << 16) | (dstG << 8) | dstB;
             *dst = dstpixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_ARGB8888_XRGB8888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+    Uint64 lasty = ~(Uint64)0;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        if (srcy == lasty) {
+            SDL_memcpy(dst, info->dst - info->dst_pitch, info->dst_w * 4);
+            posy += incy;
+            info->dst += info->dst_pitch;
+            continue;
+        }
+        lasty = srcy;
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             pixel = *src;
             pixel &= 0xFFFFFF;
             *dst = pixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_ARGB8888_XRGB8888_Blend(SDL_BlitInfo *info)
@@ -2314,24 +2557,29 @@ static void SDL_Blit_ARGB8888_XRGB8888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             srcpixel = *src;
             srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel; srcA = (Uint8)(srcpixel >> 24);
             dstpixel = *dst;
@@ -2368,12 +2616,12 @@ static void SDL_Blit_ARGB8888_XRGB8888_Blend_Scale(SDL_BlitInfo *info)
             }
             dstpixel = (dstR << 16) | (dstG << 8) | dstB;
             *dst = dstpixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_ARGB8888_XRGB8888_Modulate(SDL_BlitInfo *info)
@@ -2415,24 +2663,37 @@ static void SDL_Blit_ARGB8888_XRGB8888_Modulate_Scale(SDL_BlitInfo *info)
     const Uint32 modulateB = info->b;
     Uint32 pixel;
     Uint32 R, G, B;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+    Uint64 lasty = ~(Uint64)0;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        if (srcy == lasty) {
+            SDL_memcpy(dst, info->dst - info->dst_pitch, info->dst_w * 4);
+            posy += incy;
+            info->dst += info->dst_pitch;
+            continue;
+        }
+        lasty = srcy;
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             pixel = *src;
             R = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); B = (Uint8)pixel;
             if (flags & SDL_COPY_MODULATE_COLOR) {
@@ -2442,12 +2703,12 @@ static void SDL_Blit_ARGB8888_XRGB8888_Modulate_Scale(SDL_BlitInfo *info)
             }
             pixel = (R << 16) | (G << 8) | B;
             *dst = pixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_ARGB8888_XRGB8888_Modulate_Blend(SDL_BlitInfo *info)
@@ -2530,24 +2791,29 @@ static void SDL_Blit_ARGB8888_XRGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             srcpixel = *src;
             srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel; srcA = (Uint8)(srcpixel >> 24);
             dstpixel = *dst;
@@ -2592,46 +2858,59 @@ static void SDL_Blit_ARGB8888_XRGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
             }
             dstpixel = (dstR << 16) | (dstG << 8) | dstB;
             *dst = dstpixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_ARGB8888_XBGR8888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
     Uint32 R, G, B;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+    Uint64 lasty = ~(Uint64)0;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        if (srcy == lasty) {
+            SDL_memcpy(dst, info->dst - info->dst_pitch, info->dst_w * 4);
+            posy += incy;
+            info->dst += info->dst_pitch;
+            continue;
+        }
+        lasty = srcy;
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             pixel = *src;
             R = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); B = (Uint8)pixel;
             pixel = (B << 16) | (G << 8) | R;
             *dst = pixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_ARGB8888_XBGR8888_Blend(SDL_BlitInfo *info)
@@ -2698,24 +2977,29 @@ static void SDL_Blit_ARGB8888_XBGR8888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             srcpixel = *src;
             srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel; srcA = (Uint8)(srcpixel >> 24);
             dstpixel = *dst;
@@ -2752,12 +3036,12 @@ static void SDL_Blit_ARGB8888_XBGR8888_Blend_Scale(SDL_BlitInfo *info)
             }
             dstpixel = (dstB << 16) | (dstG << 8) | dstR;
             *dst = dstpixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_ARGB8888_XBGR8888_Modulate(SDL_BlitInfo *info)
@@ -2799,24 +3083,37 @@ static void SDL_Blit_ARGB8888_XBGR8888_Modulate_Scale(SDL_BlitInfo *info)
     const Uint32 modulateB = info->b;
     Uint32 pixel;
     Uint32 R, G, B;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+    Uint64 lasty = ~(Uint64)0;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        if (srcy == lasty) {
+            SDL_memcpy(dst, info->dst - info->dst_pitch, info->dst_w * 4);
+            posy += incy;
+            info->dst += info->dst_pitch;
+            continue;
+        }
+        lasty = srcy;
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             pixel = *src;
             R = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); B = (Uint8)pixel;
             if (flags & SDL_COPY_MODULATE_COLOR) {
@@ -2826,12 +3123,12 @@ static void SDL_Blit_ARGB8888_XBGR8888_Modulate_Scale(SDL_BlitInfo *info)
             }
             pixel = (B << 16) | (G << 8) | R;
             *dst = pixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_ARGB8888_XBGR8888_Modulate_Blend(SDL_BlitInfo *info)
@@ -2914,24 +3211,29 @@ static void SDL_Blit_ARGB8888_XBGR8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             srcpixel = *src;
             srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel; srcA = (Uint8)(srcpixel >> 24);
             dstpixel = *dst;
@@ -2976,41 +3278,54 @@ static void SDL_Blit_ARGB8888_XBGR8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
             }
             dstpixel = (dstB << 16) | (dstG << 8) | dstR;
             *dst = dstpixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_ARGB8888_ARGB8888_Scale(SDL_BlitInfo *info)
 {
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+    Uint64 lasty = ~(Uint64)0;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        if (srcy == lasty) {
+            SDL_memcpy(dst, info->dst - info->dst_pitch, info->dst_w * 4);
+            posy += incy;
+            info->dst += info->dst_pitch;
+            continue;
+        }
+        lasty = srcy;
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             *dst = *src;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_ARGB8888_ARGB8888_Blend(SDL_BlitInfo *info)
@@ -3078,24 +3393,29 @@ static void SDL_Blit_ARGB8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB, dstA;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             srcpixel = *src;
             srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel; srcA = (Uint8)(srcpixel >> 24);
             dstpixel = *dst;
@@ -3133,12 +3453,12 @@ static void SDL_Blit_ARGB8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
             }
             dstpixel = (dstA << 24) | (dstR << 16) | (dstG << 8) | dstB;
             *dst = dstpixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_ARGB8888_ARGB8888_Modulate(SDL_BlitInfo *info)
@@ -3185,24 +3505,37 @@ static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
     const Uint32 modulateA = info->a;
     Uint32 pixel;
     Uint32 R, G, B, A;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+    Uint64 lasty = ~(Uint64)0;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        if (srcy == lasty) {
+            SDL_memcpy(dst, info->dst - info->dst_pitch, info->dst_w * 4);
+            posy += incy;
+            info->dst += info->dst_pitch;
+            continue;
+        }
+        lasty = srcy;
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             pixel = *src;
             R = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); B = (Uint8)pixel; A = (Uint8)(pixel >> 24);
             if (flags & SDL_COPY_MODULATE_COLOR) {
@@ -3215,12 +3548,12 @@ static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
             }
             pixel = (A << 24) | (R << 16) | (G << 8) | B;
             *dst = pixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
@@ -3304,24 +3637,29 @@ static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB, dstA;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             srcpixel = *src;
             srcR = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcB = (Uint8)srcpixel; srcA = (Uint8)(srcpixel >> 24);
             dstpixel = *dst;
@@ -3367,44 +3705,57 @@ static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
             }
             dstpixel = (dstA << 24) | (dstR << 16) | (dstG << 8) | dstB;
             *dst = dstpixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_RGBA8888_XRGB8888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+    Uint64 lasty = ~(Uint64)0;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        if (srcy == lasty) {
+            SDL_memcpy(dst, info->dst - info->dst_pitch, info->dst_w * 4);
+            posy += incy;
+            info->dst += info->dst_pitch;
+            continue;
+        }
+        lasty = srcy;
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             pixel = *src;
             pixel >>= 8;
             *dst = pixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_RGBA8888_XRGB8888_Blend(SDL_BlitInfo *info)
@@ -3471,24 +3822,29 @@ static void SDL_Blit_RGBA8888_XRGB8888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             srcpixel = *src;
             srcR = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcB = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
             dstpixel = *dst;
@@ -3525,12 +3881,12 @@ static void SDL_Blit_RGBA8888_XRGB8888_Blend_Scale(SDL_BlitInfo *info)
             }
             dstpixel = (dstR << 16) | (dstG << 8) | dstB;
             *dst = dstpixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_RGBA8888_XRGB8888_Modulate(SDL_BlitInfo *info)
@@ -3572,24 +3928,37 @@ static void SDL_Blit_RGBA8888_XRGB8888_Modulate_Scale(SDL_BlitInfo *info)
     const Uint32 modulateB = info->b;
     Uint32 pixel;
     Uint32 R, G, B;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+    Uint64 lasty = ~(Uint64)0;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        if (srcy == lasty) {
+            SDL_memcpy(dst, info->dst - info->dst_pitch, info->dst_w * 4);
+            posy += incy;
+            info->dst += info->dst_pitch;
+            continue;
+        }
+        lasty = srcy;
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             pixel = *src;
             R = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); B = (Uint8)(pixel >> 8);
             if (flags & SDL_COPY_MODULATE_COLOR) {
@@ -3599,12 +3968,12 @@ static void SDL_Blit_RGBA8888_XRGB8888_Modulate_Scale(SDL_BlitInfo *info)
             }
             pixel = (R << 16) | (G << 8) | B;
             *dst = pixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_RGBA8888_XRGB8888_Modulate_Blend(SDL_BlitInfo *info)
@@ -3687,24 +4056,29 @@ static void SDL_Blit_RGBA8888_XRGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             srcpixel = *src;
             srcR = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcB = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
             dstpixel = *dst;
@@ -3749,46 +4123,59 @@ static void SDL_Blit_RGBA8888_XRGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
             }
             dstpixel = (dstR << 16) | (dstG << 8) | dstB;
             *dst = dstpixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_RGBA8888_XBGR8888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
     Uint32 R, G, B;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+    Uint64 lasty = ~(Uint64)0;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        if (srcy == lasty) {
+            SDL_memcpy(dst, info->dst - info->dst_pitch, info->dst_w * 4);
+            posy += incy;
+            info->dst += info->dst_pitch;
+            continue;
+        }
+        lasty = srcy;
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             pixel = *src;
             R = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); B = (Uint8)(pixel >> 8);
             pixel = (B << 16) | (G << 8) | R;
             *dst = pixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_RGBA8888_XBGR8888_Blend(SDL_BlitInfo *info)
@@ -3855,24 +4242,29 @@ static void SDL_Blit_RGBA8888_XBGR8888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             srcpixel = *src;
             srcR = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcB = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
             dstpixel = *dst;
@@ -3909,12 +4301,12 @@ static void SDL_Blit_RGBA8888_XBGR8888_Blend_Scale(SDL_BlitInfo *info)
             }
             dstpixel = (dstB << 16) | (dstG << 8) | dstR;
             *dst = dstpixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_RGBA8888_XBGR8888_Modulate(SDL_BlitInfo *info)
@@ -3956,24 +4348,37 @@ static void SDL_Blit_RGBA8888_XBGR8888_Modulate_Scale(SDL_BlitInfo *info)
     const Uint32 modulateB = info->b;
     Uint32 pixel;
     Uint32 R, G, B;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+    Uint64 lasty = ~(Uint64)0;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        if (srcy == lasty) {
+            SDL_memcpy(dst, info->dst - info->dst_pitch, info->dst_w * 4);
+            posy += incy;
+            info->dst += info->dst_pitch;
+            continue;
+        }
+        lasty = srcy;
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             pixel = *src;
             R = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); B = (Uint8)(pixel >> 8);
             if (flags & SDL_COPY_MODULATE_COLOR) {
@@ -3983,12 +4388,12 @@ static void SDL_Blit_RGBA8888_XBGR8888_Modulate_Scale(SDL_BlitInfo *info)
             }
             pixel = (B << 16) | (G << 8) | R;
             *dst = pixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_RGBA8888_XBGR8888_Modulate_Blend(SDL_BlitInfo *info)
@@ -4071,24 +4476,29 @@ static void SDL_Blit_RGBA8888_XBGR8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             srcpixel = *src;
             srcR = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcB = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
             dstpixel = *dst;
@@ -4133,44 +4543,57 @@ static void SDL_Blit_RGBA8888_XBGR8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
             }
             dstpixel = (dstB << 16) | (dstG << 8) | dstR;
             *dst = dstpixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_RGBA8888_ARGB8888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+    Uint64 lasty = ~(Uint64)0;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        if (srcy == lasty) {
+            SDL_memcpy(dst, info->dst - info->dst_pitch, info->dst_w * 4);
+            posy += incy;
+            info->dst += info->dst_pitch;
+            continue;
+        }
+        lasty = srcy;
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             pixel = *src;
             pixel = (pixel >> 8) | (pixel << 24);
             *dst = pixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_RGBA8888_ARGB8888_Blend(SDL_BlitInfo *info)
@@ -4238,24 +4661,29 @@ static void SDL_Blit_RGBA8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB, dstA;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             srcpixel = *src;
             srcR = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcB = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
             dstpixel = *dst;
@@ -4293,12 +4721,12 @@ static void SDL_Blit_RGBA8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
             }
             dstpixel = (dstA << 24) | (dstR << 16) | (dstG << 8) | dstB;
             *dst = dstpixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_RGBA8888_ARGB8888_Modulate(SDL_BlitInfo *info)
@@ -4345,24 +4773,37 @@ static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
     const Uint32 modulateA = info->a;
     Uint32 pixel;
     Uint32 R, G, B, A;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+    Uint64 lasty = ~(Uint64)0;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        if (srcy == lasty) {
+            SDL_memcpy(dst, info->dst - info->dst_pitch, info->dst_w * 4);
+            posy += incy;
+            info->dst += info->dst_pitch;
+            continue;
+        }
+        lasty = srcy;
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             pixel = *src;
             R = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); B = (Uint8)(pixel >> 8); A = (Uint8)pixel;
             if (flags & SDL_COPY_MODULATE_COLOR) {
@@ -4375,12 +4816,12 @@ static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
             }
             pixel = (A << 24) | (R << 16) | (G << 8) | B;
             *dst = pixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
@@ -4464,24 +4905,29 @@ static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB, dstA;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             srcpixel = *src;
             srcR = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcB = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
             dstpixel = *dst;
@@ -4527,46 +4973,59 @@ static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
             }
             dstpixel = (dstA << 24) | (dstR << 16) | (dstG << 8) | dstB;
             *dst = dstpixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_ABGR8888_XRGB8888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
     Uint32 R, G, B;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+    Uint64 lasty = ~(Uint64)0;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        if (srcy == lasty) {
+            SDL_memcpy(dst, info->dst - info->dst_pitch, info->dst_w * 4);
+            posy += incy;
+            info->dst += info->dst_pitch;
+            continue;
+        }
+        lasty = srcy;
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             pixel = *src;
             B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel;
             pixel = (R << 16) | (G << 8) | B;
             *dst = pixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_ABGR8888_XRGB8888_Blend(SDL_BlitInfo *info)
@@ -4633,24 +5092,29 @@ static void SDL_Blit_ABGR8888_XRGB8888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             srcpixel = *src;
             srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel; srcA = (Uint8)(srcpixel >> 24);
             dstpixel = *dst;
@@ -4687,12 +5151,12 @@ static void SDL_Blit_ABGR8888_XRGB8888_Blend_Scale(SDL_BlitInfo *info)
             }
             dstpixel = (dstR << 16) | (dstG << 8) | dstB;
             *dst = dstpixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_ABGR8888_XRGB8888_Modulate(SDL_BlitInfo *info)
@@ -4734,24 +5198,37 @@ static void SDL_Blit_ABGR8888_XRGB8888_Modulate_Scale(SDL_BlitInfo *info)
     const Uint32 modulateB = info->b;
     Uint32 pixel;
     Uint32 R, G, B;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+    Uint64 lasty = ~(Uint64)0;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        if (srcy == lasty) {
+            SDL_memcpy(dst, info->dst - info->dst_pitch, info->dst_w * 4);
+            posy += incy;
+            info->dst += info->dst_pitch;
+            continue;
+        }
+        lasty = srcy;
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             pixel = *src;
             B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel;
             if (flags & SDL_COPY_MODULATE_COLOR) {
@@ -4761,12 +5238,12 @@ static void SDL_Blit_ABGR8888_XRGB8888_Modulate_Scale(SDL_BlitInfo *info)
             }
             pixel = (R << 16) | (G << 8) | B;
             *dst = pixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_ABGR8888_XRGB8888_Modulate_Blend(SDL_BlitInfo *info)
@@ -4849,24 +5326,29 @@ static void SDL_Blit_ABGR8888_XRGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             srcpixel = *src;
             srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel; srcA = (Uint8)(srcpixel >> 24);
             dstpixel = *dst;
@@ -4911,44 +5393,57 @@ static void SDL_Blit_ABGR8888_XRGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
             }
             dstpixel = (dstR << 16) | (dstG << 8) | dstB;
             *dst = dstpixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_ABGR8888_XBGR8888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+    Uint64 lasty = ~(Uint64)0;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        if (srcy == lasty) {
+            SDL_memcpy(dst, info->dst - info->dst_pitch, info->dst_w * 4);
+            posy += incy;
+            info->dst += info->dst_pitch;
+            continue;
+        }
+        lasty = srcy;
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             pixel = *src;
             pixel &= 0xFFFFFF;
             *dst = pixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_ABGR8888_XBGR8888_Blend(SDL_BlitInfo *info)
@@ -5015,24 +5510,29 @@ static void SDL_Blit_ABGR8888_XBGR8888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             srcpixel = *src;
             srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel; srcA = (Uint8)(srcpixel >> 24);
             dstpixel = *dst;
@@ -5069,12 +5569,12 @@ static void SDL_Blit_ABGR8888_XBGR8888_Blend_Scale(SDL_BlitInfo *info)
             }
             dstpixel = (dstB << 16) | (dstG << 8) | dstR;
             *dst = dstpixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_ABGR8888_XBGR8888_Modulate(SDL_BlitInfo *info)
@@ -5116,24 +5616,37 @@ static void SDL_Blit_ABGR8888_XBGR8888_Modulate_Scale(SDL_BlitInfo *info)
     const Uint32 modulateB = info->b;
     Uint32 pixel;
     Uint32 R, G, B;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+    Uint64 lasty = ~(Uint64)0;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        if (srcy == lasty) {
+            SDL_memcpy(dst, info->dst - info->dst_pitch, info->dst_w * 4);
+            posy += incy;
+            info->dst += info->dst_pitch;
+            continue;
+        }
+        lasty = srcy;
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             pixel = *src;
             B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel;
             if (flags & SDL_COPY_MODULATE_COLOR) {
@@ -5143,12 +5656,12 @@ static void SDL_Blit_ABGR8888_XBGR8888_Modulate_Scale(SDL_BlitInfo *info)
             }
             pixel = (B << 16) | (G << 8) | R;
             *dst = pixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_ABGR8888_XBGR8888_Modulate_Blend(SDL_BlitInfo *info)
@@ -5231,24 +5744,29 @@ static void SDL_Blit_ABGR8888_XBGR8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             srcpixel = *src;
             srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel; srcA = (Uint8)(srcpixel >> 24);
             dstpixel = *dst;
@@ -5293,46 +5811,59 @@ static void SDL_Blit_ABGR8888_XBGR8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
             }
             dstpixel = (dstB << 16) | (dstG << 8) | dstR;
             *dst = dstpixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_ABGR8888_ARGB8888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
     Uint32 R, G, B, A;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+    Uint64 lasty = ~(Uint64)0;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        if (srcy == lasty) {
+            SDL_memcpy(dst, info->dst - info->dst_pitch, info->dst_w * 4);
+            posy += incy;
+            info->dst += info->dst_pitch;
+            continue;
+        }
+        lasty = srcy;
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             pixel = *src;
             B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel; A = (Uint8)(pixel >> 24);
             pixel = (A << 24) | (R << 16) | (G << 8) | B;
             *dst = pixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_ABGR8888_ARGB8888_Blend(SDL_BlitInfo *info)
@@ -5400,24 +5931,29 @@ static void SDL_Blit_ABGR8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB, dstA;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             srcpixel = *src;
             srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel; srcA = (Uint8)(srcpixel >> 24);
             dstpixel = *dst;
@@ -5455,12 +5991,12 @@ static void SDL_Blit_ABGR8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
             }
             dstpixel = (dstA << 24) | (dstR << 16) | (dstG << 8) | dstB;
             *dst = dstpixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_ABGR8888_ARGB8888_Modulate(SDL_BlitInfo *info)
@@ -5507,24 +6043,37 @@ static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
     const Uint32 modulateA = info->a;
     Uint32 pixel;
     Uint32 R, G, B, A;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+    Uint64 lasty = ~(Uint64)0;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        if (srcy == lasty) {
+            SDL_memcpy(dst, info->dst - info->dst_pitch, info->dst_w * 4);
+            posy += incy;
+            info->dst += info->dst_pitch;
+            continue;
+        }
+        lasty = srcy;
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             pixel = *src;
             B = (Uint8)(pixel >> 16); G = (Uint8)(pixel >> 8); R = (Uint8)pixel; A = (Uint8)(pixel >> 24);
             if (flags & SDL_COPY_MODULATE_COLOR) {
@@ -5537,12 +6086,12 @@ static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
             }
             pixel = (A << 24) | (R << 16) | (G << 8) | B;
             *dst = pixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
@@ -5626,24 +6175,29 @@ static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB, dstA;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             srcpixel = *src;
             srcB = (Uint8)(srcpixel >> 16); srcG = (Uint8)(srcpixel >> 8); srcR = (Uint8)srcpixel; srcA = (Uint8)(srcpixel >> 24);
             dstpixel = *dst;
@@ -5689,46 +6243,59 @@ static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
             }
             dstpixel = (dstA << 24) | (dstR << 16) | (dstG << 8) | dstB;
             *dst = dstpixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_BGRA8888_XRGB8888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
     Uint32 R, G, B;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+    Uint64 lasty = ~(Uint64)0;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        if (srcy == lasty) {
+            SDL_memcpy(dst, info->dst - info->dst_pitch, info->dst_w * 4);
+            posy += incy;
+            info->dst += info->dst_pitch;
+            continue;
+        }
+        lasty = srcy;
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             pixel = *src;
             B = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); R = (Uint8)(pixel >> 8);
             pixel = (R << 16) | (G << 8) | B;
             *dst = pixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_BGRA8888_XRGB8888_Blend(SDL_BlitInfo *info)
@@ -5795,24 +6362,29 @@ static void SDL_Blit_BGRA8888_XRGB8888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             srcpixel = *src;
             srcB = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcR = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
             dstpixel = *dst;
@@ -5849,12 +6421,12 @@ static void SDL_Blit_BGRA8888_XRGB8888_Blend_Scale(SDL_BlitInfo *info)
             }
             dstpixel = (dstR << 16) | (dstG << 8) | dstB;
             *dst = dstpixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_BGRA8888_XRGB8888_Modulate(SDL_BlitInfo *info)
@@ -5896,24 +6468,37 @@ static void SDL_Blit_BGRA8888_XRGB8888_Modulate_Scale(SDL_BlitInfo *info)
     const Uint32 modulateB = info->b;
     Uint32 pixel;
     Uint32 R, G, B;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+    Uint64 lasty = ~(Uint64)0;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        if (srcy == lasty) {
+            SDL_memcpy(dst, info->dst - info->dst_pitch, info->dst_w * 4);
+            posy += incy;
+            info->dst += info->dst_pitch;
+            continue;
+        }
+        lasty = srcy;
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             pixel = *src;
             B = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); R = (Uint8)(pixel >> 8);
             if (flags & SDL_COPY_MODULATE_COLOR) {
@@ -5923,12 +6508,12 @@ static void SDL_Blit_BGRA8888_XRGB8888_Modulate_Scale(SDL_BlitInfo *info)
             }
             pixel = (R << 16) | (G << 8) | B;
             *dst = pixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_BGRA8888_XRGB8888_Modulate_Blend(SDL_BlitInfo *info)
@@ -6011,24 +6596,29 @@ static void SDL_Blit_BGRA8888_XRGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             srcpixel = *src;
             srcB = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcR = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
             dstpixel = *dst;
@@ -6073,44 +6663,57 @@ static void SDL_Blit_BGRA8888_XRGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
             }
             dstpixel = (dstR << 16) | (dstG << 8) | dstB;
             *dst = dstpixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_BGRA8888_XBGR8888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+    Uint64 lasty = ~(Uint64)0;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        if (srcy == lasty) {
+            SDL_memcpy(dst, info->dst - info->dst_pitch, info->dst_w * 4);
+            posy += incy;
+            info->dst += info->dst_pitch;
+            continue;
+        }
+        lasty = srcy;
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             pixel = *src;
             pixel >>= 8;
             *dst = pixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_BGRA8888_XBGR8888_Blend(SDL_BlitInfo *info)
@@ -6177,24 +6780,29 @@ static void SDL_Blit_BGRA8888_XBGR8888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             srcpixel = *src;
             srcB = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcR = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
             dstpixel = *dst;
@@ -6231,12 +6839,12 @@ static void SDL_Blit_BGRA8888_XBGR8888_Blend_Scale(SDL_BlitInfo *info)
             }
             dstpixel = (dstB << 16) | (dstG << 8) | dstR;
             *dst = dstpixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_BGRA8888_XBGR8888_Modulate(SDL_BlitInfo *info)
@@ -6278,24 +6886,37 @@ static void SDL_Blit_BGRA8888_XBGR8888_Modulate_Scale(SDL_BlitInfo *info)
     const Uint32 modulateB = info->b;
     Uint32 pixel;
     Uint32 R, G, B;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+    Uint64 lasty = ~(Uint64)0;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        if (srcy == lasty) {
+            SDL_memcpy(dst, info->dst - info->dst_pitch, info->dst_w * 4);
+            posy += incy;
+            info->dst += info->dst_pitch;
+            continue;
+        }
+        lasty = srcy;
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             pixel = *src;
             B = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); R = (Uint8)(pixel >> 8);
             if (flags & SDL_COPY_MODULATE_COLOR) {
@@ -6305,12 +6926,12 @@ static void SDL_Blit_BGRA8888_XBGR8888_Modulate_Scale(SDL_BlitInfo *info)
             }
             pixel = (B << 16) | (G << 8) | R;
             *dst = pixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_BGRA8888_XBGR8888_Modulate_Blend(SDL_BlitInfo *info)
@@ -6393,24 +7014,29 @@ static void SDL_Blit_BGRA8888_XBGR8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             srcpixel = *src;
             srcB = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcR = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
             dstpixel = *dst;
@@ -6455,46 +7081,59 @@ static void SDL_Blit_BGRA8888_XBGR8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
             }
             dstpixel = (dstB << 16) | (dstG << 8) | dstR;
             *dst = dstpixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_BGRA8888_ARGB8888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
     Uint32 R, G, B, A;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+    Uint64 lasty = ~(Uint64)0;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        if (srcy == lasty) {
+            SDL_memcpy(dst, info->dst - info->dst_pitch, info->dst_w * 4);
+            posy += incy;
+            info->dst += info->dst_pitch;
+            continue;
+        }
+        lasty = srcy;
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             pixel = *src;
             B = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); R = (Uint8)(pixel >> 8); A = (Uint8)pixel;
             pixel = (A << 24) | (R << 16) | (G << 8) | B;
             *dst = pixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_BGRA8888_ARGB8888_Blend(SDL_BlitInfo *info)
@@ -6562,24 +7201,29 @@ static void SDL_Blit_BGRA8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB, dstA;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             srcpixel = *src;
             srcB = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcR = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
             dstpixel = *dst;
@@ -6617,12 +7261,12 @@ static void SDL_Blit_BGRA8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
             }
             dstpixel = (dstA << 24) | (dstR << 16) | (dstG << 8) | dstB;
             *dst = dstpixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_BGRA8888_ARGB8888_Modulate(SDL_BlitInfo *info)
@@ -6669,24 +7313,37 @@ static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
     const Uint32 modulateA = info->a;
     Uint32 pixel;
     Uint32 R, G, B, A;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+    Uint64 lasty = ~(Uint64)0;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        if (srcy == lasty) {
+            SDL_memcpy(dst, info->dst - info->dst_pitch, info->dst_w * 4);
+            posy += incy;
+            info->dst += info->dst_pitch;
+            continue;
+        }
+        lasty = srcy;
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             pixel = *src;
             B = (Uint8)(pixel >> 24); G = (Uint8)(pixel >> 16); R = (Uint8)(pixel >> 8); A = (Uint8)pixel;
             if (flags & SDL_COPY_MODULATE_COLOR) {
@@ -6699,12 +7356,12 @@ static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
             }
             pixel = (A << 24) | (R << 16) | (G << 8) | B;
             *dst = pixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 }
 
 static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
@@ -6788,24 +7445,29 @@ static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint32 srcR, srcG, srcB, srcA;
     Uint32 dstpixel;
     Uint32 dstR, dstG, dstB, dstA;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        Uint32 *src = 0;
+        Uint32 *row;
+        Uint32 *src;
         Uint32 *dst = (Uint32 *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (Uint32 *)(info->src + (srcy * info->src_pitch) + (srcx * 4));
+        row = (Uint32 *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
             srcpixel = *src;
             srcB = (Uint8)(srcpixel >> 24); srcG = (Uint8)(srcpixel >> 16); srcR = (Uint8)(srcpixel >> 8); srcA = (Uint8)srcpixel;
             dstpixel = *dst;
@@ -6851,15 +7513,2712 @@ static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
             }
             dstpixel = (dstA << 24) | (dstR << 16) | (dstG << 8) | dstB;
             *dst = dstpixel;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
+}
+
+/* The SIMD blitters widen each channel to 16 bits and do exactly the same
+   math as the scalar blitters below, so they give identical results. */
+
+#if defined(SDL_NEON_INTRINSICS) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+#define SDL_BLIT_AUTO_NEON
+#endif
+
+#if defined(SDL_SSE4_1_INTRINSICS) || defined(SDL_AVX2_INTRINSICS) || defined(SDL_BLIT_AUTO_NEON)
+
+typedef struct
+{
+    Uint8 src[16];      /* source pixels to B, G, R, A */
+    Uint8 dst[16];      /* destination pixels to B, G, R, A */
+    Uint8 out[16];      /* B, G, R, A to destination pixels */
+    Uint8 copy[16];     /* source pixels straight to destination pixels */
+    Uint32 src_alpha;   /* ORed into B, G, R, A when the source has no alpha */
+    Uint32 copy_alpha;  /* ORed into copied pixels when the source has no alpha */
+    SDL_bool src_has_alpha;
+} SDL_BlitAutoShuffle;
+
+/* Gets the byte offsets of B, G, R and A within a little endian pixel */
+static SDL_bool SDL_GetBlitAutoOffsets(Uint32 format, int *offsets)
+{
+    switch (format) {
+    case SDL_PIXELFORMAT_XBGR8888:
+    case SDL_PIXELFORMAT_ABGR8888:
+        offsets[0] = 2; offsets[1] = 1; offsets[2] = 0; offsets[3] = 3;
+        break;
+    case SDL_PIXELFORMAT_RGBA8888:
+        offsets[0] = 1; offsets[1] = 2; offsets[2] = 3; offsets[3] = 0;
+        break;
+    case SDL_PIXELFORMAT_BGRA8888:
+        offsets[0] = 3; offsets[1] = 2; offsets[2] = 1; offsets[3] = 0;
+        break;
+    default:
+        offsets[0] = 0; offsets[1] = 1; offsets[2] = 2; offsets[3] = 3;
+        break;
+    }
+    return SDL_ISPIXELFORMAT_ALPHA(format);
+}
+
+static void SDL_GetBlitAutoShuffle(const SDL_BlitInfo *info, Uint8 src_alpha, SDL_BlitAutoShuffle *shuffle)
+{
+    const Uint32 src_format = info->src_fmt->format;
+    const Uint32 dst_format = info->dst_fmt->format;
+    int src_offsets[4], dst_offsets[4], dst_channels[4];
+    const SDL_bool src_has_alpha = SDL_GetBlitAutoOffsets(src_format, src_offsets);
+    const SDL_bool dst_has_alpha = SDL_GetBlitAutoOffsets(dst_format, dst_offsets);
+    int i;
+
+    for (i = 0; i < 4; ++i) {
+        dst_channels[dst_offsets[i]] = i;
+    }
+
+    shuffle->src_alpha = src_has_alpha ? 0 : ((Uint32)src_alpha << 24);
+    shuffle->copy_alpha = 0;
+    shuffle->src_has_alpha = src_has_alpha;
+    for (i = 0; i < 4; ++i) {
+        const int channel = dst_channels[i];
+
+        shuffle->src[i] = (i == 3 && !src_has_alpha) ? 0x80 : (Uint8)src_offsets[i];
+        shuffle->dst[i] = (i == 3 && !dst_has_alpha) ? 0x80 : (Uint8)dst_offsets[i];
+        shuffle->out[i] = (channel == 3 && !dst_has_alpha) ? 0x80 : (Uint8)channel;
+        if (src_format == dst_format) {
+            shuffle->copy[i] = (Uint8)i;
+        } else if (channel == 3 && (!src_has_alpha || !dst_has_alpha)) {
+            shuffle->copy[i] = 0x80;
+            if (dst_has_alpha) {
+                shuffle->copy_alpha |= (0xFFu << (i * 8));
+            }
+        } else {
+            shuffle->copy[i] = (Uint8)src_offsets[channel];
+        }
+    }
+
+    /* Repeat the shuffles for each pixel in a 128-bit vector */
+    for (i = 4; i < 16; ++i) {
+        const Uint8 pixel = (Uint8)(i & ~3);
+        shuffle->src[i] = (shuffle->src[i & 3] == 0x80) ? 0x80 : (shuffle->src[i & 3] + pixel);
+        shuffle->dst[i] = (shuffle->dst[i & 3] == 0x80) ? 0x80 : (shuffle->dst[i & 3] + pixel);
+        shuffle->out[i] = (shuffle->out[i & 3] == 0x80) ? 0x80 : (shuffle->out[i & 3] + pixel);
+        shuffle->copy[i] = (shuffle->copy[i & 3] == 0x80) ? 0x80 : (shuffle->copy[i & 3] + pixel);
+    }
+}
+
+#endif /* SDL_SSE4_1_INTRINSICS || SDL_AVX2_INTRINSICS || SDL_BLIT_AUTO_NEON */
+
+#ifdef SDL_AVX2_INTRINSICS
+
+SDL_FORCE_INLINE __m256i SDL_TARGETING("avx2") BlitAuto_Load_AVX2(const Uint32 *pixels)
+{
+    return _mm256_loadu_si256((const __m256i *)pixels);
+}
+
+SDL_FORCE_INLINE void SDL_TARGETING("avx2") BlitAuto_Store_AVX2(Uint32 *pixels, __m256i v)
+{
+    _mm256_storeu_si256((__m256i *)pixels, v);
+}
+
+SDL_FORCE_INLINE __m256i SDL_TARGETING("avx2") BlitAuto_Gather_AVX2(const Uint32 *row, const Uint32 *columns)
+{
+    return _mm256_i32gather_epi32((const int *)row, _mm256_loadu_si256((const __m256i *)columns), 4);
+}
+
+SDL_FORCE_INLINE __m256i SDL_TARGETING("avx2") BlitAuto_LoadShuffle_AVX2(const Uint8 *shuffle)
+{
+    /* The byte shuffle works within each 128-bit lane */
+    return _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)shuffle));
+}
+
+SDL_FORCE_INLINE __m256i SDL_TARGETING("avx2") BlitAuto_Shuffle_AVX2(__m256i v, __m256i shuffle)
+{
+    return _mm256_shuffle_epi8(v, shuffle);
+}
+
+SDL_FORCE_INLINE __m256i SDL_TARGETING("avx2") BlitAuto_Splat_AVX2(Uint32 pixel)
+{
+    return _mm256_set1_epi32((int)pixel);
+}
+
+SDL_FORCE_INLINE __m256i SDL_TARGETING("avx2") BlitAuto_Or_AVX2(__m256i a, __m256i b)
+{
+    return _mm256_or_si256(a, b);
+}
+
+SDL_FORCE_INLINE __m256i SDL_TARGETING("avx2") BlitAuto_Lo_AVX2(__m256i v)
+{
+    return _mm256_unpacklo_epi8(v, _mm256_setzero_si256());
+}
+
+SDL_FORCE_INLINE __m256i SDL_TARGETING("avx2") BlitAuto_Hi_AVX2(__m256i v)
+{
+    return _mm256_unpackhi_epi8(v, _mm256_setzero_si256());
+}
+
+SDL_FORCE_INLINE __m256i SDL_TARGETING("avx2") BlitAuto_Pack_AVX2(__m256i lo, __m256i hi)
+{
+    /* This undoes the per-lane interleaving of BlitAuto_Lo_AVX2() and BlitAuto_Hi_AVX2() */
+    return _mm256_packus_epi16(lo, hi);
+}
+
+SDL_FORCE_INLINE __m256i SDL_TARGETING("avx2") BlitAuto_Channels_AVX2(Uint8 b, Uint8 g, Uint8 r, Uint8 a)
+{
+    return _mm256_set_epi16(a, r, g, b, a, r, g, b, a, r, g, b, a, r, g, b);
+}
+
+SDL_FORCE_INLINE __m256i SDL_TARGETING("avx2") BlitAuto_Div255_AVX2(__m256i x)
+{
+    /* (x * 0x8081) >> 23 is x / 255 for every 16-bit x */
+    return _mm256_srli_epi16(_mm256_mulhi_epu16(x, _mm256_set1_epi16((short)0x8081)), 7);
+}
+
+SDL_FORCE_INLINE __m256i SDL_TARGETING("avx2") BlitAuto_Mul255_AVX2(__m256i a, __m256i b)
+{
+    return BlitAuto_Div255_AVX2(_mm256_mullo_epi16(a, b));
+}
+
+SDL_FORCE_INLINE __m256i SDL_TARGETING("avx2") BlitAuto_MulClamp255_AVX2(__m256i a, __m256i b)
+{
+    /* a * b can overflow 16 bits here, anything from 255 * 255 up is 255 */
+    const __m256i overflow = _mm256_cmpeq_epi16(_mm256_mulhi_epu16(a, b), _mm256_setzero_si256());
+    const __m256i x = _mm256_or_si256(_mm256_mullo_epi16(a, b), _mm256_xor_si256(overflow, _mm256_set1_epi16(-1)));
+    return BlitAuto_Div255_AVX2(_mm256_min_epu16(x, _mm256_set1_epi16((short)(255 * 255))));
+}
+
+SDL_FORCE_INLINE __m256i SDL_TARGETING("avx2") BlitAuto_Alpha_AVX2(__m256i v)
+{
+    return _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(v, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+}
+
+SDL_FORCE_INLINE __m256i SDL_TARGETING("avx2") BlitAuto_KeepAlpha_AVX2(__m256i v, __m256i alpha)
+{
+    return _mm256_blend_epi16(v, alpha, 0x88);
+}
+
+SDL_FORCE_INLINE __m256i SDL_TARGETING("avx2") BlitAuto_Add_AVX2(__m256i a, __m256i b)
+{
+    return _mm256_add_epi16(a, b);
+}
+
+SDL_FORCE_INLINE __m256i SDL_TARGETING("avx2") BlitAuto_Sub_AVX2(__m256i a, __m256i b)
+{
+    return _mm256_sub_epi16(a, b);
+}
+
+SDL_FORCE_INLINE __m256i SDL_TARGETING("avx2") BlitAuto_Min_AVX2(__m256i a, __m256i b)
+{
+    return _mm256_min_epu16(a, b);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_8888_8888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_BlitAutoShuffle shuffle;
+    Uint32 srcbuf[8], dstbuf[8];
+    __m256i copy_mask, copy_alpha;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+    Uint64 lasty = ~(Uint64)0;
+
+    SDL_zeroa(srcbuf);
+    SDL_zeroa(dstbuf);
+    SDL_GetBlitAutoShuffle(info, 0xFF, &shuffle);
+    copy_mask = BlitAuto_LoadShuffle_AVX2(shuffle.copy);
+    copy_alpha = BlitAuto_Splat_AVX2(shuffle.copy_alpha);
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src;
+        const Uint32 *column = columns;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        srcy = posy >> 16;
+        if (srcy == lasty) {
+            SDL_memcpy(dst, info->dst - info->dst_pitch, info->dst_w * sizeof(Uint32));
+            posy += incy;
+            info->dst += info->dst_pitch;
+            continue;
+        }
+        lasty = srcy;
+        src = (const Uint32 *)(info->src + (srcy * info->src_pitch));
+
+        while (n > 0) {
+            const int count = SDL_min(n, 8);
+            Uint32 *d = (count < 8) ? dstbuf : dst;
+            __m256i gathered;
+            __m256i pixels;
+
+            if (count < 8) {
+                int i;
+                for (i = 0; i < count; ++i) {
+                    srcbuf[i] = src[column[i]];
+                }
+                gathered = BlitAuto_Load_AVX2(srcbuf);
+            } else {
+                gathered = BlitAuto_Gather_AVX2(src, column);
+            }
+            pixels = BlitAuto_Or_AVX2(BlitAuto_Shuffle_AVX2(gathered, copy_mask), copy_alpha);
+            BlitAuto_Store_AVX2(d, pixels);
+            if (count < 8) {
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            column += count;
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+    SDL_small_free(columns, isstack);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_8888_8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    SDL_BlitAutoShuffle shuffle;
+    Uint32 srcbuf[8], dstbuf[8];
+    __m256i src_mask, src_alpha, out_mask;
+    __m256i dst_mask;
+    const __m256i opaque = BlitAuto_Channels_AVX2(0xFF, 0xFF, 0xFF, 0xFF);
+
+    SDL_zeroa(srcbuf);
+    SDL_zeroa(dstbuf);
+    SDL_GetBlitAutoShuffle(info, 0xFF, &shuffle);
+    src_mask = BlitAuto_LoadShuffle_AVX2(shuffle.src);
+    src_alpha = BlitAuto_Splat_AVX2(shuffle.src_alpha);
+    out_mask = BlitAuto_LoadShuffle_AVX2(shuffle.out);
+    dst_mask = BlitAuto_LoadShuffle_AVX2(shuffle.dst);
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, 8);
+            const Uint32 *s = src;
+            Uint32 *d = (count < 8) ? dstbuf : dst;
+            __m256i pixels;
+
+            if (count < 8) {
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                s = srcbuf;
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+            }
+            {
+                const __m256i srcpixels = BlitAuto_Or_AVX2(BlitAuto_Shuffle_AVX2(BlitAuto_Load_AVX2(s), src_mask), src_alpha);
+                __m256i srclo = BlitAuto_Lo_AVX2(srcpixels);
+                __m256i srchi = BlitAuto_Hi_AVX2(srcpixels);
+                const __m256i dstpixels = BlitAuto_Shuffle_AVX2(BlitAuto_Load_AVX2(d), dst_mask);
+                __m256i dstlo = BlitAuto_Lo_AVX2(dstpixels);
+                __m256i dsthi = BlitAuto_Hi_AVX2(dstpixels);
+
+                if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                    /* This goes away if we ever use premultiplied alpha */
+                    srclo = BlitAuto_KeepAlpha_AVX2(BlitAuto_Mul255_AVX2(srclo, BlitAuto_Alpha_AVX2(srclo)), srclo);
+                    srchi = BlitAuto_KeepAlpha_AVX2(BlitAuto_Mul255_AVX2(srchi, BlitAuto_Alpha_AVX2(srchi)), srchi);
+                }
+                switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+                case SDL_COPY_BLEND:
+                    dstlo = BlitAuto_Add_AVX2(srclo, BlitAuto_Mul255_AVX2(BlitAuto_Sub_AVX2(opaque, BlitAuto_Alpha_AVX2(srclo)), dstlo));
+                    break;
+                case SDL_COPY_ADD:
+                    dstlo = BlitAuto_KeepAlpha_AVX2(BlitAuto_Min_AVX2(BlitAuto_Add_AVX2(srclo, dstlo), opaque), dstlo);
+                    break;
+                case SDL_COPY_MOD:
+                    dstlo = BlitAuto_KeepAlpha_AVX2(BlitAuto_Mul255_AVX2(srclo, dstlo), dstlo);
+                    break;
+                case SDL_COPY_MUL:
+                    dstlo = BlitAuto_KeepAlpha_AVX2(BlitAuto_MulClamp255_AVX2(dstlo, BlitAuto_Add_AVX2(srclo, BlitAuto_Sub_AVX2(opaque, BlitAuto_Alpha_AVX2(srclo)))), dstlo);
+                    break;
+                }
+                switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+                case SDL_COPY_BLEND:
+                    dsthi = BlitAuto_Add_AVX2(srchi, BlitAuto_Mul255_AVX2(BlitAuto_Sub_AVX2(opaque, BlitAuto_Alpha_AVX2(srchi)), dsthi));
+                    break;
+                case SDL_COPY_ADD:
+                    dsthi = BlitAuto_KeepAlpha_AVX2(BlitAuto_Min_AVX2(BlitAuto_Add_AVX2(srchi, dsthi), opaque), dsthi);
+                    break;
+                case SDL_COPY_MOD:
+                    dsthi = BlitAuto_KeepAlpha_AVX2(BlitAuto_Mul255_AVX2(srchi, dsthi), dsthi);
+                    break;
+                case SDL_COPY_MUL:
+                    dsthi = BlitAuto_KeepAlpha_AVX2(BlitAuto_MulClamp255_AVX2(dsthi, BlitAuto_Add_AVX2(srchi, BlitAuto_Sub_AVX2(opaque, BlitAuto_Alpha_AVX2(srchi)))), dsthi);
+                    break;
+                }
+                pixels = BlitAuto_Shuffle_AVX2(BlitAuto_Pack_AVX2(dstlo, dsthi), out_mask);
+            }
+            BlitAuto_Store_AVX2(d, pixels);
+            if (count < 8) {
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_8888_8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    SDL_BlitAutoShuffle shuffle;
+    Uint32 srcbuf[8], dstbuf[8];
+    __m256i src_mask, src_alpha, out_mask;
+    __m256i dst_mask;
+    const __m256i opaque = BlitAuto_Channels_AVX2(0xFF, 0xFF, 0xFF, 0xFF);
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+
+    SDL_zeroa(srcbuf);
+    SDL_zeroa(dstbuf);
+    SDL_GetBlitAutoShuffle(info, 0xFF, &shuffle);
+    src_mask = BlitAuto_LoadShuffle_AVX2(shuffle.src);
+    src_alpha = BlitAuto_Splat_AVX2(shuffle.src_alpha);
+    out_mask = BlitAuto_LoadShuffle_AVX2(shuffle.out);
+    dst_mask = BlitAuto_LoadShuffle_AVX2(shuffle.dst);
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src;
+        const Uint32 *column = columns;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        srcy = posy >> 16;
+        src = (const Uint32 *)(info->src + (srcy * info->src_pitch));
+
+        while (n > 0) {
+            const int count = SDL_min(n, 8);
+            Uint32 *d = (count < 8) ? dstbuf : dst;
+            __m256i gathered;
+            __m256i pixels;
+
+            if (count < 8) {
+                int i;
+                for (i = 0; i < count; ++i) {
+                    srcbuf[i] = src[column[i]];
+                }
+                gathered = BlitAuto_Load_AVX2(srcbuf);
+            } else {
+                gathered = BlitAuto_Gather_AVX2(src, column);
+            }
+            if (count < 8) {
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+            }
+            {
+                const __m256i srcpixels = BlitAuto_Or_AVX2(BlitAuto_Shuffle_AVX2(gathered, src_mask), src_alpha);
+                __m256i srclo = BlitAuto_Lo_AVX2(srcpixels);
+                __m256i srchi = BlitAuto_Hi_AVX2(srcpixels);
+                const __m256i dstpixels = BlitAuto_Shuffle_AVX2(BlitAuto_Load_AVX2(d), dst_mask);
+                __m256i dstlo = BlitAuto_Lo_AVX2(dstpixels);
+                __m256i dsthi = BlitAuto_Hi_AVX2(dstpixels);
+
+                if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                    /* This goes away if we ever use premultiplied alpha */
+                    srclo = BlitAuto_KeepAlpha_AVX2(BlitAuto_Mul255_AVX2(srclo, BlitAuto_Alpha_AVX2(srclo)), srclo);
+                    srchi = BlitAuto_KeepAlpha_AVX2(BlitAuto_Mul255_AVX2(srchi, BlitAuto_Alpha_AVX2(srchi)), srchi);
+                }
+                switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+                case SDL_COPY_BLEND:
+                    dstlo = BlitAuto_Add_AVX2(srclo, BlitAuto_Mul255_AVX2(BlitAuto_Sub_AVX2(opaque, BlitAuto_Alpha_AVX2(srclo)), dstlo));
+                    break;
+                case SDL_COPY_ADD:
+                    dstlo = BlitAuto_KeepAlpha_AVX2(BlitAuto_Min_AVX2(BlitAuto_Add_AVX2(srclo, dstlo), opaque), dstlo);
+                    break;
+                case SDL_COPY_MOD:
+                    dstlo = BlitAuto_KeepAlpha_AVX2(BlitAuto_Mul255_AVX2(srclo, dstlo), dstlo);
+                    break;
+                case SDL_COPY_MUL:
+                    dstlo = BlitAuto_KeepAlpha_AVX2(BlitAuto_MulClamp255_AVX2(dstlo, BlitAuto_Add_AVX2(srclo, BlitAuto_Sub_AVX2(opaque, BlitAuto_Alpha_AVX2(srclo)))), dstlo);
+                    break;
+                }
+                switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+                case SDL_COPY_BLEND:
+                    dsthi = BlitAuto_Add_AVX2(srchi, BlitAuto_Mul255_AVX2(BlitAuto_Sub_AVX2(opaque, BlitAuto_Alpha_AVX2(srchi)), dsthi));
+                    break;
+                case SDL_COPY_ADD:
+                    dsthi = BlitAuto_KeepAlpha_AVX2(BlitAuto_Min_AVX2(BlitAuto_Add_AVX2(srchi, dsthi), opaque), dsthi);
+                    break;
+                case SDL_COPY_MOD:
+                    dsthi = BlitAuto_KeepAlpha_AVX2(BlitAuto_Mul255_AVX2(srchi, dsthi), dsthi);
+                    break;
+                case SDL_COPY_MUL:
+                    dsthi = BlitAuto_KeepAlpha_AVX2(BlitAuto_MulClamp255_AVX2(dsthi, BlitAuto_Add_AVX2(srchi, BlitAuto_Sub_AVX2(opaque, BlitAuto_Alpha_AVX2(srchi)))), dsthi);
+                    break;
+                }
+                pixels = BlitAuto_Shuffle_AVX2(BlitAuto_Pack_AVX2(dstlo, dsthi), out_mask);
+            }
+            BlitAuto_Store_AVX2(d, pixels);
+            if (count < 8) {
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            column += count;
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+    SDL_small_free(columns, isstack);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_8888_8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    SDL_BlitAutoShuffle shuffle;
+    Uint32 srcbuf[8], dstbuf[8];
+    __m256i src_mask, src_alpha, out_mask;
+    __m256i modulate;
+
+    SDL_zeroa(srcbuf);
+    SDL_zeroa(dstbuf);
+    SDL_GetBlitAutoShuffle(info, (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF, &shuffle);
+    modulate = BlitAuto_Channels_AVX2((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF,
+                                      (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF,
+                                      (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF,
+                                      ((flags & SDL_COPY_MODULATE_ALPHA) && shuffle.src_has_alpha) ? info->a : 0xFF);
+    src_mask = BlitAuto_LoadShuffle_AVX2(shuffle.src);
+    src_alpha = BlitAuto_Splat_AVX2(shuffle.src_alpha);
+    out_mask = BlitAuto_LoadShuffle_AVX2(shuffle.out);
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, 8);
+            const Uint32 *s = src;
+            Uint32 *d = (count < 8) ? dstbuf : dst;
+            __m256i pixels;
+
+            if (count < 8) {
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                s = srcbuf;
+            }
+            {
+                const __m256i srcpixels = BlitAuto_Or_AVX2(BlitAuto_Shuffle_AVX2(BlitAuto_Load_AVX2(s), src_mask), src_alpha);
+                __m256i srclo = BlitAuto_Lo_AVX2(srcpixels);
+                __m256i srchi = BlitAuto_Hi_AVX2(srcpixels);
+
+                srclo = BlitAuto_Mul255_AVX2(srclo, modulate);
+                srchi = BlitAuto_Mul255_AVX2(srchi, modulate);
+                pixels = BlitAuto_Shuffle_AVX2(BlitAuto_Pack_AVX2(srclo, srchi), out_mask);
+            }
+            BlitAuto_Store_AVX2(d, pixels);
+            if (count < 8) {
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_8888_8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    SDL_BlitAutoShuffle shuffle;
+    Uint32 srcbuf[8], dstbuf[8];
+    __m256i src_mask, src_alpha, out_mask;
+    __m256i modulate;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+    Uint64 lasty = ~(Uint64)0;
+
+    SDL_zeroa(srcbuf);
+    SDL_zeroa(dstbuf);
+    SDL_GetBlitAutoShuffle(info, (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF, &shuffle);
+    modulate = BlitAuto_Channels_AVX2((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF,
+                                      (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF,
+                                      (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF,
+                                      ((flags & SDL_COPY_MODULATE_ALPHA) && shuffle.src_has_alpha) ? info->a : 0xFF);
+    src_mask = BlitAuto_LoadShuffle_AVX2(shuffle.src);
+    src_alpha = BlitAuto_Splat_AVX2(shuffle.src_alpha);
+    out_mask = BlitAuto_LoadShuffle_AVX2(shuffle.out);
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src;
+        const Uint32 *column = columns;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        srcy = posy >> 16;
+        if (srcy == lasty) {
+            SDL_memcpy(dst, info->dst - info->dst_pitch, info->dst_w * sizeof(Uint32));
+            posy += incy;
+            info->dst += info->dst_pitch;
+            continue;
+        }
+        lasty = srcy;
+        src = (const Uint32 *)(info->src + (srcy * info->src_pitch));
+
+        while (n > 0) {
+            const int count = SDL_min(n, 8);
+            Uint32 *d = (count < 8) ? dstbuf : dst;
+            __m256i gathered;
+            __m256i pixels;
+
+            if (count < 8) {
+                int i;
+                for (i = 0; i < count; ++i) {
+                    srcbuf[i] = src[column[i]];
+                }
+                gathered = BlitAuto_Load_AVX2(srcbuf);
+            } else {
+                gathered = BlitAuto_Gather_AVX2(src, column);
+            }
+            {
+                const __m256i srcpixels = BlitAuto_Or_AVX2(BlitAuto_Shuffle_AVX2(gathered, src_mask), src_alpha);
+                __m256i srclo = BlitAuto_Lo_AVX2(srcpixels);
+                __m256i srchi = BlitAuto_Hi_AVX2(srcpixels);
+
+                srclo = BlitAuto_Mul255_AVX2(srclo, modulate);
+                srchi = BlitAuto_Mul255_AVX2(srchi, modulate);
+                pixels = BlitAuto_Shuffle_AVX2(BlitAuto_Pack_AVX2(srclo, srchi), out_mask);
+            }
+            BlitAuto_Store_AVX2(d, pixels);
+            if (count < 8) {
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            column += count;
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+    SDL_small_free(columns, isstack);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_8888_8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    SDL_BlitAutoShuffle shuffle;
+    Uint32 srcbuf[8], dstbuf[8];
+    __m256i src_mask, src_alpha, out_mask;
+    __m256i dst_mask;
+    const __m256i opaque = BlitAuto_Channels_AVX2(0xFF, 0xFF, 0xFF, 0xFF);
+    __m256i modulate;
+
+    SDL_zeroa(srcbuf);
+    SDL_zeroa(dstbuf);
+    SDL_GetBlitAutoShuffle(info, (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF, &shuffle);
+    modulate = BlitAuto_Channels_AVX2((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF,
+                                      (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF,
+                                      (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF,
+                                      ((flags & SDL_COPY_MODULATE_ALPHA) && shuffle.src_has_alpha) ? info->a : 0xFF);
+    src_mask = BlitAuto_LoadShuffle_AVX2(shuffle.src);
+    src_alpha = BlitAuto_Splat_AVX2(shuffle.src_alpha);
+    out_mask = BlitAuto_LoadShuffle_AVX2(shuffle.out);
+    dst_mask = BlitAuto_LoadShuffle_AVX2(shuffle.dst);
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, 8);
+            const Uint32 *s = src;
+            Uint32 *d = (count < 8) ? dstbuf : dst;
+            __m256i pixels;
+
+            if (count < 8) {
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                s = srcbuf;
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+            }
+            {
+                const __m256i srcpixels = BlitAuto_Or_AVX2(BlitAuto_Shuffle_AVX2(BlitAuto_Load_AVX2(s), src_mask), src_alpha);
+                __m256i srclo = BlitAuto_Lo_AVX2(srcpixels);
+                __m256i srchi = BlitAuto_Hi_AVX2(srcpixels);
+                const __m256i dstpixels = BlitAuto_Shuffle_AVX2(BlitAuto_Load_AVX2(d), dst_mask);
+                __m256i dstlo = BlitAuto_Lo_AVX2(dstpixels);
+                __m256i dsthi = BlitAuto_Hi_AVX2(dstpixels);
+
+                srclo = BlitAuto_Mul255_AVX2(srclo, modulate);
+                srchi = BlitAuto_Mul255_AVX2(srchi, modulate);
+
+                if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                    /* This goes away if we ever use premultiplied alpha */
+                    srclo = BlitAuto_KeepAlpha_AVX2(BlitAuto_Mul255_AVX2(srclo, BlitAuto_Alpha_AVX2(srclo)), srclo);
+                    srchi = BlitAuto_KeepAlpha_AVX2(BlitAuto_Mul255_AVX2(srchi, BlitAuto_Alpha_AVX2(srchi)), srchi);
+                }
+                switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+                case SDL_COPY_BLEND:
+                    dstlo = BlitAuto_Add_AVX2(srclo, BlitAuto_Mul255_AVX2(BlitAuto_Sub_AVX2(opaque, BlitAuto_Alpha_AVX2(srclo)), dstlo));
+                    break;
+                case SDL_COPY_ADD:
+                    dstlo = BlitAuto_KeepAlpha_AVX2(BlitAuto_Min_AVX2(BlitAuto_Add_AVX2(srclo, dstlo), opaque), dstlo);
+                    break;
+                case SDL_COPY_MOD:
+                    dstlo = BlitAuto_KeepAlpha_AVX2(BlitAuto_Mul255_AVX2(srclo, dstlo), dstlo);
+                    break;
+                case SDL_COPY_MUL:
+                    dstlo = BlitAuto_KeepAlpha_AVX2(BlitAuto_MulClamp255_AVX2(dstlo, BlitAuto_Add_AVX2(srclo, BlitAuto_Sub_AVX2(opaque, BlitAuto_Alpha_AVX2(srclo)))), dstlo);
+                    break;
+                }
+                switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+                case SDL_COPY_BLEND:
+                    dsthi = BlitAuto_Add_AVX2(srchi, BlitAuto_Mul255_AVX2(BlitAuto_Sub_AVX2(opaque, BlitAuto_Alpha_AVX2(srchi)), dsthi));
+                    break;
+                case SDL_COPY_ADD:
+                    dsthi = BlitAuto_KeepAlpha_AVX2(BlitAuto_Min_AVX2(BlitAuto_Add_AVX2(srchi, dsthi), opaque), dsthi);
+                    break;
+                case SDL_COPY_MOD:
+                    dsthi = BlitAuto_KeepAlpha_AVX2(BlitAuto_Mul255_AVX2(srchi, dsthi), dsthi);
+                    break;
+                case SDL_COPY_MUL:
+                    dsthi = BlitAuto_KeepAlpha_AVX2(BlitAuto_MulClamp255_AVX2(dsthi, BlitAuto_Add_AVX2(srchi, BlitAuto_Sub_AVX2(opaque, BlitAuto_Alpha_AVX2(srchi)))), dsthi);
+                    break;
+                }
+                pixels = BlitAuto_Shuffle_AVX2(BlitAuto_Pack_AVX2(dstlo, dsthi), out_mask);
+            }
+            BlitAuto_Store_AVX2(d, pixels);
+            if (count < 8) {
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_8888_8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    SDL_BlitAutoShuffle shuffle;
+    Uint32 srcbuf[8], dstbuf[8];
+    __m256i src_mask, src_alpha, out_mask;
+    __m256i dst_mask;
+    const __m256i opaque = BlitAuto_Channels_AVX2(0xFF, 0xFF, 0xFF, 0xFF);
+    __m256i modulate;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+
+    SDL_zeroa(srcbuf);
+    SDL_zeroa(dstbuf);
+    SDL_GetBlitAutoShuffle(info, (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF, &shuffle);
+    modulate = BlitAuto_Channels_AVX2((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF,
+                                      (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF,
+                                      (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF,
+                                      ((flags & SDL_COPY_MODULATE_ALPHA) && shuffle.src_has_alpha) ? info->a : 0xFF);
+    src_mask = BlitAuto_LoadShuffle_AVX2(shuffle.src);
+    src_alpha = BlitAuto_Splat_AVX2(shuffle.src_alpha);
+    out_mask = BlitAuto_LoadShuffle_AVX2(shuffle.out);
+    dst_mask = BlitAuto_LoadShuffle_AVX2(shuffle.dst);
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src;
+        const Uint32 *column = columns;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        srcy = posy >> 16;
+        src = (const Uint32 *)(info->src + (srcy * info->src_pitch));
+
+        while (n > 0) {
+            const int count = SDL_min(n, 8);
+            Uint32 *d = (count < 8) ? dstbuf : dst;
+            __m256i gathered;
+            __m256i pixels;
+
+            if (count < 8) {
+                int i;
+                for (i = 0; i < count; ++i) {
+                    srcbuf[i] = src[column[i]];
+                }
+                gathered = BlitAuto_Load_AVX2(srcbuf);
+            } else {
+                gathered = BlitAuto_Gather_AVX2(src, column);
+            }
+            if (count < 8) {
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+            }
+            {
+                const __m256i srcpixels = BlitAuto_Or_AVX2(BlitAuto_Shuffle_AVX2(gathered, src_mask), src_alpha);
+                __m256i srclo = BlitAuto_Lo_AVX2(srcpixels);
+                __m256i srchi = BlitAuto_Hi_AVX2(srcpixels);
+                const __m256i dstpixels = BlitAuto_Shuffle_AVX2(BlitAuto_Load_AVX2(d), dst_mask);
+                __m256i dstlo = BlitAuto_Lo_AVX2(dstpixels);
+                __m256i dsthi = BlitAuto_Hi_AVX2(dstpixels);
+
+                srclo = BlitAuto_Mul255_AVX2(srclo, modulate);
+                srchi = BlitAuto_Mul255_AVX2(srchi, modulate);
+
+                if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                    /* This goes away if we ever use premultiplied alpha */
+                    srclo = BlitAuto_KeepAlpha_AVX2(BlitAuto_Mul255_AVX2(srclo, BlitAuto_Alpha_AVX2(srclo)), srclo);
+                    srchi = BlitAuto_KeepAlpha_AVX2(BlitAuto_Mul255_AVX2(srchi, BlitAuto_Alpha_AVX2(srchi)), srchi);
+                }
+                switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+                case SDL_COPY_BLEND:
+                    dstlo = BlitAuto_Add_AVX2(srclo, BlitAuto_Mul255_AVX2(BlitAuto_Sub_AVX2(opaque, BlitAuto_Alpha_AVX2(srclo)), dstlo));
+                    break;
+                case SDL_COPY_ADD:
+                    dstlo = BlitAuto_KeepAlpha_AVX2(BlitAuto_Min_AVX2(BlitAuto_Add_AVX2(srclo, dstlo), opaque), dstlo);
+                    break;
+                case SDL_COPY_MOD:
+                    dstlo = BlitAuto_KeepAlpha_AVX2(BlitAuto_Mul255_AVX2(srclo, dstlo), dstlo);
+                    break;
+                case SDL_COPY_MUL:
+                    dstlo = BlitAuto_KeepAlpha_AVX2(BlitAuto_MulClamp255_AVX2(dstlo, BlitAuto_Add_AVX2(srclo, BlitAuto_Sub_AVX2(opaque, BlitAuto_Alpha_AVX2(srclo)))), dstlo);
+                    break;
+                }
+                switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+                case SDL_COPY_BLEND:
+                    dsthi = BlitAuto_Add_AVX2(srchi, BlitAuto_Mul255_AVX2(BlitAuto_Sub_AVX2(opaque, BlitAuto_Alpha_AVX2(srchi)), dsthi));
+                    break;
+                case SDL_COPY_ADD:
+                    dsthi = BlitAuto_KeepAlpha_AVX2(BlitAuto_Min_AVX2(BlitAuto_Add_AVX2(srchi, dsthi), opaque), dsthi);
+                    break;
+                case SDL_COPY_MOD:
+                    dsthi = BlitAuto_KeepAlpha_AVX2(BlitAuto_Mul255_AVX2(srchi, dsthi), dsthi);
+                    break;
+                case SDL_COPY_MUL:
+                    dsthi = BlitAuto_KeepAlpha_AVX2(BlitAuto_MulClamp255_AVX2(dsthi, BlitAuto_Add_AVX2(srchi, BlitAuto_Sub_AVX2(opaque, BlitAuto_Alpha_AVX2(srchi)))), dsthi);
+                    break;
+                }
+                pixels = BlitAuto_Shuffle_AVX2(BlitAuto_Pack_AVX2(dstlo, dsthi), out_mask);
+            }
+            BlitAuto_Store_AVX2(d, pixels);
+            if (count < 8) {
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            column += count;
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+    SDL_small_free(columns, isstack);
 }
 
+#endif /* SDL_AVX2_INTRINSICS */
+
+#ifdef SDL_SSE4_1_INTRINSICS
+
+SDL_FORCE_INLINE __m128i SDL_TARGETING("sse4.1") BlitAuto_Load_SSE41(const Uint32 *pixels)
+{
+    return _mm_loadu_si128((const __m128i *)pixels);
+}
+
+SDL_FORCE_INLINE void SDL_TARGETING("sse4.1") BlitAuto_Store_SSE41(Uint32 *pixels, __m128i v)
+{
+    _mm_storeu_si128((__m128i *)pixels, v);
+}
+
+SDL_FORCE_INLINE __m128i SDL_TARGETING("sse4.1") BlitAuto_Gather_SSE41(const Uint32 *row, const Uint32 *columns)
+{
+    return _mm_setr_epi32((int)row[columns[0]], (int)row[columns[1]], (int)row[columns[2]], (int)row[columns[3]]);
+}
+
+SDL_FORCE_INLINE __m128i SDL_TARGETING("sse4.1") BlitAuto_LoadShuffle_SSE41(const Uint8 *shuffle)
+{
+    return _mm_loadu_si128((const __m128i *)shuffle);
+}
+
+SDL_FORCE_INLINE __m128i SDL_TARGETING("sse4.1") BlitAuto_Shuffle_SSE41(__m128i v, __m128i shuffle)
+{
+    return _mm_shuffle_epi8(v, shuffle);
+}
+
+SDL_FORCE_INLINE __m128i SDL_TARGETING("sse4.1") BlitAuto_Splat_SSE41(Uint32 pixel)
+{
+    return _mm_set1_epi32((int)pixel);
+}
+
+SDL_FORCE_INLINE __m128i SDL_TARGETING("sse4.1") BlitAuto_Or_SSE41(__m128i a, __m128i b)
+{
+    return _mm_or_si128(a, b);
+}
+
+SDL_FORCE_INLINE __m128i SDL_TARGETING("sse4.1") BlitAuto_Lo_SSE41(__m128i v)
+{
+    return _mm_unpacklo_epi8(v, _mm_setzero_si128());
+}
+
+SDL_FORCE_INLINE __m128i SDL_TARGETING("sse4.1") BlitAuto_Hi_SSE41(__m128i v)
+{
+    return _mm_unpackhi_epi8(v, _mm_setzero_si128());
+}
+
+SDL_FORCE_INLINE __m128i SDL_TARGETING("sse4.1") BlitAuto_Pack_SSE41(__m128i lo, __m128i hi)
+{
+    return _mm_packus_epi16(lo, hi);
+}
+
+SDL_FORCE_INLINE __m128i SDL_TARGETING("sse4.1") BlitAuto_Channels_SSE41(Uint8 b, Uint8 g, Uint8 r, Uint8 a)
+{
+    return _mm_set_epi16(a, r, g, b, a, r, g, b);
+}
+
+SDL_FORCE_INLINE __m128i SDL_TARGETING("sse4.1") BlitAuto_Div255_SSE41(__m128i x)
+{
+    /* (x * 0x8081) >> 23 is x / 255 for every 16-bit x */
+    return _mm_srli_epi16(_mm_mulhi_epu16(x, _mm_set1_epi16((short)0x8081)), 7);
+}
+
+SDL_FORCE_INLINE __m128i SDL_TARGETING("sse4.1") BlitAuto_Mul255_SSE41(__m128i a, __m128i b)
+{
+    return BlitAuto_Div255_SSE41(_mm_mullo_epi16(a, b));
+}
+
+SDL_FORCE_INLINE __m128i SDL_TARGETING("sse4.1") BlitAuto_MulClamp255_SSE41(__m128i a, __m128i b)
+{
+    /* a * b can overflow 16 bits here, anything from 255 * 255 up is 255 */
+    const __m128i overflow = _mm_cmpeq_epi16(_mm_mulhi_epu16(a, b), _mm_setzero_si128());
+    const __m128i x = _mm_or_si128(_mm_mullo_epi16(a, b), _mm_xor_si128(overflow, _mm_set1_epi16(-1)));
+    return BlitAuto_Div255_SSE41(_mm_min_epu16(x, _mm_set1_epi16((short)(255 * 255))));
+}
+
+SDL_FORCE_INLINE __m128i SDL_TARGETING("sse4.1") BlitAuto_Alpha_SSE41(__m128i v)
+{
+    return _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+}
+
+SDL_FORCE_INLINE __m128i SDL_TARGETING("sse4.1") BlitAuto_KeepAlpha_SSE41(__m128i v, __m128i alpha)
+{
+    return _mm_blend_epi16(v, alpha, 0x88);
+}
+
+SDL_FORCE_INLINE __m128i SDL_TARGETING("sse4.1") BlitAuto_Add_SSE41(__m128i a, __m128i b)
+{
+    return _mm_add_epi16(a, b);
+}
+
+SDL_FORCE_INLINE __m128i SDL_TARGETING("sse4.1") BlitAuto_Sub_SSE41(__m128i a, __m128i b)
+{
+    return _mm_sub_epi16(a, b);
+}
+
+SDL_FORCE_INLINE __m128i SDL_TARGETING("sse4.1") BlitAuto_Min_SSE41(__m128i a, __m128i b)
+{
+    return _mm_min_epu16(a, b);
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_8888_8888_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_BlitAutoShuffle shuffle;
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i copy_mask, copy_alpha;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+    Uint64 lasty = ~(Uint64)0;
+
+    SDL_zeroa(srcbuf);
+    SDL_zeroa(dstbuf);
+    SDL_GetBlitAutoShuffle(info, 0xFF, &shuffle);
+    copy_mask = BlitAuto_LoadShuffle_SSE41(shuffle.copy);
+    copy_alpha = BlitAuto_Splat_SSE41(shuffle.copy_alpha);
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src;
+        const Uint32 *column = columns;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        srcy = posy >> 16;
+        if (srcy == lasty) {
+            SDL_memcpy(dst, info->dst - info->dst_pitch, info->dst_w * sizeof(Uint32));
+            posy += incy;
+            info->dst += info->dst_pitch;
+            continue;
+        }
+        lasty = srcy;
+        src = (const Uint32 *)(info->src + (srcy * info->src_pitch));
+
+        while (n > 0) {
+            const int count = SDL_min(n, 4);
+            Uint32 *d = (count < 4) ? dstbuf : dst;
+            __m128i gathered;
+            __m128i pixels;
+
+            if (count < 4) {
+                int i;
+                for (i = 0; i < count; ++i) {
+                    srcbuf[i] = src[column[i]];
+                }
+                gathered = BlitAuto_Load_SSE41(srcbuf);
+            } else {
+                gathered = BlitAuto_Gather_SSE41(src, column);
+            }
+            pixels = BlitAuto_Or_SSE41(BlitAuto_Shuffle_SSE41(gathered, copy_mask), copy_alpha);
+            BlitAuto_Store_SSE41(d, pixels);
+            if (count < 4) {
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            column += count;
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+    SDL_small_free(columns, isstack);
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_8888_8888_Blend_SSE41(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    SDL_BlitAutoShuffle shuffle;
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i src_mask, src_alpha, out_mask;
+    __m128i dst_mask;
+    const __m128i opaque = BlitAuto_Channels_SSE41(0xFF, 0xFF, 0xFF, 0xFF);
+
+    SDL_zeroa(srcbuf);
+    SDL_zeroa(dstbuf);
+    SDL_GetBlitAutoShuffle(info, 0xFF, &shuffle);
+    src_mask = BlitAuto_LoadShuffle_SSE41(shuffle.src);
+    src_alpha = BlitAuto_Splat_SSE41(shuffle.src_alpha);
+    out_mask = BlitAuto_LoadShuffle_SSE41(shuffle.out);
+    dst_mask = BlitAuto_LoadShuffle_SSE41(shuffle.dst);
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, 4);
+            const Uint32 *s = src;
+            Uint32 *d = (count < 4) ? dstbuf : dst;
+            __m128i pixels;
+
+            if (count < 4) {
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                s = srcbuf;
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+            }
+            {
+                const __m128i srcpixels = BlitAuto_Or_SSE41(BlitAuto_Shuffle_SSE41(BlitAuto_Load_SSE41(s), src_mask), src_alpha);
+                __m128i srclo = BlitAuto_Lo_SSE41(srcpixels);
+                __m128i srchi = BlitAuto_Hi_SSE41(srcpixels);
+                const __m128i dstpixels = BlitAuto_Shuffle_SSE41(BlitAuto_Load_SSE41(d), dst_mask);
+                __m128i dstlo = BlitAuto_Lo_SSE41(dstpixels);
+                __m128i dsthi = BlitAuto_Hi_SSE41(dstpixels);
+
+                if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                    /* This goes away if we ever use premultiplied alpha */
+                    srclo = BlitAuto_KeepAlpha_SSE41(BlitAuto_Mul255_SSE41(srclo, BlitAuto_Alpha_SSE41(srclo)), srclo);
+                    srchi = BlitAuto_KeepAlpha_SSE41(BlitAuto_Mul255_SSE41(srchi, BlitAuto_Alpha_SSE41(srchi)), srchi);
+                }
+                switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+                case SDL_COPY_BLEND:
+                    dstlo = BlitAuto_Add_SSE41(srclo, BlitAuto_Mul255_SSE41(BlitAuto_Sub_SSE41(opaque, BlitAuto_Alpha_SSE41(srclo)), dstlo));
+                    break;
+                case SDL_COPY_ADD:
+                    dstlo = BlitAuto_KeepAlpha_SSE41(BlitAuto_Min_SSE41(BlitAuto_Add_SSE41(srclo, dstlo), opaque), dstlo);
+                    break;
+                case SDL_COPY_MOD:
+                    dstlo = BlitAuto_KeepAlpha_SSE41(BlitAuto_Mul255_SSE41(srclo, dstlo), dstlo);
+                    break;
+                case SDL_COPY_MUL:
+                    dstlo = BlitAuto_KeepAlpha_SSE41(BlitAuto_MulClamp255_SSE41(dstlo, BlitAuto_Add_SSE41(srclo, BlitAuto_Sub_SSE41(opaque, BlitAuto_Alpha_SSE41(srclo)))), dstlo);
+                    break;
+                }
+                switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+                case SDL_COPY_BLEND:
+                    dsthi = BlitAuto_Add_SSE41(srchi, BlitAuto_Mul255_SSE41(BlitAuto_Sub_SSE41(opaque, BlitAuto_Alpha_SSE41(srchi)), dsthi));
+                    break;
+                case SDL_COPY_ADD:
+                    dsthi = BlitAuto_KeepAlpha_SSE41(BlitAuto_Min_SSE41(BlitAuto_Add_SSE41(srchi, dsthi), opaque), dsthi);
+                    break;
+                case SDL_COPY_MOD:
+                    dsthi = BlitAuto_KeepAlpha_SSE41(BlitAuto_Mul255_SSE41(srchi, dsthi), dsthi);
+                    break;
+                case SDL_COPY_MUL:
+                    dsthi = BlitAuto_KeepAlpha_SSE41(BlitAuto_MulClamp255_SSE41(dsthi, BlitAuto_Add_SSE41(srchi, BlitAuto_Sub_SSE41(opaque, BlitAuto_Alpha_SSE41(srchi)))), dsthi);
+                    break;
+                }
+                pixels = BlitAuto_Shuffle_SSE41(BlitAuto_Pack_SSE41(dstlo, dsthi), out_mask);
+            }
+            BlitAuto_Store_SSE41(d, pixels);
+            if (count < 4) {
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_8888_8888_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    SDL_BlitAutoShuffle shuffle;
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i src_mask, src_alpha, out_mask;
+    __m128i dst_mask;
+    const __m128i opaque = BlitAuto_Channels_SSE41(0xFF, 0xFF, 0xFF, 0xFF);
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+
+    SDL_zeroa(srcbuf);
+    SDL_zeroa(dstbuf);
+    SDL_GetBlitAutoShuffle(info, 0xFF, &shuffle);
+    src_mask = BlitAuto_LoadShuffle_SSE41(shuffle.src);
+    src_alpha = BlitAuto_Splat_SSE41(shuffle.src_alpha);
+    out_mask = BlitAuto_LoadShuffle_SSE41(shuffle.out);
+    dst_mask = BlitAuto_LoadShuffle_SSE41(shuffle.dst);
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src;
+        const Uint32 *column = columns;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        srcy = posy >> 16;
+        src = (const Uint32 *)(info->src + (srcy * info->src_pitch));
+
+        while (n > 0) {
+            const int count = SDL_min(n, 4);
+            Uint32 *d = (count < 4) ? dstbuf : dst;
+            __m128i gathered;
+            __m128i pixels;
+
+            if (count < 4) {
+                int i;
+                for (i = 0; i < count; ++i) {
+                    srcbuf[i] = src[column[i]];
+                }
+                gathered = BlitAuto_Load_SSE41(srcbuf);
+            } else {
+                gathered = BlitAuto_Gather_SSE41(src, column);
+            }
+            if (count < 4) {
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+            }
+            {
+                const __m128i srcpixels = BlitAuto_Or_SSE41(BlitAuto_Shuffle_SSE41(gathered, src_mask), src_alpha);
+                __m128i srclo = BlitAuto_Lo_SSE41(srcpixels);
+                __m128i srchi = BlitAuto_Hi_SSE41(srcpixels);
+                const __m128i dstpixels = BlitAuto_Shuffle_SSE41(BlitAuto_Load_SSE41(d), dst_mask);
+                __m128i dstlo = BlitAuto_Lo_SSE41(dstpixels);
+                __m128i dsthi = BlitAuto_Hi_SSE41(dstpixels);
+
+                if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                    /* This goes away if we ever use premultiplied alpha */
+                    srclo = BlitAuto_KeepAlpha_SSE41(BlitAuto_Mul255_SSE41(srclo, BlitAuto_Alpha_SSE41(srclo)), srclo);
+                    srchi = BlitAuto_KeepAlpha_SSE41(BlitAuto_Mul255_SSE41(srchi, BlitAuto_Alpha_SSE41(srchi)), srchi);
+                }
+                switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+                case SDL_COPY_BLEND:
+                    dstlo = BlitAuto_Add_SSE41(srclo, BlitAuto_Mul255_SSE41(BlitAuto_Sub_SSE41(opaque, BlitAuto_Alpha_SSE41(srclo)), dstlo));
+                    break;
+                case SDL_COPY_ADD:
+                    dstlo = BlitAuto_KeepAlpha_SSE41(BlitAuto_Min_SSE41(BlitAuto_Add_SSE41(srclo, dstlo), opaque), dstlo);
+                    break;
+                case SDL_COPY_MOD:
+                    dstlo = BlitAuto_KeepAlpha_SSE41(BlitAuto_Mul255_SSE41(srclo, dstlo), dstlo);
+                    break;
+                case SDL_COPY_MUL:
+                    dstlo = BlitAuto_KeepAlpha_SSE41(BlitAuto_MulClamp255_SSE41(dstlo, BlitAuto_Add_SSE41(srclo, BlitAuto_Sub_SSE41(opaque, BlitAuto_Alpha_SSE41(srclo)))), dstlo);
+                    break;
+                }
+                switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+                case SDL_COPY_BLEND:
+                    dsthi = BlitAuto_Add_SSE41(srchi, BlitAuto_Mul255_SSE41(BlitAuto_Sub_SSE41(opaque, BlitAuto_Alpha_SSE41(srchi)), dsthi));
+                    break;
+                case SDL_COPY_ADD:
+                    dsthi = BlitAuto_KeepAlpha_SSE41(BlitAuto_Min_SSE41(BlitAuto_Add_SSE41(srchi, dsthi), opaque), dsthi);
+                    break;
+                case SDL_COPY_MOD:
+                    dsthi = BlitAuto_KeepAlpha_SSE41(BlitAuto_Mul255_SSE41(srchi, dsthi), dsthi);
+                    break;
+                case SDL_COPY_MUL:
+                    dsthi = BlitAuto_KeepAlpha_SSE41(BlitAuto_MulClamp255_SSE41(dsthi, BlitAuto_Add_SSE41(srchi, BlitAuto_Sub_SSE41(opaque, BlitAuto_Alpha_SSE41(srchi)))), dsthi);
+                    break;
+                }
+                pixels = BlitAuto_Shuffle_SSE41(BlitAuto_Pack_SSE41(dstlo, dsthi), out_mask);
+            }
+            BlitAuto_Store_SSE41(d, pixels);
+            if (count < 4) {
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            column += count;
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+    SDL_small_free(columns, isstack);
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_8888_8888_Modulate_SSE41(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    SDL_BlitAutoShuffle shuffle;
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i src_mask, src_alpha, out_mask;
+    __m128i modulate;
+
+    SDL_zeroa(srcbuf);
+    SDL_zeroa(dstbuf);
+    SDL_GetBlitAutoShuffle(info, (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF, &shuffle);
+    modulate = BlitAuto_Channels_SSE41((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF,
+                                      (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF,
+                                      (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF,
+                                      ((flags & SDL_COPY_MODULATE_ALPHA) && shuffle.src_has_alpha) ? info->a : 0xFF);
+    src_mask = BlitAuto_LoadShuffle_SSE41(shuffle.src);
+    src_alpha = BlitAuto_Splat_SSE41(shuffle.src_alpha);
+    out_mask = BlitAuto_LoadShuffle_SSE41(shuffle.out);
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, 4);
+            const Uint32 *s = src;
+            Uint32 *d = (count < 4) ? dstbuf : dst;
+            __m128i pixels;
+
+            if (count < 4) {
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                s = srcbuf;
+            }
+            {
+                const __m128i srcpixels = BlitAuto_Or_SSE41(BlitAuto_Shuffle_SSE41(BlitAuto_Load_SSE41(s), src_mask), src_alpha);
+                __m128i srclo = BlitAuto_Lo_SSE41(srcpixels);
+                __m128i srchi = BlitAuto_Hi_SSE41(srcpixels);
+
+                srclo = BlitAuto_Mul255_SSE41(srclo, modulate);
+                srchi = BlitAuto_Mul255_SSE41(srchi, modulate);
+                pixels = BlitAuto_Shuffle_SSE41(BlitAuto_Pack_SSE41(srclo, srchi), out_mask);
+            }
+            BlitAuto_Store_SSE41(d, pixels);
+            if (count < 4) {
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_8888_8888_Modulate_Scale_SSE41(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    SDL_BlitAutoShuffle shuffle;
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i src_mask, src_alpha, out_mask;
+    __m128i modulate;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+    Uint64 lasty = ~(Uint64)0;
+
+    SDL_zeroa(srcbuf);
+    SDL_zeroa(dstbuf);
+    SDL_GetBlitAutoShuffle(info, (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF, &shuffle);
+    modulate = BlitAuto_Channels_SSE41((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF,
+                                      (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF,
+                                      (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF,
+                                      ((flags & SDL_COPY_MODULATE_ALPHA) && shuffle.src_has_alpha) ? info->a : 0xFF);
+    src_mask = BlitAuto_LoadShuffle_SSE41(shuffle.src);
+    src_alpha = BlitAuto_Splat_SSE41(shuffle.src_alpha);
+    out_mask = BlitAuto_LoadShuffle_SSE41(shuffle.out);
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src;
+        const Uint32 *column = columns;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        srcy = posy >> 16;
+        if (srcy == lasty) {
+            SDL_memcpy(dst, info->dst - info->dst_pitch, info->dst_w * sizeof(Uint32));
+            posy += incy;
+            info->dst += info->dst_pitch;
+            continue;
+        }
+        lasty = srcy;
+        src = (const Uint32 *)(info->src + (srcy * info->src_pitch));
+
+        while (n > 0) {
+            const int count = SDL_min(n, 4);
+            Uint32 *d = (count < 4) ? dstbuf : dst;
+            __m128i gathered;
+            __m128i pixels;
+
+            if (count < 4) {
+                int i;
+                for (i = 0; i < count; ++i) {
+                    srcbuf[i] = src[column[i]];
+                }
+                gathered = BlitAuto_Load_SSE41(srcbuf);
+            } else {
+                gathered = BlitAuto_Gather_SSE41(src, column);
+            }
+            {
+                const __m128i srcpixels = BlitAuto_Or_SSE41(BlitAuto_Shuffle_SSE41(gathered, src_mask), src_alpha);
+                __m128i srclo = BlitAuto_Lo_SSE41(srcpixels);
+                __m128i srchi = BlitAuto_Hi_SSE41(srcpixels);
+
+                srclo = BlitAuto_Mul255_SSE41(srclo, modulate);
+                srchi = BlitAuto_Mul255_SSE41(srchi, modulate);
+                pixels = BlitAuto_Shuffle_SSE41(BlitAuto_Pack_SSE41(srclo, srchi), out_mask);
+            }
+            BlitAuto_Store_SSE41(d, pixels);
+            if (count < 4) {
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            column += count;
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+    SDL_small_free(columns, isstack);
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_8888_8888_Modulate_Blend_SSE41(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    SDL_BlitAutoShuffle shuffle;
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i src_mask, src_alpha, out_mask;
+    __m128i dst_mask;
+    const __m128i opaque = BlitAuto_Channels_SSE41(0xFF, 0xFF, 0xFF, 0xFF);
+    __m128i modulate;
+
+    SDL_zeroa(srcbuf);
+    SDL_zeroa(dstbuf);
+    SDL_GetBlitAutoShuffle(info, (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF, &shuffle);
+    modulate = BlitAuto_Channels_SSE41((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF,
+                                      (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF,
+                                      (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF,
+                                      ((flags & SDL_COPY_MODULATE_ALPHA) && shuffle.src_has_alpha) ? info->a : 0xFF);
+    src_mask = BlitAuto_LoadShuffle_SSE41(shuffle.src);
+    src_alpha = BlitAuto_Splat_SSE41(shuffle.src_alpha);
+    out_mask = BlitAuto_LoadShuffle_SSE41(shuffle.out);
+    dst_mask = BlitAuto_LoadShuffle_SSE41(shuffle.dst);
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, 4);
+            const Uint32 *s = src;
+            Uint32 *d = (count < 4) ? dstbuf : dst;
+            __m128i pixels;
+
+            if (count < 4) {
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                s = srcbuf;
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+            }
+            {
+                const __m128i srcpixels = BlitAuto_Or_SSE41(BlitAuto_Shuffle_SSE41(BlitAuto_Load_SSE41(s), src_mask), src_alpha);
+                __m128i srclo = BlitAuto_Lo_SSE41(srcpixels);
+                __m128i srchi = BlitAuto_Hi_SSE41(srcpixels);
+                const __m128i dstpixels = BlitAuto_Shuffle_SSE41(BlitAuto_Load_SSE41(d), dst_mask);
+                __m128i dstlo = BlitAuto_Lo_SSE41(dstpixels);
+                __m128i dsthi = BlitAuto_Hi_SSE41(dstpixels);
+
+                srclo = BlitAuto_Mul255_SSE41(srclo, modulate);
+                srchi = BlitAuto_Mul255_SSE41(srchi, modulate);
+
+                if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                    /* This goes away if we ever use premultiplied alpha */
+                    srclo = BlitAuto_KeepAlpha_SSE41(BlitAuto_Mul255_SSE41(srclo, BlitAuto_Alpha_SSE41(srclo)), srclo);
+                    srchi = BlitAuto_KeepAlpha_SSE41(BlitAuto_Mul255_SSE41(srchi, BlitAuto_Alpha_SSE41(srchi)), srchi);
+                }
+                switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+                case SDL_COPY_BLEND:
+                    dstlo = BlitAuto_Add_SSE41(srclo, BlitAuto_Mul255_SSE41(BlitAuto_Sub_SSE41(opaque, BlitAuto_Alpha_SSE41(srclo)), dstlo));
+                    break;
+                case SDL_COPY_ADD:
+                    dstlo = BlitAuto_KeepAlpha_SSE41(BlitAuto_Min_SSE41(BlitAuto_Add_SSE41(srclo, dstlo), opaque), dstlo);
+                    break;
+                case SDL_COPY_MOD:
+                    dstlo = BlitAuto_KeepAlpha_SSE41(BlitAuto_Mul255_SSE41(srclo, dstlo), dstlo);
+                    break;
+                case SDL_COPY_MUL:
+                    dstlo = BlitAuto_KeepAlpha_SSE41(BlitAuto_MulClamp255_SSE41(dstlo, BlitAuto_Add_SSE41(srclo, BlitAuto_Sub_SSE41(opaque, BlitAuto_Alpha_SSE41(srclo)))), dstlo);
+                    break;
+                }
+                switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+                case SDL_COPY_BLEND:
+                    dsthi = BlitAuto_Add_SSE41(srchi, BlitAuto_Mul255_SSE41(BlitAuto_Sub_SSE41(opaque, BlitAuto_Alpha_SSE41(srchi)), dsthi));
+                    break;
+                case SDL_COPY_ADD:
+                    dsthi = BlitAuto_KeepAlpha_SSE41(BlitAuto_Min_SSE41(BlitAuto_Add_SSE41(srchi, dsthi), opaque), dsthi);
+                    break;
+                case SDL_COPY_MOD:
+                    dsthi = BlitAuto_KeepAlpha_SSE41(BlitAuto_Mul255_SSE41(srchi, dsthi), dsthi);
+                    break;
+                case SDL_COPY_MUL:
+                    dsthi = BlitAuto_KeepAlpha_SSE41(BlitAuto_MulClamp255_SSE41(dsthi, BlitAuto_Add_SSE41(srchi, BlitAuto_Sub_SSE41(opaque, BlitAuto_Alpha_SSE41(srchi)))), dsthi);
+                    break;
+                }
+                pixels = BlitAuto_Shuffle_SSE41(BlitAuto_Pack_SSE41(dstlo, dsthi), out_mask);
+            }
+            BlitAuto_Store_SSE41(d, pixels);
+            if (count < 4) {
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_8888_8888_Modulate_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    SDL_BlitAutoShuffle shuffle;
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i src_mask, src_alpha, out_mask;
+    __m128i dst_mask;
+    const __m128i opaque = BlitAuto_Channels_SSE41(0xFF, 0xFF, 0xFF, 0xFF);
+    __m128i modulate;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+
+    SDL_zeroa(srcbuf);
+    SDL_zeroa(dstbuf);
+    SDL_GetBlitAutoShuffle(info, (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF, &shuffle);
+    modulate = BlitAuto_Channels_SSE41((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF,
+                                      (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF,
+                                      (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF,
+                                      ((flags & SDL_COPY_MODULATE_ALPHA) && shuffle.src_has_alpha) ? info->a : 0xFF);
+    src_mask = BlitAuto_LoadShuffle_SSE41(shuffle.src);
+    src_alpha = BlitAuto_Splat_SSE41(shuffle.src_alpha);
+    out_mask = BlitAuto_LoadShuffle_SSE41(shuffle.out);
+    dst_mask = BlitAuto_LoadShuffle_SSE41(shuffle.dst);
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src;
+        const Uint32 *column = columns;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        srcy = posy >> 16;
+        src = (const Uint32 *)(info->src + (srcy * info->src_pitch));
+
+        while (n > 0) {
+            const int count = SDL_min(n, 4);
+            Uint32 *d = (count < 4) ? dstbuf : dst;
+            __m128i gathered;
+            __m128i pixels;
+
+            if (count < 4) {
+                int i;
+                for (i = 0; i < count; ++i) {
+                    srcbuf[i] = src[column[i]];
+                }
+                gathered = BlitAuto_Load_SSE41(srcbuf);
+            } else {
+                gathered = BlitAuto_Gather_SSE41(src, column);
+            }
+            if (count < 4) {
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+            }
+            {
+                const __m128i srcpixels = BlitAuto_Or_SSE41(BlitAuto_Shuffle_SSE41(gathered, src_mask), src_alpha);
+                __m128i srclo = BlitAuto_Lo_SSE41(srcpixels);
+                __m128i srchi = BlitAuto_Hi_SSE41(srcpixels);
+                const __m128i dstpixels = BlitAuto_Shuffle_SSE41(BlitAuto_Load_SSE41(d), dst_mask);
+                __m128i dstlo = BlitAuto_Lo_SSE41(dstpixels);
+                __m128i dsthi = BlitAuto_Hi_SSE41(dstpixels);
+
+                srclo = BlitAuto_Mul255_SSE41(srclo, modulate);
+                srchi = BlitAuto_Mul255_SSE41(srchi, modulate);
+
+                if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                    /* This goes away if we ever use premultiplied alpha */
+                    srclo = BlitAuto_KeepAlpha_SSE41(BlitAuto_Mul255_SSE41(srclo, BlitAuto_Alpha_SSE41(srclo)), srclo);
+                    srchi = BlitAuto_KeepAlpha_SSE41(BlitAuto_Mul255_SSE41(srchi, BlitAuto_Alpha_SSE41(srchi)), srchi);
+                }
+                switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+                case SDL_COPY_BLEND:
+                    dstlo = BlitAuto_Add_SSE41(srclo, BlitAuto_Mul255_SSE41(BlitAuto_Sub_SSE41(opaque, BlitAuto_Alpha_SSE41(srclo)), dstlo));
+                    break;
+                case SDL_COPY_ADD:
+                    dstlo = BlitAuto_KeepAlpha_SSE41(BlitAuto_Min_SSE41(BlitAuto_Add_SSE41(srclo, dstlo), opaque), dstlo);
+                    break;
+                case SDL_COPY_MOD:
+                    dstlo = BlitAuto_KeepAlpha_SSE41(BlitAuto_Mul255_SSE41(srclo, dstlo), dstlo);
+                    break;
+                case SDL_COPY_MUL:
+                    dstlo = BlitAuto_KeepAlpha_SSE41(BlitAuto_MulClamp255_SSE41(dstlo, BlitAuto_Add_SSE41(srclo, BlitAuto_Sub_SSE41(opaque, BlitAuto_Alpha_SSE41(srclo)))), dstlo);
+                    break;
+                }
+                switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+                case SDL_COPY_BLEND:
+                    dsthi = BlitAuto_Add_SSE41(srchi, BlitAuto_Mul255_SSE41(BlitAuto_Sub_SSE41(opaque, BlitAuto_Alpha_SSE41(srchi)), dsthi));
+                    break;
+                case SDL_COPY_ADD:
+                    dsthi = BlitAuto_KeepAlpha_SSE41(BlitAuto_Min_SSE41(BlitAuto_Add_SSE41(srchi, dsthi), opaque), dsthi);
+                    break;
+                case SDL_COPY_MOD:
+                    dsthi = BlitAuto_KeepAlpha_SSE41(BlitAuto_Mul255_SSE41(srchi, dsthi), dsthi);
+                    break;
+                case SDL_COPY_MUL:
+                    dsthi = BlitAuto_KeepAlpha_SSE41(BlitAuto_MulClamp255_SSE41(dsthi, BlitAuto_Add_SSE41(srchi, BlitAuto_Sub_SSE41(opaque, BlitAuto_Alpha_SSE41(srchi)))), dsthi);
+                    break;
+                }
+                pixels = BlitAuto_Shuffle_SSE41(BlitAuto_Pack_SSE41(dstlo, dsthi), out_mask);
+            }
+            BlitAuto_Store_SSE41(d, pixels);
+            if (count < 4) {
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            column += count;
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+    SDL_small_free(columns, isstack);
+}
+
+#endif /* SDL_SSE4_1_INTRINSICS */
+
+#ifdef SDL_BLIT_AUTO_NEON
+
+SDL_FORCE_INLINE uint8x16_t BlitAuto_Load_NEON(const Uint32 *pixels)
+{
+    return vld1q_u8((const Uint8 *)pixels);
+}
+
+SDL_FORCE_INLINE void BlitAuto_Store_NEON(Uint32 *pixels, uint8x16_t v)
+{
+    vst1q_u8((Uint8 *)pixels, v);
+}
+
+SDL_FORCE_INLINE uint8x16_t BlitAuto_Gather_NEON(const Uint32 *row, const Uint32 *columns)
+{
+    uint32x4_t v = vdupq_n_u32(row[columns[0]]);
+    v = vsetq_lane_u32(row[columns[1]], v, 1);
+    v = vsetq_lane_u32(row[columns[2]], v, 2);
+    v = vsetq_lane_u32(row[columns[3]], v, 3);
+    return vreinterpretq_u8_u32(v);
+}
+
+SDL_FORCE_INLINE uint8x16_t BlitAuto_LoadShuffle_NEON(const Uint8 *shuffle)
+{
+    return vld1q_u8(shuffle);
+}
+
+SDL_FORCE_INLINE uint8x16_t BlitAuto_Shuffle_NEON(uint8x16_t v, uint8x16_t shuffle)
+{
+    /* Out of range indices, like 0x80, select zero */
+#if defined(__aarch64__) || defined(_M_ARM64)
+    return vqtbl1q_u8(v, shuffle);
+#else
+    uint8x8x2_t table;
+    table.val[0] = vget_low_u8(v);
+    table.val[1] = vget_high_u8(v);
+    return vcombine_u8(vtbl2_u8(table, vget_low_u8(shuffle)), vtbl2_u8(table, vget_high_u8(shuffle)));
+#endif
+}
+
+SDL_FORCE_INLINE uint8x16_t BlitAuto_Splat_NEON(Uint32 pixel)
+{
+    return vreinterpretq_u8_u32(vdupq_n_u32(pixel));
+}
+
+SDL_FORCE_INLINE uint8x16_t BlitAuto_Or_NEON(uint8x16_t a, uint8x16_t b)
+{
+    return vorrq_u8(a, b);
+}
+
+SDL_FORCE_INLINE uint16x8_t BlitAuto_Lo_NEON(uint8x16_t v)
+{
+    return vmovl_u8(vget_low_u8(v));
+}
+
+SDL_FORCE_INLINE uint16x8_t BlitAuto_Hi_NEON(uint8x16_t v)
+{
+    return vmovl_u8(vget_high_u8(v));
+}
+
+SDL_FORCE_INLINE uint8x16_t BlitAuto_Pack_NEON(uint16x8_t lo, uint16x8_t hi)
+{
+    return vcombine_u8(vqmovn_u16(lo), vqmovn_u16(hi));
+}
+
+SDL_FORCE_INLINE uint16x8_t BlitAuto_Channels_NEON(Uint8 b, Uint8 g, Uint8 r, Uint8 a)
+{
+    const Uint16 channels[8] = { b, g, r, a, b, g, r, a };
+    return vld1q_u16(channels);
+}
+
+SDL_FORCE_INLINE uint16x8_t BlitAuto_Div255_NEON(uint16x8_t x)
+{
+    /* (x + 1 + (x >> 8)) >> 8 is x / 255 for x up to 255 * 255 */
+    return vshrq_n_u16(vaddq_u16(vaddq_u16(x, vdupq_n_u16(1)), vshrq_n_u16(x, 8)), 8);
+}
+
+SDL_FORCE_INLINE uint16x8_t BlitAuto_Mul255_NEON(uint16x8_t a, uint16x8_t b)
+{
+    return BlitAuto_Div255_NEON(vmulq_u16(a, b));
+}
+
+SDL_FORCE_INLINE uint16x8_t BlitAuto_MulClamp255_NEON(uint16x8_t a, uint16x8_t b)
+{
+    /* a * b can overflow 16 bits here, anything from 255 * 255 up is 255 */
+    const uint32x4_t limit = vdupq_n_u32(255 * 255);
+    const uint32x4_t lo = vminq_u32(vmull_u16(vget_low_u16(a), vget_low_u16(b)), limit);
+    const uint32x4_t hi = vminq_u32(vmull_u16(vget_high_u16(a), vget_high_u16(b)), limit);
+    return BlitAuto_Div255_NEON(vcombine_u16(vmovn_u32(lo), vmovn_u32(hi)));
+}
+
+SDL_FORCE_INLINE uint16x8_t BlitAuto_Alpha_NEON(uint16x8_t v)
+{
+    static const Uint8 alpha[16] = { 6, 7, 6, 7, 6, 7, 6, 7, 14, 15, 14, 15, 14, 15, 14, 15 };
+    return vreinterpretq_u16_u8(BlitAuto_Shuffle_NEON(vreinterpretq_u8_u16(v), vld1q_u8(alpha)));
+}
+
+SDL_FORCE_INLINE uint16x8_t BlitAuto_KeepAlpha_NEON(uint16x8_t v, uint16x8_t alpha)
+{
+    static const Uint16 mask[8] = { 0, 0, 0, 0xFFFF, 0, 0, 0, 0xFFFF };
+    return vbslq_u16(vld1q_u16(mask), alpha, v);
+}
+
+SDL_FORCE_INLINE uint16x8_t BlitAuto_Add_NEON(uint16x8_t a, uint16x8_t b)
+{
+    return vaddq_u16(a, b);
+}
+
+SDL_FORCE_INLINE uint16x8_t BlitAuto_Sub_NEON(uint16x8_t a, uint16x8_t b)
+{
+    return vsubq_u16(a, b);
+}
+
+SDL_FORCE_INLINE uint16x8_t BlitAuto_Min_NEON(uint16x8_t a, uint16x8_t b)
+{
+    return vminq_u16(a, b);
+}
+
+static void SDL_Blit_8888_8888_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_BlitAutoShuffle shuffle;
+    Uint32 srcbuf[4], dstbuf[4];
+    uint8x16_t copy_mask, copy_alpha;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+    Uint64 lasty = ~(Uint64)0;
+
+    SDL_zeroa(srcbuf);
+    SDL_zeroa(dstbuf);
+    SDL_GetBlitAutoShuffle(info, 0xFF, &shuffle);
+    copy_mask = BlitAuto_LoadShuffle_NEON(shuffle.copy);
+    copy_alpha = BlitAuto_Splat_NEON(shuffle.copy_alpha);
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src;
+        const Uint32 *column = columns;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        srcy = posy >> 16;
+        if (srcy == lasty) {
+            SDL_memcpy(dst, info->dst - info->dst_pitch, info->dst_w * sizeof(Uint32));
+            posy += incy;
+            info->dst += info->dst_pitch;
+            continue;
+        }
+        lasty = srcy;
+        src = (const Uint32 *)(info->src + (srcy * info->src_pitch));
+
+        while (n > 0) {
+            const int count = SDL_min(n, 4);
+            Uint32 *d = (count < 4) ? dstbuf : dst;
+            uint8x16_t gathered;
+            uint8x16_t pixels;
+
+            if (count < 4) {
+                int i;
+                for (i = 0; i < count; ++i) {
+                    srcbuf[i] = src[column[i]];
+                }
+                gathered = BlitAuto_Load_NEON(srcbuf);
+            } else {
+                gathered = BlitAuto_Gather_NEON(src, column);
+            }
+            pixels = BlitAuto_Or_NEON(BlitAuto_Shuffle_NEON(gathered, copy_mask), copy_alpha);
+            BlitAuto_Store_NEON(d, pixels);
+            if (count < 4) {
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            column += count;
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+    SDL_small_free(columns, isstack);
+}
+
+static void SDL_Blit_8888_8888_Blend_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    SDL_BlitAutoShuffle shuffle;
+    Uint32 srcbuf[4], dstbuf[4];
+    uint8x16_t src_mask, src_alpha, out_mask;
+    uint8x16_t dst_mask;
+    const uint16x8_t opaque = BlitAuto_Channels_NEON(0xFF, 0xFF, 0xFF, 0xFF);
+
+    SDL_zeroa(srcbuf);
+    SDL_zeroa(dstbuf);
+    SDL_GetBlitAutoShuffle(info, 0xFF, &shuffle);
+    src_mask = BlitAuto_LoadShuffle_NEON(shuffle.src);
+    src_alpha = BlitAuto_Splat_NEON(shuffle.src_alpha);
+    out_mask = BlitAuto_LoadShuffle_NEON(shuffle.out);
+    dst_mask = BlitAuto_LoadShuffle_NEON(shuffle.dst);
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, 4);
+            const Uint32 *s = src;
+            Uint32 *d = (count < 4) ? dstbuf : dst;
+            uint8x16_t pixels;
+
+            if (count < 4) {
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                s = srcbuf;
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+            }
+            {
+                const uint8x16_t srcpixels = BlitAuto_Or_NEON(BlitAuto_Shuffle_NEON(BlitAuto_Load_NEON(s), src_mask), src_alpha);
+                uint16x8_t srclo = BlitAuto_Lo_NEON(srcpixels);
+                uint16x8_t srchi = BlitAuto_Hi_NEON(srcpixels);
+                const uint8x16_t dstpixels = BlitAuto_Shuffle_NEON(BlitAuto_Load_NEON(d), dst_mask);
+                uint16x8_t dstlo = BlitAuto_Lo_NEON(dstpixels);
+                uint16x8_t dsthi = BlitAuto_Hi_NEON(dstpixels);
+
+                if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                    /* This goes away if we ever use premultiplied alpha */
+                    srclo = BlitAuto_KeepAlpha_NEON(BlitAuto_Mul255_NEON(srclo, BlitAuto_Alpha_NEON(srclo)), srclo);
+                    srchi = BlitAuto_KeepAlpha_NEON(BlitAuto_Mul255_NEON(srchi, BlitAuto_Alpha_NEON(srchi)), srchi);
+                }
+                switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+                case SDL_COPY_BLEND:
+                    dstlo = BlitAuto_Add_NEON(srclo, BlitAuto_Mul255_NEON(BlitAuto_Sub_NEON(opaque, BlitAuto_Alpha_NEON(srclo)), dstlo));
+                    break;
+                case SDL_COPY_ADD:
+                    dstlo = BlitAuto_KeepAlpha_NEON(BlitAuto_Min_NEON(BlitAuto_Add_NEON(srclo, dstlo), opaque), dstlo);
+                    break;
+                case SDL_COPY_MOD:
+                    dstlo = BlitAuto_KeepAlpha_NEON(BlitAuto_Mul255_NEON(srclo, dstlo), dstlo);
+                    break;
+                case SDL_COPY_MUL:
+                    dstlo = BlitAuto_KeepAlpha_NEON(BlitAuto_MulClamp255_NEON(dstlo, BlitAuto_Add_NEON(srclo, BlitAuto_Sub_NEON(opaque, BlitAuto_Alpha_NEON(srclo)))), dstlo);
+                    break;
+                }
+                switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+                case SDL_COPY_BLEND:
+                    dsthi = BlitAuto_Add_NEON(srchi, BlitAuto_Mul255_NEON(BlitAuto_Sub_NEON(opaque, BlitAuto_Alpha_NEON(srchi)), dsthi));
+                    break;
+                case SDL_COPY_ADD:
+                    dsthi = BlitAuto_KeepAlpha_NEON(BlitAuto_Min_NEON(BlitAuto_Add_NEON(srchi, dsthi), opaque), dsthi);
+                    break;
+                case SDL_COPY_MOD:
+                    dsthi = BlitAuto_KeepAlpha_NEON(BlitAuto_Mul255_NEON(srchi, dsthi), dsthi);
+                    break;
+                case SDL_COPY_MUL:
+                    dsthi = BlitAuto_KeepAlpha_NEON(BlitAuto_MulClamp255_NEON(dsthi, BlitAuto_Add_NEON(srchi, BlitAuto_Sub_NEON(opaque, BlitAuto_Alpha_NEON(srchi)))), dsthi);
+                    break;
+                }
+                pixels = BlitAuto_Shuffle_NEON(BlitAuto_Pack_NEON(dstlo, dsthi), out_mask);
+            }
+            BlitAuto_Store_NEON(d, pixels);
+            if (count < 4) {
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_8888_8888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    SDL_BlitAutoShuffle shuffle;
+    Uint32 srcbuf[4], dstbuf[4];
+    uint8x16_t src_mask, src_alpha, out_mask;
+    uint8x16_t dst_mask;
+    const uint16x8_t opaque = BlitAuto_Channels_NEON(0xFF, 0xFF, 0xFF, 0xFF);
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+
+    SDL_zeroa(srcbuf);
+    SDL_zeroa(dstbuf);
+    SDL_GetBlitAutoShuffle(info, 0xFF, &shuffle);
+    src_mask = BlitAuto_LoadShuffle_NEON(shuffle.src);
+    src_alpha = BlitAuto_Splat_NEON(shuffle.src_alpha);
+    out_mask = BlitAuto_LoadShuffle_NEON(shuffle.out);
+    dst_mask = BlitAuto_LoadShuffle_NEON(shuffle.dst);
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src;
+        const Uint32 *column = columns;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        srcy = posy >> 16;
+        src = (const Uint32 *)(info->src + (srcy * info->src_pitch));
+
+        while (n > 0) {
+            const int count = SDL_min(n, 4);
+            Uint32 *d = (count < 4) ? dstbuf : dst;
+            uint8x16_t gathered;
+            uint8x16_t pixels;
+
+            if (count < 4) {
+                int i;
+                for (i = 0; i < count; ++i) {
+                    srcbuf[i] = src[column[i]];
+                }
+                gathered = BlitAuto_Load_NEON(srcbuf);
+            } else {
+                gathered = BlitAuto_Gather_NEON(src, column);
+            }
+            if (count < 4) {
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+            }
+            {
+                const uint8x16_t srcpixels = BlitAuto_Or_NEON(BlitAuto_Shuffle_NEON(gathered, src_mask), src_alpha);
+                uint16x8_t srclo = BlitAuto_Lo_NEON(srcpixels);
+                uint16x8_t srchi = BlitAuto_Hi_NEON(srcpixels);
+                const uint8x16_t dstpixels = BlitAuto_Shuffle_NEON(BlitAuto_Load_NEON(d), dst_mask);
+                uint16x8_t dstlo = BlitAuto_Lo_NEON(dstpixels);
+                uint16x8_t dsthi = BlitAuto_Hi_NEON(dstpixels);
+
+                if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                    /* This goes away if we ever use premultiplied alpha */
+                    srclo = BlitAuto_KeepAlpha_NEON(BlitAuto_Mul255_NEON(srclo, BlitAuto_Alpha_NEON(srclo)), srclo);
+                    srchi = BlitAuto_KeepAlpha_NEON(BlitAuto_Mul255_NEON(srchi, BlitAuto_Alpha_NEON(srchi)), srchi);
+                }
+                switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+                case SDL_COPY_BLEND:
+                    dstlo = BlitAuto_Add_NEON(srclo, BlitAuto_Mul255_NEON(BlitAuto_Sub_NEON(opaque, BlitAuto_Alpha_NEON(srclo)), dstlo));
+                    break;
+                case SDL_COPY_ADD:
+                    dstlo = BlitAuto_KeepAlpha_NEON(BlitAuto_Min_NEON(BlitAuto_Add_NEON(srclo, dstlo), opaque), dstlo);
+                    break;
+                case SDL_COPY_MOD:
+                    dstlo = BlitAuto_KeepAlpha_NEON(BlitAuto_Mul255_NEON(srclo, dstlo), dstlo);
+                    break;
+                case SDL_COPY_MUL:
+                    dstlo = BlitAuto_KeepAlpha_NEON(BlitAuto_MulClamp255_NEON(dstlo, BlitAuto_Add_NEON(srclo, BlitAuto_Sub_NEON(opaque, BlitAuto_Alpha_NEON(srclo)))), dstlo);
+                    break;
+                }
+                switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+                case SDL_COPY_BLEND:
+                    dsthi = BlitAuto_Add_NEON(srchi, BlitAuto_Mul255_NEON(BlitAuto_Sub_NEON(opaque, BlitAuto_Alpha_NEON(srchi)), dsthi));
+                    break;
+                case SDL_COPY_ADD:
+                    dsthi = BlitAuto_KeepAlpha_NEON(BlitAuto_Min_NEON(BlitAuto_Add_NEON(srchi, dsthi), opaque), dsthi);
+                    break;
+                case SDL_COPY_MOD:
+                    dsthi = BlitAuto_KeepAlpha_NEON(BlitAuto_Mul255_NEON(srchi, dsthi), dsthi);
+                    break;
+                case SDL_COPY_MUL:
+                    dsthi = BlitAuto_KeepAlpha_NEON(BlitAuto_MulClamp255_NEON(dsthi, BlitAuto_Add_NEON(srchi, BlitAuto_Sub_NEON(opaque, BlitAuto_Alpha_NEON(srchi)))), dsthi);
+                    break;
+                }
+                pixels = BlitAuto_Shuffle_NEON(BlitAuto_Pack_NEON(dstlo, dsthi), out_mask);
+            }
+            BlitAuto_Store_NEON(d, pixels);
+            if (count < 4) {
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            column += count;
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+    SDL_small_free(columns, isstack);
+}
+
+static void SDL_Blit_8888_8888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    SDL_BlitAutoShuffle shuffle;
+    Uint32 srcbuf[4], dstbuf[4];
+    uint8x16_t src_mask, src_alpha, out_mask;
+    uint16x8_t modulate;
+
+    SDL_zeroa(srcbuf);
+    SDL_zeroa(dstbuf);
+    SDL_GetBlitAutoShuffle(info, (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF, &shuffle);
+    modulate = BlitAuto_Channels_NEON((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF,
+                                      (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF,
+                                      (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF,
+                                      ((flags & SDL_COPY_MODULATE_ALPHA) && shuffle.src_has_alpha) ? info->a : 0xFF);
+    src_mask = BlitAuto_LoadShuffle_NEON(shuffle.src);
+    src_alpha = BlitAuto_Splat_NEON(shuffle.src_alpha);
+    out_mask = BlitAuto_LoadShuffle_NEON(shuffle.out);
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, 4);
+            const Uint32 *s = src;
+            Uint32 *d = (count < 4) ? dstbuf : dst;
+            uint8x16_t pixels;
+
+            if (count < 4) {
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                s = srcbuf;
+            }
+            {
+                const uint8x16_t srcpixels = BlitAuto_Or_NEON(BlitAuto_Shuffle_NEON(BlitAuto_Load_NEON(s), src_mask), src_alpha);
+                uint16x8_t srclo = BlitAuto_Lo_NEON(srcpixels);
+                uint16x8_t srchi = BlitAuto_Hi_NEON(srcpixels);
+
+                srclo = BlitAuto_Mul255_NEON(srclo, modulate);
+                srchi = BlitAuto_Mul255_NEON(srchi, modulate);
+                pixels = BlitAuto_Shuffle_NEON(BlitAuto_Pack_NEON(srclo, srchi), out_mask);
+            }
+            BlitAuto_Store_NEON(d, pixels);
+            if (count < 4) {
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_8888_8888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    SDL_BlitAutoShuffle shuffle;
+    Uint32 srcbuf[4], dstbuf[4];
+    uint8x16_t src_mask, src_alpha, out_mask;
+    uint16x8_t modulate;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+    Uint64 lasty = ~(Uint64)0;
+
+    SDL_zeroa(srcbuf);
+    SDL_zeroa(dstbuf);
+    SDL_GetBlitAutoShuffle(info, (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF, &shuffle);
+    modulate = BlitAuto_Channels_NEON((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF,
+                                      (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF,
+                                      (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF,
+                                      ((flags & SDL_COPY_MODULATE_ALPHA) && shuffle.src_has_alpha) ? info->a : 0xFF);
+    src_mask = BlitAuto_LoadShuffle_NEON(shuffle.src);
+    src_alpha = BlitAuto_Splat_NEON(shuffle.src_alpha);
+    out_mask = BlitAuto_LoadShuffle_NEON(shuffle.out);
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src;
+        const Uint32 *column = columns;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        srcy = posy >> 16;
+        if (srcy == lasty) {
+            SDL_memcpy(dst, info->dst - info->dst_pitch, info->dst_w * sizeof(Uint32));
+            posy += incy;
+            info->dst += info->dst_pitch;
+            continue;
+        }
+        lasty = srcy;
+        src = (const Uint32 *)(info->src + (srcy * info->src_pitch));
+
+        while (n > 0) {
+            const int count = SDL_min(n, 4);
+            Uint32 *d = (count < 4) ? dstbuf : dst;
+            uint8x16_t gathered;
+            uint8x16_t pixels;
+
+            if (count < 4) {
+                int i;
+                for (i = 0; i < count; ++i) {
+                    srcbuf[i] = src[column[i]];
+                }
+                gathered = BlitAuto_Load_NEON(srcbuf);
+            } else {
+                gathered = BlitAuto_Gather_NEON(src, column);
+            }
+            {
+                const uint8x16_t srcpixels = BlitAuto_Or_NEON(BlitAuto_Shuffle_NEON(gathered, src_mask), src_alpha);
+                uint16x8_t srclo = BlitAuto_Lo_NEON(srcpixels);
+                uint16x8_t srchi = BlitAuto_Hi_NEON(srcpixels);
+
+                srclo = BlitAuto_Mul255_NEON(srclo, modulate);
+                srchi = BlitAuto_Mul255_NEON(srchi, modulate);
+                pixels = BlitAuto_Shuffle_NEON(BlitAuto_Pack_NEON(srclo, srchi), out_mask);
+            }
+            BlitAuto_Store_NEON(d, pixels);
+            if (count < 4) {
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            column += count;
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+    SDL_small_free(columns, isstack);
+}
+
+static void SDL_Blit_8888_8888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    SDL_BlitAutoShuffle shuffle;
+    Uint32 srcbuf[4], dstbuf[4];
+    uint8x16_t src_mask, src_alpha, out_mask;
+    uint8x16_t dst_mask;
+    const uint16x8_t opaque = BlitAuto_Channels_NEON(0xFF, 0xFF, 0xFF, 0xFF);
+    uint16x8_t modulate;
+
+    SDL_zeroa(srcbuf);
+    SDL_zeroa(dstbuf);
+    SDL_GetBlitAutoShuffle(info, (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF, &shuffle);
+    modulate = BlitAuto_Channels_NEON((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF,
+                                      (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF,
+                                      (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF,
+                                      ((flags & SDL_COPY_MODULATE_ALPHA) && shuffle.src_has_alpha) ? info->a : 0xFF);
+    src_mask = BlitAuto_LoadShuffle_NEON(shuffle.src);
+    src_alpha = BlitAuto_Splat_NEON(shuffle.src_alpha);
+    out_mask = BlitAuto_LoadShuffle_NEON(shuffle.out);
+    dst_mask = BlitAuto_LoadShuffle_NEON(shuffle.dst);
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, 4);
+            const Uint32 *s = src;
+            Uint32 *d = (count < 4) ? dstbuf : dst;
+            uint8x16_t pixels;
+
+            if (count < 4) {
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                s = srcbuf;
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+            }
+            {
+                const uint8x16_t srcpixels = BlitAuto_Or_NEON(BlitAuto_Shuffle_NEON(BlitAuto_Load_NEON(s), src_mask), src_alpha);
+                uint16x8_t srclo = BlitAuto_Lo_NEON(srcpixels);
+                uint16x8_t srchi = BlitAuto_Hi_NEON(srcpixels);
+                const uint8x16_t dstpixels = BlitAuto_Shuffle_NEON(BlitAuto_Load_NEON(d), dst_mask);
+                uint16x8_t dstlo = BlitAuto_Lo_NEON(dstpixels);
+                uint16x8_t dsthi = BlitAuto_Hi_NEON(dstpixels);
+
+                srclo = BlitAuto_Mul255_NEON(srclo, modulate);
+                srchi = BlitAuto_Mul255_NEON(srchi, modulate);
+
+                if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                    /* This goes away if we ever use premultiplied alpha */
+                    srclo = BlitAuto_KeepAlpha_NEON(BlitAuto_Mul255_NEON(srclo, BlitAuto_Alpha_NEON(srclo)), srclo);
+                    srchi = BlitAuto_KeepAlpha_NEON(BlitAuto_Mul255_NEON(srchi, BlitAuto_Alpha_NEON(srchi)), srchi);
+                }
+                switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+                case SDL_COPY_BLEND:
+                    dstlo = BlitAuto_Add_NEON(srclo, BlitAuto_Mul255_NEON(BlitAuto_Sub_NEON(opaque, BlitAuto_Alpha_NEON(srclo)), dstlo));
+                    break;
+                case SDL_COPY_ADD:
+                    dstlo = BlitAuto_KeepAlpha_NEON(BlitAuto_Min_NEON(BlitAuto_Add_NEON(srclo, dstlo), opaque), dstlo);
+                    break;
+                case SDL_COPY_MOD:
+                    dstlo = BlitAuto_KeepAlpha_NEON(BlitAuto_Mul255_NEON(srclo, dstlo), dstlo);
+                    break;
+                case SDL_COPY_MUL:
+                    dstlo = BlitAuto_KeepAlpha_NEON(BlitAuto_MulClamp255_NEON(dstlo, BlitAuto_Add_NEON(srclo, BlitAuto_Sub_NEON(opaque, BlitAuto_Alpha_NEON(srclo)))), dstlo);
+                    break;
+                }
+                switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+                case SDL_COPY_BLEND:
+                    dsthi = BlitAuto_Add_NEON(srchi, BlitAuto_Mul255_NEON(BlitAuto_Sub_NEON(opaque, BlitAuto_Alpha_NEON(srchi)), dsthi));
+                    break;
+                case SDL_COPY_ADD:
+                    dsthi = BlitAuto_KeepAlpha_NEON(BlitAuto_Min_NEON(BlitAuto_Add_NEON(srchi, dsthi), opaque), dsthi);
+                    break;
+                case SDL_COPY_MOD:
+                    dsthi = BlitAuto_KeepAlpha_NEON(BlitAuto_Mul255_NEON(srchi, dsthi), dsthi);
+                    break;
+                case SDL_COPY_MUL:
+                    dsthi = BlitAuto_KeepAlpha_NEON(BlitAuto_MulClamp255_NEON(dsthi, BlitAuto_Add_NEON(srchi, BlitAuto_Sub_NEON(opaque, BlitAuto_Alpha_NEON(srchi)))), dsthi);
+                    break;
+                }
+                pixels = BlitAuto_Shuffle_NEON(BlitAuto_Pack_NEON(dstlo, dsthi), out_mask);
+            }
+            BlitAuto_Store_NEON(d, pixels);
+            if (count < 4) {
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_8888_8888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    SDL_BlitAutoShuffle shuffle;
+    Uint32 srcbuf[4], dstbuf[4];
+    uint8x16_t src_mask, src_alpha, out_mask;
+    uint8x16_t dst_mask;
+    const uint16x8_t opaque = BlitAuto_Channels_NEON(0xFF, 0xFF, 0xFF, 0xFF);
+    uint16x8_t modulate;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+
+    SDL_zeroa(srcbuf);
+    SDL_zeroa(dstbuf);
+    SDL_GetBlitAutoShuffle(info, (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF, &shuffle);
+    modulate = BlitAuto_Channels_NEON((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF,
+                                      (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF,
+                                      (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF,
+                                      ((flags & SDL_COPY_MODULATE_ALPHA) && shuffle.src_has_alpha) ? info->a : 0xFF);
+    src_mask = BlitAuto_LoadShuffle_NEON(shuffle.src);
+    src_alpha = BlitAuto_Splat_NEON(shuffle.src_alpha);
+    out_mask = BlitAuto_LoadShuffle_NEON(shuffle.out);
+    dst_mask = BlitAuto_LoadShuffle_NEON(shuffle.dst);
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src;
+        const Uint32 *column = columns;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        srcy = posy >> 16;
+        src = (const Uint32 *)(info->src + (srcy * info->src_pitch));
+
+        while (n > 0) {
+            const int count = SDL_min(n, 4);
+            Uint32 *d = (count < 4) ? dstbuf : dst;
+            uint8x16_t gathered;
+            uint8x16_t pixels;
+
+            if (count < 4) {
+                int i;
+                for (i = 0; i < count; ++i) {
+                    srcbuf[i] = src[column[i]];
+                }
+                gathered = BlitAuto_Load_NEON(srcbuf);
+            } else {
+                gathered = BlitAuto_Gather_NEON(src, column);
+            }
+            if (count < 4) {
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+            }
+            {
+                const uint8x16_t srcpixels = BlitAuto_Or_NEON(BlitAuto_Shuffle_NEON(gathered, src_mask), src_alpha);
+                uint16x8_t srclo = BlitAuto_Lo_NEON(srcpixels);
+                uint16x8_t srchi = BlitAuto_Hi_NEON(srcpixels);
+                const uint8x16_t dstpixels = BlitAuto_Shuffle_NEON(BlitAuto_Load_NEON(d), dst_mask);
+                uint16x8_t dstlo = BlitAuto_Lo_NEON(dstpixels);
+                uint16x8_t dsthi = BlitAuto_Hi_NEON(dstpixels);
+
+                srclo = BlitAuto_Mul255_NEON(srclo, modulate);
+                srchi = BlitAuto_Mul255_NEON(srchi, modulate);
+
+                if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                    /* This goes away if we ever use premultiplied alpha */
+                    srclo = BlitAuto_KeepAlpha_NEON(BlitAuto_Mul255_NEON(srclo, BlitAuto_Alpha_NEON(srclo)), srclo);
+                    srchi = BlitAuto_KeepAlpha_NEON(BlitAuto_Mul255_NEON(srchi, BlitAuto_Alpha_NEON(srchi)), srchi);
+                }
+                switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+                case SDL_COPY_BLEND:
+                    dstlo = BlitAuto_Add_NEON(srclo, BlitAuto_Mul255_NEON(BlitAuto_Sub_NEON(opaque, BlitAuto_Alpha_NEON(srclo)), dstlo));
+                    break;
+                case SDL_COPY_ADD:
+                    dstlo = BlitAuto_KeepAlpha_NEON(BlitAuto_Min_NEON(BlitAuto_Add_NEON(srclo, dstlo), opaque), dstlo);
+                    break;
+                case SDL_COPY_MOD:
+                    dstlo = BlitAuto_KeepAlpha_NEON(BlitAuto_Mul255_NEON(srclo, dstlo), dstlo);
+                    break;
+                case SDL_COPY_MUL:
+                    dstlo = BlitAuto_KeepAlpha_NEON(BlitAuto_MulClamp255_NEON(dstlo, BlitAuto_Add_NEON(srclo, BlitAuto_Sub_NEON(opaque, BlitAuto_Alpha_NEON(srclo)))), dstlo);
+                    break;
+                }
+                switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+                case SDL_COPY_BLEND:
+                    dsthi = BlitAuto_Add_NEON(srchi, BlitAuto_Mul255_NEON(BlitAuto_Sub_NEON(opaque, BlitAuto_Alpha_NEON(srchi)), dsthi));
+                    break;
+                case SDL_COPY_ADD:
+                    dsthi = BlitAuto_KeepAlpha_NEON(BlitAuto_Min_NEON(BlitAuto_Add_NEON(srchi, dsthi), opaque), dsthi);
+                    break;
+                case SDL_COPY_MOD:
+                    dsthi = BlitAuto_KeepAlpha_NEON(BlitAuto_Mul255_NEON(srchi, dsthi), dsthi);
+                    break;
+                case SDL_COPY_MUL:
+                    dsthi = BlitAuto_KeepAlpha_NEON(BlitAuto_MulClamp255_NEON(dsthi, BlitAuto_Add_NEON(srchi, BlitAuto_Sub_NEON(opaque, BlitAuto_Alpha_NEON(srchi)))), dsthi);
+                    break;
+                }
+                pixels = BlitAuto_Shuffle_NEON(BlitAuto_Pack_NEON(dstlo, dsthi), out_mask);
+            }
+            BlitAuto_Store_NEON(d, pixels);
+            if (count < 4) {
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            column += count;
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+    SDL_small_free(columns, isstack);
+}
+
+#endif /* SDL_BLIT_AUTO_NEON */
+
 SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_SSE41 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_SSE41 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_SSE41 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_SSE41 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_SSE41 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_SSE41 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_SSE41 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_SSE41 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_SSE41 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_SSE41 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_SSE41 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_SSE41 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_SSE41 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_SSE41 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_SSE41 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_SSE41 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_SSE41 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_SSE41 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_SSE41 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_SSE41 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_SSE41 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_SSE41 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_SSE41 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_SSE41 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_SSE41 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_SSE41 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_SSE41 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Scale_SSE41 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_SSE41 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_SSE41 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Scale_SSE41 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_SSE41 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Scale_SSE41 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_SSE41 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_SSE41 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Scale_SSE41 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_SSE41 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Scale_SSE41 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_SSE41 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_SSE41 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Scale_SSE41 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_SSE41 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_SSE41 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_SSE41 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_SSE41 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_SSE41 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_SSE41 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_SSE41 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_SSE41 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_SSE41 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_SSE41 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Scale_SSE41 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_SSE41 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_SSE41 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Scale_SSE41 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_SSE41 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Scale_SSE41 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_SSE41 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_SSE41 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Scale_SSE41 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_SSE41 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Scale_SSE41 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_SSE41 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_SSE41 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Scale_SSE41 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_SSE41 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_Scale_SSE41 },
+#endif
+#ifdef SDL_BLIT_AUTO_NEON
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Scale_NEON },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_NEON },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Scale_NEON },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_NEON },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Scale_NEON },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_NEON },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Scale_NEON },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_NEON },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Scale_NEON },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_NEON },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Scale_NEON },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_NEON },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Scale_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Scale_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Scale_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Scale_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Scale_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Scale_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Scale_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Scale_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Scale_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Scale_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Scale_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Scale_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_XRGB8888_XRGB8888_Scale },
     { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_XRGB8888_XRGB8888_Blend },
     { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_XRGB8888_XRGB8888_Blend_Scale },
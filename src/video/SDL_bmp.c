@@ -36,6 +36,9 @@
 
 #define SAVE_32BIT_BMP
 
+/* Pixel rows are written in chunks of about this many bytes */
+#define BMP_SAVE_CHUNK_SIZE 65536
+
 /* Compression encodings for BMP files */
 #ifndef BI_RGB
 #define BI_RGB       0
@@ -164,40 +167,207 @@ static SDL_bool readRlePixels(SDL_Surface *surface, SDL_IOStream *src, int isRle
     }
 }
 
+static SDL_INLINE Uint16 GetLE16(const Uint8 *data)
+{
+    return (Uint16)(data[0] | (data[1] << 8));
+}
+
+static SDL_INLINE Uint32 GetLE32(const Uint8 *data)
+{
+    return (Uint32)data[0] | ((Uint32)data[1] << 8) | ((Uint32)data[2] << 16) | ((Uint32)data[3] << 24);
+}
+
+static SDL_INLINE void PutLE16(Uint8 *data, Uint16 value)
+{
+    data[0] = (Uint8)value;
+    data[1] = (Uint8)(value >> 8);
+}
+
+static SDL_INLINE void PutLE32(Uint8 *data, Uint32 value)
+{
+    data[0] = (Uint8)value;
+    data[1] = (Uint8)(value >> 8);
+    data[2] = (Uint8)(value >> 16);
+    data[3] = (Uint8)(value >> 24);
+}
+
+/* The alpha byte is the top byte of the native pixel value on either byte order */
+#define BMP_ALPHA_MASK 0xFF000000
+
+#ifdef SDL_SSE2_INTRINSICS
+static SDL_bool SDL_TARGETING("sse2") HasAlpha_SSE2(const Uint32 *pixels, size_t count, size_t *checked)
+{
+    const __m128i mask = _mm_set1_epi32((int)BMP_ALPHA_MASK);
+    size_t i;
+
+    for (i = 0; i + 16 <= count; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(pixels + i));
+        v = _mm_or_si128(v, _mm_loadu_si128((const __m128i *)(pixels + i + 4)));
+        v = _mm_or_si128(v, _mm_loadu_si128((const __m128i *)(pixels + i + 8)));
+        v = _mm_or_si128(v, _mm_loadu_si128((const __m128i *)(pixels + i + 12)));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(v, mask), _mm_setzero_si128())) != 0xFFFF) {
+            *checked = i;
+            return SDL_TRUE;
+        }
+    }
+    *checked = i;
+    return SDL_FALSE;
+}
+
+static size_t SDL_TARGETING("sse2") SetOpaque_SSE2(Uint32 *pixels, size_t count)
+{
+    const __m128i mask = _mm_set1_epi32((int)BMP_ALPHA_MASK);
+    size_t i;
+
+    for (i = 0; i + 4 <= count; i += 4) {
+        const __m128i v = _mm_loadu_si128((const __m128i *)(pixels + i));
+        _mm_storeu_si128((__m128i *)(pixels + i), _mm_or_si128(v, mask));
+    }
+    return i;
+}
+#endif
+
+#ifdef SDL_NEON_INTRINSICS
+static SDL_bool HasAlpha_NEON(const Uint32 *pixels, size_t count, size_t *checked)
+{
+    const uint32x4_t mask = vdupq_n_u32(BMP_ALPHA_MASK);
+    size_t i;
+
+    for (i = 0; i + 16 <= count; i += 16) {
+        uint32x4_t v = vld1q_u32(pixels + i);
+        v = vorrq_u32(v, vld1q_u32(pixels + i + 4));
+        v = vorrq_u32(v, vld1q_u32(pixels + i + 8));
+        v = vorrq_u32(v, vld1q_u32(pixels + i + 12));
+        v = vandq_u32(v, mask);
+        if ((vgetq_lane_u32(v, 0) | vgetq_lane_u32(v, 1) | vgetq_lane_u32(v, 2) | vgetq_lane_u32(v, 3)) != 0) {
+            *checked = i;
+            return SDL_TRUE;
+        }
+    }
+    *checked = i;
+    return SDL_FALSE;
+}
+
+static size_t SetOpaque_NEON(Uint32 *pixels, size_t count)
+{
+    const uint32x4_t mask = vdupq_n_u32(BMP_ALPHA_MASK);
+    size_t i;
+
+    for (i = 0; i + 4 <= count; i += 4) {
+        vst1q_u32(pixels + i, vorrq_u32(vld1q_u32(pixels + i), mask));
+    }
+    return i;
+}
+#endif
+
 static void CorrectAlphaChannel(SDL_Surface *surface)
 {
     /* Check to see if there is any alpha channel data */
-    SDL_bool hasAlpha = SDL_FALSE;
-#if SDL_BYTEORDER == SDL_BIG_ENDIAN
-    int alphaChannelOffset = 0;
-#else
-    int alphaChannelOffset = 3;
-#endif
-    Uint8 *alpha = ((Uint8 *)surface->pixels) + alphaChannelOffset;
-    Uint8 *end = alpha + surface->h * surface->pitch;
+    Uint32 *pixels = (Uint32 *)surface->pixels;
+    const size_t count = ((size_t)surface->h * surface->pitch) / 4;
+    size_t i = 0;
 
-    while (alpha < end) {
-        if (*alpha != 0) {
-            hasAlpha = SDL_TRUE;
-            break;
+#ifdef SDL_SSE2_INTRINSICS
+    if (SDL_HasSSE2()) {
+        if (HasAlpha_SSE2(pixels, count, &i)) {
+            return;
+        }
+    }
+#endif
+#ifdef SDL_NEON_INTRINSICS
+    if (i == 0 && SDL_HasNEON()) {
+        if (HasAlpha_NEON(pixels, count, &i)) {
+            return;
         }
-        alpha += 4;
     }
+#endif
+    for (; i < count; ++i) {
+        if (pixels[i] & BMP_ALPHA_MASK) {
+            return;
+        }
+    }
+
+    /* No alpha anywhere, make the image opaque */
+    i = 0;
+#ifdef SDL_SSE2_INTRINSICS
+    if (SDL_HasSSE2()) {
+        i = SetOpaque_SSE2(pixels, count);
+    }
+#endif
+#ifdef SDL_NEON_INTRINSICS
+    if (i == 0 && SDL_HasNEON()) {
+        i = SetOpaque_NEON(pixels, count);
+    }
+#endif
+    for (; i < count; ++i) {
+        pixels[i] |= BMP_ALPHA_MASK;
+    }
+}
+
+/* Returns the memory backing src if it's a memory stream, so the pixels can
+   be copied straight out of it without going through SDL_ReadIO() */
+static const Uint8 *GetStreamMemory(SDL_IOStream *src, Sint64 *size)
+{
+    const SDL_PropertiesID props = SDL_GetIOProperties(src);
+    const Uint8 *mem;
+
+    if (!props) {
+        return NULL;
+    }
+    mem = (const Uint8 *)SDL_GetProperty(props, SDL_PROP_IOSTREAM_MEMORY_POINTER, NULL);
+    if (mem) {
+        *size = SDL_GetNumberProperty(props, SDL_PROP_IOSTREAM_MEMORY_SIZE_NUMBER, 0);
+        return mem;
+    }
+    mem = (const Uint8 *)SDL_GetProperty(props, SDL_PROP_IOSTREAM_DYNAMIC_MEMORY_POINTER, NULL);
+    if (mem) {
+        *size = SDL_GetIOSize(src);
+        return mem;
+    }
+    return NULL;
+}
 
-    if (!hasAlpha) {
-        alpha = ((Uint8 *)surface->pixels) + alphaChannelOffset;
-        while (alpha < end) {
-            *alpha = SDL_ALPHA_OPAQUE;
-            alpha += 4;
+/* Read the uncompressed pixel array, flipping bottom-up images as we go */
+static SDL_bool ReadPixels(SDL_Surface *surface, SDL_IOStream *src, SDL_bool topDown)
+{
+    const size_t pitch = surface->pitch;
+    const size_t size = surface->h * pitch;
+    Uint8 *pixels = (Uint8 *)surface->pixels;
+    const Uint8 *mem;
+    Sint64 offset, memsize = 0;
+    int y;
+
+    mem = GetStreamMemory(src, &memsize);
+    if (mem) {
+        offset = SDL_TellIO(src);
+        if (offset >= 0 && memsize >= offset && (Uint64)(memsize - offset) >= size) {
+            mem += offset;
+            if (topDown) {
+                SDL_memcpy(pixels, mem, size);
+            } else {
+                for (y = surface->h; y--; ) {
+                    SDL_memcpy(pixels + y * pitch, mem, pitch);
+                    mem += pitch;
+                }
+            }
+            return SDL_SeekIO(src, (Sint64)size, SDL_IO_SEEK_CUR) >= 0;
         }
     }
+
+    if (SDL_ReadIO(src, pixels, size) != size) {
+        return SDL_FALSE;
+    }
+    if (!topDown && SDL_FlipSurface(surface, SDL_FLIP_VERTICAL) < 0) {
+        return SDL_FALSE;
+    }
+    return SDL_TRUE;
 }
 
 SDL_Surface *SDL_LoadBMP_IO(SDL_IOStream *src, SDL_bool closeio)
 {
     SDL_bool was_error = SDL_TRUE;
     Sint64 fp_offset = 0;
-    int i, pad;
+    int i, y;
     SDL_Surface *surface;
     Uint32 Rmask = 0;
     Uint32 Gmask = 0;
@@ -205,14 +375,16 @@ SDL_Surface *SDL_LoadBMP_IO(SDL_IOStream *src, SDL_bool closeio)
     Uint32 Amask = 0;
     SDL_Palette *palette;
     Uint8 *bits;
-    Uint8 *top, *end;
     SDL_bool topDown;
     SDL_bool haveRGBMasks = SDL_FALSE;
     SDL_bool haveAlphaMask = SDL_FALSE;
     SDL_bool correctAlpha = SDL_FALSE;
 
+    /* Large enough for the file header and any part of the info header we read at once */
+    Uint8 header[36];
+
     /* The Win32 BMP file header (14 bytes) */
-    char magic[2];
+    /* char magic[2]; */
     /* Uint32 bfSize; */
     /* Uint16 bfReserved1; */
     /* Uint16 bfReserved2; */
@@ -238,40 +410,32 @@ SDL_Surface *SDL_LoadBMP_IO(SDL_IOStream *src, SDL_bool closeio)
         goto done;
     }
 
-    /* Read in the BMP file header */
+    /* Read in the BMP file header and the size of the info header */
     fp_offset = SDL_TellIO(src);
     if (fp_offset < 0) {
         goto done;
     }
     SDL_ClearError();
-    if (SDL_ReadIO(src, magic, 2) != 2) {
+    if (SDL_ReadIO(src, header, 18) != 18) {
         goto done;
     }
-    if (SDL_strncmp(magic, "BM", 2) != 0) {
+    if (SDL_strncmp((const char *)header, "BM", 2) != 0) {
         SDL_SetError("File is not a Windows BMP file");
         goto done;
     }
-    if (!SDL_ReadU32LE(src, NULL /* bfSize */) ||
-        !SDL_ReadU16LE(src, NULL /* bfReserved1 */) ||
-        !SDL_ReadU16LE(src, NULL /* bfReserved2 */) ||
-        !SDL_ReadU32LE(src, &bfOffBits)) {
-        goto done;
-    }
+    /* bfSize, bfReserved1 and bfReserved2 are ignored */
+    bfOffBits = GetLE32(&header[10]);
 
     /* Read the Win32 BITMAPINFOHEADER */
-    if (!SDL_ReadU32LE(src, &biSize)) {
-        goto done;
-    }
+    biSize = GetLE32(&header[14]);
     if (biSize == 12) { /* really old BITMAPCOREHEADER */
-        Uint16 biWidth16, biHeight16;
-        if (!SDL_ReadU16LE(src, &biWidth16) ||
-            !SDL_ReadU16LE(src, &biHeight16) ||
-            !SDL_ReadU16LE(src, NULL /* biPlanes */) ||
-            !SDL_ReadU16LE(src, &biBitCount)) {
+        if (SDL_ReadIO(src, header, 8) != 8) {
             goto done;
         }
-        biWidth = biWidth16;
-        biHeight = biHeight16;
+        biWidth = GetLE16(&header[0]);
+        biHeight = GetLE16(&header[2]);
+        /* biPlanes = GetLE16(&header[4]); */
+        biBitCount = GetLE16(&header[6]);
         biCompression = BI_RGB;
         /* biSizeImage = 0; */
         /* biXPelsPerMeter = 0; */
@@ -279,19 +443,20 @@ SDL_Surface *SDL_LoadBMP_IO(SDL_IOStream *src, SDL_bool closeio)
         biClrUsed = 0;
         /* biClrImportant = 0; */
     } else if (biSize >= 40) { /* some version of BITMAPINFOHEADER */
-        Uint32 headerSize;
-        if (!SDL_ReadS32LE(src, &biWidth) ||
-            !SDL_ReadS32LE(src, &biHeight) ||
-            !SDL_ReadU16LE(src, NULL /* biPlanes */) ||
-            !SDL_ReadU16LE(src, &biBitCount) ||
-            !SDL_ReadU32LE(src, &biCompression) ||
-            !SDL_ReadU32LE(src, NULL /* biSizeImage */) ||
-            !SDL_ReadU32LE(src, NULL /* biXPelsPerMeter */) ||
-            !SDL_ReadU32LE(src, NULL /* biYPelsPerMeter */) ||
-            !SDL_ReadU32LE(src, &biClrUsed) ||
-            !SDL_ReadU32LE(src, NULL /* biClrImportant */)) {
+        Uint32 headerSize = 40;
+        if (SDL_ReadIO(src, header, 36) != 36) {
             goto done;
         }
+        biWidth = (Sint32)GetLE32(&header[0]);
+        biHeight = (Sint32)GetLE32(&header[4]);
+        /* biPlanes = GetLE16(&header[8]); */
+        biBitCount = GetLE16(&header[10]);
+        biCompression = GetLE32(&header[12]);
+        /* biSizeImage = GetLE32(&header[16]); */
+        /* biXPelsPerMeter = GetLE32(&header[20]); */
+        /* biYPelsPerMeter = GetLE32(&header[24]); */
+        biClrUsed = GetLE32(&header[28]);
+        /* biClrImportant = GetLE32(&header[32]); */
 
         /* 64 == BITMAPCOREHEADER2, an incompatible OS/2 2.x extension. Skip this stuff for now. */
         if (biSize != 64) {
@@ -302,34 +467,29 @@ SDL_Surface *SDL_LoadBMP_IO(SDL_IOStream *src, SDL_bool closeio)
                these masks stored in the exact same place, but strictly
                speaking, this is the bmiColors field in BITMAPINFO immediately
                following the legacy v1 info header, just past biSize. */
-            if (biCompression == BI_BITFIELDS) {
-                haveRGBMasks = SDL_TRUE;
-                if (!SDL_ReadU32LE(src, &Rmask) ||
-                    !SDL_ReadU32LE(src, &Gmask) ||
-                    !SDL_ReadU32LE(src, &Bmask)) {
+            Uint32 maskSize = 0;
+            if (biCompression == BI_BITFIELDS || biSize >= 52) { /* BITMAPV2INFOHEADER; adds RGB masks */
+                maskSize += 12;
+            }
+            if (maskSize && biSize >= 56) { /* BITMAPV3INFOHEADER; adds alpha mask */
+                maskSize += 4;
+            }
+            if (maskSize) {
+                if (SDL_ReadIO(src, header, maskSize) != maskSize) {
                     goto done;
                 }
+                headerSize += maskSize;
+            }
 
-                /* ...v3 adds an alpha mask. */
-                if (biSize >= 56) { /* BITMAPV3INFOHEADER; adds alpha mask */
+            /* the mask fields are ignored for v2+ headers if not BI_BITFIELD. */
+            if (biCompression == BI_BITFIELDS) {
+                haveRGBMasks = SDL_TRUE;
+                Rmask = GetLE32(&header[0]);
+                Gmask = GetLE32(&header[4]);
+                Bmask = GetLE32(&header[8]);
+                if (maskSize == 16) {
                     haveAlphaMask = SDL_TRUE;
-                    if (!SDL_ReadU32LE(src, &Amask)) {
-                        goto done;
-                    }
-                }
-            } else {
-                /* the mask fields are ignored for v2+ headers if not BI_BITFIELD. */
-                if (biSize >= 52) { /* BITMAPV2INFOHEADER; adds RGB masks */
-                    if (!SDL_ReadU32LE(src, NULL /* Rmask */) ||
-                        !SDL_ReadU32LE(src, NULL /* Gmask */) ||
-                        !SDL_ReadU32LE(src, NULL /* Bmask */)) {
-                        goto done;
-                    }
-                }
-                if (biSize >= 56) { /* BITMAPV3INFOHEADER; adds alpha mask */
-                    if (!SDL_ReadU32LE(src, NULL /* Amask */)) {
-                        goto done;
-                    }
+                    Amask = GetLE32(&header[12]);
                 }
             }
 
@@ -340,7 +500,6 @@ SDL_Surface *SDL_LoadBMP_IO(SDL_IOStream *src, SDL_bool closeio)
         }
 
         /* skip any header bytes we didn't handle... */
-        headerSize = (Uint32)(SDL_TellIO(src) - (fp_offset + 14));
         if (biSize > headerSize) {
             if (SDL_SeekIO(src, (biSize - headerSize), SDL_IO_SEEK_CUR) < 0) {
                 goto done;
@@ -463,30 +622,33 @@ SDL_Surface *SDL_LoadBMP_IO(SDL_IOStream *src, SDL_bool closeio)
             }
         }
 
-        if (biSize == 12) {
-            for (i = 0; i < (int)biClrUsed; ++i) {
-                if (!SDL_ReadU8(src, &palette->colors[i].b) ||
-                    !SDL_ReadU8(src, &palette->colors[i].g) ||
-                    !SDL_ReadU8(src, &palette->colors[i].r)) {
-                    goto done;
-                }
-                palette->colors[i].a = SDL_ALPHA_OPAQUE;
+        /* Read the whole palette at once (in BGR color order) */
+        {
+            const size_t entrySize = (biSize == 12) ? 3 : 4;
+            const size_t paletteSize = biClrUsed * entrySize;
+            const Uint8 *entry;
+            Uint8 *entries = (Uint8 *)SDL_malloc(paletteSize);
+
+            if (!entries) {
+                goto done;
             }
-        } else {
+            if (SDL_ReadIO(src, entries, paletteSize) != paletteSize) {
+                SDL_free(entries);
+                goto done;
+            }
+            entry = entries;
             for (i = 0; i < (int)biClrUsed; ++i) {
-                if (!SDL_ReadU8(src, &palette->colors[i].b) ||
-                    !SDL_ReadU8(src, &palette->colors[i].g) ||
-                    !SDL_ReadU8(src, &palette->colors[i].r) ||
-                    !SDL_ReadU8(src, &palette->colors[i].a)) {
-                    goto done;
-                }
-
+                palette->colors[i].b = entry[0];
+                palette->colors[i].g = entry[1];
+                palette->colors[i].r = entry[2];
                 /* According to Microsoft documentation, the fourth element
                    is reserved and must be zero, so we shouldn't treat it as
                    alpha.
                 */
                 palette->colors[i].a = SDL_ALPHA_OPAQUE;
+                entry += entrySize;
             }
+            SDL_free(entries);
         }
         palette->ncolors = biClrUsed;
     }
@@ -503,19 +665,12 @@ SDL_Surface *SDL_LoadBMP_IO(SDL_IOStream *src, SDL_bool closeio)
         }
         goto done;
     }
-    top = (Uint8 *)surface->pixels;
-    end = (Uint8 *)surface->pixels + (surface->h * surface->pitch);
-    pad = ((surface->pitch % 4) ? (4 - (surface->pitch % 4)) : 0);
-    if (topDown) {
-        bits = top;
-    } else {
-        bits = end - surface->pitch;
+    if (!ReadPixels(surface, src, topDown)) {
+        goto done;
     }
-    while (bits >= top && bits < end) {
-        if (SDL_ReadIO(src, bits, surface->pitch) != (size_t)surface->pitch) {
-            goto done;
-        }
-        if (biBitCount == 8 && palette && biClrUsed < (1u << biBitCount)) {
+    if (biBitCount == 8 && palette && biClrUsed < (1u << biBitCount)) {
+        for (y = 0; y < surface->h; ++y) {
+            bits = (Uint8 *)surface->pixels + y * surface->pitch;
             for (i = 0; i < surface->w; ++i) {
                 if (bits[i] >= biClrUsed) {
                     SDL_SetError("A BMP image contains a pixel with a color out of the palette");
@@ -523,9 +678,12 @@ SDL_Surface *SDL_LoadBMP_IO(SDL_IOStream *src, SDL_bool closeio)
                 }
             }
         }
+    }
 #if SDL_BYTEORDER == SDL_BIG_ENDIAN
-        /* Byte-swap the pixels if needed. Note that the 24bpp
-           case has already been taken care of above. */
+    /* Byte-swap the pixels if needed. Note that the 24bpp
+       case has already been taken care of above. */
+    for (y = 0; y < surface->h; ++y) {
+        bits = (Uint8 *)surface->pixels + y * surface->pitch;
         switch (biBitCount) {
         case 15:
         case 16:
@@ -546,23 +704,8 @@ SDL_Surface *SDL_LoadBMP_IO(SDL_IOStream *src, SDL_bool closeio)
             break;
         }
         }
-#endif
-
-        /* Skip padding bytes, ugh */
-        if (pad) {
-            Uint8 padbyte;
-            for (i = 0; i < pad; ++i) {
-                if (!SDL_ReadU8(src, &padbyte)) {
-                    goto done;
-                }
-            }
-        }
-        if (topDown) {
-            bits += surface->pitch;
-        } else {
-            bits -= surface->pitch;
-        }
     }
+#endif
     if (correctAlpha) {
         CorrectAlphaChannel(surface);
     }
@@ -591,10 +734,10 @@ SDL_Surface *SDL_LoadBMP(const char *file)
 int SDL_SaveBMP_IO(SDL_Surface *surface, SDL_IOStream *dst, SDL_bool closeio)
 {
     SDL_bool was_error = SDL_TRUE;
-    Sint64 fp_offset, new_offset;
-    int i, pad;
+    int i;
     SDL_Surface *intermediate_surface;
     Uint8 *bits;
+    Uint8 *chunk = NULL;
     SDL_bool save32bit = SDL_FALSE;
     SDL_bool saveLegacyBMP = SDL_FALSE;
 
@@ -695,25 +838,12 @@ int SDL_SaveBMP_IO(SDL_Surface *surface, SDL_IOStream *dst, SDL_bool closeio)
 
     if (SDL_LockSurface(intermediate_surface) == 0) {
         const size_t bw = intermediate_surface->w * intermediate_surface->format->bytes_per_pixel;
-
-        /* Set the BMP file header values */
-        bfSize = 0; /* We'll write this when we're done */
-        bfReserved1 = 0;
-        bfReserved2 = 0;
-        bfOffBits = 0; /* We'll write this when we're done */
-
-        /* Write the BMP file header values */
-        fp_offset = SDL_TellIO(dst);
-        if (fp_offset < 0) {
-            goto done;
-        }
-        if (SDL_WriteIO(dst, magic, 2) != 2 ||
-            !SDL_WriteU32LE(dst, bfSize) ||
-            !SDL_WriteU16LE(dst, bfReserved1) ||
-            !SDL_WriteU16LE(dst, bfReserved2) ||
-            !SDL_WriteU32LE(dst, bfOffBits)) {
-            goto done;
-        }
+        const size_t stride = (bw + 3) & ~3;
+        Uint8 header[14 + 108];
+        Uint8 *info = &header[14];
+        size_t rows_per_chunk;
+        int ncolors = 0;
+        int y;
 
         /* Set the BMP info values */
         biSize = 40;
@@ -726,10 +856,9 @@ int SDL_SaveBMP_IO(SDL_Surface *surface, SDL_IOStream *dst, SDL_bool closeio)
         biXPelsPerMeter = 0;
         biYPelsPerMeter = 0;
         if (intermediate_surface->format->palette) {
-            biClrUsed = intermediate_surface->format->palette->ncolors;
-        } else {
-            biClrUsed = 0;
+            ncolors = intermediate_surface->format->palette->ncolors;
         }
+        biClrUsed = ncolors;
         biClrImportant = 0;
 
         /* Set the BMP info values for the version 4 header */
@@ -747,103 +876,90 @@ int SDL_SaveBMP_IO(SDL_Surface *surface, SDL_IOStream *dst, SDL_bool closeio)
             bV4GammaBlue = 0;
         }
 
-        /* Write the BMP info values */
-        if (!SDL_WriteU32LE(dst, biSize) ||
-            !SDL_WriteS32LE(dst, biWidth) ||
-            !SDL_WriteS32LE(dst, biHeight) ||
-            !SDL_WriteU16LE(dst, biPlanes) ||
-            !SDL_WriteU16LE(dst, biBitCount) ||
-            !SDL_WriteU32LE(dst, biCompression) ||
-            !SDL_WriteU32LE(dst, biSizeImage) ||
-            !SDL_WriteU32LE(dst, biXPelsPerMeter) ||
-            !SDL_WriteU32LE(dst, biYPelsPerMeter) ||
-            !SDL_WriteU32LE(dst, biClrUsed) ||
-            !SDL_WriteU32LE(dst, biClrImportant)) {
-            goto done;
-        }
-
-        /* Write the BMP info values for the version 4 header */
+        /* Set the BMP file header values, the layout is known up front */
+        bfReserved1 = 0;
+        bfReserved2 = 0;
+        bfOffBits = 14 + biSize + ncolors * 4;
+        bfSize = (Uint32)(bfOffBits + intermediate_surface->h * stride);
+
+        /* Write the BMP file header and info values at once */
+        SDL_memcpy(header, magic, 2);
+        PutLE32(&header[2], bfSize);
+        PutLE16(&header[6], bfReserved1);
+        PutLE16(&header[8], bfReserved2);
+        PutLE32(&header[10], bfOffBits);
+        PutLE32(&info[0], biSize);
+        PutLE32(&info[4], (Uint32)biWidth);
+        PutLE32(&info[8], (Uint32)biHeight);
+        PutLE16(&info[12], biPlanes);
+        PutLE16(&info[14], biBitCount);
+        PutLE32(&info[16], biCompression);
+        PutLE32(&info[20], biSizeImage);
+        PutLE32(&info[24], (Uint32)biXPelsPerMeter);
+        PutLE32(&info[28], (Uint32)biYPelsPerMeter);
+        PutLE32(&info[32], biClrUsed);
+        PutLE32(&info[36], biClrImportant);
+
+        /* Add the BMP info values for the version 4 header */
         if (save32bit && !saveLegacyBMP) {
-            if (!SDL_WriteU32LE(dst, bV4RedMask) ||
-                !SDL_WriteU32LE(dst, bV4GreenMask) ||
-                !SDL_WriteU32LE(dst, bV4BlueMask) ||
-                !SDL_WriteU32LE(dst, bV4AlphaMask) ||
-                !SDL_WriteU32LE(dst, bV4CSType)) {
-                goto done;
-            }
+            PutLE32(&info[40], bV4RedMask);
+            PutLE32(&info[44], bV4GreenMask);
+            PutLE32(&info[48], bV4BlueMask);
+            PutLE32(&info[52], bV4AlphaMask);
+            PutLE32(&info[56], bV4CSType);
             for (i = 0; i < 3 * 3; i++) {
-                if (!SDL_WriteU32LE(dst, bV4Endpoints[i])) {
-                    goto done;
-                }
-            }
-            if (!SDL_WriteU32LE(dst, bV4GammaRed) ||
-                !SDL_WriteU32LE(dst, bV4GammaGreen) ||
-                !SDL_WriteU32LE(dst, bV4GammaBlue)) {
-                goto done;
+                PutLE32(&info[60 + i * 4], (Uint32)bV4Endpoints[i]);
             }
+            PutLE32(&info[96], bV4GammaRed);
+            PutLE32(&info[100], bV4GammaGreen);
+            PutLE32(&info[104], bV4GammaBlue);
+        }
+        if (SDL_WriteIO(dst, header, 14 + biSize) != 14 + biSize) {
+            goto done;
         }
 
         /* Write the palette (in BGR color order) */
-        if (intermediate_surface->format->palette) {
-            SDL_Color *colors;
-            int ncolors;
+        if (ncolors > 0) {
+            const SDL_Color *colors = intermediate_surface->format->palette->colors;
+            Uint8 entries[256 * 4];
+            Uint8 *entry = entries;
 
-            colors = intermediate_surface->format->palette->colors;
-            ncolors = intermediate_surface->format->palette->ncolors;
+            SDL_assert(ncolors <= 256);
             for (i = 0; i < ncolors; ++i) {
-                if (!SDL_WriteU8(dst, colors[i].b) ||
-                    !SDL_WriteU8(dst, colors[i].g) ||
-                    !SDL_WriteU8(dst, colors[i].r) ||
-                    !SDL_WriteU8(dst, colors[i].a)) {
-                    goto done;
-                }
+                entry[0] = colors[i].b;
+                entry[1] = colors[i].g;
+                entry[2] = colors[i].r;
+                entry[3] = colors[i].a;
+                entry += 4;
+            }
+            if (SDL_WriteIO(dst, entries, ncolors * 4) != (size_t)ncolors * 4) {
+                goto done;
             }
         }
 
-        /* Write the bitmap offset */
-        bfOffBits = (Uint32)(SDL_TellIO(dst) - fp_offset);
-        if (SDL_SeekIO(dst, fp_offset + 10, SDL_IO_SEEK_SET) < 0) {
-            goto done;
-        }
-        if (!SDL_WriteU32LE(dst, bfOffBits)) {
-            goto done;
-        }
-        if (SDL_SeekIO(dst, fp_offset + bfOffBits, SDL_IO_SEEK_SET) < 0) {
-            goto done;
-        }
-
-        /* Write the bitmap image upside down */
-        bits = (Uint8 *)intermediate_surface->pixels + (intermediate_surface->h * intermediate_surface->pitch);
-        pad = ((bw % 4) ? (4 - (bw % 4)) : 0);
-        while (bits > (Uint8 *)intermediate_surface->pixels) {
-            bits -= intermediate_surface->pitch;
-            if (SDL_WriteIO(dst, bits, bw) != bw) {
+        /* Write the bitmap image upside down, a chunk of padded rows at a time */
+        rows_per_chunk = SDL_max(BMP_SAVE_CHUNK_SIZE / stride, 1);
+        rows_per_chunk = SDL_min(rows_per_chunk, (size_t)intermediate_surface->h);
+        if (rows_per_chunk > 0) {
+            chunk = (Uint8 *)SDL_calloc(rows_per_chunk, stride);
+            if (!chunk) {
                 goto done;
             }
-            if (pad) {
-                const Uint8 padbyte = 0;
-                for (i = 0; i < pad; ++i) {
-                    if (!SDL_WriteU8(dst, padbyte)) {
-                        goto done;
-                    }
-                }
-            }
         }
+        y = intermediate_surface->h;
+        while (y > 0) {
+            size_t rows = SDL_min(rows_per_chunk, (size_t)y);
+            Uint8 *row = chunk;
 
-        /* Write the BMP file size */
-        new_offset = SDL_TellIO(dst);
-        if (new_offset < 0) {
-            goto done;
-        }
-        bfSize = (Uint32)(new_offset - fp_offset);
-        if (SDL_SeekIO(dst, fp_offset + 2, SDL_IO_SEEK_SET) < 0) {
-            goto done;
-        }
-        if (!SDL_WriteU32LE(dst, bfSize)) {
-            goto done;
-        }
-        if (SDL_SeekIO(dst, fp_offset + bfSize, SDL_IO_SEEK_SET) < 0) {
-            goto done;
+            while (rows--) {
+                --y;
+                bits = (Uint8 *)intermediate_surface->pixels + y * intermediate_surface->pitch;
+                SDL_memcpy(row, bits, bw);
+                row += stride;
+            }
+            if (SDL_WriteIO(dst, chunk, row - chunk) != (size_t)(row - chunk)) {
+                goto done;
+            }
         }
 
         /* Close it up.. */
@@ -853,6 +969,7 @@ int SDL_SaveBMP_IO(SDL_Surface *surface, SDL_IOStream *dst, SDL_bool closeio)
     }
 
 done:
+    SDL_free(chunk);
     if (intermediate_surface && intermediate_surface != surface) {
         SDL_DestroySurface(intermediate_surface);
     }
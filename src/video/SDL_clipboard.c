@@ -197,6 +197,33 @@ void *SDL_GetClipboardData(const char *mime_type, size_t *size)
     }
 }
 
+int SDL_RequestClipboardData(const char *mime_type, SDL_ClipboardRequestCallback callback, void *userdata)
+{
+    SDL_VideoDevice *_this = SDL_GetVideoDevice();
+    void *data;
+    size_t size = 0;
+
+    if (!_this) {
+        return SDL_SetError("Video subsystem must be initialized to get clipboard data");
+    }
+
+    if (!mime_type) {
+        return SDL_InvalidParamError("mime_type");
+    }
+    if (!callback) {
+        return SDL_InvalidParamError("callback");
+    }
+
+    if (_this->RequestClipboardData) {
+        return _this->RequestClipboardData(_this, mime_type, callback, userdata);
+    }
+
+    data = SDL_GetClipboardData(mime_type, &size);
+    callback(userdata, mime_type, data, size);
+    SDL_free(data);
+    return 0;
+}
+
 SDL_bool SDL_HasInternalClipboardData(SDL_VideoDevice *_this, const char *mime_type)
 {
     size_t i;
@@ -1155,6 +1155,108 @@ void SDL_DitherColors(SDL_Color *colors, int bpp)
     }
 }
 
+/* The SIMD searches below look at four palette entries at a time, keeping
+ * the closest entry seen in each lane. The lanes are combined at the end so
+ * ties go to the lowest index, just like the scalar search.
+ *
+ * They return the number of entries they handled, and the scalar loop takes
+ * care of whatever is left over.
+ */
+static void FindColorReduce(const Sint32 *distances, const Sint32 *indices, unsigned int *smallest, Uint8 *pixel)
+{
+    int i, best = 0;
+
+    for (i = 1; i < 4; ++i) {
+        if (distances[i] < distances[best] ||
+            (distances[i] == distances[best] && indices[i] < indices[best])) {
+            best = i;
+        }
+    }
+    *smallest = (unsigned int)distances[best];
+    *pixel = (Uint8)indices[best];
+}
+
+#ifdef SDL_SSE2_INTRINSICS
+static int SDL_TARGETING("sse2") FindColor_SSE2(const SDL_Color *colors, int ncolors, Uint8 r, Uint8 g, Uint8 b, Uint8 a, unsigned int *smallest, Uint8 *pixel)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i target = _mm_setr_epi16(r, g, b, a, r, g, b, a);
+    const __m128i four = _mm_set1_epi32(4);
+    __m128i index = _mm_setr_epi32(0, 1, 2, 3);
+    __m128i best = _mm_set1_epi32(SDL_MAX_SINT32);
+    __m128i best_index = zero;
+    Sint32 distances[4];
+    Sint32 indices[4];
+    int i;
+
+    for (i = 0; i + 4 <= ncolors; i += 4) {
+        const __m128i px = _mm_loadu_si128((const __m128i *)&colors[i]);
+        const __m128i lo = _mm_sub_epi16(_mm_unpacklo_epi8(px, zero), target);
+        const __m128i hi = _mm_sub_epi16(_mm_unpackhi_epi8(px, zero), target);
+        /* r*r+g*g and b*b+a*a for each entry, then added per entry */
+        const __m128 sqlo = _mm_castsi128_ps(_mm_madd_epi16(lo, lo));
+        const __m128 sqhi = _mm_castsi128_ps(_mm_madd_epi16(hi, hi));
+        const __m128i distance = _mm_add_epi32(_mm_castps_si128(_mm_shuffle_ps(sqlo, sqhi, _MM_SHUFFLE(2, 0, 2, 0))),
+                                               _mm_castps_si128(_mm_shuffle_ps(sqlo, sqhi, _MM_SHUFFLE(3, 1, 3, 1))));
+        const __m128i closer = _mm_cmplt_epi32(distance, best);
+
+        best = _mm_or_si128(_mm_and_si128(closer, distance), _mm_andnot_si128(closer, best));
+        best_index = _mm_or_si128(_mm_and_si128(closer, index), _mm_andnot_si128(closer, best_index));
+        index = _mm_add_epi32(index, four);
+    }
+
+    if (i > 0) {
+        _mm_storeu_si128((__m128i *)distances, best);
+        _mm_storeu_si128((__m128i *)indices, best_index);
+        FindColorReduce(distances, indices, smallest, pixel);
+    }
+    return i;
+}
+#endif /* SDL_SSE2_INTRINSICS */
+
+#ifdef SDL_NEON_INTRINSICS
+static int FindColor_NEON(const SDL_Color *colors, int ncolors, Uint8 r, Uint8 g, Uint8 b, Uint8 a, unsigned int *smallest, Uint8 *pixel)
+{
+    const Uint8 target_values[8] = { r, g, b, a, r, g, b, a };
+    const Sint32 index_values[4] = { 0, 1, 2, 3 };
+    const uint8x8_t target = vld1_u8(target_values);
+    const int32x4_t four = vdupq_n_s32(4);
+    int32x4_t index = vld1q_s32(index_values);
+    int32x4_t best = vdupq_n_s32(SDL_MAX_SINT32);
+    int32x4_t best_index = vdupq_n_s32(0);
+    Sint32 distances[4];
+    Sint32 indices[4];
+    int i;
+
+    for (i = 0; i + 4 <= ncolors; i += 4) {
+        const uint8x16_t px = vld1q_u8((const Uint8 *)&colors[i]);
+        const int16x8_t lo = vreinterpretq_s16_u16(vsubl_u8(vget_low_u8(px), target));
+        const int16x8_t hi = vreinterpretq_s16_u16(vsubl_u8(vget_high_u8(px), target));
+        const int32x4_t sq0 = vmull_s16(vget_low_s16(lo), vget_low_s16(lo));
+        const int32x4_t sq1 = vmull_s16(vget_high_s16(lo), vget_high_s16(lo));
+        const int32x4_t sq2 = vmull_s16(vget_low_s16(hi), vget_low_s16(hi));
+        const int32x4_t sq3 = vmull_s16(vget_high_s16(hi), vget_high_s16(hi));
+        const int32x2_t d01 = vpadd_s32(vpadd_s32(vget_low_s32(sq0), vget_high_s32(sq0)),
+                                        vpadd_s32(vget_low_s32(sq1), vget_high_s32(sq1)));
+        const int32x2_t d23 = vpadd_s32(vpadd_s32(vget_low_s32(sq2), vget_high_s32(sq2)),
+                                        vpadd_s32(vget_low_s32(sq3), vget_high_s32(sq3)));
+        const int32x4_t distance = vcombine_s32(d01, d23);
+        const uint32x4_t closer = vcltq_s32(distance, best);
+
+        best = vbslq_s32(closer, distance, best);
+        best_index = vbslq_s32(closer, index, best_index);
+        index = vaddq_s32(index, four);
+    }
+
+    if (i > 0) {
+        vst1q_s32(distances, best);
+        vst1q_s32(indices, best_index);
+        FindColorReduce(distances, indices, smallest, pixel);
+    }
+    return i;
+}
+#endif /* SDL_NEON_INTRINSICS */
+
 /*
  * Match an RGB value to a particular palette index
  */
@@ -1164,11 +1266,26 @@ Uint8 SDL_FindColor(SDL_Palette *pal, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
     unsigned int smallest;
     unsigned int distance;
     int rd, gd, bd, ad;
-    int i;
+    int i = 0;
     Uint8 pixel = 0;
 
     smallest = ~0U;
-    for (i = 0; i < pal->ncolors; ++i) {
+
+#ifdef SDL_SSE2_INTRINSICS
+    if (SDL_HasSSE2()) {
+        i = FindColor_SSE2(pal->colors, pal->ncolors, r, g, b, a, &smallest, &pixel);
+    }
+#endif
+#ifdef SDL_NEON_INTRINSICS
+    if (i == 0 && SDL_HasNEON()) {
+        i = FindColor_NEON(pal->colors, pal->ncolors, r, g, b, a, &smallest, &pixel);
+    }
+#endif
+    if (smallest == 0) { /* Perfect match! */
+        return pixel;
+    }
+
+    for (; i < pal->ncolors; ++i) {
         rd = pal->colors[i].r - r;
         gd = pal->colors[i].g - g;
         bd = pal->colors[i].b - b;
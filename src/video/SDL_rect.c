@@ -110,3 +110,217 @@ SDL_bool SDL_GetSpanEnclosingRect(int width, int height,
 #define SDL_ENCLOSEPOINTS        SDL_GetRectEnclosingPointsFloat
 #define SDL_INTERSECTRECTANDLINE SDL_GetRectAndLineIntersectionFloat
 #include "SDL_rect_impl.h"
+
+/* Batch operations used by the renderer.
+ *
+ * Each SIMD kernel returns the number of elements it handled, and the scalar
+ * loops take care of whatever is left over.
+ */
+
+#ifdef SDL_SSE_INTRINSICS
+static int SDL_TARGETING("sse") ScaleFRects_SSE(const SDL_FRect *rects, int count, float scale_x, float scale_y, SDL_FRect *result)
+{
+    const __m128 scale = _mm_setr_ps(scale_x, scale_y, scale_x, scale_y);
+    int i;
+
+    for (i = 0; i < count; ++i) {
+        _mm_storeu_ps(&result[i].x, _mm_mul_ps(_mm_loadu_ps(&rects[i].x), scale));
+    }
+    return i;
+}
+
+static int SDL_TARGETING("sse") ScaleFPointsToFRects_SSE(const SDL_FPoint *points, int count, float scale_x, float scale_y, SDL_FRect *result)
+{
+    const __m128 scale = _mm_setr_ps(scale_x, scale_y, scale_x, scale_y);
+    int i;
+
+    for (i = 0; i + 2 <= count; i += 2) {
+        const __m128 xy = _mm_mul_ps(_mm_loadu_ps(&points[i].x), scale);
+        _mm_storeu_ps(&result[i].x, _mm_movelh_ps(xy, scale));
+        _mm_storeu_ps(&result[i + 1].x, _mm_movehl_ps(scale, xy));
+    }
+    return i;
+}
+
+static int SDL_TARGETING("sse") GetFRectQuads_SSE(const SDL_FRect *rects, int count, float *xy)
+{
+    int i;
+
+    for (i = 0; i < count; ++i) {
+        const __m128 r = _mm_loadu_ps(&rects[i].x);
+        /* minx, miny, maxx, maxy */
+        const __m128 m = _mm_add_ps(r, _mm_movelh_ps(_mm_setzero_ps(), r));
+        _mm_storeu_ps(&xy[i * 8], _mm_shuffle_ps(m, m, _MM_SHUFFLE(1, 2, 1, 0)));
+        _mm_storeu_ps(&xy[i * 8 + 4], _mm_shuffle_ps(m, m, _MM_SHUFFLE(3, 0, 3, 2)));
+    }
+    return i;
+}
+
+static int SDL_TARGETING("sse") CullFRects_SSE(SDL_FRect *rects, int count, const SDL_FRect *bounds, int *kept)
+{
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 bmin = _mm_setr_ps(bounds->x, bounds->y, 0.0f, 0.0f);
+    const __m128 bmax = _mm_setr_ps(bounds->x + bounds->w, bounds->y + bounds->h, 0.0f, 0.0f);
+    int i, n = 0;
+
+    for (i = 0; i < count; ++i) {
+        const __m128 r = _mm_loadu_ps(&rects[i].x);
+        const __m128 rmax = _mm_add_ps(r, _mm_movehl_ps(r, r));
+        /* x < bmaxx, y < bmaxy, bminx < x + w, bminy < y + h */
+        const __m128 a = _mm_movelh_ps(r, bmin);
+        const __m128 b = _mm_movelh_ps(bmax, rmax);
+
+        if ((_mm_movemask_ps(_mm_cmple_ps(r, zero)) & 0xC) || _mm_movemask_ps(_mm_cmplt_ps(a, b)) == 0xF) {
+            _mm_storeu_ps(&rects[n++].x, r);
+        }
+    }
+    *kept = n;
+    return i;
+}
+#endif /* SDL_SSE_INTRINSICS */
+
+#ifdef SDL_NEON_INTRINSICS
+static int ScaleFRects_NEON(const SDL_FRect *rects, int count, float scale_x, float scale_y, SDL_FRect *result)
+{
+    const float32x4_t scale = { scale_x, scale_y, scale_x, scale_y };
+    int i;
+
+    for (i = 0; i < count; ++i) {
+        vst1q_f32(&result[i].x, vmulq_f32(vld1q_f32(&rects[i].x), scale));
+    }
+    return i;
+}
+
+static int ScaleFPointsToFRects_NEON(const SDL_FPoint *points, int count, float scale_x, float scale_y, SDL_FRect *result)
+{
+    const float32x2_t scale = { scale_x, scale_y };
+    int i;
+
+    for (i = 0; i < count; ++i) {
+        vst1q_f32(&result[i].x, vcombine_f32(vmul_f32(vld1_f32(&points[i].x), scale), scale));
+    }
+    return i;
+}
+
+static int GetFRectQuads_NEON(const SDL_FRect *rects, int count, float *xy)
+{
+    int i;
+
+    for (i = 0; i < count; ++i) {
+        const float32x4_t r = vld1q_f32(&rects[i].x);
+        const float32x2_t min = vget_low_f32(r);
+        const float32x2_t max = vadd_f32(min, vget_high_f32(r));
+        /* minx, miny, maxx, miny, maxx, maxy, minx, maxy */
+        const float32x2_t maxx_miny = vset_lane_f32(vget_lane_f32(min, 1), max, 1);
+        const float32x2_t minx_maxy = vset_lane_f32(vget_lane_f32(min, 0), max, 0);
+        vst1q_f32(&xy[i * 8], vcombine_f32(min, maxx_miny));
+        vst1q_f32(&xy[i * 8 + 4], vcombine_f32(max, minx_maxy));
+    }
+    return i;
+}
+#endif /* SDL_NEON_INTRINSICS */
+
+void SDL_ScaleFRects(const SDL_FRect *rects, int count, float scale_x, float scale_y, SDL_FRect *result)
+{
+    int i = 0;
+
+#ifdef SDL_SSE_INTRINSICS
+    if (SDL_HasSSE()) {
+        i = ScaleFRects_SSE(rects, count, scale_x, scale_y, result);
+    }
+#endif
+#ifdef SDL_NEON_INTRINSICS
+    if (i == 0 && SDL_HasNEON()) {
+        i = ScaleFRects_NEON(rects, count, scale_x, scale_y, result);
+    }
+#endif
+
+    for (; i < count; ++i) {
+        result[i].x = rects[i].x * scale_x;
+        result[i].y = rects[i].y * scale_y;
+        result[i].w = rects[i].w * scale_x;
+        result[i].h = rects[i].h * scale_y;
+    }
+}
+
+void SDL_ScaleFPointsToFRects(const SDL_FPoint *points, int count, float scale_x, float scale_y, SDL_FRect *result)
+{
+    int i = 0;
+
+#ifdef SDL_SSE_INTRINSICS
+    if (SDL_HasSSE()) {
+        i = ScaleFPointsToFRects_SSE(points, count, scale_x, scale_y, result);
+    }
+#endif
+#ifdef SDL_NEON_INTRINSICS
+    if (i == 0 && SDL_HasNEON()) {
+        i = ScaleFPointsToFRects_NEON(points, count, scale_x, scale_y, result);
+    }
+#endif
+
+    for (; i < count; ++i) {
+        result[i].x = points[i].x * scale_x;
+        result[i].y = points[i].y * scale_y;
+        result[i].w = scale_x;
+        result[i].h = scale_y;
+    }
+}
+
+/* Write the four corners of each rect, clockwise from the top left, as x,y pairs */
+void SDL_GetFRectQuads(const SDL_FRect *rects, int count, float *xy)
+{
+    int i = 0;
+
+#ifdef SDL_SSE_INTRINSICS
+    if (SDL_HasSSE()) {
+        i = GetFRectQuads_SSE(rects, count, xy);
+    }
+#endif
+#ifdef SDL_NEON_INTRINSICS
+    if (i == 0 && SDL_HasNEON()) {
+        i = GetFRectQuads_NEON(rects, count, xy);
+    }
+#endif
+
+    for (; i < count; ++i) {
+        const float minx = rects[i].x;
+        const float miny = rects[i].y;
+        const float maxx = rects[i].x + rects[i].w;
+        const float maxy = rects[i].y + rects[i].h;
+        float *ptr_xy = &xy[i * 8];
+
+        *ptr_xy++ = minx;
+        *ptr_xy++ = miny;
+        *ptr_xy++ = maxx;
+        *ptr_xy++ = miny;
+        *ptr_xy++ = maxx;
+        *ptr_xy++ = maxy;
+        *ptr_xy++ = minx;
+        *ptr_xy++ = maxy;
+    }
+}
+
+/* Remove the rects that don't overlap bounds, keeping the rest in order, and return how many are left.
+   Rects with no area are always kept, since they may still be drawn as a minimum size rect. */
+int SDL_CullFRects(SDL_FRect *rects, int count, const SDL_FRect *bounds)
+{
+    const float bmaxx = bounds->x + bounds->w;
+    const float bmaxy = bounds->y + bounds->h;
+    int i = 0, n = 0;
+
+#ifdef SDL_SSE_INTRINSICS
+    if (SDL_HasSSE()) {
+        i = CullFRects_SSE(rects, count, bounds, &n);
+    }
+#endif
+
+    for (; i < count; ++i) {
+        const SDL_FRect *r = &rects[i];
+
+        if (r->w <= 0.0f || r->h <= 0.0f ||
+            (r->x < bmaxx && r->y < bmaxy && bounds->x < r->x + r->w && bounds->y < r->y + r->h)) {
+            rects[n++] = *r;
+        }
+    }
+    return n;
+}
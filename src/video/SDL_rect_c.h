@@ -26,4 +26,11 @@
 
 extern SDL_bool SDL_GetSpanEnclosingRect(int width, int height, int numrects, const SDL_Rect *rects, SDL_Rect *span);
 
+/* Batch operations on arrays of rects and points, for queueing many primitives at once.
+   These use SIMD when available and give exactly the same results as the scalar code. */
+extern void SDL_ScaleFRects(const SDL_FRect *rects, int count, float scale_x, float scale_y, SDL_FRect *result);
+extern void SDL_ScaleFPointsToFRects(const SDL_FPoint *points, int count, float scale_x, float scale_y, SDL_FRect *result);
+extern void SDL_GetFRectQuads(const SDL_FRect *rects, int count, float *xy);
+extern int SDL_CullFRects(SDL_FRect *rects, int count, const SDL_FRect *bounds);
+
 #endif /* SDL_rect_c_h_ */
@@ -26,6 +26,7 @@
 #include "SDL_RLEaccel_c.h"
 #include "SDL_pixels_c.h"
 #include "SDL_yuv_c.h"
+#include "../SDL_trace_c.h"
 #include "../render/SDL_sysrender.h"
 #include "../video/SDL_pixels_c.h"
 #include "../video/SDL_yuv_c.h"
@@ -701,6 +702,54 @@ int SDL_GetSurfaceBlendMode(SDL_Surface *surface, SDL_BlendMode *blendMode)
     return 0;
 }
 
+int SDL_SetSurfaceDitherMode(SDL_Surface *surface, SDL_DitherMode ditherMode)
+{
+    SDL_DitherMode current = SDL_DITHER_NONE;
+    int status;
+
+    if (!surface) {
+        return SDL_InvalidParamError("surface");
+    }
+
+    switch (ditherMode) {
+    case SDL_DITHER_NONE:
+    case SDL_DITHER_ORDERED:
+    case SDL_DITHER_DIFFUSION:
+        break;
+    default:
+        return SDL_Unsupported();
+    }
+
+    SDL_GetSurfaceDitherMode(surface, &current);
+    if (ditherMode == current) {
+        return 0;
+    }
+
+    status = SDL_SetNumberProperty(SDL_GetSurfaceProperties(surface), SDL_PROP_SURFACE_DITHER_MODE_NUMBER, ditherMode);
+    if (status == 0) {
+        SDL_InvalidateMap(surface->map);
+    }
+    return status;
+}
+
+int SDL_GetSurfaceDitherMode(SDL_Surface *surface, SDL_DitherMode *ditherMode)
+{
+    SDL_DitherMode surface_dither = SDL_DITHER_NONE;
+
+    if (!surface) {
+        return SDL_InvalidParamError("surface");
+    }
+
+    if (surface->flags & SDL_SURFACE_USES_PROPERTIES) {
+        surface_dither = (SDL_DitherMode)SDL_GetNumberProperty(SDL_GetSurfaceProperties(surface), SDL_PROP_SURFACE_DITHER_MODE_NUMBER, SDL_DITHER_NONE);
+    }
+
+    if (ditherMode) {
+        *ditherMode = surface_dither;
+    }
+    return 0;
+}
+
 SDL_bool SDL_SetSurfaceClipRect(SDL_Surface *surface, const SDL_Rect *rect)
 {
     SDL_Rect full_rect;
@@ -750,6 +799,8 @@ int SDL_GetSurfaceClipRect(SDL_Surface *surface, SDL_Rect *rect)
 int SDL_BlitSurfaceUnchecked(SDL_Surface *src, const SDL_Rect *srcrect,
                              SDL_Surface *dst, const SDL_Rect *dstrect)
 {
+    int retval;
+
     /* Check to make sure the blit mapping is valid */
     if ((src->map->dst != dst) ||
         (dst->format->palette &&
@@ -765,7 +816,11 @@ int SDL_BlitSurfaceUnchecked(SDL_Surface *src, const SDL_Rect *srcrect,
         /*              src, dst->flags, src->map->info.flags, dst, dst->flags, */
         /*              dst->map->info.flags, src->map->blit); */
     }
-    return src->map->blit(src, srcrect, dst, dstrect);
+
+    SDL_TRACE_ZONE_BEGIN("SDL_BlitSurface");
+    retval = src->map->blit(src, srcrect, dst, dstrect);
+    SDL_TRACE_ZONE_END("SDL_BlitSurface");
+    return retval;
 }
 
 int SDL_BlitSurface(SDL_Surface *src, const SDL_Rect *srcrect,
@@ -1207,10 +1262,68 @@ static int SDL_FlipSurfaceHorizontal(SDL_Surface *surface)
     return 0;
 }
 
+#ifdef SDL_SSE2_INTRINSICS
+static int SDL_TARGETING("sse2") SwapRows_SSE2(Uint8 *a, Uint8 *b, int len)
+{
+    int i;
+
+    for (i = 0; i + 16 <= len; i += 16) {
+        const __m128i va = _mm_loadu_si128((const __m128i *)(a + i));
+        const __m128i vb = _mm_loadu_si128((const __m128i *)(b + i));
+        _mm_storeu_si128((__m128i *)(a + i), vb);
+        _mm_storeu_si128((__m128i *)(b + i), va);
+    }
+    return i;
+}
+#endif
+
+#ifdef SDL_NEON_INTRINSICS
+static int SwapRows_NEON(Uint8 *a, Uint8 *b, int len)
+{
+    int i;
+
+    for (i = 0; i + 16 <= len; i += 16) {
+        const uint8x16_t va = vld1q_u8(a + i);
+        const uint8x16_t vb = vld1q_u8(b + i);
+        vst1q_u8(a + i, vb);
+        vst1q_u8(b + i, va);
+    }
+    return i;
+}
+#endif
+
+/* Exchange two rows in place, without going through a temporary row */
+static void SwapRows(Uint8 *a, Uint8 *b, int len)
+{
+    int i = 0;
+
+#ifdef SDL_SSE2_INTRINSICS
+    if (SDL_HasSSE2()) {
+        i = SwapRows_SSE2(a, b, len);
+    }
+#endif
+#ifdef SDL_NEON_INTRINSICS
+    if (i == 0 && SDL_HasNEON()) {
+        i = SwapRows_NEON(a, b, len);
+    }
+#endif
+    for (; i + 4 <= len; i += 4) {
+        Uint32 va, vb;
+        SDL_memcpy(&va, a + i, 4);
+        SDL_memcpy(&vb, b + i, 4);
+        SDL_memcpy(a + i, &vb, 4);
+        SDL_memcpy(b + i, &va, 4);
+    }
+    for (; i < len; ++i) {
+        const Uint8 tmp = a[i];
+        a[i] = b[i];
+        b[i] = tmp;
+    }
+}
+
 static int SDL_FlipSurfaceVertical(SDL_Surface *surface)
 {
-    SDL_bool isstack;
-    Uint8 *a, *b, *tmp;
+    Uint8 *a, *b;
     int i;
 
     if (surface->h <= 1) {
@@ -1219,15 +1332,11 @@ static int SDL_FlipSurfaceVertical(SDL_Surface *surface)
 
     a = (Uint8 *)surface->pixels;
     b = a + (surface->h - 1) * surface->pitch;
-    tmp = SDL_small_alloc(Uint8, surface->pitch, &isstack);
     for (i = surface->h / 2; i--; ) {
-        SDL_memcpy(tmp, a, surface->pitch);
-        SDL_memcpy(a, b, surface->pitch);
-        SDL_memcpy(b, tmp, surface->pitch);
+        SwapRows(a, b, surface->pitch);
         a += surface->pitch;
         b -= surface->pitch;
     }
-    SDL_small_free(tmp, isstack);
     return 0;
 }
 
@@ -100,6 +100,13 @@ struct SDL_Window
 
     SDL_PropertiesID props;
 
+    /* Internal associations that are used every frame, kept here instead of
+       in props so they don't cost a locked string lookup each time. */
+    SDL_Renderer *renderer;                       /* The renderer created for this window */
+    struct SDL_WindowTextureData *texture_data;   /* Framebuffer emulation using a renderer */
+    SDL_Surface *framebuffer;                     /* Framebuffer kept in memory by the video driver */
+    SDL_Surface *shape;                           /* Mirrored in SDL_PROP_WINDOW_SHAPE_POINTER */
+
     SDL_WindowData *driverdata;
 
     SDL_Window *prev;
@@ -332,6 +339,7 @@ struct SDL_VideoDevice
     int (*SetClipboardData)(SDL_VideoDevice *_this);
     void *(*GetClipboardData)(SDL_VideoDevice *_this, const char *mime_type, size_t *size);
     SDL_bool (*HasClipboardData)(SDL_VideoDevice *_this, const char *mime_type);
+    int (*RequestClipboardData)(SDL_VideoDevice *_this, const char *mime_type, SDL_ClipboardRequestCallback callback, void *userdata);
     /* If you implement *ClipboardData, you don't need to implement *ClipboardText */
     int (*SetClipboardText)(SDL_VideoDevice *_this, const char *text);
     char *(*GetClipboardText)(SDL_VideoDevice *_this);
@@ -32,6 +32,7 @@
 #include "../events/SDL_events_c.h"
 #include "../SDL_hints_c.h"
 #include "../SDL_properties_c.h"
+#include "../SDL_trace_c.h"
 #include "../timer/SDL_timer_c.h"
 #include "../camera/SDL_camera_c.h"
 #include "../render/SDL_sysrender.h"
@@ -239,9 +240,7 @@ static void SDL_SetWindowParent(SDL_Window *window, SDL_Window *parent)
 
 /* Support for framebuffer emulation using an accelerated renderer */
 
-#define SDL_PROP_WINDOW_TEXTUREDATA_POINTER "SDL.internal.window.texturedata"
-
-typedef struct
+typedef struct SDL_WindowTextureData
 {
     SDL_Renderer *renderer;
     SDL_Texture *texture;
@@ -265,10 +264,11 @@ static Uint32 SDL_DefaultGraphicsBackends(SDL_VideoDevice *_this)
     return 0;
 }
 
-static void SDLCALL SDL_CleanupWindowTextureData(void *userdata, void *value)
+static void SDL_CleanupWindowTextureData(SDL_WindowTextureData *data)
 {
-    SDL_WindowTextureData *data = (SDL_WindowTextureData *)value;
-
+    if (!data) {
+        return;
+    }
     if (data->texture) {
         SDL_DestroyTexture(data->texture);
     }
@@ -282,8 +282,7 @@ static void SDLCALL SDL_CleanupWindowTextureData(void *userdata, void *value)
 static int SDL_CreateWindowTexture(SDL_VideoDevice *_this, SDL_Window *window, SDL_PixelFormatEnum *format, void **pixels, int *pitch)
 {
     SDL_RendererInfo info;
-    SDL_PropertiesID props = SDL_GetWindowProperties(window);
-    SDL_WindowTextureData *data = (SDL_WindowTextureData *)SDL_GetProperty(props, SDL_PROP_WINDOW_TEXTUREDATA_POINTER, NULL);
+    SDL_WindowTextureData *data = window->texture_data;
     const SDL_bool transparent = (window->flags & SDL_WINDOW_TRANSPARENT) ? SDL_TRUE : SDL_FALSE;
     int i;
     int w, h;
@@ -331,10 +330,7 @@ static int SDL_CreateWindowTexture(SDL_VideoDevice *_this, SDL_Window *window, S
             SDL_DestroyRenderer(renderer);
             return -1;
         }
-        if (SDL_SetPropertyWithCleanup(props, SDL_PROP_WINDOW_TEXTUREDATA_POINTER, data, SDL_CleanupWindowTextureData, NULL) < 0) {
-            SDL_DestroyRenderer(renderer);
-            return -1;
-        }
+        window->texture_data = data;
 
         data->renderer = renderer;
     }
@@ -369,7 +365,7 @@ static int SDL_CreateWindowTexture(SDL_VideoDevice *_this, SDL_Window *window, S
                                       SDL_TEXTUREACCESS_STREAMING,
                                       w, h);
     if (!data->texture) {
-        /* codechecker_false_positive [Malloc] Static analyzer doesn't realize allocated `data` is saved to SDL_PROP_WINDOW_TEXTUREDATA_POINTER and not leaked here. */
+        /* codechecker_false_positive [Malloc] Static analyzer doesn't realize allocated `data` is saved to window->texture_data and not leaked here. */
         return -1; /* NOLINT(clang-analyzer-unix.Malloc) */
     }
 
@@ -407,7 +403,7 @@ static int SDL_UpdateWindowTexture(SDL_VideoDevice *unused, SDL_Window *window,
 
     SDL_GetWindowSizeInPixels(window, &w, &h);
 
-    data = (SDL_WindowTextureData *)SDL_GetProperty(SDL_GetWindowProperties(window), SDL_PROP_WINDOW_TEXTUREDATA_POINTER, NULL);
+    data = window->texture_data;
     if (!data || !data->texture) {
         return SDL_SetError("No window texture data");
     }
@@ -432,14 +428,20 @@ static int SDL_UpdateWindowTexture(SDL_VideoDevice *unused, SDL_Window *window,
 
 static void SDL_DestroyWindowTexture(SDL_VideoDevice *unused, SDL_Window *window)
 {
-    SDL_ClearProperty(SDL_GetWindowProperties(window), SDL_PROP_WINDOW_TEXTUREDATA_POINTER);
+    SDL_WindowTextureData *data = window->texture_data;
+
+    window->texture_data = NULL;
+    SDL_CleanupWindowTextureData(data);
 }
 
 int SDL_SetWindowTextureVSync(SDL_Window *window, int vsync)
 {
     SDL_WindowTextureData *data;
 
-    data = (SDL_WindowTextureData *)SDL_GetProperty(SDL_GetWindowProperties(window), SDL_PROP_WINDOW_TEXTUREDATA_POINTER, NULL);
+    if (!window) {
+        return -1;
+    }
+    data = window->texture_data;
     if (!data) {
         return -1;
     }
@@ -503,6 +505,7 @@ int SDL_VideoInit(const char *driver_name)
     SDL_bool init_mouse = SDL_FALSE;
     SDL_bool init_touch = SDL_FALSE;
     int i = 0;
+    Uint64 start;
 
     /* Check to make sure we don't overwrite '_this' */
     if (_this) {
@@ -544,7 +547,9 @@ int SDL_VideoInit(const char *driver_name)
             for (i = 0; bootstrap[i]; ++i) {
                 if ((driver_attempt_len == SDL_strlen(bootstrap[i]->name)) &&
                     (SDL_strncasecmp(bootstrap[i]->name, driver_attempt, driver_attempt_len) == 0)) {
+                    start = SDL_BeginStartupTrace();
                     video = bootstrap[i]->create();
+                    SDL_EndStartupTrace(start, "video", bootstrap[i]->name, video != NULL);
                     break;
                 }
             }
@@ -553,7 +558,9 @@ int SDL_VideoInit(const char *driver_name)
         }
     } else {
         for (i = 0; bootstrap[i]; ++i) {
+            start = SDL_BeginStartupTrace();
             video = bootstrap[i]->create();
+            SDL_EndStartupTrace(start, "video", bootstrap[i]->name, video != NULL);
             if (video) {
                 break;
             }
@@ -583,10 +590,13 @@ int SDL_VideoInit(const char *driver_name)
     _this->current_glctx_tls = SDL_CreateTLS();
 
     /* Initialize the video subsystem */
+    start = SDL_BeginStartupTrace();
     if (_this->VideoInit(_this) < 0) {
+        SDL_EndStartupTrace(start, "video", "VideoInit", SDL_FALSE);
         SDL_VideoQuit();
         return -1;
     }
+    SDL_EndStartupTrace(start, "video", "VideoInit", SDL_TRUE);
 
     /* Make sure some displays were added */
     if (_this->num_displays == 0) {
@@ -2533,6 +2543,27 @@ SDL_Window *SDL_GetWindowParent(SDL_Window *window)
     return window->parent;
 }
 
+SDL_Renderer *SDL_GetWindowRenderer(SDL_Window *window)
+{
+    CHECK_WINDOW_MAGIC(window, NULL);
+
+    return window->renderer;
+}
+
+void SDL_SetWindowRenderer(SDL_Window *window, SDL_Renderer *renderer)
+{
+    CHECK_WINDOW_MAGIC(window,);
+
+    window->renderer = renderer;
+}
+
+SDL_Surface *SDL_GetWindowShape(SDL_Window *window)
+{
+    CHECK_WINDOW_MAGIC(window, NULL);
+
+    return window->shape;
+}
+
 SDL_PropertiesID SDL_GetWindowProperties(SDL_Window *window)
 {
     CHECK_WINDOW_MAGIC(window, 0);
@@ -3621,7 +3652,7 @@ void SDL_OnWindowResized(SDL_Window *window)
     SDL_CheckWindowPixelSizeChanged(window);
 
     if ((window->flags & SDL_WINDOW_TRANSPARENT) && _this->UpdateWindowShape) {
-        SDL_Surface *surface = (SDL_Surface *)SDL_GetProperty(window->props, SDL_PROP_WINDOW_SHAPE_POINTER, NULL);
+        SDL_Surface *surface = window->shape;
         if (surface) {
             _this->UpdateWindowShape(_this, window, surface);
         }
@@ -3778,7 +3809,10 @@ void SDL_DestroyWindow(SDL_Window *window)
         SDL_HideWindow(window);
     }
 
+    SDL_DestroyWindowTexture(_this, window);
     SDL_DestroyProperties(window->props);
+    SDL_DestroySurface(window->shape);
+    window->shape = NULL;
 
     /* Clear the modal status, but don't unset the parent, as it may be
      * needed later in the destruction process if a backend needs to
@@ -5214,9 +5248,13 @@ int SDL_SetWindowShape(SDL_Window *window, SDL_Surface *shape)
         return -1;
     }
 
-    if (SDL_SetSurfaceProperty(props, SDL_PROP_WINDOW_SHAPE_POINTER, surface) < 0) {
+    /* The window owns the shape, the read-only property only mirrors it */
+    if (SDL_SetProperty(props, SDL_PROP_WINDOW_SHAPE_POINTER, surface) < 0) {
+        SDL_DestroySurface(surface);
         return -1;
     }
+    SDL_DestroySurface(window->shape);
+    window->shape = surface;
 
     if (_this->UpdateWindowShape) {
         if (_this->UpdateWindowShape(_this, window, surface) < 0) {
@@ -57,6 +57,11 @@ extern void SDL_VideoQuit(void);
 
 extern int SDL_SetWindowTextureVSync(SDL_Window *window, int vsync);
 
+/* These are used by the renderer every frame, so they don't go through the window properties */
+extern SDL_Renderer *SDL_GetWindowRenderer(SDL_Window *window);
+extern void SDL_SetWindowRenderer(SDL_Window *window, SDL_Renderer *renderer);
+extern SDL_Surface *SDL_GetWindowShape(SDL_Window *window);
+
 extern int SDL_ReadSurfacePixel(SDL_Surface *surface, int x, int y, Uint8 *r, Uint8 *g, Uint8 *b, Uint8 *a);
 
 #if defined(SDL_VIDEO_DRIVER_X11) || defined(SDL_VIDEO_DRIVER_WAYLAND) || defined(SDL_VIDEO_DRIVER_EMSCRIPTEN)
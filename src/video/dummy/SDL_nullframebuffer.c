@@ -23,12 +23,8 @@
 #ifdef SDL_VIDEO_DRIVER_DUMMY
 
 #include "../SDL_sysvideo.h"
-#include "../../SDL_properties_c.h"
 #include "SDL_nullframebuffer_c.h"
 
-#define DUMMY_SURFACE "SDL.internal.window.surface"
-
-
 int SDL_DUMMY_CreateWindowFramebuffer(SDL_VideoDevice *_this, SDL_Window *window, SDL_PixelFormatEnum *format, void **pixels, int *pitch)
 {
     SDL_Surface *surface;
@@ -43,7 +39,8 @@ int SDL_DUMMY_CreateWindowFramebuffer(SDL_VideoDevice *_this, SDL_Window *window
     }
 
     /* Save the info and return! */
-    SDL_SetSurfaceProperty(SDL_GetWindowProperties(window), DUMMY_SURFACE, surface);
+    SDL_DestroySurface(window->framebuffer);
+    window->framebuffer = surface;
     *format = surface_format;
     *pixels = surface->pixels;
     *pitch = surface->pitch;
@@ -55,7 +52,7 @@ int SDL_DUMMY_UpdateWindowFramebuffer(SDL_VideoDevice *_this, SDL_Window *window
     static int frame_number;
     SDL_Surface *surface;
 
-    surface = (SDL_Surface *)SDL_GetProperty(SDL_GetWindowProperties(window), DUMMY_SURFACE, NULL);
+    surface = window->framebuffer;
     if (!surface) {
         return SDL_SetError("Couldn't find dummy surface for window");
     }
@@ -72,7 +69,8 @@ int SDL_DUMMY_UpdateWindowFramebuffer(SDL_VideoDevice *_this, SDL_Window *window
 
 void SDL_DUMMY_DestroyWindowFramebuffer(SDL_VideoDevice *_this, SDL_Window *window)
 {
-    SDL_ClearProperty(SDL_GetWindowProperties(window), DUMMY_SURFACE);
+    SDL_DestroySurface(window->framebuffer);
+    window->framebuffer = NULL;
 }
 
 #endif /* SDL_VIDEO_DRIVER_DUMMY */
@@ -23,12 +23,8 @@
 #ifdef SDL_VIDEO_DRIVER_OFFSCREEN
 
 #include "../SDL_sysvideo.h"
-#include "../../SDL_properties_c.h"
 #include "SDL_offscreenframebuffer_c.h"
 
-#define OFFSCREEN_SURFACE "SDL.internal.window.surface"
-
-
 int SDL_OFFSCREEN_CreateWindowFramebuffer(SDL_VideoDevice *_this, SDL_Window *window, SDL_PixelFormatEnum *format, void **pixels, int *pitch)
 {
     SDL_Surface *surface;
@@ -43,7 +39,8 @@ int SDL_OFFSCREEN_CreateWindowFramebuffer(SDL_VideoDevice *_this, SDL_Window *wi
     }
 
     /* Save the info and return! */
-    SDL_SetSurfaceProperty(SDL_GetWindowProperties(window), OFFSCREEN_SURFACE, surface);
+    SDL_DestroySurface(window->framebuffer);
+    window->framebuffer = surface;
     *format = surface_format;
     *pixels = surface->pixels;
     *pitch = surface->pitch;
@@ -56,7 +53,7 @@ int SDL_OFFSCREEN_UpdateWindowFramebuffer(SDL_VideoDevice *_this, SDL_Window *wi
     static int frame_number;
     SDL_Surface *surface;
 
-    surface = (SDL_Surface *)SDL_GetProperty(SDL_GetWindowProperties(window), OFFSCREEN_SURFACE, NULL);
+    surface = window->framebuffer;
     if (!surface) {
         return SDL_SetError("Couldn't find offscreen surface for window");
     }
@@ -73,7 +70,8 @@ int SDL_OFFSCREEN_UpdateWindowFramebuffer(SDL_VideoDevice *_this, SDL_Window *wi
 
 void SDL_OFFSCREEN_DestroyWindowFramebuffer(SDL_VideoDevice *_this, SDL_Window *window)
 {
-    SDL_ClearProperty(SDL_GetWindowProperties(window), OFFSCREEN_SURFACE);
+    SDL_DestroySurface(window->framebuffer);
+    window->framebuffer = NULL;
 }
 
 #endif /* SDL_VIDEO_DRIVER_OFFSCREEN */
@@ -517,38 +517,58 @@ __EOF__
     }
     if ( $scale ) {
         print FILE <<__EOF__;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
 __EOF__
+        if ( !$blend ) {
+            print FILE <<__EOF__;
+    Uint64 lasty = ~(Uint64)0;
+__EOF__
+        }
+        print FILE <<__EOF__;
 
-    print FILE <<__EOF__;
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
-    incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2;
 
     while (info->dst_h--) {
-        $format_type{$src} *src = 0;
+        $format_type{$src} *row;
+        $format_type{$src} *src;
         $format_type{$dst} *dst = ($format_type{$dst} *)info->dst;
-        int n = info->dst_w;
-        posx = incx / 2;
+        int x;
 
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = ($format_type{$src} *)(info->src + (srcy * info->src_pitch) + (srcx * $format_size{$src}));
 __EOF__
+        if ( !$blend ) {
+            print FILE <<__EOF__;
+        if (srcy == lasty) {
+            SDL_memcpy(dst, info->dst - info->dst_pitch, info->dst_w * $format_size{$dst});
+            posy += incy;
+            info->dst += info->dst_pitch;
+            continue;
+        }
+        lasty = srcy;
+__EOF__
+        }
         print FILE <<__EOF__;
+        row = ($format_type{$src} *)(info->src + (srcy * info->src_pitch));
+        for (x = 0; x < info->dst_w; ++x) {
+            src = &row[columns[x]];
 __EOF__
         output_copycore($src, $dst, $modulate, $blend, $is_modulateA_done, $A_is_const_FF);
         print FILE <<__EOF__;
-            posx += incx;
             ++dst;
         }
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    SDL_small_free(columns, isstack);
 __EOF__
     } else {
         print FILE <<__EOF__;
@@ -585,7 +605,858 @@ sub output_copyinc
 #include "SDL_blit.h"
 #include "SDL_blit_auto.h"
 
+/* Fills in the source column of each destination pixel in a scaled blit, so
+   the rows only have to look them up instead of stepping through the source */
+static void SDL_GetBlitAutoColumns(const SDL_BlitInfo *info, Uint32 *columns)
+{
+    const Uint64 incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    Uint64 posx = incx / 2;
+    int x;
+
+    for (x = 0; x < info->dst_w; ++x) {
+        columns[x] = (Uint32)(posx >> 16);
+        posx += incx;
+    }
+}
+
+__EOF__
+}
+
+# The SIMD blitters, in order of preference. Each one handles every pair of
+# 8888 formats, shuffling pixels to B, G, R, A byte order and back.
+my @simd_isas = ( "AVX2", "SSE41", "NEON" );
+
+my %simd_guard = (
+    "AVX2" => "SDL_AVX2_INTRINSICS",
+    "SSE41" => "SDL_SSE4_1_INTRINSICS",
+    "NEON" => "SDL_BLIT_AUTO_NEON",
+);
+
+my %simd_cpu = (
+    "AVX2" => "SDL_CPU_AVX2",
+    "SSE41" => "SDL_CPU_SSE4_1",
+    "NEON" => "SDL_CPU_NEON",
+);
+
+my %simd_target = (
+    "AVX2" => " SDL_TARGETING(\"avx2\")",
+    "SSE41" => " SDL_TARGETING(\"sse4.1\")",
+    "NEON" => "",
+);
+
+my %simd_pixels_type = (
+    "AVX2" => "__m256i",
+    "SSE41" => "__m128i",
+    "NEON" => "uint8x16_t",
+);
+
+my %simd_wide_type = (
+    "AVX2" => "__m256i",
+    "SSE41" => "__m128i",
+    "NEON" => "uint16x8_t",
+);
+
+my %simd_width = (
+    "AVX2" => 8,
+    "SSE41" => 4,
+    "NEON" => 4,
+);
+
+my %simd_helpers = (
+    "SSE41" => <<'__EOF__',
+SDL_FORCE_INLINE __m128i SDL_TARGETING("sse4.1") BlitAuto_Load_SSE41(const Uint32 *pixels)
+{
+    return _mm_loadu_si128((const __m128i *)pixels);
+}
+
+SDL_FORCE_INLINE void SDL_TARGETING("sse4.1") BlitAuto_Store_SSE41(Uint32 *pixels, __m128i v)
+{
+    _mm_storeu_si128((__m128i *)pixels, v);
+}
+
+SDL_FORCE_INLINE __m128i SDL_TARGETING("sse4.1") BlitAuto_Gather_SSE41(const Uint32 *row, const Uint32 *columns)
+{
+    return _mm_setr_epi32((int)row[columns[0]], (int)row[columns[1]], (int)row[columns[2]], (int)row[columns[3]]);
+}
+
+SDL_FORCE_INLINE __m128i SDL_TARGETING("sse4.1") BlitAuto_LoadShuffle_SSE41(const Uint8 *shuffle)
+{
+    return _mm_loadu_si128((const __m128i *)shuffle);
+}
+
+SDL_FORCE_INLINE __m128i SDL_TARGETING("sse4.1") BlitAuto_Shuffle_SSE41(__m128i v, __m128i shuffle)
+{
+    return _mm_shuffle_epi8(v, shuffle);
+}
+
+SDL_FORCE_INLINE __m128i SDL_TARGETING("sse4.1") BlitAuto_Splat_SSE41(Uint32 pixel)
+{
+    return _mm_set1_epi32((int)pixel);
+}
+
+SDL_FORCE_INLINE __m128i SDL_TARGETING("sse4.1") BlitAuto_Or_SSE41(__m128i a, __m128i b)
+{
+    return _mm_or_si128(a, b);
+}
+
+SDL_FORCE_INLINE __m128i SDL_TARGETING("sse4.1") BlitAuto_Lo_SSE41(__m128i v)
+{
+    return _mm_unpacklo_epi8(v, _mm_setzero_si128());
+}
+
+SDL_FORCE_INLINE __m128i SDL_TARGETING("sse4.1") BlitAuto_Hi_SSE41(__m128i v)
+{
+    return _mm_unpackhi_epi8(v, _mm_setzero_si128());
+}
+
+SDL_FORCE_INLINE __m128i SDL_TARGETING("sse4.1") BlitAuto_Pack_SSE41(__m128i lo, __m128i hi)
+{
+    return _mm_packus_epi16(lo, hi);
+}
+
+SDL_FORCE_INLINE __m128i SDL_TARGETING("sse4.1") BlitAuto_Channels_SSE41(Uint8 b, Uint8 g, Uint8 r, Uint8 a)
+{
+    return _mm_set_epi16(a, r, g, b, a, r, g, b);
+}
+
+SDL_FORCE_INLINE __m128i SDL_TARGETING("sse4.1") BlitAuto_Div255_SSE41(__m128i x)
+{
+    /* (x * 0x8081) >> 23 is x / 255 for every 16-bit x */
+    return _mm_srli_epi16(_mm_mulhi_epu16(x, _mm_set1_epi16((short)0x8081)), 7);
+}
+
+SDL_FORCE_INLINE __m128i SDL_TARGETING("sse4.1") BlitAuto_Mul255_SSE41(__m128i a, __m128i b)
+{
+    return BlitAuto_Div255_SSE41(_mm_mullo_epi16(a, b));
+}
+
+SDL_FORCE_INLINE __m128i SDL_TARGETING("sse4.1") BlitAuto_MulClamp255_SSE41(__m128i a, __m128i b)
+{
+    /* a * b can overflow 16 bits here, anything from 255 * 255 up is 255 */
+    const __m128i overflow = _mm_cmpeq_epi16(_mm_mulhi_epu16(a, b), _mm_setzero_si128());
+    const __m128i x = _mm_or_si128(_mm_mullo_epi16(a, b), _mm_xor_si128(overflow, _mm_set1_epi16(-1)));
+    return BlitAuto_Div255_SSE41(_mm_min_epu16(x, _mm_set1_epi16((short)(255 * 255))));
+}
+
+SDL_FORCE_INLINE __m128i SDL_TARGETING("sse4.1") BlitAuto_Alpha_SSE41(__m128i v)
+{
+    return _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+}
+
+SDL_FORCE_INLINE __m128i SDL_TARGETING("sse4.1") BlitAuto_KeepAlpha_SSE41(__m128i v, __m128i alpha)
+{
+    return _mm_blend_epi16(v, alpha, 0x88);
+}
+
+SDL_FORCE_INLINE __m128i SDL_TARGETING("sse4.1") BlitAuto_Add_SSE41(__m128i a, __m128i b)
+{
+    return _mm_add_epi16(a, b);
+}
+
+SDL_FORCE_INLINE __m128i SDL_TARGETING("sse4.1") BlitAuto_Sub_SSE41(__m128i a, __m128i b)
+{
+    return _mm_sub_epi16(a, b);
+}
+
+SDL_FORCE_INLINE __m128i SDL_TARGETING("sse4.1") BlitAuto_Min_SSE41(__m128i a, __m128i b)
+{
+    return _mm_min_epu16(a, b);
+}
+__EOF__
+    "AVX2" => <<'__EOF__',
+SDL_FORCE_INLINE __m256i SDL_TARGETING("avx2") BlitAuto_Load_AVX2(const Uint32 *pixels)
+{
+    return _mm256_loadu_si256((const __m256i *)pixels);
+}
+
+SDL_FORCE_INLINE void SDL_TARGETING("avx2") BlitAuto_Store_AVX2(Uint32 *pixels, __m256i v)
+{
+    _mm256_storeu_si256((__m256i *)pixels, v);
+}
+
+SDL_FORCE_INLINE __m256i SDL_TARGETING("avx2") BlitAuto_Gather_AVX2(const Uint32 *row, const Uint32 *columns)
+{
+    return _mm256_i32gather_epi32((const int *)row, _mm256_loadu_si256((const __m256i *)columns), 4);
+}
+
+SDL_FORCE_INLINE __m256i SDL_TARGETING("avx2") BlitAuto_LoadShuffle_AVX2(const Uint8 *shuffle)
+{
+    /* The byte shuffle works within each 128-bit lane */
+    return _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)shuffle));
+}
+
+SDL_FORCE_INLINE __m256i SDL_TARGETING("avx2") BlitAuto_Shuffle_AVX2(__m256i v, __m256i shuffle)
+{
+    return _mm256_shuffle_epi8(v, shuffle);
+}
+
+SDL_FORCE_INLINE __m256i SDL_TARGETING("avx2") BlitAuto_Splat_AVX2(Uint32 pixel)
+{
+    return _mm256_set1_epi32((int)pixel);
+}
+
+SDL_FORCE_INLINE __m256i SDL_TARGETING("avx2") BlitAuto_Or_AVX2(__m256i a, __m256i b)
+{
+    return _mm256_or_si256(a, b);
+}
+
+SDL_FORCE_INLINE __m256i SDL_TARGETING("avx2") BlitAuto_Lo_AVX2(__m256i v)
+{
+    return _mm256_unpacklo_epi8(v, _mm256_setzero_si256());
+}
+
+SDL_FORCE_INLINE __m256i SDL_TARGETING("avx2") BlitAuto_Hi_AVX2(__m256i v)
+{
+    return _mm256_unpackhi_epi8(v, _mm256_setzero_si256());
+}
+
+SDL_FORCE_INLINE __m256i SDL_TARGETING("avx2") BlitAuto_Pack_AVX2(__m256i lo, __m256i hi)
+{
+    /* This undoes the per-lane interleaving of BlitAuto_Lo_AVX2() and BlitAuto_Hi_AVX2() */
+    return _mm256_packus_epi16(lo, hi);
+}
+
+SDL_FORCE_INLINE __m256i SDL_TARGETING("avx2") BlitAuto_Channels_AVX2(Uint8 b, Uint8 g, Uint8 r, Uint8 a)
+{
+    return _mm256_set_epi16(a, r, g, b, a, r, g, b, a, r, g, b, a, r, g, b);
+}
+
+SDL_FORCE_INLINE __m256i SDL_TARGETING("avx2") BlitAuto_Div255_AVX2(__m256i x)
+{
+    /* (x * 0x8081) >> 23 is x / 255 for every 16-bit x */
+    return _mm256_srli_epi16(_mm256_mulhi_epu16(x, _mm256_set1_epi16((short)0x8081)), 7);
+}
+
+SDL_FORCE_INLINE __m256i SDL_TARGETING("avx2") BlitAuto_Mul255_AVX2(__m256i a, __m256i b)
+{
+    return BlitAuto_Div255_AVX2(_mm256_mullo_epi16(a, b));
+}
+
+SDL_FORCE_INLINE __m256i SDL_TARGETING("avx2") BlitAuto_MulClamp255_AVX2(__m256i a, __m256i b)
+{
+    /* a * b can overflow 16 bits here, anything from 255 * 255 up is 255 */
+    const __m256i overflow = _mm256_cmpeq_epi16(_mm256_mulhi_epu16(a, b), _mm256_setzero_si256());
+    const __m256i x = _mm256_or_si256(_mm256_mullo_epi16(a, b), _mm256_xor_si256(overflow, _mm256_set1_epi16(-1)));
+    return BlitAuto_Div255_AVX2(_mm256_min_epu16(x, _mm256_set1_epi16((short)(255 * 255))));
+}
+
+SDL_FORCE_INLINE __m256i SDL_TARGETING("avx2") BlitAuto_Alpha_AVX2(__m256i v)
+{
+    return _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(v, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+}
+
+SDL_FORCE_INLINE __m256i SDL_TARGETING("avx2") BlitAuto_KeepAlpha_AVX2(__m256i v, __m256i alpha)
+{
+    return _mm256_blend_epi16(v, alpha, 0x88);
+}
+
+SDL_FORCE_INLINE __m256i SDL_TARGETING("avx2") BlitAuto_Add_AVX2(__m256i a, __m256i b)
+{
+    return _mm256_add_epi16(a, b);
+}
+
+SDL_FORCE_INLINE __m256i SDL_TARGETING("avx2") BlitAuto_Sub_AVX2(__m256i a, __m256i b)
+{
+    return _mm256_sub_epi16(a, b);
+}
+
+SDL_FORCE_INLINE __m256i SDL_TARGETING("avx2") BlitAuto_Min_AVX2(__m256i a, __m256i b)
+{
+    return _mm256_min_epu16(a, b);
+}
+__EOF__
+    "NEON" => <<'__EOF__',
+SDL_FORCE_INLINE uint8x16_t BlitAuto_Load_NEON(const Uint32 *pixels)
+{
+    return vld1q_u8((const Uint8 *)pixels);
+}
+
+SDL_FORCE_INLINE void BlitAuto_Store_NEON(Uint32 *pixels, uint8x16_t v)
+{
+    vst1q_u8((Uint8 *)pixels, v);
+}
+
+SDL_FORCE_INLINE uint8x16_t BlitAuto_Gather_NEON(const Uint32 *row, const Uint32 *columns)
+{
+    uint32x4_t v = vdupq_n_u32(row[columns[0]]);
+    v = vsetq_lane_u32(row[columns[1]], v, 1);
+    v = vsetq_lane_u32(row[columns[2]], v, 2);
+    v = vsetq_lane_u32(row[columns[3]], v, 3);
+    return vreinterpretq_u8_u32(v);
+}
+
+SDL_FORCE_INLINE uint8x16_t BlitAuto_LoadShuffle_NEON(const Uint8 *shuffle)
+{
+    return vld1q_u8(shuffle);
+}
+
+SDL_FORCE_INLINE uint8x16_t BlitAuto_Shuffle_NEON(uint8x16_t v, uint8x16_t shuffle)
+{
+    /* Out of range indices, like 0x80, select zero */
+#if defined(__aarch64__) || defined(_M_ARM64)
+    return vqtbl1q_u8(v, shuffle);
+#else
+    uint8x8x2_t table;
+    table.val[0] = vget_low_u8(v);
+    table.val[1] = vget_high_u8(v);
+    return vcombine_u8(vtbl2_u8(table, vget_low_u8(shuffle)), vtbl2_u8(table, vget_high_u8(shuffle)));
+#endif
+}
+
+SDL_FORCE_INLINE uint8x16_t BlitAuto_Splat_NEON(Uint32 pixel)
+{
+    return vreinterpretq_u8_u32(vdupq_n_u32(pixel));
+}
+
+SDL_FORCE_INLINE uint8x16_t BlitAuto_Or_NEON(uint8x16_t a, uint8x16_t b)
+{
+    return vorrq_u8(a, b);
+}
+
+SDL_FORCE_INLINE uint16x8_t BlitAuto_Lo_NEON(uint8x16_t v)
+{
+    return vmovl_u8(vget_low_u8(v));
+}
+
+SDL_FORCE_INLINE uint16x8_t BlitAuto_Hi_NEON(uint8x16_t v)
+{
+    return vmovl_u8(vget_high_u8(v));
+}
+
+SDL_FORCE_INLINE uint8x16_t BlitAuto_Pack_NEON(uint16x8_t lo, uint16x8_t hi)
+{
+    return vcombine_u8(vqmovn_u16(lo), vqmovn_u16(hi));
+}
+
+SDL_FORCE_INLINE uint16x8_t BlitAuto_Channels_NEON(Uint8 b, Uint8 g, Uint8 r, Uint8 a)
+{
+    const Uint16 channels[8] = { b, g, r, a, b, g, r, a };
+    return vld1q_u16(channels);
+}
+
+SDL_FORCE_INLINE uint16x8_t BlitAuto_Div255_NEON(uint16x8_t x)
+{
+    /* (x + 1 + (x >> 8)) >> 8 is x / 255 for x up to 255 * 255 */
+    return vshrq_n_u16(vaddq_u16(vaddq_u16(x, vdupq_n_u16(1)), vshrq_n_u16(x, 8)), 8);
+}
+
+SDL_FORCE_INLINE uint16x8_t BlitAuto_Mul255_NEON(uint16x8_t a, uint16x8_t b)
+{
+    return BlitAuto_Div255_NEON(vmulq_u16(a, b));
+}
+
+SDL_FORCE_INLINE uint16x8_t BlitAuto_MulClamp255_NEON(uint16x8_t a, uint16x8_t b)
+{
+    /* a * b can overflow 16 bits here, anything from 255 * 255 up is 255 */
+    const uint32x4_t limit = vdupq_n_u32(255 * 255);
+    const uint32x4_t lo = vminq_u32(vmull_u16(vget_low_u16(a), vget_low_u16(b)), limit);
+    const uint32x4_t hi = vminq_u32(vmull_u16(vget_high_u16(a), vget_high_u16(b)), limit);
+    return BlitAuto_Div255_NEON(vcombine_u16(vmovn_u32(lo), vmovn_u32(hi)));
+}
+
+SDL_FORCE_INLINE uint16x8_t BlitAuto_Alpha_NEON(uint16x8_t v)
+{
+    static const Uint8 alpha[16] = { 6, 7, 6, 7, 6, 7, 6, 7, 14, 15, 14, 15, 14, 15, 14, 15 };
+    return vreinterpretq_u16_u8(BlitAuto_Shuffle_NEON(vreinterpretq_u8_u16(v), vld1q_u8(alpha)));
+}
+
+SDL_FORCE_INLINE uint16x8_t BlitAuto_KeepAlpha_NEON(uint16x8_t v, uint16x8_t alpha)
+{
+    static const Uint16 mask[8] = { 0, 0, 0, 0xFFFF, 0, 0, 0, 0xFFFF };
+    return vbslq_u16(vld1q_u16(mask), alpha, v);
+}
+
+SDL_FORCE_INLINE uint16x8_t BlitAuto_Add_NEON(uint16x8_t a, uint16x8_t b)
+{
+    return vaddq_u16(a, b);
+}
+
+SDL_FORCE_INLINE uint16x8_t BlitAuto_Sub_NEON(uint16x8_t a, uint16x8_t b)
+{
+    return vsubq_u16(a, b);
+}
+
+SDL_FORCE_INLINE uint16x8_t BlitAuto_Min_NEON(uint16x8_t a, uint16x8_t b)
+{
+    return vminq_u16(a, b);
+}
 __EOF__
+);
+
+sub output_simddefs
+{
+    print FILE <<'__EOF__';
+/* The SIMD blitters widen each channel to 16 bits and do exactly the same
+   math as the scalar blitters below, so they give identical results. */
+
+#if defined(SDL_NEON_INTRINSICS) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+#define SDL_BLIT_AUTO_NEON
+#endif
+
+#if defined(SDL_SSE4_1_INTRINSICS) || defined(SDL_AVX2_INTRINSICS) || defined(SDL_BLIT_AUTO_NEON)
+
+typedef struct
+{
+    Uint8 src[16];      /* source pixels to B, G, R, A */
+    Uint8 dst[16];      /* destination pixels to B, G, R, A */
+    Uint8 out[16];      /* B, G, R, A to destination pixels */
+    Uint8 copy[16];     /* source pixels straight to destination pixels */
+    Uint32 src_alpha;   /* ORed into B, G, R, A when the source has no alpha */
+    Uint32 copy_alpha;  /* ORed into copied pixels when the source has no alpha */
+    SDL_bool src_has_alpha;
+} SDL_BlitAutoShuffle;
+
+/* Gets the byte offsets of B, G, R and A within a little endian pixel */
+static SDL_bool SDL_GetBlitAutoOffsets(Uint32 format, int *offsets)
+{
+    switch (format) {
+    case SDL_PIXELFORMAT_XBGR8888:
+    case SDL_PIXELFORMAT_ABGR8888:
+        offsets[0] = 2; offsets[1] = 1; offsets[2] = 0; offsets[3] = 3;
+        break;
+    case SDL_PIXELFORMAT_RGBA8888:
+        offsets[0] = 1; offsets[1] = 2; offsets[2] = 3; offsets[3] = 0;
+        break;
+    case SDL_PIXELFORMAT_BGRA8888:
+        offsets[0] = 3; offsets[1] = 2; offsets[2] = 1; offsets[3] = 0;
+        break;
+    default:
+        offsets[0] = 0; offsets[1] = 1; offsets[2] = 2; offsets[3] = 3;
+        break;
+    }
+    return SDL_ISPIXELFORMAT_ALPHA(format);
+}
+
+static void SDL_GetBlitAutoShuffle(const SDL_BlitInfo *info, Uint8 src_alpha, SDL_BlitAutoShuffle *shuffle)
+{
+    const Uint32 src_format = info->src_fmt->format;
+    const Uint32 dst_format = info->dst_fmt->format;
+    int src_offsets[4], dst_offsets[4], dst_channels[4];
+    const SDL_bool src_has_alpha = SDL_GetBlitAutoOffsets(src_format, src_offsets);
+    const SDL_bool dst_has_alpha = SDL_GetBlitAutoOffsets(dst_format, dst_offsets);
+    int i;
+
+    for (i = 0; i < 4; ++i) {
+        dst_channels[dst_offsets[i]] = i;
+    }
+
+    shuffle->src_alpha = src_has_alpha ? 0 : ((Uint32)src_alpha << 24);
+    shuffle->copy_alpha = 0;
+    shuffle->src_has_alpha = src_has_alpha;
+    for (i = 0; i < 4; ++i) {
+        const int channel = dst_channels[i];
+
+        shuffle->src[i] = (i == 3 && !src_has_alpha) ? 0x80 : (Uint8)src_offsets[i];
+        shuffle->dst[i] = (i == 3 && !dst_has_alpha) ? 0x80 : (Uint8)dst_offsets[i];
+        shuffle->out[i] = (channel == 3 && !dst_has_alpha) ? 0x80 : (Uint8)channel;
+        if (src_format == dst_format) {
+            shuffle->copy[i] = (Uint8)i;
+        } else if (channel == 3 && (!src_has_alpha || !dst_has_alpha)) {
+            shuffle->copy[i] = 0x80;
+            if (dst_has_alpha) {
+                shuffle->copy_alpha |= (0xFFu << (i * 8));
+            }
+        } else {
+            shuffle->copy[i] = (Uint8)src_offsets[channel];
+        }
+    }
+
+    /* Repeat the shuffles for each pixel in a 128-bit vector */
+    for (i = 4; i < 16; ++i) {
+        const Uint8 pixel = (Uint8)(i & ~3);
+        shuffle->src[i] = (shuffle->src[i & 3] == 0x80) ? 0x80 : (shuffle->src[i & 3] + pixel);
+        shuffle->dst[i] = (shuffle->dst[i & 3] == 0x80) ? 0x80 : (shuffle->dst[i & 3] + pixel);
+        shuffle->out[i] = (shuffle->out[i & 3] == 0x80) ? 0x80 : (shuffle->out[i & 3] + pixel);
+        shuffle->copy[i] = (shuffle->copy[i & 3] == 0x80) ? 0x80 : (shuffle->copy[i & 3] + pixel);
+    }
+}
+
+#endif /* SDL_SSE4_1_INTRINSICS || SDL_AVX2_INTRINSICS || SDL_BLIT_AUTO_NEON */
+
+__EOF__
+}
+
+sub output_simdfuncname
+{
+    my $prefix = shift;
+    my $isa = shift;
+    my $modulate = shift;
+    my $blend = shift;
+    my $scale = shift;
+    my $args = shift;
+    my $suffix = shift;
+
+    print FILE "$prefix SDL_Blit_8888_8888";
+    if ( $modulate ) {
+        print FILE "_Modulate";
+    }
+    if ( $blend ) {
+        print FILE "_Blend";
+    }
+    if ( $scale ) {
+        print FILE "_Scale";
+    }
+    print FILE "_$isa";
+    if ( $args ) {
+        print FILE "(SDL_BlitInfo *info)";
+    }
+    print FILE "$suffix";
+}
+
+sub output_simdblend
+{
+    my $isa = shift;
+    my $half = shift;
+    my $s = "src$half";
+    my $d = "dst$half";
+
+    print FILE <<__EOF__;
+                case SDL_COPY_BLEND:
+                    $d = BlitAuto_Add_$isa($s, BlitAuto_Mul255_$isa(BlitAuto_Sub_$isa(opaque, BlitAuto_Alpha_$isa($s)), $d));
+                    break;
+                case SDL_COPY_ADD:
+                    $d = BlitAuto_KeepAlpha_$isa(BlitAuto_Min_$isa(BlitAuto_Add_$isa($s, $d), opaque), $d);
+                    break;
+                case SDL_COPY_MOD:
+                    $d = BlitAuto_KeepAlpha_$isa(BlitAuto_Mul255_$isa($s, $d), $d);
+                    break;
+                case SDL_COPY_MUL:
+                    $d = BlitAuto_KeepAlpha_$isa(BlitAuto_MulClamp255_$isa($d, BlitAuto_Add_$isa($s, BlitAuto_Sub_$isa(opaque, BlitAuto_Alpha_$isa($s)))), $d);
+                    break;
+__EOF__
+}
+
+sub output_simdfunc
+{
+    my $isa = shift;
+    my $modulate = shift;
+    my $blend = shift;
+    my $scale = shift;
+
+    my $P = $simd_pixels_type{$isa};
+    my $W = $simd_wide_type{$isa};
+    my $N = $simd_width{$isa};
+    my $copy = (!$modulate && !$blend);
+
+    output_simdfuncname("static void$simd_target{$isa}", $isa, $modulate, $blend, $scale, 1, "\n");
+    print FILE <<__EOF__;
+{
+__EOF__
+    if ( !$copy ) {
+        print FILE <<__EOF__;
+    const int flags = info->flags;
+__EOF__
+    }
+    print FILE <<__EOF__;
+    SDL_BlitAutoShuffle shuffle;
+    Uint32 srcbuf[$N], dstbuf[$N];
+__EOF__
+    if ( $copy ) {
+        print FILE <<__EOF__;
+    $P copy_mask, copy_alpha;
+__EOF__
+    } else {
+        print FILE <<__EOF__;
+    $P src_mask, src_alpha, out_mask;
+__EOF__
+    }
+    if ( $blend ) {
+        print FILE <<__EOF__;
+    $P dst_mask;
+    const $W opaque = BlitAuto_Channels_$isa(0xFF, 0xFF, 0xFF, 0xFF);
+__EOF__
+    }
+    if ( $modulate ) {
+        print FILE <<__EOF__;
+    $W modulate;
+__EOF__
+    }
+    if ( $scale ) {
+        print FILE <<__EOF__;
+    Uint32 *columns;
+    SDL_bool isstack;
+    Uint64 srcy, posy, incy;
+__EOF__
+        if ( !$blend ) {
+            print FILE <<__EOF__;
+    Uint64 lasty = ~(Uint64)0;
+__EOF__
+        }
+    }
+    print FILE <<__EOF__;
+
+    SDL_zeroa(srcbuf);
+    SDL_zeroa(dstbuf);
+__EOF__
+    if ( $modulate ) {
+        print FILE <<__EOF__;
+    SDL_GetBlitAutoShuffle(info, (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF, &shuffle);
+    modulate = BlitAuto_Channels_$isa((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF,
+                                      (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF,
+                                      (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF,
+                                      ((flags & SDL_COPY_MODULATE_ALPHA) && shuffle.src_has_alpha) ? info->a : 0xFF);
+__EOF__
+    } else {
+        print FILE <<__EOF__;
+    SDL_GetBlitAutoShuffle(info, 0xFF, &shuffle);
+__EOF__
+    }
+    if ( $copy ) {
+        print FILE <<__EOF__;
+    copy_mask = BlitAuto_LoadShuffle_$isa(shuffle.copy);
+    copy_alpha = BlitAuto_Splat_$isa(shuffle.copy_alpha);
+__EOF__
+    } else {
+        print FILE <<__EOF__;
+    src_mask = BlitAuto_LoadShuffle_$isa(shuffle.src);
+    src_alpha = BlitAuto_Splat_$isa(shuffle.src_alpha);
+    out_mask = BlitAuto_LoadShuffle_$isa(shuffle.out);
+__EOF__
+    }
+    if ( $blend ) {
+        print FILE <<__EOF__;
+    dst_mask = BlitAuto_LoadShuffle_$isa(shuffle.dst);
+__EOF__
+    }
+    if ( $scale ) {
+        print FILE <<__EOF__;
+
+    columns = SDL_small_alloc(Uint32, info->dst_w, &isstack);
+    if (!columns) {
+        return;
+    }
+    SDL_GetBlitAutoColumns(info, columns);
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src;
+        const Uint32 *column = columns;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        srcy = posy >> 16;
+__EOF__
+        if ( !$blend ) {
+            print FILE <<__EOF__;
+        if (srcy == lasty) {
+            SDL_memcpy(dst, info->dst - info->dst_pitch, info->dst_w * sizeof(Uint32));
+            posy += incy;
+            info->dst += info->dst_pitch;
+            continue;
+        }
+        lasty = srcy;
+__EOF__
+        }
+        print FILE <<__EOF__;
+        src = (const Uint32 *)(info->src + (srcy * info->src_pitch));
+
+        while (n > 0) {
+            const int count = SDL_min(n, $N);
+            Uint32 *d = (count < $N) ? dstbuf : dst;
+            $P gathered;
+            $P pixels;
+
+            if (count < $N) {
+                int i;
+                for (i = 0; i < count; ++i) {
+                    srcbuf[i] = src[column[i]];
+                }
+                gathered = BlitAuto_Load_$isa(srcbuf);
+            } else {
+                gathered = BlitAuto_Gather_$isa(src, column);
+            }
+__EOF__
+    } else {
+        print FILE <<__EOF__;
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, $N);
+            const Uint32 *s = src;
+            Uint32 *d = (count < $N) ? dstbuf : dst;
+            $P pixels;
+
+            if (count < $N) {
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                s = srcbuf;
+__EOF__
+        if ( $blend ) {
+            print FILE <<__EOF__;
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+__EOF__
+        }
+        print FILE <<__EOF__;
+            }
+__EOF__
+    }
+    my $s = $scale ? "gathered" : "BlitAuto_Load_$isa(s)";
+    if ( $blend && $scale ) {
+        print FILE <<__EOF__;
+            if (count < $N) {
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+            }
+__EOF__
+    }
+    if ( $copy ) {
+        print FILE <<__EOF__;
+            pixels = BlitAuto_Or_$isa(BlitAuto_Shuffle_$isa($s, copy_mask), copy_alpha);
+__EOF__
+    } else {
+        print FILE <<__EOF__;
+            {
+                const $P srcpixels = BlitAuto_Or_$isa(BlitAuto_Shuffle_$isa($s, src_mask), src_alpha);
+                $W srclo = BlitAuto_Lo_$isa(srcpixels);
+                $W srchi = BlitAuto_Hi_$isa(srcpixels);
+__EOF__
+        if ( $blend ) {
+            print FILE <<__EOF__;
+                const $P dstpixels = BlitAuto_Shuffle_$isa(BlitAuto_Load_$isa(d), dst_mask);
+                $W dstlo = BlitAuto_Lo_$isa(dstpixels);
+                $W dsthi = BlitAuto_Hi_$isa(dstpixels);
+__EOF__
+        }
+        if ( $modulate ) {
+            print FILE <<__EOF__;
+
+                srclo = BlitAuto_Mul255_$isa(srclo, modulate);
+                srchi = BlitAuto_Mul255_$isa(srchi, modulate);
+__EOF__
+        }
+        if ( $blend ) {
+            print FILE <<__EOF__;
+
+                if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                    /* This goes away if we ever use premultiplied alpha */
+                    srclo = BlitAuto_KeepAlpha_$isa(BlitAuto_Mul255_$isa(srclo, BlitAuto_Alpha_$isa(srclo)), srclo);
+                    srchi = BlitAuto_KeepAlpha_$isa(BlitAuto_Mul255_$isa(srchi, BlitAuto_Alpha_$isa(srchi)), srchi);
+                }
+                switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+__EOF__
+            output_simdblend($isa, "lo");
+            print FILE <<__EOF__;
+                }
+                switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+__EOF__
+            output_simdblend($isa, "hi");
+            print FILE <<__EOF__;
+                }
+                pixels = BlitAuto_Shuffle_$isa(BlitAuto_Pack_$isa(dstlo, dsthi), out_mask);
+__EOF__
+        } else {
+            print FILE <<__EOF__;
+                pixels = BlitAuto_Shuffle_$isa(BlitAuto_Pack_$isa(srclo, srchi), out_mask);
+__EOF__
+        }
+        print FILE <<__EOF__;
+            }
+__EOF__
+    }
+    print FILE <<__EOF__;
+            BlitAuto_Store_$isa(d, pixels);
+            if (count < $N) {
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+__EOF__
+    if ( $scale ) {
+        print FILE <<__EOF__;
+            column += count;
+__EOF__
+    } else {
+        print FILE <<__EOF__;
+            src += count;
+__EOF__
+    }
+    print FILE <<__EOF__;
+            dst += count;
+            n -= count;
+        }
+__EOF__
+    if ( $scale ) {
+        print FILE <<__EOF__;
+        posy += incy;
+__EOF__
+    } else {
+        print FILE <<__EOF__;
+        info->src += info->src_pitch;
+__EOF__
+    }
+    print FILE <<__EOF__;
+        info->dst += info->dst_pitch;
+    }
+__EOF__
+    if ( $scale ) {
+        print FILE <<__EOF__;
+    SDL_small_free(columns, isstack);
+__EOF__
+    }
+    print FILE <<__EOF__;
+}
+
+__EOF__
+}
+
+sub output_simdfuncs
+{
+    output_simddefs();
+    foreach my $isa (@simd_isas) {
+        print FILE "#ifdef $simd_guard{$isa}\n\n";
+        print FILE $simd_helpers{$isa};
+        print FILE "\n";
+        for (my $modulate = 0; $modulate <= 1; ++$modulate) {
+            for (my $blend = 0; $blend <= 1; ++$blend) {
+                for (my $scale = 0; $scale <= 1; ++$scale) {
+                    if ( $modulate || $blend || $scale ) {
+                        output_simdfunc($isa, $modulate, $blend, $scale);
+                    }
+                }
+            }
+        }
+        print FILE "#endif /* $simd_guard{$isa} */\n\n";
+    }
+}
+
+sub get_copyflags
+{
+    my $modulate = shift;
+    my $blend = shift;
+    my $scale = shift;
+    my $flags = "";
+    my $flag = "";
+
+    if ( $modulate ) {
+        $flag = "SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA";
+        if ( $flags eq "" ) {
+            $flags = $flag;
+        } else {
+            $flags = "$flags | $flag";
+        }
+    }
+    if ( $blend ) {
+        $flag = "SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL";
+        if ( $flags eq "" ) {
+            $flags = $flag;
+        } else {
+            $flags = "$flags | $flag";
+        }
+    }
+    if ( $scale ) {
+        $flag = "SDL_COPY_NEAREST";
+        if ( $flags eq "" ) {
+            $flags = $flag;
+        } else {
+            $flags = "$flags | $flag";
+        }
+    }
+    if ( $flags eq "" ) {
+        $flags = "0";
+    }
+    return $flags;
 }
 
 sub output_copyfunctable
@@ -593,6 +1464,28 @@ sub output_copyfunctable
     print FILE <<__EOF__;
 SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
 __EOF__
+    # SDL_ChooseBlitFunc() takes the first match, so the SIMD blitters go first
+    foreach my $isa (@simd_isas) {
+        print FILE "#ifdef $simd_guard{$isa}\n";
+        for (my $i = 0; $i <= $#src_formats; ++$i) {
+            my $src = $src_formats[$i];
+            for (my $j = 0; $j <= $#dst_formats; ++$j) {
+                my $dst = $dst_formats[$j];
+                for (my $modulate = 0; $modulate <= 1; ++$modulate) {
+                    for (my $blend = 0; $blend <= 1; ++$blend) {
+                        for (my $scale = 0; $scale <= 1; ++$scale) {
+                            if ( $modulate || $blend || $scale ) {
+                                print FILE "    { SDL_PIXELFORMAT_$src, SDL_PIXELFORMAT_$dst, ";
+                                print FILE "(" . get_copyflags($modulate, $blend, $scale) . "), $simd_cpu{$isa},";
+                                output_simdfuncname("", $isa, $modulate, $blend, $scale, 0, " },\n");
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        print FILE "#endif\n";
+    }
     for (my $i = 0; $i <= $#src_formats; ++$i) {
         my $src = $src_formats[$i];
         for (my $j = 0; $j <= $#dst_formats; ++$j) {
@@ -602,36 +1495,7 @@ __EOF__
                     for (my $scale = 0; $scale <= 1; ++$scale) {
                         if ( $modulate || $blend || $scale ) {
                             print FILE "    { SDL_PIXELFORMAT_$src, SDL_PIXELFORMAT_$dst, ";
-                            my $flags = "";
-                            my $flag = "";
-                            if ( $modulate ) {
-                                $flag = "SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA";
-                                if ( $flags eq "" ) {
-                                    $flags = $flag;
-                                } else {
-                                    $flags = "$flags | $flag";
-                                }
-                            }
-                            if ( $blend ) {
-                                $flag = "SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL";
-                                if ( $flags eq "" ) {
-                                    $flags = $flag;
-                                } else {
-                                    $flags = "$flags | $flag";
-                                }
-                            }
-                            if ( $scale ) {
-                                $flag = "SDL_COPY_NEAREST";
-                                if ( $flags eq "" ) {
-                                    $flags = $flag;
-                                } else {
-                                    $flags = "$flags | $flag";
-                                }
-                            }
-                            if ( $flags eq "" ) {
-                                $flags = "0";
-                            }
-                            print FILE "($flags), SDL_CPU_ANY,";
+                            print FILE "(" . get_copyflags($modulate, $blend, $scale) . "), SDL_CPU_ANY,";
                             output_copyfuncname("", $src_formats[$i], $dst_formats[$j], $modulate, $blend, $scale, 0, " },\n");
                         }
                     }
@@ -679,5 +1543,6 @@ for (my $i = 0; $i <= $#src_formats; ++$i) {
         output_copyfunc_c($src_formats[$i], $dst_formats[$j]);
     }
 }
+output_simdfuncs();
 output_copyfunctable();
 close_file("SDL_blit_auto.c");
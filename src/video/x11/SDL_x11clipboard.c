@@ -26,9 +26,17 @@
 
 #include "SDL_x11video.h"
 #include "SDL_x11clipboard.h"
+#include "SDL_x11events.h"
+#include "SDL_x11xfixes.h"
 #include "../SDL_clipboard_c.h"
 #include "../../events/SDL_events_c.h"
 
+/* How long a selection owner can go without responding to a request */
+#define SELECTION_TIMEOUT_NS SDL_MS_TO_NS(1000)
+
+/* How long a requestor can go without reading the next chunk of an INCR transfer */
+#define SELECTION_TRANSFER_TIMEOUT_NS SDL_MS_TO_NS(5000)
+
 static const char *text_mime_types[] = {
     "UTF8_STRING",
     "text/plain;charset=utf-8",
@@ -50,15 +58,26 @@ static Window GetWindow(SDL_VideoDevice *_this)
         Display *dpy = data->display;
         Window parent = RootWindow(dpy, DefaultScreen(dpy));
         XSetWindowAttributes xattr;
+        /* Property changes drive incoming INCR transfers */
+        xattr.event_mask = PropertyChangeMask;
         data->clipboard_window = X11_XCreateWindow(dpy, parent, -10, -10, 1, 1, 0,
                                                    CopyFromParent, InputOnly,
-                                                   CopyFromParent, 0, &xattr);
+                                                   CopyFromParent, CWEventMask, &xattr);
         X11_XFlush(data->display);
     }
 
     return data->clipboard_window;
 }
 
+static SDLX11_ClipboardData *GetClipboardForSelection(SDL_VideoData *videodata, Atom selection)
+{
+    if (selection == XA_PRIMARY) {
+        return &videodata->primary_selection;
+    } else {
+        return &videodata->clipboard;
+    }
+}
+
 static int SetSelectionData(SDL_VideoDevice *_this, Atom selection, SDL_ClipboardDataCallback callback,
                             void *userdata, const char **mime_types, size_t mime_count, Uint32 sequence)
 {
@@ -73,11 +92,7 @@ static int SetSelectionData(SDL_VideoDevice *_this, Atom selection, SDL_Clipboar
         return SDL_SetError("Couldn't find a window to own the selection");
     }
 
-    if (selection == XA_PRIMARY) {
-        clipboard = &videodata->primary_selection;
-    } else {
-        clipboard = &videodata->clipboard;
-    }
+    clipboard = GetClipboardForSelection(videodata, selection);
 
     clipboard_owner = X11_XGetSelectionOwner(display, selection) == window;
 
@@ -92,6 +107,9 @@ static int SetSelectionData(SDL_VideoDevice *_this, Atom selection, SDL_Clipboar
     clipboard->mime_count = mime_count;
     clipboard->sequence = sequence;
 
+    /* Anything cached for this selection came from the previous owner */
+    X11_InvalidateClipboardCache(_this, selection);
+
     X11_XSetSelectionOwner(display, selection, window, CurrentTime);
     return 0;
 }
@@ -109,88 +127,473 @@ static void *CloneDataBuffer(const void *buffer, size_t *len)
     return clone;
 }
 
-static void *GetSelectionData(SDL_VideoDevice *_this, Atom selection_type,
-                              const char *mime_type, size_t *length)
+/* Data from other clients can only be kept while we're told when the selection owner changes */
+static SDL_bool CanCacheSelections(void)
+{
+#ifdef SDL_VIDEO_DRIVER_X11_XFIXES
+    return SDL_X11_HAVE_XFIXES && X11_GetXFixesSelectionNotifyEvent() != 0;
+#else
+    return SDL_FALSE;
+#endif
+}
+
+static SDLX11_ClipboardCacheEntry *FindCachedData(SDL_VideoData *videodata, Atom selection, const char *mime_type)
+{
+    SDLX11_ClipboardCacheEntry *entry;
+
+    for (entry = videodata->clipboard_cache; entry; entry = entry->next) {
+        if (entry->selection == selection && SDL_strcmp(entry->mime_type, mime_type) == 0) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+static void CacheData(SDL_VideoData *videodata, Atom selection, const char *mime_type, const void *data, size_t length)
+{
+    SDLX11_ClipboardCacheEntry *entry;
+
+    if (!CanCacheSelections() || FindCachedData(videodata, selection, mime_type)) {
+        return;
+    }
+
+    entry = (SDLX11_ClipboardCacheEntry *)SDL_calloc(1, sizeof(*entry));
+    if (!entry) {
+        return;
+    }
+    entry->selection = selection;
+    entry->mime_type = SDL_strdup(mime_type);
+    entry->length = length;
+    entry->data = CloneDataBuffer(data, &entry->length);
+    if (!entry->mime_type || (length > 0 && !entry->data)) {
+        SDL_free(entry->mime_type);
+        SDL_free(entry->data);
+        SDL_free(entry);
+        return;
+    }
+    entry->next = videodata->clipboard_cache;
+    videodata->clipboard_cache = entry;
+}
+
+/* Requests that were sent before the selection owner changed may still
+   complete afterwards, and their data must not be cached */
+static void CacheRequestData(SDL_VideoData *videodata, const SDLX11_ClipboardRequest *request, const void *data, size_t length)
+{
+    if (request->cache_generation == GetClipboardForSelection(videodata, request->selection)->cache_generation) {
+        CacheData(videodata, request->selection, request->mime_type, data, length);
+    }
+}
+
+void X11_InvalidateClipboardCache(SDL_VideoDevice *_this, Atom selection)
+{
+    SDL_VideoData *videodata = _this->driverdata;
+    SDLX11_ClipboardCacheEntry **prev = &videodata->clipboard_cache;
+
+    if (selection == None) {
+        ++videodata->clipboard.cache_generation;
+        ++videodata->primary_selection.cache_generation;
+    } else {
+        ++GetClipboardForSelection(videodata, selection)->cache_generation;
+    }
+
+    while (*prev) {
+        SDLX11_ClipboardCacheEntry *entry = *prev;
+        if (selection == None || entry->selection == selection) {
+            *prev = entry->next;
+            SDL_free(entry->mime_type);
+            SDL_free(entry->data);
+            SDL_free(entry);
+        } else {
+            prev = &entry->next;
+        }
+    }
+}
+
+static SDL_bool AppendRequestData(SDLX11_ClipboardRequest *request, const void *data, size_t length)
+{
+    /* Keep room for a terminator, so text data is always null terminated */
+    const size_t needed = request->length + length + sizeof(Uint32);
+
+    if (needed > request->allocated) {
+        size_t allocated = SDL_max(request->allocated * 2, needed);
+        Uint8 *buffer = (Uint8 *)SDL_realloc(request->data, allocated);
+        if (!buffer) {
+            return SDL_FALSE;
+        }
+        request->data = buffer;
+        request->allocated = allocated;
+    }
+    SDL_memcpy(request->data + request->length, data, length);
+    request->length += length;
+    SDL_memset(request->data + request->length, 0, sizeof(Uint32));
+    return SDL_TRUE;
+}
+
+static void SendRequest(SDL_VideoDevice *_this, SDLX11_ClipboardRequest *request)
+{
+    SDL_VideoData *videodata = _this->driverdata;
+    Display *display = videodata->display;
+    Window window = GetWindow(_this);
+    Atom property = X11_XInternAtom(display, "SDL_SELECTION", False);
+
+    /* Request that the selection owner copy the data to our window */
+    X11_XDeleteProperty(display, window, property);
+    X11_XConvertSelection(display, request->selection, request->target, property, window, CurrentTime);
+    X11_XFlush(display);
+
+    request->sent = SDL_TRUE;
+    request->cache_generation = GetClipboardForSelection(videodata, request->selection)->cache_generation;
+    request->last_activity = SDL_GetTicksNS();
+}
+
+static void CompleteRequest(SDL_VideoDevice *_this, SDL_bool succeeded)
+{
+    SDL_VideoData *videodata = _this->driverdata;
+    SDLX11_ClipboardRequest *request = videodata->clipboard_requests;
+
+    /* Start the next request first, the callback may wait for it */
+    videodata->clipboard_requests = request->next;
+    if (videodata->clipboard_requests) {
+        SendRequest(_this, videodata->clipboard_requests);
+    }
+
+    if (succeeded) {
+        CacheRequestData(videodata, request, request->data, request->length);
+    }
+    request->callback(request->userdata, request->mime_type, (succeeded && request->length > 0) ? request->data : NULL, succeeded ? request->length : 0);
+
+    SDL_free(request->mime_type);
+    SDL_free(request->data);
+    SDL_free(request);
+}
+
+static int RequestSelectionData(SDL_VideoDevice *_this, Atom selection_type, const char *mime_type,
+                                SDL_ClipboardRequestCallback callback, void *userdata)
 {
     SDL_VideoData *videodata = _this->driverdata;
     Display *display = videodata->display;
     Window window;
     Window owner;
-    Atom selection;
+    SDLX11_ClipboardRequest *request;
+    SDLX11_ClipboardRequest **tail;
+
+    /* Get the window that holds the selection */
+    window = GetWindow(_this);
+    owner = X11_XGetSelectionOwner(display, selection_type);
+    if (owner == None) {
+        /* This requires a fallback to ancient X10 cut-buffers. We will just skip those for now */
+        callback(userdata, mime_type, NULL, 0);
+        return 0;
+    }
+
+    if (owner == window) {
+        SDLX11_ClipboardData *clipboard = GetClipboardForSelection(videodata, selection_type);
+        size_t length = 0;
+        void *data = NULL;
+
+        if (clipboard->callback) {
+            const void *clipboard_data = clipboard->callback(clipboard->userdata, mime_type, &length);
+            data = CloneDataBuffer(clipboard_data, &length);
+        }
+        callback(userdata, mime_type, data, data ? length : 0);
+        SDL_free(data);
+        return 0;
+    }
+
+    {
+        const SDLX11_ClipboardCacheEntry *entry = FindCachedData(videodata, selection_type, mime_type);
+        if (entry) {
+            callback(userdata, mime_type, entry->data, entry->length);
+            return 0;
+        }
+    }
+
+    request = (SDLX11_ClipboardRequest *)SDL_calloc(1, sizeof(*request));
+    if (!request) {
+        return -1;
+    }
+    request->selection = selection_type;
+    request->target = X11_XInternAtom(display, mime_type, False);
+    request->mime_type = SDL_strdup(mime_type);
+    request->callback = callback;
+    request->userdata = userdata;
+    if (!request->mime_type) {
+        SDL_free(request);
+        return -1;
+    }
+
+    for (tail = &videodata->clipboard_requests; *tail; tail = &(*tail)->next) {
+    }
+    *tail = request;
+    if (request == videodata->clipboard_requests) {
+        SendRequest(_this, request);
+    }
+    return 0;
+}
+
+typedef struct
+{
+    SDL_bool done;
+    void *data;
+    size_t length;
+} SDLX11_SelectionResult;
+
+static void SDLCALL StoreSelectionData(void *userdata, const char *mime_type, const void *data, size_t size)
+{
+    SDLX11_SelectionResult *result = (SDLX11_SelectionResult *)userdata;
+
+    result->length = size;
+    result->data = CloneDataBuffer(data, &result->length);
+    if (!result->data) {
+        result->length = 0;
+    }
+    result->done = SDL_TRUE;
+}
+
+static void *GetSelectionData(SDL_VideoDevice *_this, Atom selection_type,
+                              const char *mime_type, size_t *length)
+{
+    SDLX11_SelectionResult result;
+
+    SDL_zero(result);
+    *length = 0;
+
+    if (RequestSelectionData(_this, selection_type, mime_type, StoreSelectionData, &result) < 0) {
+        return NULL;
+    }
+
+    /* Wait for the selection owner, handling events as they come in rather
+       than spinning, large transfers can take many round trips */
+    while (!result.done) {
+        X11_WaitEventTimeout(_this, SDL_MS_TO_NS(10));
+        X11_UpdateClipboard(_this);
+    }
+
+    *length = result.length;
+    return result.data;
+}
+
+void X11_HandleSelectionNotify(SDL_VideoDevice *_this, const XSelectionEvent *xevent)
+{
+    SDL_VideoData *videodata = _this->driverdata;
+    Display *display = videodata->display;
+    SDLX11_ClipboardRequest *request = videodata->clipboard_requests;
+    Atom XA_INCR = X11_XInternAtom(display, "INCR", False);
     Atom seln_type;
     int seln_format;
     unsigned long count;
     unsigned long overflow;
-    Uint64 waitStart;
-    Uint64 waitElapsed;
-
-    SDLX11_ClipboardData *clipboard;
-    void *data = NULL;
     unsigned char *src = NULL;
-    Atom XA_MIME = X11_XInternAtom(display, mime_type, False);
-    Atom XA_INCR = X11_XInternAtom(display, "INCR", False);
+    SDL_bool succeeded = SDL_FALSE;
 
-    *length = 0;
+    if (!request || !request->sent || request->incremental ||
+        xevent->selection != request->selection || xevent->target != request->target) {
+        return;
+    }
 
-    /* Get the window that holds the selection */
-    window = GetWindow(_this);
-    owner = X11_XGetSelectionOwner(display, selection_type);
-    if (owner == None) {
-        /* This requires a fallback to ancient X10 cut-buffers. We will just skip those for now */
-        data = NULL;
-    } else if (owner == window) {
-        owner = DefaultRootWindow(display);
-        if (selection_type == XA_PRIMARY) {
-            clipboard = &videodata->primary_selection;
-        } else {
-            clipboard = &videodata->clipboard;
+    if (xevent->property == None) {
+        /* The owner doesn't have data for this mime type */
+        CacheRequestData(videodata, request, NULL, 0);
+        CompleteRequest(_this, SDL_FALSE);
+        return;
+    }
+
+    /* Deleting the property tells the owner to start an INCR transfer */
+    if (X11_XGetWindowProperty(display, xevent->requestor, xevent->property, 0, INT_MAX / 4, True,
+                               AnyPropertyType, &seln_type, &seln_format, &count, &overflow, &src) == Success) {
+        if (seln_type == XA_INCR) {
+            request->incremental = SDL_TRUE;
+            request->last_activity = SDL_GetTicksNS();
+            X11_XFree(src);
+            return;
         }
+        if (seln_type != None) {
+            const size_t bytes = (size_t)count * ((seln_format == 32) ? sizeof(long) : (size_t)(seln_format / 8));
+            succeeded = AppendRequestData(request, src, bytes);
+        }
+        X11_XFree(src);
+    }
+    CompleteRequest(_this, succeeded);
+}
 
-        if (clipboard->callback) {
-            const void *clipboard_data = clipboard->callback(clipboard->userdata, mime_type, length);
-            data = CloneDataBuffer(clipboard_data, length);
+void X11_HandleClipboardPropertyNotify(SDL_VideoDevice *_this, const XPropertyEvent *xevent)
+{
+    SDL_VideoData *videodata = _this->driverdata;
+    Display *display = videodata->display;
+    SDLX11_ClipboardRequest *request = videodata->clipboard_requests;
+    Atom seln_type;
+    int seln_format;
+    unsigned long count;
+    unsigned long overflow;
+    unsigned char *src = NULL;
+
+    if (!request || !request->incremental || xevent->state != PropertyNewValue ||
+        xevent->atom != X11_XInternAtom(display, "SDL_SELECTION", False)) {
+        return;
+    }
+
+    /* Each chunk is deleted once read, which asks the owner for the next one */
+    if (X11_XGetWindowProperty(display, xevent->window, xevent->atom, 0, INT_MAX / 4, True,
+                               AnyPropertyType, &seln_type, &seln_format, &count, &overflow, &src) != Success) {
+        CompleteRequest(_this, SDL_FALSE);
+        return;
+    }
+    request->last_activity = SDL_GetTicksNS();
+
+    if (count == 0) {
+        /* A zero length chunk ends the transfer */
+        X11_XFree(src);
+        CompleteRequest(_this, SDL_TRUE);
+        return;
+    }
+
+    if (!AppendRequestData(request, src, (size_t)count * ((seln_format == 32) ? sizeof(long) : (size_t)(seln_format / 8)))) {
+        X11_XFree(src);
+        CompleteRequest(_this, SDL_FALSE);
+        return;
+    }
+    X11_XFree(src);
+}
+
+/* The largest property we set in one go, larger data is sent with the INCR protocol */
+static size_t GetMaxPropertySize(Display *display)
+{
+    return (size_t)X11_XMaxRequestSize(display) * 4 - 100;
+}
+
+void X11_SendSelectionData(SDL_VideoDevice *_this, const XSelectionRequestEvent *req, const void *data, size_t length)
+{
+    SDL_VideoData *videodata = _this->driverdata;
+    Display *display = videodata->display;
+    SDLX11_ClipboardTransfer *transfer;
+    long incr_length;
+
+    if (length <= GetMaxPropertySize(display)) {
+        /* This is a safe cast, XChangeProperty() doesn't take a const value, but it doesn't modify the data */
+        X11_XChangeProperty(display, req->requestor, req->property,
+                            req->target, 8, PropModeReplace,
+                            (unsigned char *)data, (int)length);
+        return;
+    }
+
+    transfer = (SDLX11_ClipboardTransfer *)SDL_calloc(1, sizeof(*transfer));
+    if (!transfer) {
+        return;
+    }
+    transfer->data = (Uint8 *)SDL_malloc(length);
+    if (!transfer->data) {
+        SDL_free(transfer);
+        return;
+    }
+    SDL_memcpy(transfer->data, data, length);
+    transfer->length = length;
+    transfer->requestor = req->requestor;
+    transfer->property = req->property;
+    transfer->target = req->target;
+    transfer->last_activity = SDL_GetTicksNS();
+    transfer->next = videodata->clipboard_transfers;
+    videodata->clipboard_transfers = transfer;
+
+    /* The requestor deletes the property each time it has read a chunk */
+    X11_XSelectInput(display, req->requestor, PropertyChangeMask);
+    incr_length = (long)SDL_min(length, (size_t)LONG_MAX);
+    X11_XChangeProperty(display, req->requestor, req->property,
+                        X11_XInternAtom(display, "INCR", False), 32, PropModeReplace,
+                        (unsigned char *)&incr_length, 1);
+}
+
+static void FreeTransfer(SDL_VideoData *videodata, SDLX11_ClipboardTransfer *transfer, SDL_bool stop_listening)
+{
+    SDLX11_ClipboardTransfer **prev;
+    SDLX11_ClipboardTransfer *other;
+
+    for (prev = &videodata->clipboard_transfers; *prev; prev = &(*prev)->next) {
+        if (*prev == transfer) {
+            *prev = transfer->next;
+            break;
         }
-    } else {
-        /* Request that the selection owner copy the data to our window */
-        owner = window;
-        selection = X11_XInternAtom(display, "SDL_SELECTION", False);
-        X11_XConvertSelection(display, selection_type, XA_MIME, selection, owner,
-                              CurrentTime);
-
-        /* When using synergy on Linux and when data has been put in the clipboard
-           on the remote (Windows anyway) machine then selection_waiting may never
-           be set to False. Time out after a while. */
-        waitStart = SDL_GetTicks();
-        videodata->selection_waiting = SDL_TRUE;
-        while (videodata->selection_waiting) {
-            SDL_PumpEvents();
-            waitElapsed = SDL_GetTicks() - waitStart;
-            /* Wait one second for a selection response. */
-            if (waitElapsed > 1000) {
-                videodata->selection_waiting = SDL_FALSE;
-                SDL_SetError("Selection timeout");
-                /* We need to set the selection text so that next time we won't
-                   timeout, otherwise we will hang on every call to this function. */
-                SetSelectionData(_this, selection_type, SDL_ClipboardTextCallback, NULL,
-                                 text_mime_types, SDL_arraysize(text_mime_types), 0);
-                data = NULL;
-                *length = 0;
+    }
+    if (stop_listening) {
+        /* The requestor may still be reading another property from us */
+        for (other = videodata->clipboard_transfers; other; other = other->next) {
+            if (other->requestor == transfer->requestor) {
+                stop_listening = SDL_FALSE;
+                break;
             }
         }
+    }
+    if (stop_listening) {
+        X11_XSelectInput(videodata->display, transfer->requestor, NoEventMask);
+    }
+    SDL_free(transfer->data);
+    SDL_free(transfer);
+}
 
-        if (X11_XGetWindowProperty(display, owner, selection, 0, INT_MAX / 4, False,
-                                   XA_MIME, &seln_type, &seln_format, &count, &overflow, &src) == Success) {
-            if (seln_type == XA_MIME) {
-                *length = (size_t)count;
-                data = CloneDataBuffer(src, length);
-            } else if (seln_type == XA_INCR) {
-                /* FIXME: Need to implement the X11 INCR protocol */
-                /*SDL_Log("Need to implement the X11 INCR protocol");*/
-            }
-            X11_XFree(src);
+SDL_bool X11_HandleClipboardTransferEvent(SDL_VideoDevice *_this, const XPropertyEvent *xevent)
+{
+    SDL_VideoData *videodata = _this->driverdata;
+    Display *display = videodata->display;
+    SDLX11_ClipboardTransfer *transfer;
+    size_t chunk;
+
+    for (transfer = videodata->clipboard_transfers; transfer; transfer = transfer->next) {
+        if (transfer->requestor == xevent->window && transfer->property == xevent->atom) {
+            break;
+        }
+    }
+    if (!transfer) {
+        return SDL_FALSE;
+    }
+    if (xevent->state != PropertyDelete) {
+        return SDL_TRUE;
+    }
+
+    /* Send the next chunk, the last one is empty */
+    chunk = SDL_min(transfer->length - transfer->offset, GetMaxPropertySize(display));
+    X11_XChangeProperty(display, transfer->requestor, transfer->property,
+                        transfer->target, 8, PropModeReplace,
+                        transfer->data + transfer->offset, (int)chunk);
+    X11_XFlush(display);
+    transfer->offset += chunk;
+    transfer->last_activity = SDL_GetTicksNS();
+
+    if (chunk == 0) {
+        FreeTransfer(videodata, transfer, SDL_TRUE);
+    }
+    return SDL_TRUE;
+}
+
+void X11_UpdateClipboard(SDL_VideoDevice *_this)
+{
+    SDL_VideoData *videodata = _this->driverdata;
+    SDLX11_ClipboardRequest *request = videodata->clipboard_requests;
+    SDLX11_ClipboardTransfer *transfer;
+    const Uint64 now = SDL_GetTicksNS();
+
+    /* When using synergy on Linux and when data has been put in the clipboard
+       on the remote (Windows anyway) machine then the selection owner may never
+       respond. Time out if a request makes no progress for a while. */
+    if (request && request->sent && (now - request->last_activity) > SELECTION_TIMEOUT_NS) {
+        const Atom selection = request->selection;
+
+        SDL_SetError("Selection timeout");
+        CompleteRequest(_this, SDL_FALSE);
+
+        /* We need to set the selection text so that next time we won't
+           timeout, otherwise we will hang on every call to this function. */
+        SetSelectionData(_this, selection, SDL_ClipboardTextCallback, NULL,
+                         text_mime_types, SDL_arraysize(text_mime_types), 0);
+    }
+
+    /* Give up on requestors that stopped reading our data */
+    transfer = videodata->clipboard_transfers;
+    while (transfer) {
+        SDLX11_ClipboardTransfer *next = transfer->next;
+        if ((now - transfer->last_activity) > SELECTION_TRANSFER_TIMEOUT_NS) {
+            FreeTransfer(videodata, transfer, SDL_TRUE);
         }
+        transfer = next;
     }
-    return data;
 }
 
 const char **X11_GetTextMimeTypes(SDL_VideoDevice *_this, size_t *num_mime_types)
@@ -221,6 +624,16 @@ void *X11_GetClipboardData(SDL_VideoDevice *_this, const char *mime_type, size_t
     return GetSelectionData(_this, XA_CLIPBOARD, mime_type, length);
 }
 
+int X11_RequestClipboardData(SDL_VideoDevice *_this, const char *mime_type, SDL_ClipboardRequestCallback callback, void *userdata)
+{
+    SDL_VideoData *videodata = _this->driverdata;
+    Atom XA_CLIPBOARD = X11_XInternAtom(videodata->display, "CLIPBOARD", 0);
+    if (XA_CLIPBOARD == None) {
+        return SDL_SetError("Couldn't access X clipboard");
+    }
+    return RequestSelectionData(_this, XA_CLIPBOARD, mime_type, callback, userdata);
+}
+
 SDL_bool X11_HasClipboardData(SDL_VideoDevice *_this, const char *mime_type)
 {
     size_t length;
@@ -263,6 +676,16 @@ SDL_bool X11_HasPrimarySelectionText(SDL_VideoDevice *_this)
 void X11_QuitClipboard(SDL_VideoDevice *_this)
 {
     SDL_VideoData *data = _this->driverdata;
+
+    while (data->clipboard_requests) {
+        SDL_SetError("Video subsystem is shutting down");
+        CompleteRequest(_this, SDL_FALSE);
+    }
+    while (data->clipboard_transfers) {
+        FreeTransfer(data, data->clipboard_transfers, SDL_FALSE);
+    }
+    X11_InvalidateClipboardCache(_this, None);
+
     if (data->primary_selection.sequence == 0) {
         SDL_free(data->primary_selection.userdata);
     }
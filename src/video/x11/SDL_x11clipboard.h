@@ -31,15 +31,63 @@ typedef struct X11_ClipboardData {
     const char **mime_types;
     size_t mime_count;
     Uint32 sequence;
+    Uint32 cache_generation; /* Incremented each time the cache for this selection is invalidated */
 } SDLX11_ClipboardData;
 
+/* A request for another client's selection data, these are sent one at a time */
+typedef struct X11_ClipboardRequest {
+    Atom selection;
+    Atom target;
+    char *mime_type;
+    SDL_ClipboardRequestCallback callback;
+    void *userdata;
+    SDL_bool sent;
+    SDL_bool incremental;
+    Uint32 cache_generation; /* The cache generation of the selection when the request was sent */
+    Uint8 *data;
+    size_t length;
+    size_t allocated;
+    Uint64 last_activity;
+    struct X11_ClipboardRequest *next;
+} SDLX11_ClipboardRequest;
+
+/* Selection data received from another client, kept until the selection owner changes */
+typedef struct X11_ClipboardCacheEntry {
+    Atom selection;
+    char *mime_type;
+    void *data;
+    size_t length;
+    struct X11_ClipboardCacheEntry *next;
+} SDLX11_ClipboardCacheEntry;
+
+/* Selection data being sent to another client in INCR chunks */
+typedef struct X11_ClipboardTransfer {
+    Window requestor;
+    Atom property;
+    Atom target;
+    Uint8 *data;
+    size_t length;
+    size_t offset;
+    Uint64 last_activity;
+    struct X11_ClipboardTransfer *next;
+} SDLX11_ClipboardTransfer;
+
 extern const char **X11_GetTextMimeTypes(SDL_VideoDevice *_this, size_t *num_mime_types);
 extern int X11_SetClipboardData(SDL_VideoDevice *_this);
 extern void *X11_GetClipboardData(SDL_VideoDevice *_this, const char *mime_type, size_t *length);
 extern SDL_bool X11_HasClipboardData(SDL_VideoDevice *_this, const char *mime_type);
+extern int X11_RequestClipboardData(SDL_VideoDevice *_this, const char *mime_type, SDL_ClipboardRequestCallback callback, void *userdata);
 extern int X11_SetPrimarySelectionText(SDL_VideoDevice *_this, const char *text);
 extern char *X11_GetPrimarySelectionText(SDL_VideoDevice *_this);
 extern SDL_bool X11_HasPrimarySelectionText(SDL_VideoDevice *_this);
 extern void X11_QuitClipboard(SDL_VideoDevice *_this);
 
+/* Called from the event loop */
+extern void X11_HandleSelectionNotify(SDL_VideoDevice *_this, const XSelectionEvent *xevent);
+extern void X11_HandleClipboardPropertyNotify(SDL_VideoDevice *_this, const XPropertyEvent *xevent);
+extern SDL_bool X11_HandleClipboardTransferEvent(SDL_VideoDevice *_this, const XPropertyEvent *xevent);
+extern void X11_SendSelectionData(SDL_VideoDevice *_this, const XSelectionRequestEvent *req, const void *data, size_t length);
+extern void X11_InvalidateClipboardCache(SDL_VideoDevice *_this, Atom selection);
+extern void X11_UpdateClipboard(SDL_VideoDevice *_this);
+
 #endif /* SDL_x11clipboard_h_ */
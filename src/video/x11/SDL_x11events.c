@@ -656,7 +656,7 @@ static void X11_HandleClipboardEvent(SDL_VideoDevice *_this, const XEvent *xeven
         const XSelectionRequestEvent *req = &xevent->xselectionrequest;
         XEvent sevent;
         int mime_formats;
-        unsigned char *seln_data;
+        const void *seln_data;
         size_t seln_length = 0;
         Atom XA_TARGETS = X11_XInternAtom(display, "TARGETS", 0);
         SDLX11_ClipboardData *clipboard;
@@ -712,13 +712,10 @@ static void X11_HandleClipboardEvent(SDL_VideoDevice *_this, const XEvent *xeven
                         continue;
                     }
 
-                    /* FIXME: We don't support the X11 INCR protocol for large clipboards. Do we want that? - Yes, yes we do. */
-                    /* This is a safe cast, XChangeProperty() doesn't take a const value, but it doesn't modify the data */
-                    seln_data = (unsigned char *)clipboard->callback(clipboard->userdata, mime_type, &seln_length);
+                    /* Large data is sent with the INCR protocol as the requestor reads it */
+                    seln_data = clipboard->callback(clipboard->userdata, mime_type, &seln_length);
                     if (seln_data) {
-                        X11_XChangeProperty(display, req->requestor, req->property,
-                                            req->target, 8, PropModeReplace,
-                                            seln_data, seln_length);
+                        X11_SendSelectionData(_this, req, seln_data, seln_length);
                         sevent.xselection.property = req->property;
                         sevent.xselection.target = req->target;
                     }
@@ -736,7 +733,12 @@ static void X11_HandleClipboardEvent(SDL_VideoDevice *_this, const XEvent *xeven
         printf("window CLIPBOARD: SelectionNotify (requestor = %ld, target = %ld)\n",
                xevent->xselection.requestor, xevent->xselection.target);
 #endif
-        videodata->selection_waiting = SDL_FALSE;
+        X11_HandleSelectionNotify(_this, &xevent->xselection);
+    } break;
+
+    case PropertyNotify:
+    {
+        X11_HandleClipboardPropertyNotify(_this, &xevent->xproperty);
     } break;
 
     case SelectionClear:
@@ -1027,6 +1029,11 @@ static void X11_DispatchEvent(SDL_VideoDevice *_this, XEvent *xevent)
     SDL_assert(videodata != NULL);
     display = videodata->display;
 
+    /* Merged mouse motion has to be sent before anything that came after it */
+    if (videodata->pending_motion.pending && !X11_Xinput2IsMotionEvent(xevent)) {
+        X11_Xinput2FlushMotion(_this);
+    }
+
     /* filter events catches XIM events and sends them to the correct handler */
     /* Key press/release events are filtered in X11_HandleKeyEvent() */
     if (xevent->type != KeyPress && xevent->type != KeyRelease) {
@@ -1079,6 +1086,7 @@ static void X11_DispatchEvent(SDL_VideoDevice *_this, XEvent *xevent)
 
         if (ev->selection == XA_PRIMARY ||
             (XA_CLIPBOARD != None && ev->selection == XA_CLIPBOARD)) {
+            X11_InvalidateClipboardCache(_this, ev->selection);
             SDL_SendClipboardUpdate();
             return;
         }
@@ -1091,6 +1099,12 @@ static void X11_DispatchEvent(SDL_VideoDevice *_this, XEvent *xevent)
         return;
     }
 
+    /* Requestors reading our data with the INCR protocol aren't our windows */
+    if (xevent->type == PropertyNotify && videodata->clipboard_transfers &&
+        X11_HandleClipboardTransferEvent(_this, &xevent->xproperty)) {
+        return;
+    }
+
     data = X11_FindWindow(_this, xevent->xany.window);
 
     if (!data) {
@@ -1247,6 +1261,7 @@ static void X11_DispatchEvent(SDL_VideoDevice *_this, XEvent *xevent)
         } else {
             data->pending_focus = PENDING_FOCUS_IN;
             data->pending_focus_time = SDL_GetTicks() + PENDING_FOCUS_TIME;
+            videodata->pending_focus_changes = SDL_TRUE;
         }
         data->last_focus_event_time = SDL_GetTicks();
     } break;
@@ -1280,6 +1295,7 @@ static void X11_DispatchEvent(SDL_VideoDevice *_this, XEvent *xevent)
         } else {
             data->pending_focus = PENDING_FOCUS_OUT;
             data->pending_focus_time = SDL_GetTicks() + PENDING_FOCUS_TIME;
+            videodata->pending_focus_changes = SDL_TRUE;
         }
 
 #ifdef SDL_VIDEO_DRIVER_X11_XFIXES
@@ -1879,6 +1895,7 @@ static void X11_DispatchEvent(SDL_VideoDevice *_this, XEvent *xevent)
 static void X11_HandleFocusChanges(SDL_VideoDevice *_this)
 {
     SDL_VideoData *videodata = _this->driverdata;
+    SDL_bool pending = SDL_FALSE;
     int i;
 
     if (videodata && videodata->windowlist) {
@@ -1893,10 +1910,13 @@ static void X11_HandleFocusChanges(SDL_VideoDevice *_this)
                         X11_DispatchFocusOut(_this, data);
                     }
                     data->pending_focus = PENDING_FOCUS_NONE;
+                } else {
+                    pending = SDL_TRUE;
                 }
             }
         }
     }
+    videodata->pending_focus_changes = pending;
 }
 
 static Bool isAnyEvent(Display *display, XEvent *ev, XPointer arg)
@@ -1974,6 +1994,7 @@ int X11_WaitEventTimeout(SDL_VideoDevice *_this, Sint64 timeoutNS)
     }
 
     X11_DispatchEvent(_this, &xevent);
+    X11_Xinput2FlushMotion(_this);
 
 #ifdef SDL_USE_IME
     if (SDL_TextInputActive()) {
@@ -2030,10 +2051,29 @@ void X11_PumpEvents(SDL_VideoDevice *_this)
 
     SDL_zero(xevent);
 
-    /* Keep processing pending events */
-    while (X11_PollEvent(data->display, &xevent)) {
+    /* Keep processing pending events, this only reads from the connection
+       when the queue is empty rather than searching it for each event.
+       Like XPending(), it flushes the requests we've made before reading,
+       including any made while dispatching events. */
+    while (X11_XEventsQueued(data->display, QueuedAfterFlush) > 0) {
+        X11_XNextEvent(data->display, &xevent);
+
+        /* Only the last of a run of core motion events for a window matters,
+           event hooks still get to see every event */
+        if (xevent.type == MotionNotify && !g_X11EventHook &&
+            X11_XEventsQueued(data->display, QueuedAlready) > 0) {
+            XEvent next;
+            X11_XPeekEvent(data->display, &next);
+            if (next.type == MotionNotify &&
+                next.xmotion.window == xevent.xmotion.window &&
+                next.xmotion.state == xevent.xmotion.state) {
+                continue;
+            }
+        }
+
         X11_DispatchEvent(_this, &xevent);
     }
+    X11_Xinput2FlushMotion(_this);
 
 #ifdef SDL_USE_IME
     if (SDL_TextInputActive()) {
@@ -2045,16 +2085,29 @@ void X11_PumpEvents(SDL_VideoDevice *_this)
     SDL_DBus_PumpEvents();
 #endif
 
-    /* FIXME: Only need to do this when there are pending focus changes */
-    X11_HandleFocusChanges(_this);
+    /* Time out stalled clipboard transfers */
+    if (data->clipboard_requests || data->clipboard_transfers) {
+        X11_UpdateClipboard(_this);
+    }
+
+    if (data->pending_focus_changes) {
+        X11_HandleFocusChanges(_this);
+    }
+
+    if (data->flashing_windows) {
+        SDL_bool flashing = SDL_FALSE;
 
-    /* FIXME: Only need to do this when there are flashing windows */
-    for (i = 0; i < data->numwindows; ++i) {
-        if (data->windowlist[i] != NULL &&
-            data->windowlist[i]->flash_cancel_time &&
-            SDL_GetTicks() >= data->windowlist[i]->flash_cancel_time) {
-            X11_FlashWindow(_this, data->windowlist[i]->window, SDL_FLASH_CANCEL);
+        for (i = 0; i < data->numwindows; ++i) {
+            if (data->windowlist[i] != NULL &&
+                data->windowlist[i]->flash_cancel_time) {
+                if (SDL_GetTicks() >= data->windowlist[i]->flash_cancel_time) {
+                    X11_FlashWindow(_this, data->windowlist[i]->window, SDL_FLASH_CANCEL);
+                } else {
+                    flashing = SDL_TRUE;
+                }
+            }
         }
+        data->flashing_windows = flashing;
     }
 
     if (data->xinput_hierarchy_changed) {
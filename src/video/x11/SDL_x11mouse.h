@@ -33,6 +33,17 @@ typedef struct SDL_XInput2DeviceInfo
     struct SDL_XInput2DeviceInfo *next;
 } SDL_XInput2DeviceInfo;
 
+/* Mouse motion from consecutive XInput2 events, merged and sent as one */
+typedef struct SDL_XInput2PendingMotion
+{
+    SDL_bool pending;
+    SDL_bool relative;
+    SDL_MouseID mouseID;
+    SDL_WindowID windowID; /* The window for absolute motion */
+    double x;
+    double y;
+} SDL_XInput2PendingMotion;
+
 extern void X11_InitMouse(SDL_VideoDevice *_this);
 extern void X11_QuitMouse(SDL_VideoDevice *_this);
 extern void X11_SetHitTestCursor(SDL_HitTestResult rc);
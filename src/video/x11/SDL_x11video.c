@@ -260,6 +260,7 @@ static SDL_VideoDevice *X11_CreateDevice(void)
     device->GetTextMimeTypes = X11_GetTextMimeTypes;
     device->SetClipboardData = X11_SetClipboardData;
     device->GetClipboardData = X11_GetClipboardData;
+    device->RequestClipboardData = X11_RequestClipboardData;
     device->HasClipboardData = X11_HasClipboardData;
     device->SetPrimarySelectionText = X11_SetPrimarySelectionText;
     device->GetPrimarySelectionText = X11_GetPrimarySelectionText;
@@ -55,6 +55,9 @@ struct SDL_VideoData
     Window clipboard_window;
     SDLX11_ClipboardData clipboard;
     SDLX11_ClipboardData primary_selection;
+    SDLX11_ClipboardRequest *clipboard_requests;
+    SDLX11_ClipboardCacheEntry *clipboard_cache;
+    SDLX11_ClipboardTransfer *clipboard_transfers;
 #ifdef SDL_VIDEO_DRIVER_X11_XFIXES
     SDL_Window *active_cursor_confined_window;
 #endif /* SDL_VIDEO_DRIVER_X11_XFIXES */
@@ -102,7 +105,6 @@ struct SDL_VideoData
     Atom XKLAVIER_STATE;
 
     SDL_Scancode key_layout[256];
-    SDL_bool selection_waiting;
 
     SDL_bool broken_pointer_grab; /* true if XGrabPointer seems unreliable. */
 
@@ -113,8 +115,12 @@ struct SDL_VideoData
     Uint32 global_mouse_buttons;
 
     SDL_XInput2DeviceInfo *mouse_device_info;
+    SDL_XInput2PendingMotion pending_motion;
     SDL_bool xinput_hierarchy_changed;
 
+    SDL_bool pending_focus_changes; /* true if a window has a delayed focus change */
+    SDL_bool flashing_windows;      /* true if a window has a flash to cancel */
+
     int xrandr_event_base;
 
 #ifdef SDL_VIDEO_DRIVER_X11_HAS_XKBKEYCODETOKEYSYM
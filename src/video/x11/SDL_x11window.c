@@ -1991,6 +1991,7 @@ int X11_FlashWindow(SDL_VideoDevice *_this, SDL_Window *window, SDL_FlashOperati
             data->flashing_window = SDL_TRUE;
             /* On Ubuntu 21.04 this causes a dialog to pop up, so leave it up for a full second so users can see it */
             data->flash_cancel_time = SDL_GetTicks() + 1000;
+            data->videodata->flashing_windows = SDL_TRUE;
         }
         break;
     case SDL_FLASH_UNTIL_FOCUSED:
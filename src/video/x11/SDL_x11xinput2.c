@@ -275,6 +275,32 @@ static SDL_XInput2DeviceInfo *xinput2_get_device_info(SDL_VideoData *videodata,
     return devinfo;
 }
 
+/* High rate mice send many motion events per frame, consecutive events from
+   the same mouse are merged here and sent when any other event arrives */
+static void xinput2_queue_motion(SDL_VideoDevice *_this, SDL_bool relative, SDL_MouseID mouseID, SDL_Window *window, double x, double y)
+{
+    SDL_VideoData *videodata = (SDL_VideoData *)_this->driverdata;
+    SDL_XInput2PendingMotion *motion = &videodata->pending_motion;
+    const SDL_WindowID windowID = window ? window->id : 0;
+
+    if (motion->pending &&
+        (motion->relative != relative || motion->mouseID != mouseID || motion->windowID != windowID)) {
+        X11_Xinput2FlushMotion(_this);
+    }
+
+    if (motion->pending && relative) {
+        motion->x += x;
+        motion->y += y;
+    } else {
+        motion->x = x;
+        motion->y = y;
+    }
+    motion->pending = SDL_TRUE;
+    motion->relative = relative;
+    motion->mouseID = mouseID;
+    motion->windowID = windowID;
+}
+
 static void xinput2_pen_ensure_window(SDL_VideoDevice *_this, const SDL_Pen *pen, Window window)
 {
     /* When "flipping" a Wacom eraser pen, we get an XI_DeviceChanged event
@@ -371,7 +397,7 @@ void X11_HandleXinput2Event(SDL_VideoDevice *_this, XGenericEventCookie *cookie)
             }
         }
 
-        SDL_SendMouseMotion(0, mouse->focus, (SDL_MouseID)rawev->sourceid, SDL_TRUE, (float)processed_coords[0], (float)processed_coords[1]);
+        xinput2_queue_motion(_this, SDL_TRUE, (SDL_MouseID)rawev->sourceid, NULL, processed_coords[0], processed_coords[1]);
         devinfo->prev_coords[0] = coords[0];
         devinfo->prev_coords[1] = coords[1];
     } break;
@@ -512,8 +538,7 @@ void X11_HandleXinput2Event(SDL_VideoDevice *_this, XGenericEventCookie *cookie)
             if (!mouse->relative_mode || mouse->relative_mode_warp) {
                 SDL_Window *window = xinput2_get_sdlwindow(videodata, xev->event);
                 if (window) {
-                    X11_ProcessHitTest(_this, window->driverdata, (float)xev->event_x, (float)xev->event_y, SDL_FALSE);
-                    SDL_SendMouseMotion(0, window, (SDL_MouseID)xev->sourceid, SDL_FALSE, (float)xev->event_x, (float)xev->event_y);
+                    xinput2_queue_motion(_this, SDL_FALSE, (SDL_MouseID)xev->sourceid, window, xev->event_x, xev->event_y);
                 }
             }
         }
@@ -551,6 +576,41 @@ void X11_HandleXinput2Event(SDL_VideoDevice *_this, XGenericEventCookie *cookie)
 #endif /* SDL_VIDEO_DRIVER_X11_XINPUT2 */
 }
 
+SDL_bool X11_Xinput2IsMotionEvent(const XEvent *xevent)
+{
+#ifdef SDL_VIDEO_DRIVER_X11_XINPUT2
+    if (xevent->type == GenericEvent && xevent->xcookie.extension == xinput2_opcode) {
+        return xevent->xcookie.evtype == XI_Motion || xevent->xcookie.evtype == XI_RawMotion;
+    }
+#endif
+    return SDL_FALSE;
+}
+
+void X11_Xinput2FlushMotion(SDL_VideoDevice *_this)
+{
+#ifdef SDL_VIDEO_DRIVER_X11_XINPUT2
+    SDL_VideoData *videodata = (SDL_VideoData *)_this->driverdata;
+    SDL_XInput2PendingMotion *motion = &videodata->pending_motion;
+
+    if (!motion->pending) {
+        return;
+    }
+    motion->pending = SDL_FALSE;
+
+    if (motion->relative) {
+        SDL_Mouse *mouse = SDL_GetMouse();
+        SDL_SendMouseMotion(0, mouse->focus, motion->mouseID, SDL_TRUE, (float)motion->x, (float)motion->y);
+    } else {
+        /* The window may have been destroyed by an event watcher since the motion was queued */
+        SDL_Window *window = SDL_GetWindowFromID(motion->windowID);
+        if (window) {
+            X11_ProcessHitTest(_this, window->driverdata, (float)motion->x, (float)motion->y, SDL_FALSE);
+            SDL_SendMouseMotion(0, window, motion->mouseID, SDL_FALSE, (float)motion->x, (float)motion->y);
+        }
+    }
+#endif
+}
+
 void X11_InitXinput2Multitouch(SDL_VideoDevice *_this)
 {
 }
@@ -33,6 +33,8 @@ typedef struct XGenericEventCookie XGenericEventCookie;
 extern SDL_bool X11_InitXinput2(SDL_VideoDevice *_this);
 extern void X11_InitXinput2Multitouch(SDL_VideoDevice *_this);
 extern void X11_HandleXinput2Event(SDL_VideoDevice *_this, XGenericEventCookie *cookie);
+extern SDL_bool X11_Xinput2IsMotionEvent(const XEvent *xevent);
+extern void X11_Xinput2FlushMotion(SDL_VideoDevice *_this);
 extern int X11_Xinput2IsInitialized(void);
 extern int X11_Xinput2IsMultitouchSupported(void);
 extern void X11_Xinput2SelectTouch(SDL_VideoDevice *_this, SDL_Window *window);
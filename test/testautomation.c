@@ -44,10 +44,13 @@ static SDLTest_TestSuiteReference *testSuites[] = {
     &renderTestSuite,
     &iostrmTestSuite,
     &sdltestTestSuite,
+    &sensorTestSuite,
     &stdlibTestSuite,
     &surfaceTestSuite,
     &timeTestSuite,
     &timerTestSuite,
+    &touchTestSuite,
+    &traceTestSuite,
     &videoTestSuite,
     &subsystemsTestSuite, /* run last, not interfere with other test enviroment */
     NULL
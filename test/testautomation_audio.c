@@ -1214,6 +1214,178 @@ static int audio_convertAccuracy(void *arg)
     return TEST_COMPLETED;
 }
 
+/* Scalar reference conversions, matching the bit-exact behaviour of SDL's fallback converters. */
+typedef union
+{
+    Uint32 u32;
+    float f32;
+} reference_float_bits;
+
+#define REFERENCE_SIGNMASK(x) (Uint32)(0u - ((Uint32)(x) >> 31))
+
+static Uint32 reference_from_float(float f, SDL_AudioFormat format)
+{
+    reference_float_bits x;
+    Uint32 y, z;
+
+    switch (SDL_AUDIO_BITSIZE(format)) {
+    case 8:
+        x.f32 = f + 98304.0f;
+        y = x.u32 - 0x47C00000u;
+        z = 0x7Fu - (y ^ REFERENCE_SIGNMASK(y));
+        y = y ^ (z & REFERENCE_SIGNMASK(z));
+        return (SDL_AUDIO_ISSIGNED(format) ? y : (y ^ 0x80u)) & 0xFF;
+    case 16:
+        x.f32 = f + 384.0f;
+        y = x.u32 - 0x43C00000u;
+        z = 0x7FFFu - (y ^ REFERENCE_SIGNMASK(y));
+        y = y ^ (z & REFERENCE_SIGNMASK(z));
+        return y & 0xFFFF;
+    default:
+        if (SDL_AUDIO_ISFLOAT(format)) {
+            x.f32 = f;
+            return x.u32;
+        }
+        x.f32 = f;
+        y = x.u32 + 0x0F800000u;
+        z = y - 0xCF000000u;
+        z &= REFERENCE_SIGNMASK(y ^ z);
+        x.u32 = y - z;
+        return (Uint32)((Sint32)x.f32 ^ (Sint32)REFERENCE_SIGNMASK(z));
+    }
+}
+
+/* Returns the bits of the expected float, so NaNs from random F32 input compare correctly too. */
+static Uint32 reference_to_float(Uint32 sample, SDL_AudioFormat format)
+{
+    reference_float_bits x;
+
+    switch (SDL_AUDIO_BITSIZE(format)) {
+    case 8:
+        x.f32 = SDL_AUDIO_ISSIGNED(format) ? ((float)(Sint8)sample / 128.0f) : (((float)sample - 128.0f) / 128.0f);
+        break;
+    case 16:
+        x.f32 = (float)(Sint16)sample / 32768.0f;
+        break;
+    default:
+        if (SDL_AUDIO_ISFLOAT(format)) {
+            return sample;
+        }
+        x.f32 = (float)(Sint32)sample * 0.0000000004656612873077392578125f;
+        break;
+    }
+    return x.u32;
+}
+
+#undef REFERENCE_SIGNMASK
+
+static Uint32 reference_load(const Uint8 *data, int index, SDL_AudioFormat format)
+{
+    const SDL_bool swap = (SDL_AUDIO_ISBIGENDIAN(format) != 0) != (SDL_BYTEORDER == SDL_BIG_ENDIAN);
+    Uint16 u16;
+    Uint32 u32;
+
+    switch (SDL_AUDIO_BITSIZE(format)) {
+    case 8:
+        return data[index];
+    case 16:
+        SDL_memcpy(&u16, data + index * 2, 2);
+        return swap ? SDL_Swap16(u16) : u16;
+    default:
+        SDL_memcpy(&u32, data + index * 4, 4);
+        return swap ? SDL_Swap32(u32) : u32;
+    }
+}
+
+/**
+ * Check that the (possibly SIMD-accelerated) converters match the scalar reference exactly
+ *
+ * \sa SDL_ConvertAudioSamples
+ */
+static int audio_convertAgainstReference(void *arg)
+{
+    static const SDL_AudioFormat formats[] = {
+        SDL_AUDIO_S8, SDL_AUDIO_U8, SDL_AUDIO_S16LE, SDL_AUDIO_S16BE,
+        SDL_AUDIO_S32LE, SDL_AUDIO_S32BE, SDL_AUDIO_F32BE
+    };
+    static const char *format_names[] = { "S8", "U8", "S16LE", "S16BE", "S32LE", "S32BE", "F32BE" };
+    /* an odd length, so the vectorized paths also have to deal with unaligned heads and tails */
+    const int num_samples = 65536 + 1024 + 4003;
+    float *floats = (float *)SDL_malloc(num_samples * sizeof(float));
+    Uint8 *ints = (Uint8 *)SDL_malloc(num_samples * sizeof(Uint32));
+    SDL_AudioSpec float_spec, int_spec;
+    int i, j;
+
+    if (!SDLTest_AssertCheck(floats && ints, "Expected buffers to be created.")) {
+        SDL_free(floats);
+        SDL_free(ints);
+        return TEST_ABORTED;
+    }
+
+    /* exact 16-bit steps (including the rounding ties of the 8-bit formats), values near and past full scale, and noise */
+    for (i = 0; i < 65536; ++i) {
+        floats[i] = ((float)i - 32768.0f) / 32768.0f;
+    }
+    for (i = 0; i < 1024; ++i) {
+        floats[65536 + i] = ((i & 1) ? -1.0f : 1.0f) * (1.0f + (float)(i / 2) / 128.0f);
+    }
+    for (i = 65536 + 1024; i < num_samples; ++i) {
+        floats[i] = SDLTest_RandomSint32() / 1073741824.0f;
+    }
+    for (i = 0; i < num_samples * 4; ++i) {
+        ints[i] = (Uint8)SDLTest_RandomUint8();
+    }
+
+    float_spec.format = SDL_AUDIO_F32;
+    float_spec.channels = 1;
+    float_spec.freq = 48000;
+    int_spec.channels = 1;
+    int_spec.freq = 48000;
+
+    for (i = 0; i < (int)SDL_arraysize(formats); ++i) {
+        const SDL_AudioFormat format = formats[i];
+        const int sample_size = SDL_AUDIO_BYTESIZE(format);
+        Uint8 *dst_data = NULL;
+        int dst_len = 0;
+        int mismatches = 0;
+        int ret;
+
+        int_spec.format = format;
+
+        ret = SDL_ConvertAudioSamples(&float_spec, (const Uint8 *)floats, num_samples * (int)sizeof(float), &int_spec, &dst_data, &dst_len);
+        SDLTest_AssertCheck(ret == 0 && dst_len == num_samples * sample_size, "Expected SDL_ConvertAudioSamples(F32->%s) to succeed", format_names[i]);
+        if (ret == 0) {
+            for (j = 0; j < num_samples; ++j) {
+                if (reference_load(dst_data, j, format) != reference_from_float(floats[j], format)) {
+                    mismatches++;
+                }
+            }
+            SDLTest_AssertCheck(mismatches == 0, "Expected F32->%s to match the scalar reference, %d samples differ", format_names[i], mismatches);
+        }
+        SDL_free(dst_data);
+
+        dst_data = NULL;
+        dst_len = 0;
+        mismatches = 0;
+        ret = SDL_ConvertAudioSamples(&int_spec, ints, num_samples * sample_size, &float_spec, &dst_data, &dst_len);
+        SDLTest_AssertCheck(ret == 0 && dst_len == num_samples * (int)sizeof(float), "Expected SDL_ConvertAudioSamples(%s->F32) to succeed", format_names[i]);
+        if (ret == 0) {
+            for (j = 0; j < num_samples; ++j) {
+                if (reference_to_float(reference_load(ints, j, format), format) != reference_load(dst_data, j, SDL_AUDIO_F32)) {
+                    mismatches++;
+                }
+            }
+            SDLTest_AssertCheck(mismatches == 0, "Expected %s->F32 to match the scalar reference, %d samples differ", format_names[i], mismatches);
+        }
+        SDL_free(dst_data);
+    }
+
+    SDL_free(floats);
+    SDL_free(ints);
+
+    return TEST_COMPLETED;
+}
+
 /**
  * Check accuracy when switching between formats
  *
@@ -1366,6 +1538,307 @@ cleanup:
 
     return status;
 }
+
+/**
+ * Bind several streams to one capture device and check that each of them gets the captured data.
+ *
+ * \sa SDL_BindAudioStreams
+ */
+static int audio_captureMultipleStreams(void *arg)
+{
+    int i;
+    int retval;
+    int status = TEST_ABORTED;
+    SDL_AudioSpec spec, converted_spec;
+    SDL_AudioDeviceID devid = 0;
+    SDL_AudioStream *streams[3] = { NULL, NULL, NULL };
+    Uint8 buffer_1[512];
+    Uint8 buffer_2[512];
+    Uint64 timeout;
+
+    spec.format = SDL_AUDIO_S16;
+    spec.channels = 1;
+    spec.freq = 44100;
+
+    converted_spec.format = SDL_AUDIO_F32;
+    converted_spec.channels = 2;
+    converted_spec.freq = 48000;
+
+    devid = SDL_OpenAudioDevice(SDL_AUDIO_DEVICE_DEFAULT_CAPTURE, &spec);
+    if (devid == 0) {
+        SDLTest_Log("No capture device available, skipping: %s", SDL_GetError());
+        return TEST_SKIPPED;
+    }
+
+    retval = SDL_GetAudioDeviceFormat(devid, &spec, NULL);
+    if (!SDLTest_AssertCheck(retval == 0, "Expected SDL_GetAudioDeviceFormat to succeed")) {
+        goto cleanup;
+    }
+
+    /* two streams that want the device's format, and one that needs conversion and resampling. */
+    for (i = 0; i < (int)SDL_arraysize(streams); i++) {
+        streams[i] = SDL_CreateAudioStream(NULL, (i == 2) ? &converted_spec : &spec);
+        if (!SDLTest_AssertCheck(streams[i] != NULL, "Expected SDL_CreateAudioStream to succeed")) {
+            goto cleanup;
+        }
+    }
+
+    SDL_PauseAudioDevice(devid);
+    retval = SDL_BindAudioStreams(devid, streams, (int)SDL_arraysize(streams));
+    if (!SDLTest_AssertCheck(retval == 0, "Expected SDL_BindAudioStreams to succeed")) {
+        goto cleanup;
+    }
+    SDL_ResumeAudioDevice(devid);
+
+    timeout = SDL_GetTicks() + 2000;
+    while ((SDL_GetAudioStreamAvailable(streams[2]) < (int)sizeof(buffer_1)) && (SDL_GetTicks() < timeout)) {
+        SDL_Delay(10);
+    }
+
+    /* unbinding waits for the device thread, so no more data arrives after this. */
+    SDL_UnbindAudioStreams(streams, (int)SDL_arraysize(streams));
+
+    for (i = 0; i < (int)SDL_arraysize(streams); i++) {
+        retval = SDL_GetAudioStreamAvailable(streams[i]);
+        SDLTest_AssertCheck(retval > 0, "Expected stream %d to have captured data, got %d bytes", i, retval);
+    }
+
+    /* the unconverted streams were fed the same device buffers, so they must match exactly. */
+    retval = SDL_GetAudioStreamAvailable(streams[0]);
+    SDLTest_AssertCheck(retval == SDL_GetAudioStreamAvailable(streams[1]), "Expected same-format streams to have the same amount of data");
+    retval = SDL_min(retval, (int)sizeof(buffer_1));
+    SDLTest_AssertCheck(SDL_GetAudioStreamData(streams[0], buffer_1, retval) == retval, "Expected SDL_GetAudioStreamData on stream 0 to succeed");
+    SDLTest_AssertCheck(SDL_GetAudioStreamData(streams[1], buffer_2, retval) == retval, "Expected SDL_GetAudioStreamData on stream 1 to succeed");
+    SDLTest_AssertCheck(SDL_memcmp(buffer_1, buffer_2, retval) == 0, "Expected same-format streams to have identical data");
+
+    status = TEST_COMPLETED;
+
+cleanup:
+    SDL_CloseAudioDevice(devid);
+    for (i = 0; i < (int)SDL_arraysize(streams); i++) {
+        SDL_DestroyAudioStream(streams[i]);
+    }
+
+    return status;
+}
+
+/**
+ * Check the audio device and stream performance counters.
+ *
+ * \sa SDL_GetAudioDeviceStats
+ * \sa SDL_GetAudioStreamStats
+ */
+static int audio_statsCounters(void *arg)
+{
+    int retval;
+    const int frames = 10000;
+    float *buf = NULL;
+    SDL_AudioSpec src_spec, dst_spec;
+    SDL_AudioStream *stream = NULL;
+    SDL_AudioStreamStats stream_stats;
+    SDL_AudioDeviceStats start_stats, device_stats;
+    SDL_AudioDeviceID devid = 0;
+    Uint64 timeout;
+
+    retval = SDL_GetAudioStreamStats(NULL, &stream_stats);
+    SDLTest_AssertCheck(retval < 0, "Expected SDL_GetAudioStreamStats to fail with a NULL stream");
+    retval = SDL_GetAudioDeviceStats(SDL_AUDIO_DEVICE_DEFAULT_OUTPUT, NULL);
+    SDLTest_AssertCheck(retval < 0, "Expected SDL_GetAudioDeviceStats to fail with NULL stats");
+
+    src_spec.format = SDL_AUDIO_F32;
+    src_spec.channels = 1;
+    src_spec.freq = 44100;
+    dst_spec.format = SDL_AUDIO_S16;
+    dst_spec.channels = 2;
+    dst_spec.freq = 48000;
+
+    stream = SDL_CreateAudioStream(&src_spec, &dst_spec);
+    SDLTest_AssertCheck(stream != NULL, "Expected SDL_CreateAudioStream to succeed");
+    buf = (float *)SDL_calloc(frames, 2 * sizeof(float));
+    SDLTest_AssertCheck(buf != NULL, "Expected buffer to be created");
+    if (!stream || !buf) {
+        goto cleanup;
+    }
+
+    retval = SDL_GetAudioStreamStats(stream, &stream_stats);
+    SDLTest_AssertCheck(retval == 0, "Expected SDL_GetAudioStreamStats to succeed");
+    SDLTest_AssertCheck(stream_stats.frames_out == 0, "Expected no frames out from a new stream, got %" SDL_PRIu64, stream_stats.frames_out);
+
+    SDL_PutAudioStreamData(stream, buf, frames * sizeof(float));
+    SDL_FlushAudioStream(stream);
+    retval = SDL_GetAudioStreamData(stream, buf, frames * 2 * sizeof(float));
+    SDLTest_AssertCheck(retval > 0, "Expected SDL_GetAudioStreamData to succeed");
+
+    SDL_GetAudioStreamStats(stream, &stream_stats);
+    SDLTest_AssertCheck(stream_stats.frames_out == (Uint64)(retval / 4), "Expected %d frames out, got %" SDL_PRIu64, retval / 4, stream_stats.frames_out);
+    SDLTest_AssertCheck(stream_stats.resample_ns > 0, "Expected resampling time to be counted");
+    SDLTest_AssertCheck(stream_stats.get_callback_ns == 0 && stream_stats.put_callback_ns == 0, "Expected no callback time without callbacks");
+
+    devid = SDL_OpenAudioDevice(SDL_AUDIO_DEVICE_DEFAULT_OUTPUT, NULL);
+    if (devid == 0) {
+        SDLTest_Log("No output device available, skipping device stats: %s", SDL_GetError());
+        goto cleanup;
+    }
+
+    /* the physical device might already be open from an earlier test, so only look at what changes from here. */
+    SDL_BindAudioStream(devid, stream);
+    retval = SDL_GetAudioDeviceStats(devid, &start_stats);
+    SDLTest_AssertCheck(retval == 0, "Expected SDL_GetAudioDeviceStats to succeed");
+    timeout = SDL_GetTicks() + 2000;
+    do {
+        SDL_Delay(10);
+        retval = SDL_GetAudioDeviceStats(devid, &device_stats);
+    } while ((retval == 0) && (device_stats.periods < start_stats.periods + 2) && (SDL_GetTicks() < timeout));
+
+    SDLTest_AssertCheck(retval == 0, "Expected SDL_GetAudioDeviceStats to succeed");
+    SDLTest_AssertCheck(device_stats.periods >= start_stats.periods + 2, "Expected the device to process buffers, got %" SDL_PRIu64, device_stats.periods - start_stats.periods);
+    SDLTest_AssertCheck(device_stats.period_ns > 0, "Expected a non-zero period");
+    SDLTest_AssertCheck(device_stats.min_mix_ns <= device_stats.avg_mix_ns && device_stats.avg_mix_ns <= device_stats.max_mix_ns,
+                        "Expected min <= avg <= max mix time, got %" SDL_PRIu64 ", %" SDL_PRIu64 ", %" SDL_PRIu64,
+                        device_stats.min_mix_ns, device_stats.avg_mix_ns, device_stats.max_mix_ns);
+    SDLTest_AssertCheck(device_stats.silence_frames > start_stats.silence_frames, "Expected an empty stream to cause silence");
+
+cleanup:
+    SDL_CloseAudioDevice(devid);
+    SDL_DestroyAudioStream(stream);
+    SDL_free(buf);
+
+    return TEST_COMPLETED;
+}
+
+/* Straightforward per-sample version of SDL_MixAudio() for the integer formats, to check the optimized paths against. */
+static Sint64 reference_mix_load(SDL_AudioFormat format, const Uint8 *p)
+{
+    const int size = SDL_AUDIO_BYTESIZE(format);
+    Uint32 bits = 0;
+    int i;
+
+    for (i = 0; i < size; i++) {
+        const int shift = SDL_AUDIO_ISBIGENDIAN(format) ? (size - 1 - i) * 8 : i * 8;
+        bits |= ((Uint32)p[i]) << shift;
+    }
+
+    switch (size) {
+    case 1:
+        return SDL_AUDIO_ISSIGNED(format) ? (Sint64)(Sint8)bits : (Sint64)bits - 128;
+    case 2:
+        return (Sint16)bits;
+    default:
+        return (Sint32)bits;
+    }
+}
+
+static void reference_mix_store(SDL_AudioFormat format, Uint8 *p, Sint64 value)
+{
+    const int size = SDL_AUDIO_BYTESIZE(format);
+    const Sint64 max_value = (((Sint64)1) << (size * 8 - 1)) - 1;
+    Uint32 bits;
+    int i;
+
+    value = SDL_clamp(value, -max_value - 1, max_value);
+    bits = (size == 1 && !SDL_AUDIO_ISSIGNED(format)) ? (Uint32)(value + 128) : (Uint32)value;
+
+    for (i = 0; i < size; i++) {
+        const int shift = SDL_AUDIO_ISBIGENDIAN(format) ? (size - 1 - i) * 8 : i * 8;
+        p[i] = (Uint8)(bits >> shift);
+    }
+}
+
+static void reference_mix(SDL_AudioFormat format, Uint8 *dst, const Uint8 *src, int len, int volume)
+{
+    const int size = SDL_AUDIO_BYTESIZE(format);
+    int i;
+
+    for (i = 0; i < len; i += size) {
+        const Sint64 adjusted = (reference_mix_load(format, &src[i]) * volume) / 128;
+        reference_mix_store(format, &dst[i], reference_mix_load(format, &dst[i]) + adjusted);
+    }
+}
+
+/**
+ * Check SDL_MixAudio() for integer formats against a scalar reference, and time it.
+ *
+ * \sa SDL_MixAudio
+ */
+static int audio_mixAudio(void *arg)
+{
+    static const SDL_AudioFormat formats[] = { SDL_AUDIO_U8, SDL_AUDIO_S8, SDL_AUDIO_S16LE, SDL_AUDIO_S16BE, SDL_AUDIO_S32LE, SDL_AUDIO_S32BE };
+    static const char *format_names[] = { "U8", "S8", "S16LE", "S16BE", "S32LE", "S32BE" };
+    static const float volumes[] = { 1.0f, 0.5f, 0.3f, 1.0f / 128.0f, 0.999f };
+    const int len = 4093 * 4;  /* not a multiple of any vector size, to cover the leftovers too */
+    const int bench_len = 1 << 20;
+    Uint8 *src = (Uint8 *)SDL_malloc(bench_len);
+    Uint8 *dst = (Uint8 *)SDL_malloc(bench_len);
+    Uint8 *expected = (Uint8 *)SDL_malloc(bench_len);
+    Uint64 tick_beg, tick_end;
+    int i, j, k;
+
+    SDLTest_AssertCheck(src && dst && expected, "Expected buffers to be created");
+    if (!src || !dst || !expected) {
+        goto cleanup;
+    }
+
+    for (i = 0; i < (int)SDL_arraysize(formats); i++) {
+        const SDL_AudioFormat format = formats[i];
+        const int size = SDL_AUDIO_BYTESIZE(format);
+
+        for (j = 0; j < (int)SDL_arraysize(volumes); j++) {
+            int mismatch = -1;
+
+            /* random data, with full-scale values mixed in to hit the saturation */
+            for (k = 0; k < len; k++) {
+                src[k] = (Uint8)SDLTest_RandomUint8();
+                dst[k] = (Uint8)SDLTest_RandomUint8();
+            }
+            for (k = 0; k < len; k += 7 * size) {
+                SDL_memset(&src[k], (k & 1) ? 0x80 : 0x7F, size);
+                SDL_memset(&dst[k], (k & 1) ? 0x80 : 0x7F, size);
+            }
+            SDL_memcpy(expected, dst, len);
+
+            reference_mix(format, expected, src, len, (int)SDL_roundf(volumes[j] * 128));
+            SDLTest_AssertCheck(SDL_MixAudio(dst, src, format, len, volumes[j]) == 0, "Expected SDL_MixAudio to succeed");
+
+            for (k = 0; k < len; k++) {
+                if (dst[k] != expected[k]) {
+                    mismatch = k;
+                    break;
+                }
+            }
+            SDLTest_AssertCheck(mismatch < 0, "Expected mixing %s at volume %f to match the reference (first mismatch at byte %d)",
+                                format_names[i], volumes[j], mismatch);
+        }
+    }
+
+    /* Benchmark the common case against the scalar reference. */
+    SDL_memset(src, 0x11, bench_len);
+    SDL_memset(dst, 0x22, bench_len);
+    SDL_memcpy(expected, dst, bench_len);
+
+    tick_beg = SDL_GetPerformanceCounter();
+    for (i = 0; i < 10; i++) {
+        reference_mix(SDL_AUDIO_S16, expected, src, bench_len, 64);
+    }
+    tick_end = SDL_GetPerformanceCounter();
+    SDLTest_Log("Reference S16 mixing used %f seconds.", ((double)(tick_end - tick_beg)) / SDL_GetPerformanceFrequency());
+
+    tick_beg = SDL_GetPerformanceCounter();
+    for (i = 0; i < 10; i++) {
+        SDL_MixAudio(dst, src, SDL_AUDIO_S16, bench_len, 0.5f);
+    }
+    tick_end = SDL_GetPerformanceCounter();
+    SDLTest_Log("SDL_MixAudio S16 mixing used %f seconds.", ((double)(tick_end - tick_beg)) / SDL_GetPerformanceFrequency());
+
+    SDLTest_AssertCheck(SDL_memcmp(dst, expected, bench_len) == 0, "Expected benchmark results to match the reference");
+
+cleanup:
+    SDL_free(src);
+    SDL_free(dst);
+    SDL_free(expected);
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test Case References ================== */
 
 /* Audio test cases */
@@ -1443,12 +1916,28 @@ static const SDLTest_TestCaseReference audioTest18 = {
     audio_formatChange, "audio_formatChange", "Check handling of format changes.", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference audioTest19 = {
+    audio_captureMultipleStreams, "audio_captureMultipleStreams", "Check that several streams bound to one capture device all get its data.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest20 = {
+    audio_convertAgainstReference, "audio_convertAgainstReference", "Check that audio format converters match the scalar reference exactly.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest21 = {
+    audio_statsCounters, "audio_statsCounters", "Check the audio device and stream performance counters.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest22 = {
+    audio_mixAudio, "audio_mixAudio", "Check SDL_MixAudio for integer formats against a scalar reference.", TEST_ENABLED
+};
+
 /* Sequence of Audio test cases */
 static const SDLTest_TestCaseReference *audioTests[] = {
     &audioTest1, &audioTest2, &audioTest3, &audioTest4, &audioTest5, &audioTest6,
     &audioTest7, &audioTest8, &audioTest9, &audioTest10, &audioTest11,
     &audioTest12, &audioTest13, &audioTest14, &audioTest15, &audioTest16,
-    &audioTest17, &audioTest18, NULL
+    &audioTest17, &audioTest18, &audioTest19, &audioTest20, &audioTest21, &audioTest22, NULL
 };
 
 /* Audio test suite (global) */
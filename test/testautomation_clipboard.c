@@ -541,6 +541,104 @@ static int clipboard_testPrimarySelectionTextFunctions(void *arg)
     return TEST_COMPLETED;
 }
 
+typedef struct
+{
+    int count;
+    char mime_type[32];
+    char data[32];
+    size_t size;
+} ClipboardRequestResult;
+
+static void SDLCALL ClipboardRequestCallback(void *userdata, const char *mime_type, const void *data, size_t size)
+{
+    ClipboardRequestResult *result = (ClipboardRequestResult *)userdata;
+
+    ++result->count;
+    SDL_strlcpy(result->mime_type, mime_type, sizeof(result->mime_type));
+    result->size = size;
+    if (data && size < sizeof(result->data)) {
+        SDL_memcpy(result->data, data, size);
+        result->data[size] = '\0';
+    }
+}
+
+/**
+ * End-to-end test of SDL_RequestClipboardData
+ * \sa SDL_RequestClipboardData
+ * \sa SDL_SetClipboardData
+ */
+static int clipboard_testRequestClipboardData(void *arg)
+{
+    ClipboardRequestResult request;
+    TestClipboardData test_data = { NULL, 0 };
+    Uint64 start;
+    int result;
+
+    /* Validate error handling */
+    result = SDL_RequestClipboardData(NULL, ClipboardRequestCallback, &request);
+    SDLTest_AssertCheck(
+        result == -1,
+        "Validate SDL_RequestClipboardData(NULL mime type) result, expected -1, got %i",
+        result);
+    result = SDL_RequestClipboardData(test_mime_types[TEST_MIME_TYPE_TEXT], NULL, &request);
+    SDLTest_AssertCheck(
+        result == -1,
+        "Validate SDL_RequestClipboardData(NULL callback) result, expected -1, got %i",
+        result);
+
+    result = SDL_SetClipboardData(ClipboardDataCallback, ClipboardCleanupCallback, &test_data, test_mime_types, SDL_arraysize(test_mime_types));
+    SDLTest_AssertCheck(
+        result == 0,
+        "Validate SDL_SetClipboardData(test_data) result, expected 0, got %i",
+        result);
+
+    /* The data may be delivered later, while events are pumped */
+    SDL_zero(request);
+    result = SDL_RequestClipboardData(test_mime_types[TEST_MIME_TYPE_CUSTOM_TEXT], ClipboardRequestCallback, &request);
+    SDLTest_AssertCheck(
+        result == 0,
+        "Validate SDL_RequestClipboardData(test/text) result, expected 0, got %i",
+        result);
+    start = SDL_GetTicks();
+    while (request.count == 0 && SDL_GetTicks() - start < 1000) {
+        SDL_PumpEvents();
+        SDL_Delay(1);
+    }
+    SDLTest_AssertCheck(
+        request.count == 1,
+        "Verify request callback count, expected 1, got %d",
+        request.count);
+    SDLTest_AssertCheck(
+        SDL_strcmp(request.mime_type, test_mime_types[TEST_MIME_TYPE_CUSTOM_TEXT]) == 0,
+        "Verify request mime type, expected %s, got %s",
+        test_mime_types[TEST_MIME_TYPE_CUSTOM_TEXT], request.mime_type);
+    SDLTest_AssertCheck(
+        request.size == 6 && SDL_strcmp(request.data, "CUSTOM") == 0,
+        "Verify request data, expected CUSTOM, got %s (%u bytes)",
+        request.data, (unsigned int)request.size);
+
+    /* Missing data is reported to the callback as empty */
+    SDL_zero(request);
+    result = SDL_RequestClipboardData("test/missing", ClipboardRequestCallback, &request);
+    SDLTest_AssertCheck(
+        result == 0,
+        "Validate SDL_RequestClipboardData(test/missing) result, expected 0, got %i",
+        result);
+    start = SDL_GetTicks();
+    while (request.count == 0 && SDL_GetTicks() - start < 1000) {
+        SDL_PumpEvents();
+        SDL_Delay(1);
+    }
+    SDLTest_AssertCheck(
+        request.count == 1 && request.size == 0,
+        "Verify missing data, expected 1 callback with 0 bytes, got %d callbacks with %u bytes",
+        request.count, (unsigned int)request.size);
+
+    SDL_ClearClipboardData();
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 static const SDLTest_TestCaseReference clipboardTest1 = {
@@ -555,9 +653,13 @@ static const SDLTest_TestCaseReference clipboardTest3 = {
     (SDLTest_TestCaseFp)clipboard_testPrimarySelectionTextFunctions, "clipboard_testPrimarySelectionTextFunctions", "End-to-end test of SDL_xyzPrimarySelectionText functions", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference clipboardTest4 = {
+    (SDLTest_TestCaseFp)clipboard_testRequestClipboardData, "clipboard_testRequestClipboardData", "End-to-end test of SDL_RequestClipboardData", TEST_ENABLED
+};
+
 /* Sequence of Clipboard test cases */
 static const SDLTest_TestCaseReference *clipboardTests[] = {
-    &clipboardTest1, &clipboardTest2, &clipboardTest3,  NULL
+    &clipboardTest1, &clipboardTest2, &clipboardTest3, &clipboardTest4, NULL
 };
 
 /* Clipboard test suite (global) */
@@ -227,6 +227,73 @@ static int hints_setHint(void *arg)
     return TEST_COMPLETED;
 }
 
+#define HINTS_TEST_THREAD_COUNT 4
+#define HINTS_TEST_THREAD_HINTS 64
+
+typedef struct
+{
+    int index;
+    SDL_AtomicInt calls;
+} HintsThreadData;
+
+static void SDLCALL hints_testThreadHintChanged(void *userdata, const char *name, const char *oldValue, const char *hint)
+{
+    SDL_AtomicIncRef(&((HintsThreadData *)userdata)->calls);
+}
+
+static int SDLCALL hints_testThread(void *arg)
+{
+    HintsThreadData *data = (HintsThreadData *)arg;
+    char name[64];
+    int i;
+
+    /* Each hint is new, so every call adds to the hint list while the other threads walk it */
+    for (i = 0; i < HINTS_TEST_THREAD_HINTS; ++i) {
+        SDL_snprintf(name, sizeof(name), "SDL_AUTOMATED_TEST_THREAD_HINT_%d_%d", data->index, i);
+        SDL_AddHintCallback(name, hints_testThreadHintChanged, data);
+        SDL_GetHint(SDL_HINT_CPU_FEATURE_MASK);
+    }
+    return 0;
+}
+
+/**
+ * Add hint callbacks from several threads at once, like parallel subsystem initialization does
+ */
+static int hints_threadedCallbacks(void *arg)
+{
+    HintsThreadData data[HINTS_TEST_THREAD_COUNT];
+    SDL_Thread *threads[HINTS_TEST_THREAD_COUNT];
+    char name[64];
+    int i, j;
+
+    for (i = 0; i < HINTS_TEST_THREAD_COUNT; ++i) {
+        data[i].index = i;
+        SDL_AtomicSet(&data[i].calls, 0);
+        threads[i] = SDL_CreateThread(hints_testThread, "HintsTest", &data[i]);
+        SDLTest_AssertCheck(threads[i] != NULL, "Check that hint thread %d was created", i);
+    }
+    for (i = 0; i < HINTS_TEST_THREAD_COUNT; ++i) {
+        SDL_WaitThread(threads[i], NULL);
+    }
+    SDLTest_AssertPass("Call to SDL_AddHintCallback() from %d threads", HINTS_TEST_THREAD_COUNT);
+
+    /* Every callback should have been added, changing the hints calls each of them once more */
+    for (i = 0; i < HINTS_TEST_THREAD_COUNT; ++i) {
+        for (j = 0; j < HINTS_TEST_THREAD_HINTS; ++j) {
+            SDL_snprintf(name, sizeof(name), "SDL_AUTOMATED_TEST_THREAD_HINT_%d_%d", i, j);
+            SDL_SetHint(name, "1");
+            SDL_DelHintCallback(name, hints_testThreadHintChanged, &data[i]);
+            SDL_ResetHint(name);
+        }
+        SDLTest_AssertCheck(
+            SDL_AtomicGet(&data[i].calls) == 2 * HINTS_TEST_THREAD_HINTS,
+            "Callbacks of thread %d were called %d times, expected %d",
+            i, SDL_AtomicGet(&data[i].calls), 2 * HINTS_TEST_THREAD_HINTS);
+    }
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Hints test cases */
@@ -238,9 +305,13 @@ static const SDLTest_TestCaseReference hintsTest2 = {
     (SDLTest_TestCaseFp)hints_setHint, "hints_setHint", "Call to SDL_SetHint", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference hintsTest3 = {
+    (SDLTest_TestCaseFp)hints_threadedCallbacks, "hints_threadedCallbacks", "Call to SDL_AddHintCallback from several threads", TEST_ENABLED
+};
+
 /* Sequence of Hints test cases */
 static const SDLTest_TestCaseReference *hintsTests[] = {
-    &hintsTest1, &hintsTest2, NULL
+    &hintsTest1, &hintsTest2, &hintsTest3, NULL
 };
 
 /* Hints test suite (global) */
@@ -566,6 +566,56 @@ static int keyboard_getScancodeFromName(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * Check that every scancode and keycode round trips through the name and keymap lookups
+ *
+ * \sa SDL_GetScancodeFromName
+ * \sa SDL_GetScancodeFromKey
+ */
+static int keyboard_roundTripLookups(void *arg)
+{
+    SDL_Scancode scancode;
+    int names = 0, keys = 0;
+
+    for (scancode = SDL_SCANCODE_UNKNOWN; scancode < SDL_NUM_SCANCODES; ++scancode) {
+        const char *name = SDL_GetScancodeName(scancode);
+        SDL_Keycode key = SDL_GetKeyFromScancode(scancode);
+
+        if (*name) {
+            char lower[64];
+            SDL_Scancode found;
+            int i;
+
+            found = SDL_GetScancodeFromName(name);
+            if (found != scancode && SDL_strcasecmp(name, SDL_GetScancodeName(found)) != 0) {
+                SDLTest_AssertCheck(SDL_FALSE, "Validate SDL_GetScancodeFromName('%s'), expected: %d, got: %d", name, scancode, found);
+            }
+
+            SDL_strlcpy(lower, name, sizeof(lower));
+            for (i = 0; lower[i]; ++i) {
+                lower[i] = (char)SDL_tolower((unsigned char)lower[i]);
+            }
+            found = SDL_GetScancodeFromName(lower);
+            if (found != scancode && SDL_strcasecmp(name, SDL_GetScancodeName(found)) != 0) {
+                SDLTest_AssertCheck(SDL_FALSE, "Validate SDL_GetScancodeFromName('%s'), expected: %d, got: %d", lower, scancode, found);
+            }
+            ++names;
+        }
+
+        if (key != SDLK_UNKNOWN) {
+            SDL_Scancode found = SDL_GetScancodeFromKey(key);
+            if (found > scancode || SDL_GetKeyFromScancode(found) != key) {
+                SDLTest_AssertCheck(SDL_FALSE, "Validate SDL_GetScancodeFromKey(0x%.8x), expected: %d, got: %d", key, scancode, found);
+            }
+            ++keys;
+        }
+    }
+    SDLTest_AssertPass("Looked up %d scancode names and %d keycodes", names, keys);
+    SDLTest_AssertCheck(names > 0 && keys > 0, "Validate that names and keycodes were checked");
+
+    return TEST_COMPLETED;
+}
+
 /*
  * Local helper to check for the invalid scancode error message
  */
@@ -687,11 +737,15 @@ static const SDLTest_TestCaseReference keyboardTest14 = {
     (SDLTest_TestCaseFp)keyboard_getScancodeNameNegative, "keyboard_getScancodeNameNegative", "Check call to SDL_GetScancodeName with invalid data", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference keyboardTest15 = {
+    (SDLTest_TestCaseFp)keyboard_roundTripLookups, "keyboard_roundTripLookups", "Check that all scancode names and keycodes round trip", TEST_ENABLED
+};
+
 /* Sequence of Keyboard test cases */
 static const SDLTest_TestCaseReference *keyboardTests[] = {
     &keyboardTest1, &keyboardTest2, &keyboardTest3, &keyboardTest4, &keyboardTest5, &keyboardTest6,
     &keyboardTest7, &keyboardTest8, &keyboardTest9, &keyboardTest10, &keyboardTest11, &keyboardTest12,
-    &keyboardTest13, &keyboardTest14, NULL
+    &keyboardTest13, &keyboardTest14, &keyboardTest15, NULL
 };
 
 /* Keyboard test suite (global) */
@@ -1872,6 +1872,150 @@ pen_memoryLayout(void *arg)
     return TEST_COMPLETED;
 }
 
+#define PEN_NUM_REGISTRY_PENS 48
+
+typedef struct
+{
+    SDL_PenID penid;
+    SDL_AtomicInt done;
+    int reads;
+    int torn_reads;
+} pen_status_reader;
+
+/* Reads the pen status until told to stop, the writer always sets x, y and pressure to the same value */
+static int SDLCALL _pen_status_reader_thread(void *arg)
+{
+    pen_status_reader *reader = (pen_status_reader *)arg;
+
+    while (!SDL_AtomicGet(&reader->done)) {
+        float x, y, axes[SDL_PEN_NUM_AXES];
+
+        SDL_GetPenStatus(reader->penid, &x, &y, axes, SDL_PEN_NUM_AXES);
+        if (x != y || x != axes[SDL_PEN_AXIS_PRESSURE]) {
+            ++reader->torn_reads;
+        }
+        ++reader->reads;
+    }
+    return 0;
+}
+
+/**
+ * @brief Check that the pen registry keeps pens in place and finds them by ID, and that pen status reads are consistent
+ *
+ * @sa SDL_GetPens, SDL_PenConnected, SDL_GetPenStatus
+ */
+static int
+pen_registry(void *arg)
+{
+    pen_testdata ptest;
+    deviceinfo_backup *backup = _setup_test(&ptest, 0);
+    SDL_Pen *pens[PEN_NUM_REGISTRY_PENS];
+    SDL_PenID base = 5000;
+    SDL_PenID *ids;
+    pen_status_reader reader;
+    SDL_Thread *thread;
+    int i, count, misplaced, out_of_order;
+
+    /* Find a range of unused IDs, and register them in descending order */
+    for (i = 0; i < PEN_NUM_REGISTRY_PENS; ++i) {
+        if (SDL_GetPenPtr(base + i)) {
+            base += i + 1;
+            i = -1;
+        }
+    }
+    SDL_PenGCMark();
+    for (i = PEN_NUM_REGISTRY_PENS; i--;) {
+        SDL_GUID guid;
+        char name[32];
+
+        SDL_zero(guid);
+        SDL_PenUpdateGUIDForGeneric(&guid, 0x7e57, base + i);
+        SDL_snprintf(name, sizeof(name), "registry pen %d", i);
+        pens[i] = _pen_register(base + i, guid, name, SDL_PEN_INK_MASK | SDL_PEN_AXIS_PRESSURE_MASK);
+        SDL_PenModifyEnd(pens[i], SDL_TRUE);
+    }
+    SDL_PenGCSweep(NULL, _pen_assert_impossible);
+
+    misplaced = 0;
+    for (i = 0; i < PEN_NUM_REGISTRY_PENS; ++i) {
+        if (SDL_GetPenPtr(base + i) != pens[i]) {
+            ++misplaced;
+        }
+    }
+    SDLTest_AssertCheck(misplaced == 0, "All pens stayed in place after registration, %d moved", misplaced);
+
+    ids = SDL_GetPens(&count);
+    out_of_order = 0;
+    for (i = 1; i < count; ++i) {
+        if (ids[i - 1] >= ids[i]) {
+            ++out_of_order;
+        }
+    }
+    SDL_free(ids);
+    SDLTest_AssertCheck(count == PEN_NUM_REGISTRY_PENS, "SDL_GetPens() reports %d pens, expected %d", count, PEN_NUM_REGISTRY_PENS);
+    SDLTest_AssertCheck(out_of_order == 0, "SDL_GetPens() reports pens in ascending ID order, %d out of order", out_of_order);
+
+    /* Detach every other pen */
+    SDL_PenGCMark();
+    for (i = 0; i < PEN_NUM_REGISTRY_PENS; i += 2) {
+        SDL_PenModifyEnd(SDL_PenModifyBegin(base + i), SDL_TRUE);
+    }
+    SDL_PenGCSweep(NULL, _pen_assert_impossible);
+
+    misplaced = 0;
+    for (i = 0; i < PEN_NUM_REGISTRY_PENS; ++i) {
+        if (SDL_GetPenPtr(base + i) != pens[i] || SDL_PenConnected(base + i) != !(i & 1)) {
+            ++misplaced;
+        }
+    }
+    SDLTest_AssertCheck(misplaced == 0, "Detached pens stay registered in place, %d pens differ", misplaced);
+    ids = SDL_GetPens(&count);
+    out_of_order = 0;
+    for (i = 0; i < count; ++i) {
+        if (ids[i] != base + i * 2) {
+            ++out_of_order;
+        }
+    }
+    SDL_free(ids);
+    SDLTest_AssertCheck(count == PEN_NUM_REGISTRY_PENS / 2, "SDL_GetPens() reports %d pens, expected %d", count, PEN_NUM_REGISTRY_PENS / 2);
+    SDLTest_AssertCheck(out_of_order == 0, "SDL_GetPens() reports the attached pens in order, %d differ", out_of_order);
+
+    /* Read the status of a pen while it's moving */
+    SDL_SendPenWindowEvent(0, base, ptest.window);
+    SDL_SetEventEnabled(SDL_EVENT_PEN_MOTION, SDL_FALSE);
+    SDL_zero(reader);
+    reader.penid = base;
+    thread = SDL_CreateThread(_pen_status_reader_thread, "PenStatusReader", &reader);
+    for (i = 1; i <= 200000 && (thread || i == 1); ++i) {
+        SDL_PenStatusInfo status;
+        int k;
+
+        status.x = status.y = (float)i;
+        for (k = 0; k < SDL_PEN_NUM_AXES; ++k) {
+            status.axes[k] = (float)i;
+        }
+        status.buttons = 0;
+        SDL_SendPenMotion(0, base, SDL_TRUE, &status);
+    }
+    SDL_AtomicSet(&reader.done, 1);
+    SDL_WaitThread(thread, NULL);
+    {
+        float x = 0.0f;
+        SDL_GetPenStatus(base, &x, NULL, NULL, 0);
+        SDLTest_AssertCheck(x == (float)(i - 1), "Pen status reports the last motion, expected x = %d, got %f", i - 1, x);
+    }
+    SDL_SetEventEnabled(SDL_EVENT_PEN_MOTION, SDL_TRUE);
+    SDL_SendPenWindowEvent(0, base, NULL);
+    SDLTest_AssertCheck(reader.torn_reads == 0, "Pen status reads were consistent, %d of %d torn", reader.torn_reads, reader.reads);
+
+    /* Remove the test pens again */
+    SDL_PenGCMark();
+    SDL_PenGCSweep(NULL, _pen_assert_impossible);
+
+    _teardown_test(&ptest, backup);
+    return TEST_COMPLETED;
+}
+
 /* ================= Test Setup and Teardown ================== */
 
 static void
@@ -1905,9 +2049,11 @@ static const SDLTest_TestCaseReference penTest8 = { (SDLTest_TestCaseFp)pen_mous
 
 static const SDLTest_TestCaseReference penTest9 = { (SDLTest_TestCaseFp)pen_memoryLayout, "pen_memoryLayout", "Check that all pen events have compatible layout (required by SDL_pen.c)", TEST_ENABLED };
 
+static const SDLTest_TestCaseReference penTest10 = { (SDLTest_TestCaseFp)pen_registry, "pen_registry", "Check pen registry lookups and consistent pen status reads", TEST_ENABLED };
+
 /* Sequence of Pen test cases */
 static const SDLTest_TestCaseReference *penTests[] = {
-    &penTest1, &penTest2, &penTest3, &penTest4, &penTest5, &penTest6, &penTest7, &penTest8, &penTest9, NULL
+    &penTest1, &penTest2, &penTest3, &penTest4, &penTest5, &penTest6, &penTest7, &penTest8, &penTest9, &penTest10, NULL
 };
 
 /* Pen test suite (global) */
@@ -367,6 +367,102 @@ static int pixels_allocFreePalette(void *arg)
     return TEST_COMPLETED;
 }
 
+/* The straightforward nearest color search that SDL_MapRGBA() has to match */
+static Uint8 FindColorReference(const SDL_Palette *palette, const SDL_Color *color)
+{
+    unsigned int smallest = ~0U;
+    Uint8 pixel = 0;
+    int i;
+
+    for (i = 0; i < palette->ncolors; ++i) {
+        const int rd = palette->colors[i].r - color->r;
+        const int gd = palette->colors[i].g - color->g;
+        const int bd = palette->colors[i].b - color->b;
+        const int ad = palette->colors[i].a - color->a;
+        const unsigned int distance = (rd * rd) + (gd * gd) + (bd * bd) + (ad * ad);
+        if (distance < smallest) {
+            smallest = distance;
+            pixel = (Uint8)i;
+        }
+    }
+    return pixel;
+}
+
+/**
+ * Call to SDL_MapRGBA on an indexed format, checking the nearest palette entry is found
+ *
+ * \sa SDL_MapRGBA
+ */
+static int pixels_mapPaletteColors(void *arg)
+{
+    static const int palette_sizes[] = { 1, 3, 4, 7, 16, 61, 256 };
+    SDL_PixelFormat *format;
+    SDL_Palette *palette;
+    SDL_Color colors[256];
+    SDL_Color color;
+    int size, i, j, mismatches;
+    Uint8 expected;
+    Uint32 result;
+
+    format = SDL_CreatePixelFormat(SDL_PIXELFORMAT_INDEX8);
+    SDLTest_AssertPass("Call to SDL_CreatePixelFormat(SDL_PIXELFORMAT_INDEX8)");
+    SDLTest_AssertCheck(format != NULL, "Verify result is not NULL");
+    if (format == NULL) {
+        return TEST_ABORTED;
+    }
+
+    for (size = 0; size < SDL_arraysize(palette_sizes); ++size) {
+        const int ncolors = palette_sizes[size];
+
+        palette = SDL_CreatePalette(ncolors);
+        SDLTest_AssertCheck(palette != NULL, "Verify SDL_CreatePalette(%d) result is not NULL", ncolors);
+        if (palette == NULL) {
+            continue;
+        }
+
+        /* Use a coarse set of values so some entries are duplicated and the
+           search has to break ties the same way */
+        for (i = 0; i < ncolors; ++i) {
+            colors[i].r = (Uint8)(SDLTest_RandomIntegerInRange(0, 4) * 63);
+            colors[i].g = (Uint8)(SDLTest_RandomIntegerInRange(0, 4) * 63);
+            colors[i].b = (Uint8)(SDLTest_RandomIntegerInRange(0, 4) * 63);
+            colors[i].a = (Uint8)(SDLTest_RandomIntegerInRange(0, 1) * 255);
+        }
+        SDL_SetPaletteColors(palette, colors, 0, ncolors);
+        SDL_SetPixelFormatPalette(format, palette);
+
+        mismatches = 0;
+        for (j = 0; j < 1000; ++j) {
+            if (j < ncolors) {
+                /* Every palette entry should map to itself or an identical entry */
+                color = colors[j];
+            } else {
+                color.r = SDLTest_RandomUint8();
+                color.g = SDLTest_RandomUint8();
+                color.b = SDLTest_RandomUint8();
+                color.a = SDLTest_RandomUint8();
+            }
+            expected = FindColorReference(palette, &color);
+            result = SDL_MapRGBA(format, color.r, color.g, color.b, color.a);
+            if (result != expected) {
+                if (mismatches == 0) {
+                    SDLTest_LogError("Color (%u,%u,%u,%u) with %d palette entries mapped to %" SDL_PRIu32 ", expected %u",
+                                     color.r, color.g, color.b, color.a, ncolors, result, expected);
+                }
+                ++mismatches;
+            }
+        }
+        SDLTest_AssertCheck(mismatches == 0, "Verify SDL_MapRGBA() with %d palette entries, got %d mismatches", ncolors, mismatches);
+
+        SDL_SetPixelFormatPalette(format, NULL);
+        SDL_DestroyPalette(palette);
+    }
+
+    SDL_DestroyPixelFormat(format);
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Pixels test cases */
@@ -382,9 +478,13 @@ static const SDLTest_TestCaseReference pixelsTest3 = {
     (SDLTest_TestCaseFp)pixels_getPixelFormatName, "pixels_getPixelFormatName", "Call to SDL_GetPixelFormatName", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference pixelsTest4 = {
+    (SDLTest_TestCaseFp)pixels_mapPaletteColors, "pixels_mapPaletteColors", "Call to SDL_MapRGBA on an indexed format, checking the nearest palette entry is found", TEST_ENABLED
+};
+
 /* Sequence of Pixels test cases */
 static const SDLTest_TestCaseReference *pixelsTests[] = {
-    &pixelsTest1, &pixelsTest2, &pixelsTest3, NULL
+    &pixelsTest1, &pixelsTest2, &pixelsTest3, &pixelsTest4, NULL
 };
 
 /* Pixels test suite (global) */
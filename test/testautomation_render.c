@@ -1024,6 +1024,98 @@ static int render_testLogicalSize(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * Tests that batches of fill rects, including ones that are partly or
+ * entirely outside the viewport, render the same as filling each rect
+ */
+static int render_testFillRectsBatch(void *arg)
+{
+    const int width = 64, height = 64;
+    const Uint32 colors[] = { 0xFFFF0000, 0xFF00FF00, 0xFF0000FF, 0xFFFFFFFF };
+    SDL_Surface *target, *reference;
+    SDL_Renderer *swrenderer;
+    SDL_FRect rects[50];
+    int pass, batch, i, ret;
+
+    target = SDL_CreateSurface(width, height, RENDER_COMPARE_FORMAT);
+    reference = SDL_CreateSurface(width, height, RENDER_COMPARE_FORMAT);
+    SDLTest_AssertCheck(target != NULL && reference != NULL, "Check SDL_CreateSurface result");
+    if (!target || !reference) {
+        SDL_DestroySurface(target);
+        SDL_DestroySurface(reference);
+        return TEST_ABORTED;
+    }
+
+    swrenderer = SDL_CreateSoftwareRenderer(target);
+    SDLTest_AssertCheck(swrenderer != NULL, "Check SDL_CreateSoftwareRenderer result: %s", swrenderer != NULL ? "success" : SDL_GetError());
+    if (!swrenderer) {
+        SDL_DestroySurface(target);
+        SDL_DestroySurface(reference);
+        return TEST_ABORTED;
+    }
+
+    for (pass = 0; pass < 2; ++pass) {
+        /* The first pass draws through a viewport, the second at 2x scale */
+        const float scale = (pass == 0) ? 1.0f : 2.0f;
+        SDL_Rect viewport;
+
+        if (pass == 0) {
+            viewport.x = 8;
+            viewport.y = 4;
+            viewport.w = 40;
+            viewport.h = 48;
+            CHECK_FUNC(SDL_SetRenderViewport, (swrenderer, &viewport))
+        } else {
+            viewport.x = 0;
+            viewport.y = 0;
+            viewport.w = width;
+            viewport.h = height;
+            CHECK_FUNC(SDL_SetRenderViewport, (swrenderer, NULL))
+        }
+        CHECK_FUNC(SDL_SetRenderScale, (swrenderer, scale, scale))
+
+        CHECK_FUNC(SDL_SetRenderDrawColor, (swrenderer, 0, 0, 0, SDL_ALPHA_OPAQUE))
+        CHECK_FUNC(SDL_RenderClear, (swrenderer))
+        SDL_SetSurfaceClipRect(reference, NULL);
+        SDL_FillSurfaceRect(reference, NULL, RENDER_COLOR_CLEAR);
+        SDL_SetSurfaceClipRect(reference, &viewport);
+
+        for (batch = 0; batch < (int)SDL_arraysize(colors); ++batch) {
+            const Uint32 color = colors[batch];
+
+            for (i = 0; i < (int)SDL_arraysize(rects); ++i) {
+                SDL_Rect rect;
+
+                /* Eighths of a pixel, from well outside the target to well inside it */
+                rects[i].x = SDLTest_RandomIntegerInRange(-640, 640) / 8.0f;
+                rects[i].y = SDLTest_RandomIntegerInRange(-640, 640) / 8.0f;
+                rects[i].w = SDLTest_RandomIntegerInRange(-40, 320) / 8.0f;
+                rects[i].h = SDLTest_RandomIntegerInRange(-40, 320) / 8.0f;
+
+                /* This matches how the software renderer rasterizes a fill rect */
+                rect.x = viewport.x + (int)(rects[i].x * scale);
+                rect.y = viewport.y + (int)(rects[i].y * scale);
+                rect.w = SDL_max((int)(rects[i].w * scale), 1);
+                rect.h = SDL_max((int)(rects[i].h * scale), 1);
+                SDL_FillSurfaceRect(reference, &rect, color);
+            }
+
+            CHECK_FUNC(SDL_SetRenderDrawColor, (swrenderer, (Uint8)(color >> 16), (Uint8)(color >> 8), (Uint8)color, SDL_ALPHA_OPAQUE))
+            CHECK_FUNC(SDL_RenderFillRects, (swrenderer, rects, (int)SDL_arraysize(rects)))
+        }
+        CHECK_FUNC(SDL_FlushRenderer, (swrenderer))
+
+        ret = SDLTest_CompareSurfaces(target, reference, ALLOWABLE_ERROR_OPAQUE);
+        SDLTest_AssertCheck(ret == 0, "Validate batched fill rects at scale %g, expected: 0, got: %i", scale, ret);
+    }
+
+    SDL_DestroyRenderer(swrenderer);
+    SDL_DestroySurface(target);
+    SDL_DestroySurface(reference);
+
+    return TEST_COMPLETED;
+}
+
 /* Helper functions */
 
 /**
@@ -1383,11 +1475,15 @@ static const SDLTest_TestCaseReference renderTest11 = {
     (SDLTest_TestCaseFp)render_testLogicalSize, "render_testLogicalSize", "Tests logical size", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference renderTest12 = {
+    (SDLTest_TestCaseFp)render_testFillRectsBatch, "render_testFillRectsBatch", "Tests batched fill rects against per-rect fills", TEST_ENABLED
+};
+
 /* Sequence of Render test cases */
 static const SDLTest_TestCaseReference *renderTests[] = {
     &renderTest1, &renderTest2, &renderTest3, &renderTest4,
     &renderTest5, &renderTest6, &renderTest7, &renderTest8,
-    &renderTest9, &renderTest10, &renderTest11, NULL
+    &renderTest9, &renderTest10, &renderTest11, &renderTest12, NULL
 };
 
 /* Render test suite (global) */
@@ -0,0 +1,163 @@
+/**
+ * Sensor test suite
+ */
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_test.h>
+#include "testautomation_suites.h"
+
+/* The dummy sensor driver provides a gyroscope at this rate when asked to,
+   this needs to match the value of SDL_HINT_SENSOR_DUMMY_RATE below */
+#define TEST_SENSOR_RATE 1000
+
+static SDL_Sensor *sensor;
+
+static void sensorSetUp(void *arg)
+{
+    SDL_SensorID *sensors;
+    int i, count = 0;
+
+    sensor = NULL;
+
+    SDL_SetHint(SDL_HINT_SENSOR_DUMMY_RATE, "1000");
+    SDL_SetHint(SDL_HINT_SENSOR_UPDATE_EVENTS, "0");
+    if (SDL_InitSubSystem(SDL_INIT_SENSOR) < 0) {
+        return;
+    }
+
+    sensors = SDL_GetSensors(&count);
+    for (i = 0; i < count; ++i) {
+        const char *name = SDL_GetSensorInstanceName(sensors[i]);
+        if (name && SDL_strcmp(name, "Dummy Gyroscope") == 0) {
+            sensor = SDL_OpenSensor(sensors[i]);
+            break;
+        }
+    }
+    SDL_free(sensors);
+}
+
+static void sensorTearDown(void *arg)
+{
+    if (sensor) {
+        SDL_CloseSensor(sensor);
+        sensor = NULL;
+    }
+    SDL_QuitSubSystem(SDL_INIT_SENSOR);
+    SDL_ResetHint(SDL_HINT_SENSOR_DUMMY_RATE);
+    SDL_ResetHint(SDL_HINT_SENSOR_UPDATE_EVENTS);
+}
+
+/* Checks that the samples are consecutive readings from the dummy sensor */
+static int CheckSampleSequence(const SDL_SensorSample *samples, int count)
+{
+    const Uint64 period = SDL_NS_PER_SECOND / TEST_SENSOR_RATE;
+    int i;
+
+    for (i = 1; i < count; ++i) {
+        if (samples[i].sensor_timestamp != samples[i - 1].sensor_timestamp + period) {
+            return i;
+        }
+    }
+    return 0;
+}
+
+/* Test case functions */
+
+/**
+ * Check that samples can be read in bulk without being posted as events
+ */
+static int sensor_testGetSamples(void *arg)
+{
+    SDL_SensorSample samples[SDL_SENSOR_SAMPLE_HISTORY];
+    Uint32 cursor = 0;
+    int count, total, gap;
+
+    if (!sensor) {
+        SDLTest_Log("Dummy sensor not available, skipping test");
+        return TEST_SKIPPED;
+    }
+
+    count = SDL_GetSensorSamples(sensor, NULL, samples, SDL_arraysize(samples));
+    SDLTest_AssertCheck(count < 0, "Check that SDL_GetSensorSamples() fails without a cursor, got: %d", count);
+
+    SDL_FlushEvent(SDL_EVENT_SENSOR_UPDATE);
+    SDL_Delay(50);
+    SDL_UpdateSensors();
+    SDLTest_AssertPass("Call to SDL_UpdateSensors()");
+
+    count = SDL_GetSensorSamples(sensor, &cursor, samples, SDL_arraysize(samples));
+    SDLTest_AssertPass("Call to SDL_GetSensorSamples()");
+    SDLTest_AssertCheck(count > 1, "Check that samples were returned, got: %d", count);
+    gap = CheckSampleSequence(samples, count);
+    SDLTest_AssertCheck(gap == 0, "Check that the samples are consecutive, first gap at: %d", gap);
+    SDLTest_AssertCheck(!SDL_HasEvent(SDL_EVENT_SENSOR_UPDATE), "Check that no sensor events were posted");
+
+    count = SDL_GetSensorSamples(sensor, &cursor, samples, SDL_arraysize(samples));
+    SDLTest_AssertCheck(count == 0, "Check that no samples are returned twice, got: %d", count);
+
+    /* Read in small batches, the next batch picks up where the last one left off */
+    SDL_Delay(20);
+    SDL_UpdateSensors();
+    count = SDL_GetSensorSamples(sensor, &cursor, samples, 4);
+    SDLTest_AssertCheck(count == 4, "Check that the batch size is respected, expected: 4, got: %d", count);
+    total = count;
+    while (count > 0 && total < SDL_arraysize(samples)) {
+        count = SDL_GetSensorSamples(sensor, &cursor, &samples[total], SDL_arraysize(samples) - total);
+        total += SDL_max(count, 0);
+    }
+    gap = CheckSampleSequence(samples, total);
+    SDLTest_AssertCheck(gap == 0, "Check that batches are consecutive, first gap at: %d of %d", gap, total);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Check that a reader that falls behind gets the most recent samples
+ */
+static int sensor_testSampleOverflow(void *arg)
+{
+    SDL_SensorSample samples[SDL_SENSOR_SAMPLE_HISTORY];
+    Uint32 cursor = 0;
+    int count, gap;
+
+    if (!sensor) {
+        SDLTest_Log("Dummy sensor not available, skipping test");
+        return TEST_SKIPPED;
+    }
+
+    /* Produce more samples than the ring can hold */
+    SDL_Delay(200);
+    SDL_UpdateSensors();
+    SDL_Delay(200);
+    SDL_UpdateSensors();
+
+    count = SDL_GetSensorSamples(sensor, &cursor, samples, SDL_arraysize(samples));
+    SDLTest_AssertCheck(count == SDL_SENSOR_SAMPLE_HISTORY - 1, "Check that the ring was full, expected: %d, got: %d", SDL_SENSOR_SAMPLE_HISTORY - 1, count);
+    gap = CheckSampleSequence(samples, count);
+    SDLTest_AssertCheck(gap == 0, "Check that the samples are consecutive, first gap at: %d", gap);
+
+    return TEST_COMPLETED;
+}
+
+/* ================= Test References ================== */
+
+/* Sensor test cases */
+static const SDLTest_TestCaseReference sensorTest1 = {
+    (SDLTest_TestCaseFp)sensor_testGetSamples, "sensor_testGetSamples", "Check that samples can be read in bulk without being posted as events", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference sensorTest2 = {
+    (SDLTest_TestCaseFp)sensor_testSampleOverflow, "sensor_testSampleOverflow", "Check that a reader that falls behind gets the most recent samples", TEST_ENABLED
+};
+
+/* Sequence of Sensor test cases */
+static const SDLTest_TestCaseReference *sensorTests[] = {
+    &sensorTest1, &sensorTest2, NULL
+};
+
+/* Sensor test suite (global) */
+SDLTest_TestSuiteReference sensorTestSuite = {
+    "Sensor",
+    sensorSetUp,
+    sensorTests,
+    sensorTearDown
+};
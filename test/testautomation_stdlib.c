@@ -871,6 +871,109 @@ static int stdlib_aligned_alloc(void *arg)
     return TEST_COMPLETED;
 }
 
+#define MALLOC_THREADS       8
+#define MALLOC_ITERATIONS    200000
+
+static int SDLCALL stdlib_mallocThread(void *arg)
+{
+    void *ptrs[16];
+    int i, j;
+
+    for (i = 0; i < MALLOC_ITERATIONS; i += (int)SDL_arraysize(ptrs)) {
+        for (j = 0; j < (int)SDL_arraysize(ptrs); j++) {
+            ptrs[j] = SDL_malloc(16 + j * 8);
+        }
+        for (j = 0; j < (int)SDL_arraysize(ptrs); j++) {
+            SDL_free(ptrs[j]);
+        }
+    }
+    return 0;
+}
+
+/**
+ * Allocate and free from several threads at once, and check the allocation count comes out right.
+ */
+static int stdlib_mallocThreads(void *arg)
+{
+    SDL_Thread *threads[MALLOC_THREADS];
+    const int allocations = SDL_GetNumAllocations();
+    Uint64 tick_beg, tick_end;
+    int i;
+
+    tick_beg = SDL_GetPerformanceCounter();
+    for (i = 0; i < MALLOC_THREADS; i++) {
+        threads[i] = SDL_CreateThread(stdlib_mallocThread, "malloc", NULL);
+        SDLTest_AssertCheck(threads[i] != NULL, "Check SDL_CreateThread(), expected non-NULL");
+    }
+    for (i = 0; i < MALLOC_THREADS; i++) {
+        SDL_WaitThread(threads[i], NULL);
+    }
+    tick_end = SDL_GetPerformanceCounter();
+
+    SDLTest_Log("%d threads doing %d allocations each took %f seconds", MALLOC_THREADS, MALLOC_ITERATIONS,
+                ((double)(tick_end - tick_beg)) / SDL_GetPerformanceFrequency());
+
+    /* Thread creation allocates too, but it's all been freed again by now */
+    SDLTest_AssertCheck(SDL_GetNumAllocations() == allocations, "Check SDL_GetNumAllocations(), expected %d, got %d", allocations, SDL_GetNumAllocations());
+
+    return TEST_COMPLETED;
+}
+
+static int SDLCALL stdlib_mallocHandoffThread(void *arg)
+{
+    void **ptrs = (void **)arg;
+    int i;
+
+    for (i = 0; i < MALLOC_ITERATIONS / MALLOC_THREADS; i++) {
+        ptrs[i] = SDL_malloc(8 + (i % 64) * 8);
+    }
+    return 0;
+}
+
+/**
+ * Allocate on several threads, then reallocate and free everything on this one.
+ */
+static int stdlib_mallocHandoff(void *arg)
+{
+    SDL_Thread *threads[MALLOC_THREADS];
+    void **ptrs = (void **)SDL_calloc(MALLOC_ITERATIONS, sizeof(void *));
+    const int allocations = SDL_GetNumAllocations();
+    Uint64 tick_beg, tick_end;
+    int i, failed = 0;
+
+    SDLTest_AssertCheck(ptrs != NULL, "Check SDL_calloc(), expected non-NULL");
+    if (!ptrs) {
+        return TEST_ABORTED;
+    }
+
+    tick_beg = SDL_GetPerformanceCounter();
+    for (i = 0; i < MALLOC_THREADS; i++) {
+        threads[i] = SDL_CreateThread(stdlib_mallocHandoffThread, "malloc", &ptrs[i * (MALLOC_ITERATIONS / MALLOC_THREADS)]);
+        SDLTest_AssertCheck(threads[i] != NULL, "Check SDL_CreateThread(), expected non-NULL");
+    }
+    for (i = 0; i < MALLOC_THREADS; i++) {
+        SDL_WaitThread(threads[i], NULL);
+    }
+    for (i = 0; i < MALLOC_ITERATIONS; i++) {
+        void *mem = SDL_realloc(ptrs[i], 1024);
+        if (!mem) {
+            failed++;
+            mem = ptrs[i];
+        }
+        SDL_free(mem);
+    }
+    tick_end = SDL_GetPerformanceCounter();
+
+    SDLTest_Log("Handing off %d allocations between threads took %f seconds", MALLOC_ITERATIONS,
+                ((double)(tick_end - tick_beg)) / SDL_GetPerformanceFrequency());
+
+    SDLTest_AssertCheck(failed == 0, "Check SDL_realloc(), expected no failures, got %d", failed);
+    SDLTest_AssertCheck(SDL_GetNumAllocations() == allocations, "Check SDL_GetNumAllocations(), expected %d, got %d", allocations, SDL_GetNumAllocations());
+    SDL_free(ptrs);
+
+    return TEST_COMPLETED;
+}
+
 typedef struct
 {
     size_t a;
@@ -1058,6 +1161,14 @@ static const SDLTest_TestCaseReference stdlibTest8 = {
     stdlib_aligned_alloc, "stdlib_aligned_alloc", "Call to SDL_aligned_alloc", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference stdlibTest9 = {
+    stdlib_mallocThreads, "stdlib_mallocThreads", "Call to SDL_malloc and SDL_free from several threads", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference stdlibTest10 = {
+    stdlib_mallocHandoff, "stdlib_mallocHandoff", "Call to SDL_realloc and SDL_free on memory from other threads", TEST_ENABLED
+};
+
 static const SDLTest_TestCaseReference stdlibTestOverflow = {
     stdlib_overflow, "stdlib_overflow", "Overflow detection", TEST_ENABLED
 };
@@ -1072,6 +1183,8 @@ static const SDLTest_TestCaseReference *stdlibTests[] = {
     &stdlibTest6,
     &stdlibTest7,
     &stdlibTest8,
+    &stdlibTest9,
+    &stdlibTest10,
     &stdlibTestOverflow,
     NULL
 };
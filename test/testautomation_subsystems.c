@@ -206,6 +206,94 @@ static int subsystems_dependRefCountWithExtraInit()
     return TEST_COMPLETED;
 }
 
+/**
+ * Inits subsystems in parallel and makes sure the reference counts match a serial init.
+ *
+ * \sa SDL_InitSubSystem
+ * \sa SDL_QuitSubSystem
+ *
+ */
+static int subsystems_parallelInit()
+{
+    const Uint32 systems = SDL_INIT_VIDEO | SDL_INIT_AUDIO | SDL_INIT_JOYSTICK;
+    Uint32 result;
+    int ret;
+
+    /* Ensure that we start with reset subsystems. */
+    SDLTest_AssertCheck(SDL_WasInit(systems | SDL_INIT_EVENTS) == 0,
+                        "Check result from SDL_WasInit(SDL_INIT_VIDEO | SDL_INIT_AUDIO | SDL_INIT_JOYSTICK | SDL_INIT_EVENTS)");
+
+    SDL_SetHint(SDL_HINT_INIT_PARALLEL, "1");
+    SDLTest_AssertPass("Call to SDL_SetHint(SDL_HINT_INIT_PARALLEL, \"1\")");
+
+    ret = SDL_InitSubSystem(systems);
+    SDLTest_AssertPass("Call to SDL_InitSubSystem(SDL_INIT_VIDEO | SDL_INIT_AUDIO | SDL_INIT_JOYSTICK)");
+    SDLTest_AssertCheck(ret == 0, "Check result from SDL_InitSubSystem, expected: 0, got: %d", ret);
+    result = SDL_WasInit(systems | SDL_INIT_EVENTS);
+    SDLTest_AssertCheck(result == (systems | SDL_INIT_EVENTS), "Check result from SDL_WasInit, expected: 0x%x, got: 0x%x", systems | SDL_INIT_EVENTS, result);
+
+    /* Audio should be usable as soon as SDL_InitSubSystem() returns */
+    SDLTest_AssertCheck(SDL_GetCurrentAudioDriver() != NULL, "Check that an audio driver is active");
+
+    /* Initializing again just adds references */
+    ret = SDL_InitSubSystem(SDL_INIT_AUDIO);
+    SDLTest_AssertCheck(ret == 0, "Check result from second SDL_InitSubSystem(SDL_INIT_AUDIO), expected: 0, got: %d", ret);
+    SDL_QuitSubSystem(SDL_INIT_AUDIO);
+    result = SDL_WasInit(SDL_INIT_AUDIO);
+    SDLTest_AssertCheck(result == SDL_INIT_AUDIO, "Check result from SDL_WasInit(SDL_INIT_AUDIO), expected: 0x%x, got: 0x%x", SDL_INIT_AUDIO, result);
+
+    /* Each subsystem holds its own reference on events */
+    SDL_QuitSubSystem(SDL_INIT_VIDEO | SDL_INIT_JOYSTICK);
+    SDLTest_AssertPass("Call to SDL_QuitSubSystem(SDL_INIT_VIDEO | SDL_INIT_JOYSTICK)");
+    result = SDL_WasInit(SDL_INIT_EVENTS);
+    SDLTest_AssertCheck(result == SDL_INIT_EVENTS, "Check result from SDL_WasInit(SDL_INIT_EVENTS), expected: 0x4000, got: 0x%x", result);
+    SDL_QuitSubSystem(SDL_INIT_AUDIO);
+    SDLTest_AssertPass("Call to SDL_QuitSubSystem(SDL_INIT_AUDIO)");
+    result = SDL_WasInit(systems | SDL_INIT_EVENTS);
+    SDLTest_AssertCheck(result == 0, "Check result from SDL_WasInit, expected: 0, got: 0x%x", result);
+
+    SDL_ResetHint(SDL_HINT_INIT_PARALLEL);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Checks that the startup trace is written as a Chrome trace file.
+ *
+ * \sa SDL_InitSubSystem
+ *
+ */
+static int subsystems_startupTrace()
+{
+    const char *filename = "startup_trace.json";
+    char *trace;
+    size_t size = 0;
+    int ret;
+
+    SDL_SetHint(SDL_HINT_STARTUP_TRACE, filename);
+    SDLTest_AssertPass("Call to SDL_SetHint(SDL_HINT_STARTUP_TRACE, \"%s\")", filename);
+
+    ret = SDL_InitSubSystem(SDL_INIT_VIDEO | SDL_INIT_AUDIO);
+    SDLTest_AssertPass("Call to SDL_InitSubSystem(SDL_INIT_VIDEO | SDL_INIT_AUDIO)");
+    SDLTest_AssertCheck(ret == 0, "Check result from SDL_InitSubSystem, expected: 0, got: %d", ret);
+
+    trace = (char *)SDL_LoadFile(filename, &size);
+    SDLTest_AssertCheck(trace != NULL, "Check that %s was written", filename);
+    if (trace) {
+        SDLTest_AssertCheck(SDL_strncmp(trace, "{\"traceEvents\":[", 16) == 0, "Check that the trace starts with the traceEvents array");
+        SDLTest_AssertCheck(SDL_strstr(trace, "\"cat\":\"video\"") != NULL, "Check that the video driver was traced");
+        SDLTest_AssertCheck(SDL_strstr(trace, "\"cat\":\"audio\"") != NULL, "Check that the audio driver was traced");
+        SDLTest_AssertCheck(size > 0 && trace[size - 2] == '}', "Check that the trace is terminated");
+        SDL_free(trace);
+    }
+
+    SDL_QuitSubSystem(SDL_INIT_VIDEO | SDL_INIT_AUDIO);
+    SDL_ResetHint(SDL_HINT_STARTUP_TRACE);
+    SDL_RemovePath(filename);
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Subsystems test cases */
@@ -225,9 +313,17 @@ static const SDLTest_TestCaseReference subsystemsTest4 = {
     (SDLTest_TestCaseFp)subsystems_dependRefCountWithExtraInit, "subsystems_dependRefCountWithExtraInit", "Check reference count of subsystem dependencies.", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference subsystemsTest5 = {
+    (SDLTest_TestCaseFp)subsystems_parallelInit, "subsystems_parallelInit", "Check reference counts when initializing subsystems in parallel.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference subsystemsTest6 = {
+    (SDLTest_TestCaseFp)subsystems_startupTrace, "subsystems_startupTrace", "Check that the startup trace is written.", TEST_ENABLED
+};
+
 /* Sequence of Events test cases */
 static const SDLTest_TestCaseReference *subsystemsTests[] = {
-    &subsystemsTest1, &subsystemsTest2, &subsystemsTest3, &subsystemsTest4, NULL
+    &subsystemsTest1, &subsystemsTest2, &subsystemsTest3, &subsystemsTest4, &subsystemsTest5, &subsystemsTest6, NULL
 };
 
 /* Events test suite (global) */
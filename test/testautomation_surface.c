@@ -264,6 +264,191 @@ static int surface_testSaveLoadBitmap(void *arg)
     return TEST_COMPLETED;
 }
 
+static void WriteBitmapFile(const char *filename, const void *data, size_t size)
+{
+    SDL_IOStream *io = SDL_IOFromFile(filename, "wb");
+    if (io) {
+        SDL_WriteIO(io, data, size);
+        SDL_CloseIO(io);
+    }
+}
+
+/* Checks that a loaded BMP has the same format and pixels as the surface that was saved */
+static void CheckLoadedBitmap(SDL_Surface *expected, SDL_Surface *loaded, const char *how)
+{
+    const int bw = expected->w * expected->format->bytes_per_pixel;
+    int y, mismatch = -1;
+
+    SDLTest_AssertCheck(loaded != NULL, "Verify that the bitmap was loaded %s: %s", how, loaded ? "" : SDL_GetError());
+    if (!loaded) {
+        return;
+    }
+    SDLTest_AssertCheck(loaded->format->format == expected->format->format &&
+                        loaded->w == expected->w && loaded->h == expected->h,
+                        "Verify format and size loaded %s, expected: %s %dx%d, got: %s %dx%d", how,
+                        SDL_GetPixelFormatName(expected->format->format), expected->w, expected->h,
+                        SDL_GetPixelFormatName(loaded->format->format), loaded->w, loaded->h);
+    if (loaded->format->format != expected->format->format || loaded->w != expected->w || loaded->h != expected->h) {
+        return;
+    }
+    for (y = 0; y < expected->h; ++y) {
+        if (SDL_memcmp((Uint8 *)expected->pixels + y * expected->pitch, (Uint8 *)loaded->pixels + y * loaded->pitch, bw) != 0) {
+            mismatch = y;
+            break;
+        }
+    }
+    SDLTest_AssertCheck(mismatch < 0, "Verify pixels loaded %s, first mismatched row: %d", how, mismatch);
+    if (expected->format->palette) {
+        SDLTest_AssertCheck(loaded->format->palette &&
+                            loaded->format->palette->ncolors == expected->format->palette->ncolors &&
+                            SDL_memcmp(loaded->format->palette->colors, expected->format->palette->colors,
+                                       expected->format->palette->ncolors * sizeof(SDL_Color)) == 0,
+                            "Verify palette loaded %s", how);
+    }
+}
+
+/**
+ * Tests saving and loading bitmaps in several formats through files and memory streams
+ */
+static int surface_testSaveLoadBitmapFormats(void *arg)
+{
+    static const struct
+    {
+        SDL_PixelFormatEnum format;
+        SDL_bool legacy;
+        SDL_bool transparent;
+    } cases[] = {
+        { SDL_PIXELFORMAT_INDEX8, SDL_FALSE, SDL_FALSE },
+        { SDL_PIXELFORMAT_BGR24, SDL_FALSE, SDL_FALSE },
+        { SDL_PIXELFORMAT_ARGB8888, SDL_FALSE, SDL_FALSE },
+        { SDL_PIXELFORMAT_ARGB8888, SDL_TRUE, SDL_FALSE },
+        { SDL_PIXELFORMAT_ARGB8888, SDL_TRUE, SDL_TRUE },
+    };
+    const char *filename = "testSaveLoadBitmapFormats.bmp";
+    SDLTest_RandomContext rndctx;
+    int c, i, x, y;
+
+    SDLTest_RandomInit(&rndctx, 0x5EED, 0xB17);
+
+    for (c = 0; c < SDL_arraysize(cases); ++c) {
+        SDL_Surface *surface, *loaded;
+        SDL_IOStream *io;
+        Uint8 *data, *flipped;
+        size_t size;
+        Uint32 offset, stride;
+        int ret;
+
+        surface = SDL_CreateSurface(37, 23, cases[c].format);
+        SDLTest_AssertCheck(surface != NULL, "Verify %s surface is not NULL", SDL_GetPixelFormatName(cases[c].format));
+        if (!surface) {
+            return TEST_ABORTED;
+        }
+        if (surface->format->palette) {
+            SDL_Color colors[256];
+            for (i = 0; i < SDL_arraysize(colors); ++i) {
+                colors[i].r = (Uint8)i;
+                colors[i].g = (Uint8)(255 - i);
+                colors[i].b = (Uint8)(i * 7);
+                colors[i].a = SDL_ALPHA_OPAQUE;
+            }
+            SDL_SetPaletteColors(surface->format->palette, colors, 0, SDL_arraysize(colors));
+        }
+        for (y = 0; y < surface->h; ++y) {
+            Uint8 *row = (Uint8 *)surface->pixels + y * surface->pitch;
+            for (x = 0; x < surface->w * surface->format->bytes_per_pixel; ++x) {
+                row[x] = (Uint8)SDLTest_Random(&rndctx);
+            }
+            if (cases[c].format == SDL_PIXELFORMAT_ARGB8888) {
+                for (x = 0; x < surface->w; ++x) {
+                    Uint32 *pixel = (Uint32 *)row + x;
+                    if (cases[c].transparent) {
+                        /* Fully transparent legacy bitmaps are loaded as opaque */
+                        *pixel &= 0x00FFFFFF;
+                    } else if (x == surface->w - 1 && y == surface->h - 1) {
+                        /* Only the last pixel has alpha, to check that it is found */
+                        *pixel |= 0x80000000;
+                    } else if (cases[c].legacy) {
+                        *pixel &= 0x00FFFFFF;
+                    }
+                }
+            }
+        }
+
+        SDL_SetHint(SDL_HINT_BMP_SAVE_LEGACY_FORMAT, cases[c].legacy ? "1" : "0");
+        io = SDL_IOFromDynamicMem();
+        ret = SDL_SaveBMP_IO(surface, io, SDL_FALSE);
+        SDL_ResetHint(SDL_HINT_BMP_SAVE_LEGACY_FORMAT);
+        SDLTest_AssertCheck(ret == 0, "Verify result from SDL_SaveBMP_IO, expected: 0, got: %i", ret);
+        SDLTest_AssertCheck(SDL_GetIOSize(io) == SDL_TellIO(io), "Verify that the stream is at the end of the bitmap");
+
+        if (cases[c].transparent) {
+            for (y = 0; y < surface->h; ++y) {
+                Uint32 *row = (Uint32 *)((Uint8 *)surface->pixels + y * surface->pitch);
+                for (x = 0; x < surface->w; ++x) {
+                    row[x] |= 0xFF000000;
+                }
+            }
+        }
+
+        /* Load from the dynamic memory stream */
+        SDL_SeekIO(io, 0, SDL_IO_SEEK_SET);
+        loaded = SDL_LoadBMP_IO(io, SDL_FALSE);
+        CheckLoadedBitmap(surface, loaded, "from dynamic memory");
+        SDL_DestroySurface(loaded);
+
+        size = (size_t)SDL_GetIOSize(io);
+        data = (Uint8 *)SDL_GetProperty(SDL_GetIOProperties(io), SDL_PROP_IOSTREAM_DYNAMIC_MEMORY_POINTER, NULL);
+        SDLTest_AssertCheck(data != NULL, "Verify the dynamic memory pointer is not NULL");
+        if (!data) {
+            SDL_CloseIO(io);
+            SDL_DestroySurface(surface);
+            return TEST_ABORTED;
+        }
+
+        /* Load from constant memory */
+        loaded = SDL_LoadBMP_IO(SDL_IOFromConstMem(data, size), SDL_TRUE);
+        CheckLoadedBitmap(surface, loaded, "from constant memory");
+        SDL_DestroySurface(loaded);
+
+        /* Load from a file */
+        unlink(filename);
+        WriteBitmapFile(filename, data, size);
+        loaded = SDL_LoadBMP(filename);
+        CheckLoadedBitmap(surface, loaded, "from a file");
+        SDL_DestroySurface(loaded);
+
+        /* Load a top-down copy, from memory and from a file */
+        flipped = (Uint8 *)SDL_malloc(size);
+        if (flipped) {
+            offset = data[10] | (data[11] << 8) | (data[12] << 16) | ((Uint32)data[13] << 24);
+            stride = (Uint32)((size - offset) / surface->h);
+            SDL_memcpy(flipped, data, offset);
+            for (y = 0; y < surface->h; ++y) {
+                SDL_memcpy(flipped + offset + y * stride, data + offset + (surface->h - 1 - y) * stride, stride);
+            }
+            flipped[22] = (Uint8)(-surface->h);
+            flipped[23] = flipped[24] = flipped[25] = 0xFF;
+
+            loaded = SDL_LoadBMP_IO(SDL_IOFromConstMem(flipped, size), SDL_TRUE);
+            CheckLoadedBitmap(surface, loaded, "top-down from constant memory");
+            SDL_DestroySurface(loaded);
+
+            unlink(filename);
+            WriteBitmapFile(filename, flipped, size);
+            loaded = SDL_LoadBMP(filename);
+            CheckLoadedBitmap(surface, loaded, "top-down from a file");
+            SDL_DestroySurface(loaded);
+            SDL_free(flipped);
+        }
+
+        unlink(filename);
+        SDL_CloseIO(io);
+        SDL_DestroySurface(surface);
+    }
+
+    return TEST_COMPLETED;
+}
+
 /**
  *  Tests surface conversion.
  */
@@ -592,6 +777,391 @@ static int surface_testBlitBlendLoop(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * Tests nearest neighbor scaled blits through the generated blitters against a reference scaler.
+ */
+static int surface_testBlitScaledNearest(void *arg)
+{
+    /* 2x, 3x, 0.5x and an uneven scale */
+    static const int dst_sizes[][2] = { { 74, 26 }, { 111, 39 }, { 18, 6 }, { 61, 7 } };
+    static const SDL_BlendMode blend_modes[] = { SDL_BLENDMODE_NONE, SDL_BLENDMODE_BLEND };
+    static const char *masks[] = { "-sse41,-avx2,-neon", "all" };
+    const int src_w = 37, src_h = 13;
+    SDL_Surface *src;
+    int i, size, b, m;
+
+    src = SDL_CreateSurface(src_w, src_h, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(src != NULL, "Verify source surface is not NULL");
+    if (!src) {
+        return TEST_ABORTED;
+    }
+    for (i = 0; i < src_h; ++i) {
+        Uint32 *row = (Uint32 *)((Uint8 *)src->pixels + i * src->pitch);
+        int x;
+        for (x = 0; x < src_w; ++x) {
+            /* Opaque, so blending gives the source color */
+            row[x] = (Uint32)SDLTest_RandomUint32() | 0xFF000000;
+        }
+    }
+
+    for (size = 0; size < SDL_arraysize(dst_sizes); ++size) {
+    for (b = 0; b < SDL_arraysize(blend_modes); ++b) {
+    for (m = 0; m < SDL_arraysize(masks); ++m) {
+        const int dst_w = dst_sizes[size][0], dst_h = dst_sizes[size][1];
+        const Uint64 incx = ((Uint64)src_w << 16) / dst_w;
+        const Uint64 incy = ((Uint64)src_h << 16) / dst_h;
+        SDL_Surface *dst;
+        Uint64 posy = incy / 2;
+        int x, y, ret, mismatches = 0;
+
+        SDL_SetHint(SDL_HINT_CPU_FEATURE_MASK, masks[m]);
+
+        dst = SDL_CreateSurface(dst_w, dst_h, SDL_PIXELFORMAT_XBGR8888);
+        SDLTest_AssertCheck(dst != NULL, "Verify destination surface is not NULL");
+        if (!dst) {
+            SDL_DestroySurface(src);
+            SDL_ResetHint(SDL_HINT_CPU_FEATURE_MASK);
+            return TEST_ABORTED;
+        }
+        SDL_SetSurfaceBlendMode(src, blend_modes[b]);
+        ret = SDL_BlitSurfaceScaled(src, NULL, dst, NULL, SDL_SCALEMODE_NEAREST);
+        SDLTest_AssertCheck(ret == 0, "Validate result from SDL_BlitSurfaceScaled, expected: 0, got: %i", ret);
+
+        for (y = 0; y < dst_h; ++y) {
+            const Uint32 *srcrow = (const Uint32 *)((const Uint8 *)src->pixels + (posy >> 16) * src->pitch);
+            const Uint32 *dstrow = (const Uint32 *)((const Uint8 *)dst->pixels + y * dst->pitch);
+            Uint64 posx = incx / 2;
+
+            for (x = 0; x < dst_w; ++x) {
+                const Uint32 pixel = srcrow[posx >> 16];
+                const Uint32 expected = ((pixel & 0xFF) << 16) | (pixel & 0xFF00) | ((pixel >> 16) & 0xFF);
+                if ((dstrow[x] & 0x00FFFFFF) != expected) {
+                    ++mismatches;
+                }
+                posx += incx;
+            }
+            posy += incy;
+        }
+        SDLTest_AssertCheck(mismatches == 0, "Validate %dx%d to %dx%d blit with blend mode 0x%x and CPU feature mask \"%s\", expected: 0 mismatches, got: %d",
+                            src_w, src_h, dst_w, dst_h, blend_modes[b], masks[m], mismatches);
+        SDL_DestroySurface(dst);
+    }
+    }
+    }
+    SDL_ResetHint(SDL_HINT_CPU_FEATURE_MASK);
+    SDL_DestroySurface(src);
+
+    return TEST_COMPLETED;
+}
+
+/* Fills in the RGB332 colors in reverse order, so indexed blits go through a mapping table */
+static void SetReversedRGB332Palette(SDL_Surface *surface)
+{
+    SDL_Color colors[256];
+    int i;
+
+    for (i = 0; i < 256; ++i) {
+        const int code = 255 - i;
+        colors[i].r = (Uint8)(((code >> 5) & 7) * 255 / 7);
+        colors[i].g = (Uint8)(((code >> 2) & 7) * 255 / 7);
+        colors[i].b = (Uint8)((code & 3) * 255 / 3);
+        colors[i].a = SDL_ALPHA_OPAQUE;
+    }
+    SDL_SetPaletteColors(surface->format->palette, colors, 0, 256);
+}
+
+/* Returns the average difference between the colors of a surface and the gray gradient it was converted from,
+   measured over groups of four columns so the whole dither pattern is covered */
+static double GetGradientError(SDL_Surface *surface)
+{
+    double total = 0.0;
+    int x, y, i;
+
+    for (x = 0; x < surface->w; x += 4) {
+        double sum = 0.0;
+        for (y = 0; y < surface->h; ++y) {
+            for (i = 0; i < 4; ++i) {
+                Uint8 r, g, b, a;
+                SDL_ReadSurfacePixel(surface, x + i, y, &r, &g, &b, &a);
+                sum += (double)r + g + b;
+            }
+        }
+        total += SDL_fabs(sum / (12.0 * surface->h) - (x + 1.5));
+    }
+    return total / (surface->w / 4);
+}
+
+/**
+ * Tests that dithering gets the average color of a gradient closer to the source than truncating.
+ */
+static int surface_testDither(void *arg)
+{
+    static const SDL_PixelFormatEnum formats[] = {
+        SDL_PIXELFORMAT_RGB565, SDL_PIXELFORMAT_RGB332, SDL_PIXELFORMAT_INDEX8
+    };
+    static const char *mode_names[] = { "none", "ordered", "diffusion" };
+    SDL_Surface *src, *dst, *convert;
+    SDL_DitherMode mode;
+    double error[3];
+    int i, f, m, x, y, ret;
+
+    src = SDL_CreateSurface(256, 16, SDL_PIXELFORMAT_XRGB8888);
+    SDLTest_AssertCheck(src != NULL, "Verify source surface is not NULL");
+    if (!src) {
+        return TEST_ABORTED;
+    }
+    for (y = 0; y < src->h; ++y) {
+        Uint32 *row = (Uint32 *)((Uint8 *)src->pixels + y * src->pitch);
+        for (x = 0; x < src->w; ++x) {
+            row[x] = ((Uint32)x << 16) | ((Uint32)x << 8) | (Uint32)x;
+        }
+    }
+
+    ret = SDL_GetSurfaceDitherMode(src, &mode);
+    SDLTest_AssertCheck(ret == 0 && mode == SDL_DITHER_NONE, "Validate default dither mode, expected: 0, got: %i", mode);
+    ret = SDL_SetSurfaceDitherMode(src, (SDL_DitherMode)42);
+    SDLTest_AssertCheck(ret < 0, "Validate that an invalid dither mode is rejected, got: %i", ret);
+
+    for (f = 0; f < SDL_arraysize(formats); ++f) {
+        dst = SDL_CreateSurface(src->w, src->h, formats[f]);
+        SDLTest_AssertCheck(dst != NULL, "Verify destination surface is not NULL");
+        if (!dst) {
+            SDL_DestroySurface(src);
+            return TEST_ABORTED;
+        }
+        if (dst->format->palette) {
+            SetReversedRGB332Palette(dst);
+        }
+
+        for (m = 0; m < SDL_arraysize(error); ++m) {
+            ret = SDL_SetSurfaceDitherMode(src, (SDL_DitherMode)m);
+            SDLTest_AssertCheck(ret == 0, "Validate result from SDL_SetSurfaceDitherMode, expected: 0, got: %i", ret);
+            ret = SDL_GetSurfaceDitherMode(src, &mode);
+            SDLTest_AssertCheck(ret == 0 && mode == (SDL_DitherMode)m, "Validate dither mode, expected: %i, got: %i", m, mode);
+
+            ret = SDL_BlitSurface(src, NULL, dst, NULL);
+            SDLTest_AssertCheck(ret == 0, "Validate result from SDL_BlitSurface, expected: 0, got: %i", ret);
+            error[m] = GetGradientError(dst);
+            SDLTest_Log("%s, dither %s: average error %.2f", SDL_GetPixelFormatName(formats[f]), mode_names[m], error[m]);
+
+            /* Conversions go through the same blitters */
+            if (!dst->format->palette) {
+                convert = SDL_ConvertSurfaceFormat(src, formats[f]);
+                SDLTest_AssertCheck(convert != NULL, "Verify result from SDL_ConvertSurfaceFormat is not NULL");
+                if (convert) {
+                    int mismatches = 0;
+                    for (i = 0; i < dst->h; ++i) {
+                        if (SDL_memcmp((Uint8 *)dst->pixels + i * dst->pitch, (Uint8 *)convert->pixels + i * convert->pitch, dst->w * dst->format->bytes_per_pixel) != 0) {
+                            ++mismatches;
+                        }
+                    }
+                    SDLTest_AssertCheck(mismatches == 0, "Validate that the converted surface matches the blit, got %d mismatched rows", mismatches);
+                    SDL_DestroySurface(convert);
+                }
+            }
+        }
+        SDLTest_AssertCheck(error[SDL_DITHER_ORDERED] < error[SDL_DITHER_NONE] / 2,
+                            "Validate that ordered dithering to %s reduces the error, %.2f vs %.2f", SDL_GetPixelFormatName(formats[f]), error[SDL_DITHER_ORDERED], error[SDL_DITHER_NONE]);
+        SDLTest_AssertCheck(error[SDL_DITHER_DIFFUSION] < error[SDL_DITHER_NONE] / 2,
+                            "Validate that error diffusion to %s reduces the error, %.2f vs %.2f", SDL_GetPixelFormatName(formats[f]), error[SDL_DITHER_DIFFUSION], error[SDL_DITHER_NONE]);
+        SDL_DestroySurface(dst);
+    }
+    SDL_DestroySurface(src);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Tests that the SIMD ordered dithering matches the scalar version, and that the pattern is anchored to the destination.
+ */
+static int surface_testDitherSIMD(void *arg)
+{
+    static const SDL_PixelFormatEnum formats[] = {
+        SDL_PIXELFORMAT_RGB565, SDL_PIXELFORMAT_BGR565, SDL_PIXELFORMAT_XRGB1555, SDL_PIXELFORMAT_RGB332, SDL_PIXELFORMAT_INDEX8
+    };
+    /* The first mask gives the scalar results */
+    static const char *masks[] = { "-sse2,-neon", "all" };
+    /* Odd sizes, so the SIMD kernels have to leave a tail */
+    const int w = 61, h = 7;
+    SDL_Surface *src, *dst[SDL_arraysize(masks) + 1];
+    SDL_Rect rect;
+    int f, m, i, y, ret;
+
+    src = SDL_CreateSurface(w, h, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(src != NULL, "Verify source surface is not NULL");
+    if (!src) {
+        return TEST_ABORTED;
+    }
+    for (y = 0; y < h; ++y) {
+        Uint32 *row = (Uint32 *)((Uint8 *)src->pixels + y * src->pitch);
+        for (i = 0; i < w; ++i) {
+            row[i] = (Uint32)SDLTest_RandomUint32();
+        }
+    }
+    SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_NONE);
+    SDL_SetSurfaceDitherMode(src, SDL_DITHER_ORDERED);
+
+    for (f = 0; f < SDL_arraysize(formats); ++f) {
+        int mismatches = 0;
+
+        SDL_zeroa(dst);
+        for (i = 0; i < SDL_arraysize(dst); ++i) {
+            dst[i] = SDL_CreateSurface(w, h, formats[f]);
+            SDLTest_AssertCheck(dst[i] != NULL, "Verify destination surface is not NULL");
+            if (!dst[i]) {
+                goto done;
+            }
+            if (dst[i]->format->palette) {
+                SetReversedRGB332Palette(dst[i]);
+            }
+        }
+
+        for (m = 0; m < SDL_arraysize(masks); ++m) {
+            SDL_SetHint(SDL_HINT_CPU_FEATURE_MASK, masks[m]);
+            ret = SDL_BlitSurface(src, NULL, dst[m], NULL);
+            SDLTest_AssertCheck(ret == 0, "Validate result from SDL_BlitSurface, expected: 0, got: %i", ret);
+        }
+        SDL_ResetHint(SDL_HINT_CPU_FEATURE_MASK);
+
+        /* Blit one column at a time */
+        for (i = 0; i < w; ++i) {
+            rect.x = i;
+            rect.y = 0;
+            rect.w = 1;
+            rect.h = h;
+            SDL_BlitSurface(src, &rect, dst[SDL_arraysize(masks)], &rect);
+        }
+
+        for (i = 1; i < SDL_arraysize(dst); ++i) {
+            for (y = 0; y < h; ++y) {
+                if (SDL_memcmp((Uint8 *)dst[0]->pixels + y * dst[0]->pitch, (Uint8 *)dst[i]->pixels + y * dst[i]->pitch, w * dst[0]->format->bytes_per_pixel) != 0) {
+                    ++mismatches;
+                }
+            }
+        }
+        SDLTest_AssertCheck(mismatches == 0, "Validate dithered blits to %s, expected: 0 mismatched rows, got: %d", SDL_GetPixelFormatName(formats[f]), mismatches);
+
+done:
+        for (i = 0; i < SDL_arraysize(dst); ++i) {
+            SDL_DestroySurface(dst[i]);
+        }
+    }
+    SDL_ResetHint(SDL_HINT_CPU_FEATURE_MASK);
+    SDL_DestroySurface(src);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Tests that the SIMD versions of the generated blitters give exactly the same results as the scalar ones.
+ */
+static int surface_testBlitSIMD(void *arg)
+{
+    static const SDL_PixelFormatEnum src_formats[] = {
+        SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888,
+        SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGRA8888
+    };
+    static const SDL_PixelFormatEnum dst_formats[] = {
+        SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888
+    };
+    static const SDL_BlendMode blend_modes[] = {
+        SDL_BLENDMODE_NONE, SDL_BLENDMODE_BLEND, SDL_BLENDMODE_ADD, SDL_BLENDMODE_MOD, SDL_BLENDMODE_MUL
+    };
+    /* The first mask gives the scalar results, the others allow each SIMD blitter in turn */
+    static const char *masks[] = { "-sse41,-avx2,-neon", "-avx2", "all" };
+    /* Odd sizes, so the blitters have to handle partial vectors */
+    const int src_w = 37, src_h = 5, dst_w = 64, dst_h = 8;
+    Uint32 src_pixels[37 * 5];
+    Uint32 dst_pixels[64 * 8];
+    Uint32 results[SDL_arraysize(masks)][64 * 8];
+    int mismatches[SDL_arraysize(masks)];
+    int i, s, d, b, modulate, scale, m;
+
+    SDLTest_Log("SSE4.1: %s, AVX2: %s, NEON: %s", SDL_HasSSE41() ? "yes" : "no", SDL_HasAVX2() ? "yes" : "no", SDL_HasNEON() ? "yes" : "no");
+
+    SDL_zeroa(mismatches);
+    for (s = 0; s < SDL_arraysize(src_formats); ++s) {
+    for (d = 0; d < SDL_arraysize(dst_formats); ++d) {
+    for (b = 0; b < SDL_arraysize(blend_modes); ++b) {
+    for (modulate = 0; modulate <= 1; ++modulate) {
+    for (scale = 0; scale <= 1; ++scale) {
+        const Uint8 r = SDLTest_RandomUint8(), g = SDLTest_RandomUint8(), bl = SDLTest_RandomUint8(), a = SDLTest_RandomUint8();
+
+        for (i = 0; i < SDL_arraysize(src_pixels); ++i) {
+            src_pixels[i] = (Uint32)SDLTest_RandomUint32();
+        }
+        /* Make sure fully transparent and fully opaque pixels are covered */
+        src_pixels[0] &= 0x00FFFF00;
+        src_pixels[1] |= 0xFF0000FF;
+        for (i = 0; i < SDL_arraysize(dst_pixels); ++i) {
+            dst_pixels[i] = (Uint32)SDLTest_RandomUint32();
+        }
+
+        for (m = 0; m < SDL_arraysize(masks); ++m) {
+            SDL_Surface *src, *dst;
+            int ret;
+
+            SDL_SetHint(SDL_HINT_CPU_FEATURE_MASK, masks[m]);
+
+            src = SDL_CreateSurface(src_w, src_h, src_formats[s]);
+            dst = SDL_CreateSurface(dst_w, dst_h, dst_formats[d]);
+            if (!src || !dst) {
+                SDLTest_AssertCheck(src != NULL && dst != NULL, "Validate result from SDL_CreateSurface, %s", SDL_GetError());
+                SDL_DestroySurface(src);
+                SDL_DestroySurface(dst);
+                SDL_ResetHint(SDL_HINT_CPU_FEATURE_MASK);
+                return TEST_ABORTED;
+            }
+            for (i = 0; i < src_h; ++i) {
+                SDL_memcpy((Uint8 *)src->pixels + i * src->pitch, &src_pixels[i * src_w], src_w * sizeof(Uint32));
+            }
+            for (i = 0; i < dst_h; ++i) {
+                SDL_memcpy((Uint8 *)dst->pixels + i * dst->pitch, &dst_pixels[i * dst_w], dst_w * sizeof(Uint32));
+            }
+
+            SDL_SetSurfaceBlendMode(src, blend_modes[b]);
+            if (modulate) {
+                SDL_SetSurfaceColorMod(src, r, g, bl);
+                SDL_SetSurfaceAlphaMod(src, a);
+            }
+            if (scale) {
+                SDL_Rect dstrect = { 1, 1, 61, 7 };
+                ret = SDL_BlitSurfaceScaled(src, NULL, dst, &dstrect, SDL_SCALEMODE_NEAREST);
+            } else {
+                ret = SDL_BlitSurface(src, NULL, dst, NULL);
+            }
+            if (ret != 0) {
+                SDLTest_AssertCheck(ret == 0, "Validate result from SDL_BlitSurface, expected: 0, got: %i, %s", ret, SDL_GetError());
+            }
+
+            for (i = 0; i < dst_h; ++i) {
+                SDL_memcpy(&results[m][i * dst_w], (Uint8 *)dst->pixels + i * dst->pitch, dst_w * sizeof(Uint32));
+            }
+            SDL_DestroySurface(src);
+            SDL_DestroySurface(dst);
+
+            if (m > 0 && SDL_memcmp(results[m], results[0], sizeof(results[0])) != 0) {
+                if (mismatches[m]++ == 0) {
+                    SDLTest_LogError("%s blit from %s to %s with blend mode 0x%x%s%s differs from the scalar blit",
+                                     masks[m], SDL_GetPixelFormatName(src_formats[s]), SDL_GetPixelFormatName(dst_formats[d]),
+                                     blend_modes[b], modulate ? ", modulated" : "", scale ? ", scaled" : "");
+                }
+            }
+        }
+    }
+    }
+    }
+    }
+    }
+    SDL_ResetHint(SDL_HINT_CPU_FEATURE_MASK);
+
+    for (m = 1; m < SDL_arraysize(masks); ++m) {
+        SDLTest_AssertCheck(mismatches[m] == 0, "Validate blits with CPU feature mask \"%s\" against the scalar blits, expected: 0 mismatches, got: %d", masks[m], mismatches[m]);
+    }
+
+    return TEST_COMPLETED;
+}
+
 static int surface_testOverflow(void *arg)
 {
     char buf[1024];
@@ -862,6 +1432,10 @@ static const SDLTest_TestCaseReference surfaceTest1 = {
     (SDLTest_TestCaseFp)surface_testSaveLoadBitmap, "surface_testSaveLoadBitmap", "Tests sprite saving and loading.", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference surfaceTestSaveLoadBitmapFormats = {
+    surface_testSaveLoadBitmapFormats, "surface_testSaveLoadBitmapFormats", "Tests saving and loading bitmaps through files and memory streams.", TEST_ENABLED
+};
+
 static const SDLTest_TestCaseReference surfaceTest2 = {
     (SDLTest_TestCaseFp)surface_testBlit, "surface_testBlit", "Tests basic blitting.", TEST_ENABLED
 };
@@ -909,6 +1483,22 @@ static const SDLTest_TestCaseReference surfaceTest12 = {
     (SDLTest_TestCaseFp)surface_testBlitBlendMod, "surface_testBlitBlendMod", "Tests blitting routines with mod blending mode.", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference surfaceTestBlitSIMD = {
+    surface_testBlitSIMD, "surface_testBlitSIMD", "Tests the SIMD blitters against the scalar blitters.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference surfaceTestBlitScaledNearest = {
+    surface_testBlitScaledNearest, "surface_testBlitScaledNearest", "Tests nearest neighbor scaled blits against a reference scaler.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference surfaceTestDither = {
+    surface_testDither, "surface_testDither", "Tests that dithering reduces the error of low precision blits.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference surfaceTestDitherSIMD = {
+    surface_testDitherSIMD, "surface_testDitherSIMD", "Tests the SIMD ordered dithering against the scalar version.", TEST_ENABLED
+};
+
 static const SDLTest_TestCaseReference surfaceTestOverflow = {
     surface_testOverflow, "surface_testOverflow", "Test overflow detection.", TEST_ENABLED
 };
@@ -921,7 +1511,7 @@ static const SDLTest_TestCaseReference surfaceTestFlip = {
 static const SDLTest_TestCaseReference *surfaceTests[] = {
     &surfaceTest1, &surfaceTest2, &surfaceTest3, &surfaceTest4, &surfaceTest5,
     &surfaceTest6, &surfaceTest7, &surfaceTest8, &surfaceTest9, &surfaceTest10,
-    &surfaceTest11, &surfaceTest12, &surfaceTestOverflow, &surfaceTestFlip, NULL
+    &surfaceTest11, &surfaceTest12, &surfaceTestBlitScaledNearest, &surfaceTestBlitSIMD, &surfaceTestDither, &surfaceTestDitherSIMD, &surfaceTestOverflow, &surfaceTestFlip, &surfaceTestSaveLoadBitmapFormats, NULL
 };
 
 /* Surface test suite (global) */
@@ -100,6 +100,29 @@ static int timer_delayAndGetTicks(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * Call to SDL_DelayPrecise
+ */
+static int timer_delayPrecise(void *arg)
+{
+    const Uint64 testDelays[] = { 0, SDL_US_TO_NS(10), SDL_US_TO_NS(500), SDL_MS_TO_NS(2), SDL_MS_TO_NS(15) };
+    int i;
+
+    for (i = 0; i < SDL_arraysize(testDelays); ++i) {
+        const Uint64 start = SDL_GetTicksNS();
+        Uint64 elapsed;
+
+        SDL_DelayPrecise(testDelays[i]);
+        SDLTest_AssertPass("Call to SDL_DelayPrecise(%" SDL_PRIu64 ")", testDelays[i]);
+        elapsed = SDL_GetTicksNS() - start;
+
+        /* Only the lower bound, the upper one might fail on non-interactive systems */
+        SDLTest_AssertCheck(elapsed >= testDelays[i], "Check elapsed time, expected: >=%" SDL_PRIu64 ", got: %" SDL_PRIu64, testDelays[i], elapsed);
+    }
+
+    return TEST_COMPLETED;
+}
+
 /* Test callback */
 static Uint32 SDLCALL timerTestCallback(Uint32 interval, void *param)
 {
@@ -187,9 +210,13 @@ static const SDLTest_TestCaseReference timerTest4 = {
     (SDLTest_TestCaseFp)timer_addRemoveTimer, "timer_addRemoveTimer", "Call to SDL_AddTimer and SDL_RemoveTimer", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference timerTest5 = {
+    (SDLTest_TestCaseFp)timer_delayPrecise, "timer_delayPrecise", "Call to SDL_DelayPrecise", TEST_ENABLED
+};
+
 /* Sequence of Timer test cases */
 static const SDLTest_TestCaseReference *timerTests[] = {
-    &timerTest1, &timerTest2, &timerTest3, &timerTest4, NULL
+    &timerTest1, &timerTest2, &timerTest3, &timerTest4, &timerTest5, NULL
 };
 
 /* Timer test suite (global) */
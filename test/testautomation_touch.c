@@ -0,0 +1,481 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef NO_BUILD_CONFIG
+
+/**
+ * Touch test suite
+ */
+
+#define SDL_internal_h_ /* Inhibit dynamic symbol redefinitions that clash with ours */
+
+/* ================= System Under Test (SUT) ================== */
+/* Renaming SUT operations to avoid link-time symbol clashes */
+#define SDL_TouchDevicesAvailable SDL_SUT_TouchDevicesAvailable
+#define SDL_GetTouchDevices       SDL_SUT_GetTouchDevices
+#define SDL_GetTouchDeviceName    SDL_SUT_GetTouchDeviceName
+#define SDL_GetTouchDeviceType    SDL_SUT_GetTouchDeviceType
+#define SDL_GetTouchFingers       SDL_SUT_GetTouchFingers
+
+#define SDL_InitTouch        SDL_SUT_InitTouch
+#define SDL_AddTouch         SDL_SUT_AddTouch
+#define SDL_GetTouch         SDL_SUT_GetTouch
+#define SDL_SendTouch        SDL_SUT_SendTouch
+#define SDL_SendTouchMotion  SDL_SUT_SendTouchMotion
+#define SDL_SendTouchMotions SDL_SUT_SendTouchMotions
+#define SDL_DelTouch         SDL_SUT_DelTouch
+#define SDL_QuitTouch        SDL_SUT_QuitTouch
+
+/* ================= Mock API ================== */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_test.h>
+/* For SDL_Window, SDL_Mouse, SDL_VideoDevice: */
+#include "../src/events/SDL_events_c.h"
+#include "../src/video/SDL_sysvideo.h"
+/* Divert calls to mock mouse, event and video API: */
+#define SDL_SendMouseMotion SDL_Mock_SendMouseMotion
+#define SDL_SendMouseButton SDL_Mock_SendMouseButton
+#define SDL_GetMouse        SDL_Mock_GetMouse
+#define SDL_EventEnabled    SDL_Mock_EventEnabled
+#define SDL_PushEvent       SDL_Mock_PushEvent
+#define SDL_GetWindowID     SDL_Mock_GetWindowID
+#define SDL_GetVideoDevice  SDL_Mock_GetVideoDevice
+
+/* Mock API */
+static int SDL_SendMouseMotion(Uint64 timestamp, SDL_Window *window, SDL_MouseID mouseID, SDL_bool relative, float x, float y);
+static int SDL_SendMouseButton(Uint64 timestamp, SDL_Window *window, SDL_MouseID mouseID, Uint8 state, Uint8 button);
+static SDL_Mouse *SDL_GetMouse(void);
+static SDL_bool SDL_EventEnabled(Uint32 type);
+static int SDL_PushEvent(SDL_Event *event);
+static SDL_WindowID SDL_GetWindowID(SDL_Window *window);
+static SDL_VideoDevice *SDL_GetVideoDevice(void);
+
+/* Import SUT code with macro-renamed function names  */
+#define SDL_waylanddyn_h_ /* hack: suppress spurious build problem with libdecor.h on Wayland */
+#include "../src/events/SDL_touch.c"
+
+/* ================= Internal SDL API Compatibility ================== */
+/* Mock implementations of Touch -> Mouse, Event and Video calls */
+/* Not thread-safe! */
+
+#define TOUCH_MAX_TEST_EVENTS 16
+
+static SDL_Event _touch_events[TOUCH_MAX_TEST_EVENTS];
+static int _touch_num_events = 0;
+
+static int SDL_SendMouseMotion(Uint64 timestamp, SDL_Window *window, SDL_MouseID mouseID, SDL_bool relative, float x, float y)
+{
+    return 1;
+}
+
+static int SDL_SendMouseButton(Uint64 timestamp, SDL_Window *window, SDL_MouseID mouseID, Uint8 state, Uint8 button)
+{
+    return 1;
+}
+
+static SDL_Mouse *SDL_GetMouse(void)
+{
+    static SDL_Mouse dummy_mouse;
+
+    return &dummy_mouse;
+}
+
+static SDL_bool SDL_EventEnabled(Uint32 type)
+{
+    return SDL_TRUE;
+}
+
+static int SDL_PushEvent(SDL_Event *event)
+{
+    if (_touch_num_events < TOUCH_MAX_TEST_EVENTS) {
+        _touch_events[_touch_num_events] = *event;
+    }
+    ++_touch_num_events;
+    return 1;
+}
+
+static SDL_WindowID SDL_GetWindowID(SDL_Window *window)
+{
+    return 0;
+}
+
+static SDL_VideoDevice *SDL_GetVideoDevice(void)
+{
+    static SDL_VideoDevice dummy_device;
+
+    return &dummy_device;
+}
+
+/* ================= Test Case Support ================== */
+
+#define TOUCH_NUM_TEST_FINGERS 1000
+#define TOUCH_NUM_TEST_DEVICES 64
+
+/* Half of the IDs are small and consecutive, like most platforms hand out, the rest are spread over the whole range */
+static Uint64 _touch_test_id(int i)
+{
+    if (i % 2) {
+        return (Uint64)(i + 1) * SDL_UINT64_C(0x9E3779B97F4A7C15);
+    }
+    return (Uint64)(i + 1);
+}
+
+static void _touch_shuffle(int *order, int count)
+{
+    int i;
+
+    for (i = 0; i < count; ++i) {
+        order[i] = i;
+    }
+    for (i = count - 1; i > 0; --i) {
+        const int j = SDLTest_RandomIntegerInRange(0, i);
+        const int tmp = order[i];
+        order[i] = order[j];
+        order[j] = tmp;
+    }
+}
+
+static float _touch_test_x(int i)
+{
+    return (float)i / TOUCH_NUM_TEST_FINGERS;
+}
+
+/* Check that every finger still down resolves to its own state, and that the released ones are gone */
+static int _touch_check_fingers(SDL_TouchID touchID, const SDL_bool *down, int expected_count)
+{
+    SDL_Touch *touch = SDL_GetTouch(touchID);
+    SDL_Finger **fingers;
+    int i, count = -1;
+    int failures = 0;
+
+    for (i = 0; i < TOUCH_NUM_TEST_FINGERS; ++i) {
+        const SDL_FingerID fingerID = _touch_test_id(i);
+        const SDL_Finger *finger = SDL_GetFinger(touch, fingerID);
+
+        if (down[i]) {
+            if (!finger || finger->id != fingerID || finger->x != _touch_test_x(i)) {
+                ++failures;
+            }
+        } else if (finger) {
+            ++failures;
+        }
+    }
+
+    fingers = SDL_GetTouchFingers(touchID, &count);
+    if (!fingers || count != expected_count) {
+        ++failures;
+    } else {
+        for (i = 0; i < count; ++i) {
+            if (SDL_GetFinger(touch, fingers[i]->id) != &touch->fingers[i]) {
+                ++failures;
+            }
+        }
+        if (fingers[count] != NULL) {
+            ++failures;
+        }
+    }
+    SDL_free(fingers);
+
+    return failures;
+}
+
+/* ================= Test Case Implementation ================== */
+
+/**
+ * Press and release many fingers in random order, checking the finger lookup after every change
+ *
+ * \sa SDL_SendTouch
+ * \sa SDL_GetTouchFingers
+ */
+static int touch_fingerLookup(void *arg)
+{
+    const SDL_TouchID touchID = 42;
+    SDL_bool down[TOUCH_NUM_TEST_FINGERS];
+    int order[TOUCH_NUM_TEST_FINGERS];
+    int i, num_down = 0;
+    int failures = 0;
+
+    SDLTest_AssertCheck(SDL_AddTouch(touchID, SDL_TOUCH_DEVICE_DIRECT, "Test touch") == 0, "Added touch device");
+    SDL_zeroa(down);
+
+    _touch_shuffle(order, TOUCH_NUM_TEST_FINGERS);
+    for (i = 0; i < TOUCH_NUM_TEST_FINGERS; ++i) {
+        const int f = order[i];
+        SDL_SendTouch(0, touchID, _touch_test_id(f), NULL, SDL_TRUE, _touch_test_x(f), 0.5f, 1.0f);
+        down[f] = SDL_TRUE;
+        ++num_down;
+        failures += _touch_check_fingers(touchID, down, num_down);
+    }
+    SDLTest_AssertCheck(failures == 0, "All pressed fingers resolve while pressing, %d failures", failures);
+
+    /* Release half of the fingers, press them again and then release everything */
+    failures = 0;
+    _touch_shuffle(order, TOUCH_NUM_TEST_FINGERS);
+    for (i = 0; i < TOUCH_NUM_TEST_FINGERS / 2; ++i) {
+        const int f = order[i];
+        SDL_SendTouch(0, touchID, _touch_test_id(f), NULL, SDL_FALSE, 0.0f, 0.0f, 0.0f);
+        down[f] = SDL_FALSE;
+        --num_down;
+        failures += _touch_check_fingers(touchID, down, num_down);
+    }
+    for (i = 0; i < TOUCH_NUM_TEST_FINGERS / 2; ++i) {
+        const int f = order[i];
+        SDL_SendTouch(0, touchID, _touch_test_id(f), NULL, SDL_TRUE, _touch_test_x(f), 0.5f, 1.0f);
+        down[f] = SDL_TRUE;
+        ++num_down;
+        failures += _touch_check_fingers(touchID, down, num_down);
+    }
+    _touch_shuffle(order, TOUCH_NUM_TEST_FINGERS);
+    for (i = 0; i < TOUCH_NUM_TEST_FINGERS; ++i) {
+        const int f = order[i];
+        SDL_SendTouch(0, touchID, _touch_test_id(f), NULL, SDL_FALSE, 0.0f, 0.0f, 0.0f);
+        down[f] = SDL_FALSE;
+        --num_down;
+        failures += _touch_check_fingers(touchID, down, num_down);
+    }
+    SDLTest_AssertCheck(failures == 0, "All remaining fingers resolve while releasing, %d failures", failures);
+
+    /* Releasing a finger that isn't down is ignored */
+    SDLTest_AssertCheck(SDL_SendTouch(0, touchID, _touch_test_id(0), NULL, SDL_FALSE, 0.0f, 0.0f, 0.0f) == 0, "Release of a finger that is up is ignored");
+
+    SDL_DelTouch(touchID);
+    SDLTest_AssertCheck(!SDL_TouchDevicesAvailable(), "Touch device removed");
+    return TEST_COMPLETED;
+}
+
+/**
+ * Add and remove many touch devices in random order, checking the device lookup after every change
+ *
+ * \sa SDL_AddTouch
+ * \sa SDL_DelTouch
+ * \sa SDL_GetTouchDevices
+ */
+static int touch_deviceLookup(void *arg)
+{
+    SDL_bool present[TOUCH_NUM_TEST_DEVICES];
+    int order[TOUCH_NUM_TEST_DEVICES];
+    int i, j, count, num_present = 0;
+    int failures = 0;
+
+    SDL_zeroa(present);
+
+    _touch_shuffle(order, TOUCH_NUM_TEST_DEVICES);
+    for (i = 0; i < TOUCH_NUM_TEST_DEVICES; ++i) {
+        const int d = order[i];
+        if (SDL_AddTouch(_touch_test_id(d), SDL_TOUCH_DEVICE_DIRECT, NULL) != num_present) {
+            ++failures;
+        }
+        present[d] = SDL_TRUE;
+        ++num_present;
+    }
+    SDLTest_AssertCheck(failures == 0, "Touch devices added at the end of the device list, %d failures", failures);
+
+    /* Adding a device that is already present returns its existing index */
+    failures = 0;
+    for (i = 0; i < TOUCH_NUM_TEST_DEVICES; ++i) {
+        const int index = SDL_AddTouch(_touch_test_id(i), SDL_TOUCH_DEVICE_DIRECT, NULL);
+        if (index < 0 || SDL_touchDevices[index]->id != _touch_test_id(i)) {
+            ++failures;
+        }
+    }
+    SDLTest_AssertCheck(failures == 0 && SDL_num_touch == TOUCH_NUM_TEST_DEVICES, "Touch devices not added twice, %d failures", failures);
+
+    failures = 0;
+    _touch_shuffle(order, TOUCH_NUM_TEST_DEVICES);
+    for (i = 0; i < TOUCH_NUM_TEST_DEVICES; ++i) {
+        SDL_TouchID *devices;
+
+        SDL_DelTouch(_touch_test_id(order[i]));
+        present[order[i]] = SDL_FALSE;
+        --num_present;
+
+        for (j = 0; j < TOUCH_NUM_TEST_DEVICES; ++j) {
+            const int index = SDL_GetTouchIndex(_touch_test_id(j));
+            if (present[j]) {
+                if (index < 0 || index >= SDL_num_touch || SDL_touchDevices[index]->id != _touch_test_id(j)) {
+                    ++failures;
+                }
+            } else if (index >= 0) {
+                ++failures;
+            }
+        }
+
+        devices = SDL_GetTouchDevices(&count);
+        if (!devices || count != num_present) {
+            ++failures;
+        } else {
+            for (j = 0; j < count; ++j) {
+                if (SDL_GetTouchIndex(devices[j]) != j) {
+                    ++failures;
+                }
+            }
+        }
+        SDL_free(devices);
+    }
+    SDLTest_AssertCheck(failures == 0, "All remaining touch devices resolve while removing, %d failures", failures);
+
+    /* Removed devices are unknown */
+    SDLTest_AssertCheck(SDL_GetTouchDeviceType(_touch_test_id(0)) == SDL_TOUCH_DEVICE_INVALID, "Removed touch device is unknown");
+    return TEST_COMPLETED;
+}
+
+/* Checks one of the events the SUT posted */
+static void _touch_check_event(int index, Uint32 type, SDL_FingerID fingerID, float x, float y, float dx, float dy, float pressure)
+{
+    const SDL_TouchFingerEvent *event = &_touch_events[index].tfinger;
+
+    if (index >= _touch_num_events) {
+        SDLTest_AssertCheck(SDL_FALSE, "Event %d was posted", index);
+        return;
+    }
+    SDLTest_AssertCheck(event->type == type && event->fingerID == fingerID,
+                        "Event %d is of type 0x%x for finger %" SDL_PRIu64 ", got type 0x%x for finger %" SDL_PRIu64,
+                        index, type, fingerID, event->type, event->fingerID);
+    SDLTest_AssertCheck(event->x == x && event->y == y && event->dx == dx && event->dy == dy && event->pressure == pressure,
+                        "Event %d is at (%g, %g), moved (%g, %g) with pressure %g, got (%g, %g), moved (%g, %g) with pressure %g",
+                        index, x, y, dx, dy, pressure, event->x, event->y, event->dx, event->dy, event->pressure);
+}
+
+/**
+ * Move several fingers at once, the way SDL_evdev.c reports each SYN_REPORT
+ *
+ * \sa SDL_SendTouchMotions
+ */
+static int touch_motionBatch(void *arg)
+{
+    const SDL_TouchID touchID = 42;
+    SDL_Finger batch[4];
+    SDL_Touch *touch;
+    int posted;
+
+    SDLTest_AssertCheck(SDL_AddTouch(touchID, SDL_TOUCH_DEVICE_DIRECT, "Test touch") == 0, "Added touch device");
+    SDL_SendTouch(0, touchID, 1, NULL, SDL_TRUE, 0.25f, 0.25f, 1.0f);
+    SDL_SendTouch(0, touchID, 2, NULL, SDL_TRUE, 0.5f, 0.5f, 1.0f);
+    SDL_SendTouch(0, touchID, 3, NULL, SDL_TRUE, 0.75f, 0.75f, 1.0f);
+    _touch_num_events = 0;
+
+    /* Finger 1 moves, finger 2 stays where it is, finger 3 only presses harder and finger 4 isn't down yet */
+    batch[0].id = 1;
+    batch[0].x = 0.5f;
+    batch[0].y = 0.125f;
+    batch[0].pressure = 1.0f;
+    batch[1].id = 2;
+    batch[1].x = 0.5f;
+    batch[1].y = 0.5f;
+    batch[1].pressure = 1.0f;
+    batch[2].id = 3;
+    batch[2].x = 0.75f;
+    batch[2].y = 0.75f;
+    batch[2].pressure = 0.5f;
+    batch[3].id = 4;
+    batch[3].x = 0.0f;
+    batch[3].y = 1.0f;
+    batch[3].pressure = 0.25f;
+    posted = SDL_SendTouchMotions(1, touchID, NULL, batch, SDL_arraysize(batch));
+    SDLTest_AssertCheck(posted == 3, "SDL_SendTouchMotions() posted 3 events, got %d", posted);
+    SDLTest_AssertCheck(_touch_num_events == 3, "3 events were pushed, got %d", _touch_num_events);
+    _touch_check_event(0, SDL_EVENT_FINGER_MOTION, 1, 0.5f, 0.125f, 0.25f, -0.125f, 1.0f);
+    _touch_check_event(1, SDL_EVENT_FINGER_MOTION, 3, 0.75f, 0.75f, 0.0f, 0.0f, 0.5f);
+    _touch_check_event(2, SDL_EVENT_FINGER_DOWN, 4, 0.0f, 1.0f, 0.0f, 0.0f, 0.25f);
+
+    touch = SDL_GetTouch(touchID);
+    SDLTest_AssertCheck(touch->num_fingers == 4, "Finger 4 went down, %d fingers down", touch->num_fingers);
+    SDLTest_AssertCheck(SDL_GetFinger(touch, 1)->x == 0.5f && SDL_GetFinger(touch, 1)->y == 0.125f, "Finger 1 moved");
+    SDLTest_AssertCheck(SDL_GetFinger(touch, 3)->pressure == 0.5f, "Finger 3 pressure changed");
+
+    /* A frame where one finger lifts, one lands and two move: SDL_evdev.c sends the presses first, then all the motion */
+    _touch_num_events = 0;
+    SDL_SendTouch(2, touchID, 2, NULL, SDL_FALSE, 0.5f, 0.5f, 1.0f);
+    SDL_SendTouch(2, touchID, 5, NULL, SDL_TRUE, 0.125f, 0.875f, 1.0f);
+    batch[0].x = 0.375f;
+    batch[1] = batch[3];
+    batch[1].x = 0.125f;
+    posted = SDL_SendTouchMotions(2, touchID, NULL, batch, 2);
+    SDLTest_AssertCheck(posted == 2, "SDL_SendTouchMotions() posted 2 events, got %d", posted);
+    SDLTest_AssertCheck(_touch_num_events == 4, "4 events were pushed, got %d", _touch_num_events);
+    _touch_check_event(0, SDL_EVENT_FINGER_UP, 2, 0.5f, 0.5f, 0.0f, 0.0f, 1.0f);
+    _touch_check_event(1, SDL_EVENT_FINGER_DOWN, 5, 0.125f, 0.875f, 0.0f, 0.0f, 1.0f);
+    _touch_check_event(2, SDL_EVENT_FINGER_MOTION, 1, 0.375f, 0.125f, -0.125f, 0.0f, 1.0f);
+    _touch_check_event(3, SDL_EVENT_FINGER_MOTION, 4, 0.125f, 1.0f, 0.125f, 0.0f, 0.25f);
+
+    /* Batches for unknown touch devices are rejected */
+    posted = SDL_SendTouchMotions(3, touchID + 1, NULL, batch, 2);
+    SDLTest_AssertCheck(posted == -1, "SDL_SendTouchMotions() for an unknown touch device fails, got %d", posted);
+
+    SDL_DelTouch(touchID);
+    return TEST_COMPLETED;
+}
+
+/* ================= Test Setup and Teardown ================== */
+
+static void
+touch_test_setup(void *arg) {
+    _touch_num_events = 0;
+    SDL_InitTouch();
+}
+
+static void
+touch_test_teardown(void *arg) {
+    SDL_QuitTouch();
+}
+
+/* ================= Test References ================== */
+
+/* Touch test cases */
+static const SDLTest_TestCaseReference touchTest1 = { (SDLTest_TestCaseFp)touch_fingerLookup, "touch_fingerLookup", "Press and release many fingers in random order and check they resolve", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference touchTest2 = { (SDLTest_TestCaseFp)touch_deviceLookup, "touch_deviceLookup", "Add and remove many touch devices in random order and check they resolve", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference touchTest3 = { (SDLTest_TestCaseFp)touch_motionBatch, "touch_motionBatch", "Move several fingers at once and check the events posted", TEST_ENABLED };
+
+/* Sequence of Touch test cases */
+static const SDLTest_TestCaseReference *touchTests[] = {
+    &touchTest1, &touchTest2, &touchTest3, NULL
+};
+
+/* Touch test suite (global) */
+SDLTest_TestSuiteReference touchTestSuite = {
+    "Touch",
+    (SDLTest_TestCaseSetUpFp)touch_test_setup,
+    touchTests,
+    (SDLTest_TestCaseTearDownFp)touch_test_teardown
+};
+
+#else
+
+#include <SDL3/SDL_test.h>
+#include "testautomation_suites.h"
+
+/* Sequence of Touch test cases */
+static const SDLTest_TestCaseReference *touchTests[] = {
+    NULL
+};
+
+/* Touch test suite (global) */
+SDLTest_TestSuiteReference touchTestSuite = {
+    "Touch",
+    NULL,
+    touchTests,
+    NULL
+};
+
+#endif
@@ -0,0 +1,293 @@
+/**
+ * Trace test suite
+ */
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_test.h>
+#include "testautomation_suites.h"
+
+typedef struct
+{
+    int begin_count;
+    int end_count;
+    int counter_count;
+    Sint64 last_value;
+} TraceCallbackData;
+
+static void SDLCALL TestTraceCallback(void *userdata, SDL_TraceEventType type, const char *name, Uint64 timestamp, Sint64 value)
+{
+    TraceCallbackData *data = (TraceCallbackData *)userdata;
+
+    if (SDL_strncmp(name, "trace_test", 10) != 0) {
+        /* Ignore any zones SDL records on its own threads */
+        return;
+    }
+
+    switch (type) {
+    case SDL_TRACE_EVENT_BEGIN:
+        ++data->begin_count;
+        break;
+    case SDL_TRACE_EVENT_END:
+        ++data->end_count;
+        break;
+    case SDL_TRACE_EVENT_COUNTER:
+        ++data->counter_count;
+        data->last_value = value;
+        break;
+    }
+}
+
+/* Test case functions */
+
+/**
+ * Check that zones and counters reach the trace callback, and only while tracing is enabled
+ */
+static int trace_testCallback(void *arg)
+{
+    TraceCallbackData data;
+    SDL_TraceCallback callback = NULL;
+    void *userdata = NULL;
+    int ret;
+
+    SDL_zero(data);
+    SDL_SetTraceCallback(TestTraceCallback, &data);
+    SDL_GetTraceCallback(&callback, &userdata);
+    SDLTest_AssertPass("Call to SDL_SetTraceCallback()");
+    SDLTest_AssertCheck(callback == TestTraceCallback && userdata == &data, "Check that the trace callback was set");
+
+    SDL_BeginTraceZone("trace_test_disabled");
+    SDL_EndTraceZone("trace_test_disabled");
+    SDLTest_AssertCheck(data.begin_count == 0, "Check that no events are recorded while tracing is disabled, got: %d", data.begin_count);
+
+    ret = SDL_SetTraceEnabled(SDL_TRUE);
+    if (ret < 0) {
+        SDLTest_Log("Tracing not available: %s", SDL_GetError());
+        SDL_SetTraceCallback(NULL, NULL);
+        return TEST_SKIPPED;
+    }
+    SDLTest_AssertPass("Call to SDL_SetTraceEnabled(SDL_TRUE)");
+    SDLTest_AssertCheck(SDL_IsTraceEnabled(), "Check that tracing is enabled");
+
+    SDL_BeginTraceZone("trace_test_outer");
+    SDL_BeginTraceZone("trace_test_inner");
+    SDL_TraceCounter("trace_test_counter", 42);
+    SDL_EndTraceZone("trace_test_inner");
+    SDL_EndTraceZone("trace_test_outer");
+    SDLTest_AssertPass("Call to SDL_BeginTraceZone(), SDL_TraceCounter() and SDL_EndTraceZone()");
+    SDLTest_AssertCheck(data.begin_count == 2, "Check begin events, expected: 2, got: %d", data.begin_count);
+    SDLTest_AssertCheck(data.end_count == 2, "Check end events, expected: 2, got: %d", data.end_count);
+    SDLTest_AssertCheck(data.counter_count == 1, "Check counter events, expected: 1, got: %d", data.counter_count);
+    SDLTest_AssertCheck(data.last_value == 42, "Check counter value, expected: 42, got: %" SDL_PRIs64, data.last_value);
+
+    SDL_SetTraceEnabled(SDL_FALSE);
+    SDL_SetTraceCallback(NULL, NULL);
+    SDLTest_AssertCheck(!SDL_IsTraceEnabled(), "Check that tracing is disabled");
+
+    return TEST_COMPLETED;
+}
+
+typedef struct
+{
+    SDL_TraceCallback callback;
+    SDL_AtomicInt *mismatches;
+} TraceSwapData;
+
+static SDL_AtomicInt trace_swap_stop;
+
+static void SDLCALL TestTraceSwapCallbackA(void *userdata, SDL_TraceEventType type, const char *name, Uint64 timestamp, Sint64 value)
+{
+    TraceSwapData *data = (TraceSwapData *)userdata;
+    if (data->callback != TestTraceSwapCallbackA) {
+        SDL_AtomicIncRef(data->mismatches);
+    }
+}
+
+static void SDLCALL TestTraceSwapCallbackB(void *userdata, SDL_TraceEventType type, const char *name, Uint64 timestamp, Sint64 value)
+{
+    TraceSwapData *data = (TraceSwapData *)userdata;
+    if (data->callback != TestTraceSwapCallbackB) {
+        SDL_AtomicIncRef(data->mismatches);
+    }
+}
+
+static int SDLCALL TraceSwapThread(void *arg)
+{
+    Sint64 value = 0;
+
+    while (!SDL_AtomicGet(&trace_swap_stop)) {
+        SDL_TraceCounter("trace_test_swap", value++);
+    }
+    return 0;
+}
+
+/**
+ * Check that a callback is always called with its own userdata while another thread changes it
+ */
+static int trace_testCallbackSwap(void *arg)
+{
+    SDL_AtomicInt mismatches;
+    TraceSwapData data_a, data_b;
+    SDL_Thread *thread;
+    int i;
+
+    if (SDL_SetTraceEnabled(SDL_TRUE) < 0) {
+        SDLTest_Log("Tracing not available: %s", SDL_GetError());
+        return TEST_SKIPPED;
+    }
+
+    SDL_AtomicSet(&mismatches, 0);
+    data_a.callback = TestTraceSwapCallbackA;
+    data_a.mismatches = &mismatches;
+    data_b.callback = TestTraceSwapCallbackB;
+    data_b.mismatches = &mismatches;
+
+    SDL_AtomicSet(&trace_swap_stop, 0);
+    thread = SDL_CreateThread(TraceSwapThread, "TraceSwap", NULL);
+    SDLTest_AssertCheck(thread != NULL, "Check that the tracing thread was created");
+    if (!thread) {
+        SDL_SetTraceEnabled(SDL_FALSE);
+        return TEST_ABORTED;
+    }
+
+    for (i = 0; i < 20000; ++i) {
+        SDL_SetTraceCallback(TestTraceSwapCallbackA, &data_a);
+        SDL_SetTraceCallback(TestTraceSwapCallbackB, &data_b);
+    }
+    SDLTest_AssertPass("Call to SDL_SetTraceCallback() while another thread records events");
+
+    SDL_AtomicSet(&trace_swap_stop, 1);
+    SDL_WaitThread(thread, NULL);
+    SDL_SetTraceCallback(NULL, NULL);
+    SDL_SetTraceEnabled(SDL_FALSE);
+
+    SDLTest_AssertCheck(SDL_AtomicGet(&mismatches) == 0, "Check that no callback got another callback's userdata, got: %d", SDL_AtomicGet(&mismatches));
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Check that the recorded events are saved in the Chrome trace event format
+ */
+static int trace_testSave(void *arg)
+{
+    const char *filename = "trace_test.json";
+    char *trace;
+    size_t size = 0;
+    int ret;
+
+    ret = SDL_SetTraceEnabled(SDL_TRUE);
+    if (ret < 0) {
+        SDLTest_Log("Tracing not available: %s", SDL_GetError());
+        return TEST_SKIPPED;
+    }
+
+    SDL_BeginTraceZone("trace_test_save");
+    SDL_TraceCounter("trace_test_save_counter", 7);
+    SDL_EndTraceZone("trace_test_save");
+
+    ret = SDL_SaveTrace(filename);
+    SDLTest_AssertPass("Call to SDL_SaveTrace(\"%s\")", filename);
+    SDLTest_AssertCheck(ret == 0, "Check result from SDL_SaveTrace, expected: 0, got: %d", ret);
+
+    SDL_SetTraceEnabled(SDL_FALSE);
+
+    trace = (char *)SDL_LoadFile(filename, &size);
+    SDLTest_AssertCheck(trace != NULL, "Check that %s was written", filename);
+    if (trace) {
+        SDLTest_AssertCheck(SDL_strncmp(trace, "{\"traceEvents\":[", 16) == 0, "Check that the trace starts with the traceEvents array");
+        SDLTest_AssertCheck(SDL_strstr(trace, "\"name\":\"trace_test_save\",\"ph\":\"B\"") != NULL, "Check that the zone begin was saved");
+        SDLTest_AssertCheck(SDL_strstr(trace, "\"name\":\"trace_test_save\",\"ph\":\"E\"") != NULL, "Check that the zone end was saved");
+        SDLTest_AssertCheck(SDL_strstr(trace, "\"name\":\"trace_test_save_counter\",\"ph\":\"C\"") != NULL, "Check that the counter was saved");
+        SDL_free(trace);
+    }
+
+    SDL_RemovePath(filename);
+
+    return TEST_COMPLETED;
+}
+
+#define TRACE_TEST_THREAD_COUNT 32
+
+static int SDLCALL TraceZoneThread(void *arg)
+{
+    SDL_BeginTraceZone("trace_test_thread");
+    SDL_EndTraceZone("trace_test_thread");
+    return 0;
+}
+
+/**
+ * Check that threads which have exited hand their trace buffers on instead of keeping one each
+ */
+static int trace_testThreadBuffers(void *arg)
+{
+    const char *filename = "trace_test_threads.json";
+    const char *zone = "\"name\":\"trace_test_thread\",\"ph\":\"B\"";
+    int num_zones = 0;
+    char *trace;
+    const char *event;
+    int i, ret;
+
+    if (SDL_SetTraceEnabled(SDL_TRUE) < 0) {
+        SDLTest_Log("Tracing not available: %s", SDL_GetError());
+        return TEST_SKIPPED;
+    }
+
+    for (i = 0; i < TRACE_TEST_THREAD_COUNT; ++i) {
+        SDL_Thread *thread = SDL_CreateThread(TraceZoneThread, "TraceZone", NULL);
+        SDLTest_AssertCheck(thread != NULL, "Check that tracing thread %d was created", i);
+        SDL_WaitThread(thread, NULL);
+    }
+    SDLTest_AssertPass("Started and joined %d threads that record a zone", TRACE_TEST_THREAD_COUNT);
+
+    ret = SDL_SaveTrace(filename);
+    SDLTest_AssertCheck(ret == 0, "Check result from SDL_SaveTrace, expected: 0, got: %d", ret);
+
+    SDL_SetTraceEnabled(SDL_FALSE);
+
+    /* Each thread recorded one zone, which is only saved until another thread takes its buffer over */
+    trace = (char *)SDL_LoadFile(filename, NULL);
+    SDLTest_AssertCheck(trace != NULL, "Check that %s was written", filename);
+    if (trace) {
+        for (event = SDL_strstr(trace, zone); event; event = SDL_strstr(event + 1, zone)) {
+            ++num_zones;
+        }
+        SDL_free(trace);
+    }
+    SDLTest_AssertCheck(num_zones > 0, "Check that the last thread's zone was saved");
+    SDLTest_AssertCheck(num_zones <= TRACE_TEST_THREAD_COUNT / 4, "Check that exited threads share trace buffers, expected at most %d buffers, got: %d", TRACE_TEST_THREAD_COUNT / 4, num_zones);
+
+    SDL_RemovePath(filename);
+
+    return TEST_COMPLETED;
+}
+
+/* ================= Test References ================== */
+
+/* Trace test cases */
+static const SDLTest_TestCaseReference traceTest1 = {
+    (SDLTest_TestCaseFp)trace_testCallback, "trace_testCallback", "Check that zones and counters reach the trace callback", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference traceTest2 = {
+    (SDLTest_TestCaseFp)trace_testSave, "trace_testSave", "Check that the trace is saved in the Chrome trace event format", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference traceTest3 = {
+    (SDLTest_TestCaseFp)trace_testCallbackSwap, "trace_testCallbackSwap", "Check that the trace callback and its userdata change together", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference traceTest4 = {
+    (SDLTest_TestCaseFp)trace_testThreadBuffers, "trace_testThreadBuffers", "Check that trace buffers of exited threads are reused", TEST_ENABLED
+};
+
+/* Sequence of Trace test cases */
+static const SDLTest_TestCaseReference *traceTests[] = {
+    &traceTest1, &traceTest2, &traceTest3, &traceTest4, NULL
+};
+
+/* Trace test suite (global) */
+SDLTest_TestSuiteReference traceTestSuite = {
+    "Trace",
+    NULL,
+    traceTests,
+    NULL
+};
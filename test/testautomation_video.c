@@ -2230,6 +2230,66 @@ minimize_test:
     return skipFlags != (SDL_WINDOW_MAXIMIZED | SDL_WINDOW_MINIMIZED)  ? TEST_COMPLETED : TEST_SKIPPED;
 }
 
+/**
+ * Tests that the window keeps its shape when the shape property is cleared
+ */
+static int video_setWindowShape(void *arg)
+{
+    SDL_Window *window;
+    SDL_Renderer *renderer;
+    SDL_Surface *shape;
+    SDL_PropertiesID props;
+    int result;
+
+    window = SDL_CreateWindow("video_setWindowShape Test Window", 320, 240, SDL_WINDOW_TRANSPARENT);
+    SDLTest_AssertPass("Call to SDL_CreateWindow(..., SDL_WINDOW_TRANSPARENT)");
+    if (!window) {
+        SDLTest_Log("Skipping shape test: %s", SDL_GetError());
+        return TEST_SKIPPED;
+    }
+
+    shape = SDL_CreateSurface(64, 64, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(shape != NULL, "Validate that the shape surface is not NULL");
+    if (!shape) {
+        SDL_DestroyWindow(window);
+        return TEST_ABORTED;
+    }
+    SDL_FillSurfaceRect(shape, NULL, 0xFFFFFFFF);
+
+    /* Setting the shape twice replaces the first copy */
+    result = SDL_SetWindowShape(window, shape);
+    SDLTest_AssertPass("Call to SDL_SetWindowShape()");
+    SDLTest_AssertCheck(result == 0, "Verify return value; expected: 0, got: %d", result);
+    result = SDL_SetWindowShape(window, shape);
+    SDLTest_AssertCheck(result == 0, "Verify return value; expected: 0, got: %d", result);
+    SDL_DestroySurface(shape);
+
+    props = SDL_GetWindowProperties(window);
+    SDLTest_AssertCheck(SDL_GetProperty(props, SDL_PROP_WINDOW_SHAPE_POINTER, NULL) != NULL,
+                        "Verify that SDL_PROP_WINDOW_SHAPE_POINTER is set");
+
+    /* Clearing the property must not free the surface the window still uses */
+    SDL_ClearProperty(props, SDL_PROP_WINDOW_SHAPE_POINTER);
+    SDLTest_AssertPass("Call to SDL_ClearProperty(SDL_PROP_WINDOW_SHAPE_POINTER)");
+
+    SDL_SetWindowSize(window, 400, 300);
+    SDL_SyncWindow(window);
+    SDLTest_AssertPass("Call to SDL_SetWindowSize() after clearing the shape property");
+
+    renderer = SDL_CreateRenderer(window, NULL);
+    if (renderer) {
+        SDL_RenderClear(renderer);
+        SDL_RenderPresent(renderer);
+        SDLTest_AssertPass("Call to SDL_RenderPresent() with the window shape");
+        SDL_DestroyRenderer(renderer);
+    }
+
+    SDL_DestroyWindow(window);
+    SDLTest_AssertPass("Call to SDL_DestroyWindow()");
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Video test cases */
@@ -2309,12 +2369,16 @@ static const SDLTest_TestCaseReference videoTest19 = {
     (SDLTest_TestCaseFp)video_getSetWindowState, "video_getSetWindowState", "Checks transitioning between windowed, minimized, maximized, and fullscreen states", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference videoTest20 = {
+    (SDLTest_TestCaseFp)video_setWindowShape, "video_setWindowShape", "Checks that SDL_SetWindowShape survives clearing SDL_PROP_WINDOW_SHAPE_POINTER", TEST_ENABLED
+};
+
 /* Sequence of Video test cases */
 static const SDLTest_TestCaseReference *videoTests[] = {
     &videoTest1, &videoTest2, &videoTest3, &videoTest4, &videoTest5, &videoTest6,
     &videoTest7, &videoTest8, &videoTest9, &videoTest10, &videoTest11, &videoTest12,
     &videoTest13, &videoTest14, &videoTest15, &videoTest16, &videoTest17,
-    &videoTest18, &videoTest19, NULL
+    &videoTest18, &videoTest19, &videoTest20, NULL
 };
 
 /* Video test suite (global) */
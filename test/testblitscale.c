@@ -0,0 +1,140 @@
+/*
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Benchmark for nearest neighbor scaled sprite blits */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+static const struct
+{
+    const char *name;
+    float scale;
+} scales[] = {
+    { "2x", 2.0f },
+    { "3x", 3.0f },
+    { "0.5x", 0.5f },
+};
+
+static const struct
+{
+    const char *name;
+    SDL_BlendMode mode;
+} blend_modes[] = {
+    { "none", SDL_BLENDMODE_NONE },
+    { "blend", SDL_BLENDMODE_BLEND },
+};
+
+static int run_benchmark(SDL_Surface *sprite, SDL_PixelFormatEnum format, int iterations)
+{
+    int s, b, i;
+
+    for (s = 0; s < SDL_arraysize(scales); ++s) {
+        const int w = (int)(sprite->w * scales[s].scale);
+        const int h = (int)(sprite->h * scales[s].scale);
+        SDL_Surface *dst = SDL_CreateSurface(w, h, format);
+
+        if (!dst) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create %dx%d surface: %s", w, h, SDL_GetError());
+            return -1;
+        }
+
+        for (b = 0; b < SDL_arraysize(blend_modes); ++b) {
+            Uint64 start, elapsed;
+
+            SDL_SetSurfaceBlendMode(sprite, blend_modes[b].mode);
+
+            /* Warm up the blit mapping and the caches */
+            SDL_BlitSurfaceScaled(sprite, NULL, dst, NULL, SDL_SCALEMODE_NEAREST);
+
+            start = SDL_GetTicksNS();
+            for (i = 0; i < iterations; ++i) {
+                SDL_BlitSurfaceScaled(sprite, NULL, dst, NULL, SDL_SCALEMODE_NEAREST);
+            }
+            elapsed = SDL_GetTicksNS() - start;
+
+            SDL_Log("%4s %dx%d -> %dx%d %s, blend %-5s: %d iterations in %" SDL_PRIu64 " ms, %.1f Mpixels/s",
+                    scales[s].name, sprite->w, sprite->h, w, h, SDL_GetPixelFormatName(format) + 16, blend_modes[b].name,
+                    iterations, elapsed / SDL_NS_PER_MS,
+                    (double)w * h * iterations * 1000.0 / (double)(elapsed ? elapsed : 1));
+        }
+        SDL_DestroySurface(dst);
+    }
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    SDLTest_RandomContext rndctx;
+    SDL_Surface *sprite;
+    int iterations = 1000;
+    int size = 256;
+    int i, x, y;
+    int result = 0;
+
+    /* Initialize test framework */
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    /* Parse commandline */
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--iterations") == 0 && argv[i + 1]) {
+                iterations = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--size") == 0 && argv[i + 1]) {
+                size = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            }
+        }
+        if (consumed <= 0 || iterations <= 0 || size <= 1) {
+            static const char *options[] = { "[--iterations N]", "[--size N]", NULL };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+
+        i += consumed;
+    }
+
+    sprite = SDL_CreateSurface(size, size, SDL_PIXELFORMAT_ARGB8888);
+    if (!sprite) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create sprite: %s", SDL_GetError());
+        SDLTest_CommonDestroyState(state);
+        return 1;
+    }
+    SDLTest_RandomInitTime(&rndctx);
+    for (y = 0; y < sprite->h; ++y) {
+        Uint32 *row = (Uint32 *)((Uint8 *)sprite->pixels + y * sprite->pitch);
+        for (x = 0; x < sprite->w; ++x) {
+            row[x] = SDLTest_Random(&rndctx);
+        }
+    }
+
+    /* The same format goes through SDL_SoftStretch() when not blending,
+       the other one through the generated blitters */
+    if (run_benchmark(sprite, SDL_PIXELFORMAT_XBGR8888, iterations) < 0 ||
+        run_benchmark(sprite, SDL_PIXELFORMAT_ARGB8888, iterations) < 0) {
+        result = 1;
+    }
+
+    SDL_DestroySurface(sprite);
+    SDLTest_CommonDestroyState(state);
+    SDL_Quit();
+    return result;
+}
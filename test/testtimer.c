@@ -47,6 +47,30 @@ static int test_sdl_delay_within_bounds(void) {
     return SDLTest_AssertSummaryToTestResult() == TEST_RESULT_PASSED ? 0 : 1;
 }
 
+static int SDLCALL compare_errors(const void *a, const void *b)
+{
+    const Uint64 error_a = *(const Uint64 *)a;
+    const Uint64 error_b = *(const Uint64 *)b;
+    return (error_a < error_b) ? -1 : (error_a > error_b);
+}
+
+static void log_delay_error(const char *name, void (SDLCALL *delay)(Uint64))
+{
+    const Uint64 testDelay = SDL_US_TO_NS(1500);
+    Uint64 errors[100];
+    int i;
+
+    for (i = 0; i < SDL_arraysize(errors); ++i) {
+        const Uint64 start = SDL_GetTicksNS();
+
+        delay(testDelay);
+        errors[i] = SDL_GetTicksNS() - start - testDelay;
+    }
+    SDL_qsort(errors, SDL_arraysize(errors), sizeof(errors[0]), compare_errors);
+    SDL_Log("%s(1.5 ms) oversleeps %" SDL_PRIu64 " us typically, %" SDL_PRIu64 " us at worst\n", name,
+            SDL_NS_TO_US(errors[SDL_arraysize(errors) / 2]), SDL_NS_TO_US(errors[SDL_arraysize(errors) - 1]));
+}
+
 static int ticks = 0;
 
 static Uint32 SDLCALL
@@ -195,6 +219,9 @@ int main(int argc, char *argv[])
     now = SDL_GetTicks();
     SDL_Log("Delay 1 second = %d ms in ticks, %f ms according to performance counter\n", (int)(now - start), (double)((now_perf - start_perf) * 1000) / SDL_GetPerformanceFrequency());
 
+    log_delay_error("SDL_DelayNS", SDL_DelayNS);
+    log_delay_error("SDL_DelayPrecise", SDL_DelayPrecise);
+
     if (run_interactive_tests) {
         return_code = test_sdl_delay_within_bounds();
     }
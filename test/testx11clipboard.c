@@ -0,0 +1,750 @@
+/*
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Exercises the X11 clipboard against a second client on the same display.
+   The second client is plain Xlib running on its own thread and connection,
+   so it talks to SDL through the X server like any other application would.
+   This is skipped if there is no X server to connect to. */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+
+#include <X11/Xlib.h>
+#include <X11/Xatom.h>
+
+#define TEST_MIME_TYPE "application/x-sdl-clipboard-test"
+
+/* Larger than the biggest property SDL sets in one go, so it takes INCR */
+#define LARGE_DATA_SIZE (1024 * 1024 + 17)
+
+/* Read with SDL_RequestClipboardData(), this takes many INCR round trips */
+#define HUGE_DATA_SIZE (4 * 1024 * 1024 + 17)
+
+/* How much the peer sends in each INCR chunk */
+#define PEER_CHUNK_SIZE 65536
+
+#define TEST_TIMEOUT_MS 10000
+
+typedef struct
+{
+    Window requestor;
+    Atom property;
+    Atom target;
+    const Uint8 *data;
+    size_t length;
+    size_t offset;
+    SDL_bool active;
+} PeerTransfer;
+
+typedef struct
+{
+    /* Data the peer offers while it owns the clipboard */
+    const Uint8 *data;
+    size_t length;
+    const Uint8 *next_data;
+    size_t next_length;
+
+    SDL_AtomicInt replace;
+    SDL_AtomicInt replace_on_request; /* Change owners after a request arrives, before answering it */
+    SDL_AtomicInt quit;
+    SDL_Semaphore *ready;
+    SDL_bool failed;
+} PeerOwner;
+
+typedef struct
+{
+    Atom property;
+    Uint8 *data;
+    size_t length;
+    SDL_bool incremental;
+    SDL_bool done;
+    SDL_bool failed;
+} PeerReceive;
+
+typedef struct
+{
+    PeerReceive receive[2];
+    SDL_AtomicInt done;
+} PeerFetch;
+
+typedef struct
+{
+    SDL_AtomicInt done;
+    SDL_bool requesting;
+    SDL_bool pumping;
+    SDL_bool called_while_requesting;
+    SDL_bool called_while_pumping;
+    Uint8 *data;
+    size_t length;
+} RequestResult;
+
+static Uint8 *large_data;
+static Uint8 *huge_data;
+
+static void FillTestData(Uint8 *data, size_t length, Uint8 seed)
+{
+    size_t i;
+
+    for (i = 0; i < length; ++i) {
+        data[i] = (Uint8)((i * 31) + (i >> 11) + seed);
+    }
+}
+
+static SDL_bool AppendData(Uint8 **data, size_t *length, const void *chunk, size_t size)
+{
+    Uint8 *buffer = (Uint8 *)SDL_realloc(*data, *length + size + 1);
+    if (!buffer) {
+        return SDL_FALSE;
+    }
+    SDL_memcpy(buffer + *length, chunk, size);
+    *length += size;
+    buffer[*length] = '\0';
+    *data = buffer;
+    return SDL_TRUE;
+}
+
+static void PumpUntil(SDL_AtomicInt *flag, Uint64 timeout_ms)
+{
+    const Uint64 deadline = SDL_GetTicks() + timeout_ms;
+
+    while (!SDL_AtomicGet(flag) && SDL_GetTicks() < deadline) {
+        SDL_PumpEvents();
+        SDL_Delay(1);
+    }
+}
+
+/* Serve a selection request from SDL, using INCR for large data */
+static void PeerHandleSelectionRequest(Display *display, const XSelectionRequestEvent *req,
+                                       const Uint8 *data, size_t length, PeerTransfer *transfer)
+{
+    const Atom XA_TARGETS = XInternAtom(display, "TARGETS", False);
+    const Atom XA_INCR = XInternAtom(display, "INCR", False);
+    const Atom test_target = XInternAtom(display, TEST_MIME_TYPE, False);
+    XEvent sevent;
+
+    SDL_zero(sevent);
+    sevent.xselection.type = SelectionNotify;
+    sevent.xselection.requestor = req->requestor;
+    sevent.xselection.selection = req->selection;
+    sevent.xselection.target = req->target;
+    sevent.xselection.property = None;
+    sevent.xselection.time = req->time;
+
+    if (req->target == XA_TARGETS) {
+        Atom targets[2];
+        targets[0] = XA_TARGETS;
+        targets[1] = test_target;
+        XChangeProperty(display, req->requestor, req->property, XA_ATOM, 32,
+                        PropModeReplace, (unsigned char *)targets, 2);
+        sevent.xselection.property = req->property;
+    } else if (req->target == test_target) {
+        if (length <= PEER_CHUNK_SIZE) {
+            XChangeProperty(display, req->requestor, req->property, req->target, 8,
+                            PropModeReplace, (unsigned char *)data, (int)length);
+            sevent.xselection.property = req->property;
+        } else if (!transfer->active) {
+            long incr_length = (long)length;
+
+            transfer->requestor = req->requestor;
+            transfer->property = req->property;
+            transfer->target = req->target;
+            transfer->data = data;
+            transfer->length = length;
+            transfer->offset = 0;
+            transfer->active = SDL_TRUE;
+
+            XSelectInput(display, req->requestor, PropertyChangeMask);
+            XChangeProperty(display, req->requestor, req->property, XA_INCR, 32,
+                            PropModeReplace, (unsigned char *)&incr_length, 1);
+            sevent.xselection.property = req->property;
+        }
+    }
+
+    XSendEvent(display, req->requestor, False, 0, &sevent);
+    XFlush(display);
+}
+
+/* Send the next INCR chunk once SDL has deleted the previous one */
+static void PeerHandleTransferProperty(Display *display, const XPropertyEvent *xevent, PeerTransfer *transfer)
+{
+    size_t chunk;
+
+    if (!transfer->active || xevent->state != PropertyDelete ||
+        xevent->window != transfer->requestor || xevent->atom != transfer->property) {
+        return;
+    }
+
+    chunk = SDL_min(transfer->length - transfer->offset, PEER_CHUNK_SIZE);
+    XChangeProperty(display, transfer->requestor, transfer->property, transfer->target, 8,
+                    PropModeReplace, (unsigned char *)transfer->data + transfer->offset, (int)chunk);
+    transfer->offset += chunk;
+    if (chunk == 0) {
+        XSelectInput(display, transfer->requestor, NoEventMask);
+        transfer->active = SDL_FALSE;
+    }
+    XFlush(display);
+}
+
+/* Hand the clipboard to the peer's other window, with the next data */
+static void PeerReplaceOwner(Display *display, PeerOwner *owner, const Window *windows, int *current)
+{
+    owner->data = owner->next_data;
+    owner->length = owner->next_length;
+    *current = !*current;
+    XSetSelectionOwner(display, XInternAtom(display, "CLIPBOARD", False), windows[*current], CurrentTime);
+    XSync(display, False);
+}
+
+static int SDLCALL PeerOwnerThread(void *userdata)
+{
+    PeerOwner *owner = (PeerOwner *)userdata;
+    Display *display;
+    Window windows[2];
+    Atom XA_CLIPBOARD;
+    PeerTransfer transfer;
+    int current = 0;
+
+    SDL_zero(transfer);
+
+    display = XOpenDisplay(NULL);
+    if (!display) {
+        owner->failed = SDL_TRUE;
+        SDL_PostSemaphore(owner->ready);
+        return 0;
+    }
+    XA_CLIPBOARD = XInternAtom(display, "CLIPBOARD", False);
+
+    /* A second window takes over the selection, so the owner really changes */
+    windows[0] = XCreateSimpleWindow(display, DefaultRootWindow(display), 0, 0, 1, 1, 0, 0, 0);
+    windows[1] = XCreateSimpleWindow(display, DefaultRootWindow(display), 0, 0, 1, 1, 0, 0, 0);
+    XSetSelectionOwner(display, XA_CLIPBOARD, windows[current], CurrentTime);
+    XSync(display, False);
+    if (XGetSelectionOwner(display, XA_CLIPBOARD) != windows[current]) {
+        owner->failed = SDL_TRUE;
+    }
+    SDL_PostSemaphore(owner->ready);
+
+    while (!SDL_AtomicGet(&owner->quit)) {
+        if (SDL_AtomicGet(&owner->replace)) {
+            PeerReplaceOwner(display, owner, windows, &current);
+            SDL_AtomicSet(&owner->replace, 0);
+            SDL_PostSemaphore(owner->ready);
+        }
+
+        while (XPending(display)) {
+            XEvent xevent;
+
+            XNextEvent(display, &xevent);
+            if (xevent.type == SelectionRequest && xevent.xselectionrequest.target == XInternAtom(display, TEST_MIME_TYPE, False) &&
+                SDL_AtomicGet(&owner->replace_on_request)) {
+                /* The requestor sees the owner change before the answer, which still has the old data */
+                const Uint8 *data = owner->data;
+                const size_t length = owner->length;
+
+                PeerReplaceOwner(display, owner, windows, &current);
+                SDL_AtomicSet(&owner->replace_on_request, 0);
+                PeerHandleSelectionRequest(display, &xevent.xselectionrequest, data, length, &transfer);
+                SDL_PostSemaphore(owner->ready);
+            } else if (xevent.type == SelectionRequest) {
+                PeerHandleSelectionRequest(display, &xevent.xselectionrequest, owner->data, owner->length, &transfer);
+            } else if (xevent.type == PropertyNotify) {
+                PeerHandleTransferProperty(display, &xevent.xproperty, &transfer);
+            }
+        }
+        SDL_Delay(1);
+    }
+
+    XDestroyWindow(display, windows[0]);
+    XDestroyWindow(display, windows[1]);
+    XCloseDisplay(display);
+    return 0;
+}
+
+/* Read one property of an incoming selection, deleting it to ask for more */
+static SDL_bool PeerReadProperty(Display *display, Window window, PeerReceive *receive, Atom *type, size_t *size)
+{
+    int format;
+    unsigned long count;
+    unsigned long overflow;
+    unsigned char *src = NULL;
+    SDL_bool result = SDL_TRUE;
+
+    *size = 0;
+    if (XGetWindowProperty(display, window, receive->property, 0, 0x7FFFFFFF / 4, True,
+                           AnyPropertyType, type, &format, &count, &overflow, &src) != Success) {
+        return SDL_FALSE;
+    }
+    if (*type != None && *type != XInternAtom(display, "INCR", False)) {
+        *size = (size_t)count * (format / 8);
+        result = AppendData(&receive->data, &receive->length, src, *size);
+    }
+    if (src) {
+        XFree(src);
+    }
+    return result;
+}
+
+static int SDLCALL PeerFetchThread(void *userdata)
+{
+    PeerFetch *fetch = (PeerFetch *)userdata;
+    const Uint64 deadline = SDL_GetTicks() + TEST_TIMEOUT_MS;
+    Display *display;
+    Window window;
+    XSetWindowAttributes xattr;
+    Atom XA_CLIPBOARD, XA_INCR, target;
+    int i;
+
+    display = XOpenDisplay(NULL);
+    if (!display) {
+        fetch->receive[0].failed = SDL_TRUE;
+        SDL_AtomicSet(&fetch->done, 1);
+        return 0;
+    }
+    XA_CLIPBOARD = XInternAtom(display, "CLIPBOARD", False);
+    XA_INCR = XInternAtom(display, "INCR", False);
+    target = XInternAtom(display, TEST_MIME_TYPE, False);
+
+    xattr.event_mask = PropertyChangeMask;
+    window = XCreateWindow(display, DefaultRootWindow(display), 0, 0, 1, 1, 0,
+                           CopyFromParent, InputOnly, CopyFromParent, CWEventMask, &xattr);
+
+    /* Two transfers from SDL to the same window at the same time */
+    fetch->receive[0].property = XInternAtom(display, "SDL_TEST_PROPERTY_A", False);
+    fetch->receive[1].property = XInternAtom(display, "SDL_TEST_PROPERTY_B", False);
+    for (i = 0; i < SDL_arraysize(fetch->receive); ++i) {
+        XConvertSelection(display, XA_CLIPBOARD, target, fetch->receive[i].property, window, CurrentTime);
+    }
+    XFlush(display);
+
+    while ((!fetch->receive[0].done || !fetch->receive[1].done) && SDL_GetTicks() < deadline) {
+        while (XPending(display)) {
+            XEvent xevent;
+            PeerReceive *receive = NULL;
+            Atom type;
+            size_t size;
+
+            XNextEvent(display, &xevent);
+            for (i = 0; i < SDL_arraysize(fetch->receive); ++i) {
+                if ((xevent.type == SelectionNotify && xevent.xselection.property == fetch->receive[i].property) ||
+                    (xevent.type == PropertyNotify && xevent.xproperty.atom == fetch->receive[i].property)) {
+                    receive = &fetch->receive[i];
+                }
+            }
+            if (!receive || receive->done) {
+                continue;
+            }
+
+            if (xevent.type == SelectionNotify) {
+                if (receive->incremental) {
+                    continue;
+                }
+                if (!PeerReadProperty(display, window, receive, &type, &size)) {
+                    receive->failed = SDL_TRUE;
+                    receive->done = SDL_TRUE;
+                } else if (type == XA_INCR) {
+                    receive->incremental = SDL_TRUE;
+                } else {
+                    receive->done = SDL_TRUE;
+                }
+            } else if (receive->incremental && xevent.xproperty.state == PropertyNewValue) {
+                if (!PeerReadProperty(display, window, receive, &type, &size)) {
+                    receive->failed = SDL_TRUE;
+                    receive->done = SDL_TRUE;
+                } else if (size == 0) {
+                    receive->done = SDL_TRUE;
+                }
+            }
+            XFlush(display);
+        }
+        SDL_Delay(1);
+    }
+
+    for (i = 0; i < SDL_arraysize(fetch->receive); ++i) {
+        if (!fetch->receive[i].done) {
+            fetch->receive[i].failed = SDL_TRUE;
+        }
+    }
+
+    XDestroyWindow(display, window);
+    XCloseDisplay(display);
+    SDL_AtomicSet(&fetch->done, 1);
+    return 0;
+}
+
+static SDL_bool CheckData(const char *what, const void *data, size_t length, const void *expected, size_t expected_length)
+{
+    if (!data) {
+        SDL_Log("%s: no data: %s", what, SDL_GetError());
+        return SDL_FALSE;
+    }
+    if (length != expected_length) {
+        SDL_Log("%s: expected %u bytes, got %u", what, (unsigned int)expected_length, (unsigned int)length);
+        return SDL_FALSE;
+    }
+    if (SDL_memcmp(data, expected, length) != 0) {
+        SDL_Log("%s: data doesn't match", what);
+        return SDL_FALSE;
+    }
+    return SDL_TRUE;
+}
+
+/* SDL reads large data from another client with INCR, then sees the owner change */
+static SDL_bool TestReadFromPeer(void)
+{
+    static const char first[] = "first clipboard owner";
+    static const char second[] = "second clipboard owner";
+    PeerOwner owner;
+    SDL_Thread *thread;
+    SDL_bool result = SDL_TRUE;
+    void *data;
+    size_t length;
+    Uint64 deadline;
+
+    SDL_zero(owner);
+    owner.data = large_data;
+    owner.length = LARGE_DATA_SIZE;
+    owner.ready = SDL_CreateSemaphore(0);
+    thread = SDL_CreateThread(PeerOwnerThread, "ClipboardOwner", &owner);
+    if (!thread) {
+        SDL_Log("Couldn't create thread: %s", SDL_GetError());
+        SDL_DestroySemaphore(owner.ready);
+        return SDL_FALSE;
+    }
+    SDL_WaitSemaphore(owner.ready);
+    if (owner.failed) {
+        SDL_Log("The peer couldn't take the clipboard");
+        result = SDL_FALSE;
+        goto done;
+    }
+
+    data = SDL_GetClipboardData(TEST_MIME_TYPE, &length);
+    if (!CheckData("INCR read from peer", data, length, large_data, LARGE_DATA_SIZE)) {
+        result = SDL_FALSE;
+    }
+    SDL_free(data);
+
+    /* Switch to small data and read it, so it can be cached */
+    owner.next_data = (const Uint8 *)first;
+    owner.next_length = SDL_strlen(first);
+    SDL_AtomicSet(&owner.replace, 1);
+    SDL_WaitSemaphore(owner.ready);
+
+    deadline = SDL_GetTicks() + TEST_TIMEOUT_MS;
+    do {
+        SDL_PumpEvents();
+        data = SDL_GetClipboardData(TEST_MIME_TYPE, &length);
+        if (data && length == SDL_strlen(first) && SDL_memcmp(data, first, length) == 0) {
+            break;
+        }
+        SDL_free(data);
+        data = NULL;
+        SDL_Delay(10);
+    } while (SDL_GetTicks() < deadline);
+    if (!CheckData("Read after the first owner change", data, length, first, SDL_strlen(first))) {
+        result = SDL_FALSE;
+    }
+    SDL_free(data);
+
+    /* Anything cached from the previous owner has to go when the owner changes */
+    owner.next_data = (const Uint8 *)second;
+    owner.next_length = SDL_strlen(second);
+    SDL_AtomicSet(&owner.replace, 1);
+    SDL_WaitSemaphore(owner.ready);
+
+    deadline = SDL_GetTicks() + TEST_TIMEOUT_MS;
+    do {
+        SDL_PumpEvents();
+        data = SDL_GetClipboardData(TEST_MIME_TYPE, &length);
+        if (data && length == SDL_strlen(second) && SDL_memcmp(data, second, length) == 0) {
+            break;
+        }
+        SDL_free(data);
+        data = NULL;
+        SDL_Delay(10);
+    } while (SDL_GetTicks() < deadline);
+    if (!CheckData("Read after the second owner change", data, length, second, SDL_strlen(second))) {
+        result = SDL_FALSE;
+    }
+    SDL_free(data);
+
+done:
+    SDL_AtomicSet(&owner.quit, 1);
+    SDL_WaitThread(thread, NULL);
+    SDL_DestroySemaphore(owner.ready);
+    return result;
+}
+
+static void SDLCALL RequestCallback(void *userdata, const char *mime_type, const void *data, size_t size)
+{
+    RequestResult *result = (RequestResult *)userdata;
+
+    result->called_while_requesting = result->requesting;
+    result->called_while_pumping = result->pumping;
+    if (data) {
+        AppendData(&result->data, &result->length, data, size);
+    }
+    SDL_AtomicSet(&result->done, 1);
+}
+
+static SDL_bool RequestFromPeer(RequestResult *result)
+{
+    const Uint64 deadline = SDL_GetTicks() + TEST_TIMEOUT_MS;
+
+    SDL_zerop(result);
+    result->requesting = SDL_TRUE;
+    if (SDL_RequestClipboardData(TEST_MIME_TYPE, RequestCallback, result) < 0) {
+        SDL_Log("Couldn't request clipboard data: %s", SDL_GetError());
+        return SDL_FALSE;
+    }
+    result->requesting = SDL_FALSE;
+
+    if (SDL_AtomicGet(&result->done)) {
+        SDL_Log("The request completed before SDL_RequestClipboardData() returned");
+        return SDL_FALSE;
+    }
+
+    while (!SDL_AtomicGet(&result->done) && SDL_GetTicks() < deadline) {
+        result->pumping = SDL_TRUE;
+        SDL_PumpEvents();
+        result->pumping = SDL_FALSE;
+        SDL_Delay(1);
+    }
+    if (!SDL_AtomicGet(&result->done)) {
+        SDL_Log("The request callback never ran");
+        return SDL_FALSE;
+    }
+    if (result->called_while_requesting || !result->called_while_pumping) {
+        SDL_Log("The request callback ran outside of SDL_PumpEvents()");
+        return SDL_FALSE;
+    }
+    return SDL_TRUE;
+}
+
+/* SDL reads many megabytes from another client without blocking the caller */
+static SDL_bool TestRequestFromPeer(void)
+{
+    PeerOwner owner;
+    SDL_Thread *thread;
+    RequestResult request;
+    SDL_bool result = SDL_TRUE;
+
+    SDL_zero(owner);
+    owner.data = huge_data;
+    owner.length = HUGE_DATA_SIZE;
+    owner.ready = SDL_CreateSemaphore(0);
+    thread = SDL_CreateThread(PeerOwnerThread, "ClipboardOwner", &owner);
+    if (!thread) {
+        SDL_Log("Couldn't create thread: %s", SDL_GetError());
+        SDL_DestroySemaphore(owner.ready);
+        return SDL_FALSE;
+    }
+    SDL_WaitSemaphore(owner.ready);
+    if (owner.failed) {
+        SDL_Log("The peer couldn't take the clipboard");
+        result = SDL_FALSE;
+        goto done;
+    }
+
+    /* The owner change is queued before the peer is ready, drop anything cached from earlier tests */
+    SDL_PumpEvents();
+
+    if (!RequestFromPeer(&request) ||
+        !CheckData("Asynchronous INCR read from peer", request.data, request.length, huge_data, HUGE_DATA_SIZE)) {
+        result = SDL_FALSE;
+    }
+    SDL_free(request.data);
+
+done:
+    SDL_AtomicSet(&owner.quit, 1);
+    SDL_WaitThread(thread, NULL);
+    SDL_DestroySemaphore(owner.ready);
+    return result;
+}
+
+/* The owner changes while a request is in flight, so the answer to it can't be cached */
+static SDL_bool TestOwnerChangeDuringRequest(void)
+{
+    static const char old_owner[] = "clipboard owner when the request was sent";
+    static const char new_owner[] = "clipboard owner when the answer arrived";
+    PeerOwner owner;
+    SDL_Thread *thread;
+    RequestResult request;
+    SDL_bool result = SDL_TRUE;
+    void *data;
+    size_t length;
+
+    SDL_zero(owner);
+    owner.data = (const Uint8 *)old_owner;
+    owner.length = SDL_strlen(old_owner);
+    owner.next_data = (const Uint8 *)new_owner;
+    owner.next_length = SDL_strlen(new_owner);
+    SDL_AtomicSet(&owner.replace_on_request, 1);
+    owner.ready = SDL_CreateSemaphore(0);
+    thread = SDL_CreateThread(PeerOwnerThread, "ClipboardOwner", &owner);
+    if (!thread) {
+        SDL_Log("Couldn't create thread: %s", SDL_GetError());
+        SDL_DestroySemaphore(owner.ready);
+        return SDL_FALSE;
+    }
+    SDL_WaitSemaphore(owner.ready);
+    if (owner.failed) {
+        SDL_Log("The peer couldn't take the clipboard");
+        result = SDL_FALSE;
+        goto done;
+    }
+    SDL_PumpEvents();
+
+    /* SDL sees the new owner before the answer, which has the old owner's data */
+    if (!RequestFromPeer(&request) ||
+        !CheckData("Read while the owner changes", request.data, request.length, old_owner, SDL_strlen(old_owner))) {
+        result = SDL_FALSE;
+    }
+    SDL_free(request.data);
+    SDL_WaitSemaphore(owner.ready);
+    SDL_PumpEvents();
+
+    data = SDL_GetClipboardData(TEST_MIME_TYPE, &length);
+    if (!CheckData("Read after the owner changed during a request", data, length, new_owner, SDL_strlen(new_owner))) {
+        result = SDL_FALSE;
+    }
+    SDL_free(data);
+
+done:
+    SDL_AtomicSet(&owner.quit, 1);
+    SDL_WaitThread(thread, NULL);
+    SDL_DestroySemaphore(owner.ready);
+    return result;
+}
+
+static const void *SDLCALL ClipboardDataCallback(void *userdata, const char *mime_type, size_t *size)
+{
+    if (SDL_strcmp(mime_type, TEST_MIME_TYPE) != 0) {
+        *size = 0;
+        return NULL;
+    }
+    *size = LARGE_DATA_SIZE;
+    return large_data;
+}
+
+/* Another client reads large data from SDL into two properties at once */
+static SDL_bool TestWriteToPeer(void)
+{
+    const char *mime_types[] = { TEST_MIME_TYPE };
+    PeerFetch fetch;
+    SDL_Thread *thread;
+    SDL_bool result = SDL_TRUE;
+    int i;
+
+    if (SDL_SetClipboardData(ClipboardDataCallback, NULL, NULL, mime_types, SDL_arraysize(mime_types)) < 0) {
+        SDL_Log("Couldn't set clipboard data: %s", SDL_GetError());
+        return SDL_FALSE;
+    }
+    SDL_PumpEvents();
+
+    SDL_zero(fetch);
+    thread = SDL_CreateThread(PeerFetchThread, "ClipboardFetch", &fetch);
+    if (!thread) {
+        SDL_Log("Couldn't create thread: %s", SDL_GetError());
+        return SDL_FALSE;
+    }
+
+    /* SDL answers the requests and sends the chunks while pumping events */
+    PumpUntil(&fetch.done, TEST_TIMEOUT_MS + 1000);
+    SDL_WaitThread(thread, NULL);
+
+    for (i = 0; i < SDL_arraysize(fetch.receive); ++i) {
+        char what[64];
+
+        SDL_snprintf(what, sizeof(what), "INCR write to peer, transfer %d", i + 1);
+        if (fetch.receive[i].failed) {
+            SDL_Log("%s: didn't complete", what);
+            result = SDL_FALSE;
+        } else if (!fetch.receive[i].incremental) {
+            SDL_Log("%s: wasn't sent with INCR", what);
+            result = SDL_FALSE;
+        } else if (!CheckData(what, fetch.receive[i].data, fetch.receive[i].length, large_data, LARGE_DATA_SIZE)) {
+            result = SDL_FALSE;
+        }
+        SDL_free(fetch.receive[i].data);
+    }
+
+    SDL_ClearClipboardData();
+    return result;
+}
+
+int main(int argc, char *argv[])
+{
+    Display *display;
+    int result = 0;
+
+    /* Enable standard application logging */
+    SDL_SetLogPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    XInitThreads();
+    display = XOpenDisplay(NULL);
+    if (!display) {
+        SDL_Log("No X server available, skipping the X11 clipboard test");
+        return 0;
+    }
+    XCloseDisplay(display);
+
+    SDL_SetHintWithPriority(SDL_HINT_VIDEO_DRIVER, "x11", SDL_HINT_OVERRIDE);
+    if (SDL_Init(SDL_INIT_VIDEO) < 0) {
+        SDL_Log("Couldn't initialize the x11 video driver, skipping: %s", SDL_GetError());
+        return 0;
+    }
+
+    large_data = (Uint8 *)SDL_malloc(LARGE_DATA_SIZE);
+    if (!large_data) {
+        SDL_Quit();
+        return 1;
+    }
+    FillTestData(large_data, LARGE_DATA_SIZE, 0x5A);
+
+    huge_data = (Uint8 *)SDL_malloc(HUGE_DATA_SIZE);
+    if (!huge_data) {
+        SDL_free(large_data);
+        SDL_Quit();
+        return 1;
+    }
+    FillTestData(huge_data, HUGE_DATA_SIZE, 0xA5);
+
+    if (TestReadFromPeer()) {
+        SDL_Log("Reading from another client: passed");
+    } else {
+        SDL_Log("Reading from another client: FAILED");
+        result = 1;
+    }
+    if (TestRequestFromPeer()) {
+        SDL_Log("Requesting from another client: passed");
+    } else {
+        SDL_Log("Requesting from another client: FAILED");
+        result = 1;
+    }
+    if (TestOwnerChangeDuringRequest()) {
+        SDL_Log("Owner change during a request: passed");
+    } else {
+        SDL_Log("Owner change during a request: FAILED");
+        result = 1;
+    }
+    if (TestWriteToPeer()) {
+        SDL_Log("Writing to another client: passed");
+    } else {
+        SDL_Log("Writing to another client: FAILED");
+        result = 1;
+    }
+
+    SDL_free(huge_data);
+    SDL_free(large_data);
+    SDL_Quit();
+    return result;
+}